@@ -0,0 +1,31 @@
+#pragma once
+#include <vector>
+#include <Arduino.h>
+#include "util/string_pool.h"
+
+// Maximum number of departures requested (maxJourneys) and kept from one departureBoard response.
+// Parsing needs a fixed ring buffer only, so the limit is bounded by the record array (18 bytes each).
+#define RMV_MAX_DEPARTURES 40
+
+// Departure record filled in place by RMVDepartureParser.
+// Text fields reference the per-wake StringPool, so repeated lines, directions and
+// disruption texts are stored once. They stay valid until StringPool::reset(),
+// which DeviceModeManager calls after rendering.
+struct DepartureInfo {
+    PooledString line;          // "S5", "M36"                        (Product[0].line)
+    PooledString direction;     // "Frankfurt (Main) Südbahnhof"
+    PooledString directionFlag; // "1" / "2", empty if not provided
+    PooledString time;          // "21:46:00"
+    PooledString rtTime;        // "21:48:00", empty without real-time data
+    PooledString track;         // "2"
+    PooledString category;      // "S", "Bus"                         (Product[0].catOut)
+    PooledString text;          // Service disruption headline        (Messages.Message[0].head)
+    bool cancelled;
+};
+
+struct DepartureData {
+    String stopId;
+    String stopName;
+    std::vector<DepartureInfo> departures;
+    int departureCount;
+};
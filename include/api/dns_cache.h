@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+#include <IPAddress.h>
+
+// Resolved address for one host, kept in RTC memory across deep sleep
+struct DnsCacheEntry {
+    char host[40];
+    uint32_t address;
+    uint32_t ttl;     // seconds
+    uint32_t savedAt; // epoch seconds
+};
+
+/**
+ * Host name cache in front of WiFi.hostByName() for the API hosts
+ * (www.rmv.de, api.open-meteo.com, nominatim.openstreetmap.org, api.github.com).
+ *
+ * lwIP keeps its own table only until deep sleep, so every wake would ask
+ * the resolver again. Entries here live for DEFAULT_TTL_S (lwIP does not
+ * hand the record TTL to callers); expired entries are looked up again, and
+ * a caller that cannot connect to a cached address evicts it. The least
+ * recently saved entry is replaced when all slots are taken.
+ */
+class DnsCache {
+public:
+    static const uint8_t MAX_HOSTS = 5;
+    static const uint32_t DEFAULT_TTL_S = 1800;
+
+    // fromCache tells the caller whether a connect failure may be a stale entry
+    static bool resolve(const char* host, IPAddress& ip, bool& fromCache);
+    static void evict(const char* host);
+    static void clear();
+
+private:
+    static DnsCacheEntry* find(const char* host);
+    static void store(const char* host, const IPAddress& ip);
+};
@@ -0,0 +1,65 @@
+#pragma once
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * HTTP/1.1 response body, read straight from the connection.
+ *
+ * Strips the chunked transfer framing like ChunkDecodingStream, or counts
+ * down the Content-Length, and stops exactly at the end of the body without
+ * reading into whatever follows on a keep-alive connection. That makes the
+ * end of the body visible (isDone()), so a parser that stops early can skip
+ * the rest and still hand the connection back for reuse:
+ *
+ *   HttpBodyStream body(http.getStream(), chunked, http.getSize());
+ *   deserializeJson(doc, body);
+ *   HttpConnectionPool::end(http, !error && body.skipRest());
+ *
+ * A body without either framing runs until the server closes the
+ * connection; it never reports isDone().
+ */
+class HttpBodyStream : public Stream {
+public:
+    // Most that skipRest() reads past a parser: closing fields, gzip trailer, chunk terminator
+    static const size_t SKIP_LIMIT = 4096;
+
+    /**
+     * @param chunked       true for Transfer-Encoding: chunked
+     * @param contentLength Content-Length (HTTPClient::getSize()), -1 if unknown
+     */
+    HttpBodyStream(Stream& upstream, bool chunked, int contentLength);
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override;
+    size_t write(uint8_t) { return 0; } // Read-only; required by Arduino's Print
+
+    /**
+     * Read and discard the rest of the body.
+     * @return true if the end was reached within maxBytes, so nothing of
+     *         this response is left on the connection
+     */
+    bool skipRest(size_t maxBytes = SKIP_LIMIT);
+
+    bool isDone() const { return state == State::DONE; }
+    bool hasError() const { return state == State::FAILED; }
+    size_t bodyBytes() const { return delivered; }
+
+private:
+    enum class State : uint8_t { CHUNK_SIZE, CHUNK_EXTENSION, DATA, DATA_END, TRAILER, DONE, FAILED, UNBOUNDED };
+
+    bool advance(bool wait);
+    void frame(uint8_t c);
+    void consumed(size_t n);
+    int nextFramingByte(bool wait);
+
+    Stream& upstream;
+    State state;
+    bool chunked;
+    size_t remaining;   // Data bytes left in the current chunk, or of the Content-Length
+    size_t chunkSize;   // Chunk size line being parsed
+    uint8_t lineLength; // Length of the current trailer line, 0 at the start of a line
+    size_t delivered;   // Body bytes handed to the reader or skipped
+};
@@ -0,0 +1,69 @@
+#pragma once
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include "api/tls_session_cache.h"
+
+/**
+ * Keep-alive HTTPS connections, one per host, for the requests of one wake.
+ *
+ * Each host (www.rmv.de, api.open-meteo.com, nominatim.openstreetmap.org)
+ * gets a ResumableTlsClient and an HTTPClient with setReuse(true). A second
+ * request to the same host in the same wake - departures + trip, stops +
+ * departures in config mode - goes over the open TCP+TLS connection instead
+ * of a new handshake. The HTTPClient is owned by the pool because its
+ * destructor would close the connection.
+ *
+ * Usage:
+ *   HTTPClient& http = HttpConnectionPool::begin(url);
+ *   int code = http.GET();
+ *   ... read the body ...
+ *   HttpConnectionPool::end(http, bodyRead);
+ *
+ * closeAll() runs before WiFi is switched off and logs how many
+ * connections were opened vs. reused. begin()/end() may be called from
+ * concurrent fetch tasks as long as they target different hosts.
+ */
+class HttpConnectionPool {
+public:
+    static const uint8_t MAX_HOSTS = 4;
+
+    /**
+     * Get the host's HTTPClient, set up for url. With all slots taken by
+     * other hosts, the slot used least recently is closed and handed over.
+     */
+    static HTTPClient& begin(const char* url);
+    static HTTPClient& begin(const String& url) { return begin(url.c_str()); }
+
+    /**
+     * Finish a request started with begin().
+     * @param bodyRead true if the response was read to its end, including the
+     *                 chunk terminator (HttpBodyStream::skipRest() after a
+     *                 parser that stops early). Anything less leaves
+     *                 unread bytes in flight, so the connection is closed
+     *                 instead of kept for reuse.
+     */
+    static void end(HTTPClient& http, bool bodyRead);
+
+    // Close every connection and log the per-wake statistics
+    static void closeAll();
+
+    static uint16_t openedCount() { return opened; }
+    static uint16_t reusedCount() { return reused; }
+
+private:
+    struct Slot {
+        char host[40];
+        ResumableTlsClient* client;
+        HTTPClient* http;
+        uint32_t lastUsed; // request sequence number
+        bool inUse;        // between begin() and end()
+    };
+
+    static bool parseHost(const char* url, char* host, size_t size);
+    static Slot* slotFor(const char* host);
+
+    static Slot slots[MAX_HOSTS];
+    static uint16_t opened;
+    static uint16_t reused;
+    static uint32_t sequence;
+};
@@ -1,7 +1,7 @@
 #pragma once
 #include <vector>
 #include <Arduino.h>
-#include <ArduinoJson.h>
+#include "api/departure_data.h"
 
 struct Station {
     String id;
@@ -9,26 +9,6 @@ struct Station {
     String type;
 };
 
-struct DepartureInfo {
-    String line;
-    String direction;
-    String directionFlag;
-    String time;
-    String rtTime;
-    bool cancelled;
-    String track;
-    String category;
-    String lead; // Service disruption lead text
-    String text; // Service disruption full text
-};
-
-struct DepartureData {
-    String stopId;
-    String stopName;
-    std::vector<DepartureInfo> departures;
-    int departureCount;
-};
-
 extern std::vector<Station> stations;
 
 // === Trip/Connection data structures ===
@@ -58,4 +38,3 @@ struct TripData {
 void getNearbyStops(float lat, float lon);
 bool getDepartureFromRMV(const char* stopId, DepartureData& departData);
 bool getTripFromRMV(const char* originId, const char* destId, TripData& tripData);
-bool populateDepartureData(const JsonDocument& doc, DepartureData& departData);
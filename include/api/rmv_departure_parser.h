@@ -0,0 +1,116 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "api/departure_data.h"
+
+/**
+ * SAX-style parser for the RMV departureBoard JSON response.
+ *
+ * Bytes are pushed in with feed() as they arrive (RMVStreamParser does this
+ * from the HTTP Stream); the tokenizer keeps its state between calls, so a
+ * response can be fed in arbitrary slices, down to one byte at a time.
+ * Only the fields the display needs are kept; their bytes are written straight
+ * into the StringPool arena and interned there, DepartureInfo only keeps the
+ * offsets. The departures vector is reserved once up front, so there is no
+ * heap allocation per departure and no intermediate JsonDocument.
+ *
+ * Extracted paths (same set as the former ArduinoJson filter):
+ *   Departure[].time / rtTime / track / direction / directionFlag / cancelled
+ *   Departure[].Product[0].line / catOut
+ *   Departure[].Messages.Message[0].head
+ */
+class RMVDepartureParser {
+public:
+    explicit RMVDepartureParser(DepartureData& out, size_t maxDepartures = RMV_MAX_DEPARTURES);
+
+    // Clear the output and tokenizer state for a new response
+    void reset();
+
+    /**
+     * Push the next slice of the response body.
+     * @return false once the input turned out to be malformed
+     */
+    bool feed(const char* data, size_t len);
+
+    // Departure array closed (or limit reached) - the rest of the body can be skipped
+    bool isDone() const { return done; }
+    bool hasError() const { return error; }
+    size_t bytesConsumed() const { return consumed; }
+
+private:
+    static const uint8_t MAX_DEPTH = 24;
+    static const uint8_t KEY_SIZE = 16;
+
+    enum class Ctx : uint8_t {
+        SKIP,
+        ROOT,
+        DEPARTURE_LIST,
+        DEPARTURE,
+        PRODUCT_LIST,
+        PRODUCT,
+        MESSAGES,
+        MESSAGE_LIST,
+        MESSAGE
+    };
+
+    enum class State : uint8_t {
+        VALUE,
+        KEY_OR_END,
+        KEY,
+        COLON,
+        COMMA_OR_END,
+        STRING,
+        ESCAPE,
+        UNICODE,
+        LITERAL,
+        END
+    };
+
+    struct Frame {
+        Ctx ctx;
+        bool isArray;
+        uint16_t index; // elements seen so far (arrays only)
+    };
+
+    bool openContainer(bool isArray);
+    bool closeContainer(bool isArray);
+    void afterValue();
+    void onKey();
+    void beginValue();
+    void putStringByte(char c);
+    void endString();
+    void endLiteral();
+    void putCodepoint(uint32_t cp);
+
+    DepartureData& out;
+    size_t maxDepartures;
+
+    Frame stack[MAX_DEPTH];
+    uint8_t depth;
+    State state;
+    bool stringIsKey;
+    bool done;
+    bool error;
+    size_t consumed;
+
+    // Current key (truncated keys never match a wanted field)
+    char key[KEY_SIZE];
+    uint8_t keyLen;
+    bool keyOverflow;
+
+    // Where the next value goes
+    Ctx pendingCtx;     // context for a container value
+    PooledString* target; // string destination, nullptr if the value is skipped
+    size_t targetMax;     // longest value kept for this field (bytes)
+    size_t targetLen;
+    bool targetTruncated;
+    bool wantCancelled; // next literal is Departure[].cancelled
+
+    char literal[6];
+    uint8_t literalLen;
+
+    uint32_t unicode;
+    uint8_t unicodeDigits;
+
+    int current; // index of the departure being filled, -1 if none
+};
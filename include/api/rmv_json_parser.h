@@ -1,26 +1,39 @@
 #pragma once
 #include <Arduino.h>
-#include <ArduinoJson.h>
 #include "api/rmv_api.h"
+#include "api/rmv_departure_parser.h"
 
-// Maximum number of departures to parse (matches display limitations)
-#define MAX_DEPARTURES 20
-
-// Safe JSON string extraction utility
-inline String safeJsonString(JsonVariantConst variant, const char* key, const String& defaultVal = "") {
-    const char* value = variant[key];
-    return value ? String(value) : defaultVal;
-}
-
+/**
+ * Incremental reader for RMV departureBoard responses.
+ *
+ * Bytes are pulled from the HTTP Stream into a fixed buffer and handed to
+ * RMVDepartureParser, which keeps brace/string state across refills and
+ * fills each departure record in place. The parser consumes every refill
+ * completely, so the buffer is simply reused from the start. Peak memory is
+ * the buffer plus the parser state, independent of the response size.
+ */
 class RMVStreamParser {
 public:
-    static bool parseResponse(const String& payload, DepartureData& departData);
+    static const size_t BUFFER_SIZE = 512;
+
+    explicit RMVStreamParser(DepartureData& departData, size_t maxDepartures = RMV_MAX_DEPARTURES);
+
+    /**
+     * Consume the response until the Departure array is complete.
+     * Waiting for data is bounded by the stream's own timeout.
+     * @return true if the departure list was parsed completely
+     */
+    bool parseResponse(Stream& stream);
+
+    size_t bytesRead() const { return totalRead; }
+    size_t peakBuffered() const { return peak; }
 
 private:
-    static bool findAndParseDepartures(const String& json, DepartureData& departData);
-    static String extractJsonValue(const String& json, const String& key, int startPos = 0);
-    static int findJsonArrayStart(const String& json, const String& arrayName, int startPos = 0);
-    static bool parseIndividualDeparture(const String& departureJson, DepartureInfo& info);
-    static void parseMessagesArray(const String& json, DepartureInfo& info);
-    static String extractNestedValue(const String& json, const String& path);
+    size_t refill(Stream& stream);
+
+    RMVDepartureParser parser;
+
+    char buffer[BUFFER_SIZE];
+    size_t totalRead;
+    size_t peak;
 };
@@ -0,0 +1,100 @@
+#pragma once
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/entropy.h>
+
+// Largest session ticket kept in RTC memory; bigger tickets fall back to session-ID resumption
+#define TLS_TICKET_MAX 192
+
+// Resumption state for one host, kept in RTC memory across deep sleep
+struct TlsSessionEntry {
+    char host[40];
+    int32_t ciphersuite;
+    uint8_t idLen;
+    uint8_t id[32];
+    uint8_t master[48];
+    uint16_t ticketLen;
+    uint8_t ticket[TLS_TICKET_MAX];
+    uint32_t lifetime; // seconds, from the ticket or SESSION_MAX_AGE_S
+    uint32_t savedAt;  // epoch seconds
+};
+
+/**
+ * Per-host TLS session cache (www.rmv.de, api.open-meteo.com, api.github.com).
+ *
+ * Holds the session ID / ticket and master secret of the last handshake per
+ * host so the next wake can do an abbreviated handshake instead of a full
+ * ECDHE exchange. Entries expire with the ticket lifetime; the least
+ * recently saved entry is replaced when all slots are taken.
+ */
+class TlsSessionCache {
+public:
+    static const uint8_t MAX_HOSTS = 3;
+    static const uint32_t SESSION_MAX_AGE_S = 3600; // Used when the server sends no ticket lifetime
+
+    // Copies the host's unexpired entry into entry; false if there is none
+    static bool find(const char* host, TlsSessionEntry& entry);
+    static void store(const char* host, const mbedtls_ssl_session& session);
+    static void invalidate(const char* host);
+    static void clear();
+
+    // Running full vs. resumed handshake statistics, logged after each handshake
+    static void recordHandshake(const char* host, bool resumed, uint32_t durationMs);
+};
+
+/**
+ * WiFiClient with TLS session resumption, for use with HTTPClient::begin(client, url).
+ *
+ * Offers the cached session for the host on connect and stores the new one
+ * after the handshake. If a resumption attempt fails outright the cache entry
+ * is dropped and the connection is retried once with a full handshake; a
+ * server that just ignores the ticket is handled by mbedTLS itself.
+ * Certificates are not verified, same as the plain HTTPClient::begin(url) it replaces.
+ */
+class ResumableTlsClient : public WiFiClient {
+public:
+    static const uint32_t HANDSHAKE_TIMEOUT_MS = 10000;
+
+    ResumableTlsClient();
+    ~ResumableTlsClient();
+
+    int connect(IPAddress ip, uint16_t port);
+    int connect(IPAddress ip, uint16_t port, int32_t timeout);
+    int connect(const char* host, uint16_t port);
+    int connect(const char* host, uint16_t port, int32_t timeout);
+
+    size_t write(uint8_t data);
+    size_t write(const uint8_t* buf, size_t size);
+    int available();
+    int read();
+    int read(uint8_t* buf, size_t size);
+    int peek();
+    void flush();
+    void stop();
+    uint8_t connected();
+
+    bool lastHandshakeResumed() const { return resumed; }
+    uint32_t lastHandshakeMs() const { return handshakeMs; }
+
+private:
+    bool connectResuming(const IPAddress& ip, uint16_t port, int32_t timeout);
+    bool startTls(const IPAddress& ip, uint16_t port, int32_t timeout, const TlsSessionEntry* cached);
+    void freeTls();
+
+    static int bioSend(void* ctx, const unsigned char* buf, size_t len);
+    static int bioRecv(void* ctx, unsigned char* buf, size_t len);
+
+    mbedtls_ssl_context ssl;
+    mbedtls_ssl_config conf;
+    mbedtls_ctr_drbg_context drbg;
+    mbedtls_entropy_context entropy;
+
+    char hostName[40];
+    TlsSessionEntry cachedSession; // Copy of the cache entry offered in the handshake
+    bool tlsActive;
+    bool resumed;
+    uint32_t handshakeMs;
+    int peeked;
+};
@@ -40,24 +40,43 @@ enum class BoardType {
 };
 
 // Detect which board we're building for (set via platformio.ini build_flags)
+// PARALLEL_FETCH: run independent HTTP fetches as concurrent tasks (dual-core boards only)
 #if defined(BOARD_C3_SUPERMINI)
 #define SHOW_BATTERY_STATUS 0
 #define HAS_BUTTON 0
+#define PARALLEL_FETCH 0
 
 #elif defined(BOARD_S3_E1001)
 #define SHOW_BATTERY_STATUS 1
 #define HAS_BUTTON 1
+#define PARALLEL_FETCH 1
 
 #elif defined(BOARD_S3_EE04)
 #define SHOW_BATTERY_STATUS 1
 #define HAS_BUTTON 1
+#define PARALLEL_FETCH 1
 
 #elif defined(BOARD_C5_XIAO)
 #define SHOW_BATTERY_STATUS 1
 #define HAS_BUTTON 1
+#define PARALLEL_FETCH 0
 
 #endif
 
+#ifndef PARALLEL_FETCH
+#define PARALLEL_FETCH 0
+#endif
+
+// Battery capacity for the projected runtime on the Application Info screen (see EnergyMeter).
+// Override with -D BATTERY_CAPACITY_MAH=<mAh> when a different cell is fitted.
+#ifndef BATTERY_CAPACITY_MAH
+#if SHOW_BATTERY_STATUS
+#define BATTERY_CAPACITY_MAH 2000
+#else
+#define BATTERY_CAPACITY_MAH 0
+#endif
+#endif
+
 // =============================================================================
 // Debug Display Features
 // =============================================================================
@@ -55,6 +55,11 @@ struct RTCConfigData {
     bool tripMode;              // false = departures, true = connections (A→B)
     char tripDestId[128];       // Destination stop ID for trip mode
 
+    // Battery energy plan (see EnergyPolicy)
+    int maxWeatherInterval;   // 4 bytes (hours) - longest stretched weather interval
+    int maxTransportInterval; // 4 bytes (minutes) - longest stretched transport interval
+    int8_t chargeDay;         // 1 byte - weekday the battery is charged (0=Sunday), -1 = no target
+
     // System state
     bool configMode; // 1 byte
     uint32_t lastUpdate; // 4 bytes (timestamp)
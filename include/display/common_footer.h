@@ -16,6 +16,9 @@ public:
     // elements: bitwise OR of FooterElements flags
     static void drawFooter(int16_t x, int16_t y, int16_t h, uint8_t elements = FOOTER_TIME | FOOTER_REFRESH);
 
+    // Hash of everything drawFooter() would draw for these elements right now
+    static uint32_t fingerprint(uint8_t elements);
+
     // Cache WiFi state before turning WiFi off (call before WiFi.disconnect())
     static void cacheWiFiState();
 
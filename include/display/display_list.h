@@ -0,0 +1,200 @@
+#pragma once
+#include <GxEPD2_BW.h>
+#include <U8g2_for_Adafruit_GFX.h>
+#include <gdey/GxEPD2_750_GDEY075T7.h>
+#include <vector>
+
+// Rows held by the frame buffer. Every board keeps the whole frame, which partial refreshes
+// need. A build short on RAM can opt in with -D DISPLAY_PAGE_HEIGHT=<rows>; GxEPD2 then draws
+// the frame in pages, and DISPLAY_LIST records each frame once and replays it per page.
+#ifdef DISPLAY_PAGE_HEIGHT
+#ifndef DISPLAY_LIST
+#define DISPLAY_LIST 1
+#endif
+#else
+#define DISPLAY_PAGE_HEIGHT GxEPD2_750_GDEY075T7::HEIGHT
+#endif
+
+#ifndef DISPLAY_LIST
+#define DISPLAY_LIST 0
+#endif
+
+using EpdPanel = GxEPD2_BW<GxEPD2_750_GDEY075T7, DISPLAY_PAGE_HEIGHT>;
+
+class RecordingDisplay;
+class RecordingU8g2;
+
+/**
+ * Repeating 1bpp fill pattern for RecordingDisplay::fillStipple(): dotted lines, grids and
+ * hatching. Row r of a filled area uses rows[r % rowCount]; pixel i of a row is bit 31 - i
+ * of the first `period` bits, repeated every `period` pixels. The pattern is anchored at
+ * the top left corner of the area. Stipples are referenced by display lists, so define
+ * them as static constants.
+ */
+struct Stipple {
+    uint32_t rows[8];
+    uint8_t rowCount; // 1..8
+    uint8_t period;   // 1..32
+};
+
+/**
+ * Draw calls of one frame in a compact command buffer.
+ *
+ * While a list is recording, everything the layout code draws through `display` and
+ * `u8g2` is appended to it instead of the frame buffer. replay() then draws the commands
+ * that touch a band of rows, so a paged buffer runs the layout (text shortening, String
+ * formatting, curve math) once per frame instead of once per page.
+ *
+ * Text is kept as UTF-8 runs with their font, pixels that continue a fixed step (dotted
+ * grid lines, hatched bars) are merged into a single command. Fonts and bitmaps are
+ * referenced, not copied, so they must stay valid until the list is replayed (PROGMEM data).
+ */
+class DisplayList {
+public:
+    ~DisplayList();
+
+    void beginRecording();
+    void endRecording();
+
+    // List that draw calls go to, nullptr when drawing straight into the frame buffer
+    static DisplayList* recording() { return active; }
+
+    // Pauses the recording list without clearing it (nullptr if none); resume() continues it
+    static DisplayList* suspend();
+    static void resume(DisplayList* list);
+
+    // False when the list ran out of references; the frame must then be drawn directly
+    bool complete() const { return !overflowed; }
+    size_t commandCount() const { return commands.size(); }
+    size_t bytes() const;
+
+    // Draws the commands that touch rows [top, bottom)
+    void replay(RecordingDisplay& gfx, RecordingU8g2& text, int16_t top, int16_t bottom) const;
+
+    // ===== Recording (called by RecordingDisplay and RecordingU8g2) =====
+
+    void fillScreen(uint16_t color);
+    void pixel(int16_t x, int16_t y, uint16_t color);
+    void line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void hLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void vLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void invertedBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color);
+    void compressedBitmap(int16_t x, int16_t y, const uint8_t* runs, int16_t w, int16_t h, uint16_t color);
+    void stipple(int16_t x, int16_t y, int16_t w, int16_t h, const Stipple& pattern, uint16_t color);
+    void text(int16_t x, int16_t y, const uint8_t* font, uint16_t color, const uint8_t* utf8, size_t len);
+
+    // Drops draw calls while a recorded text run advances the U8g2 cursor
+    bool muted() const { return muteDepth > 0; }
+    void mute() { muteDepth++; }
+    void unmute() { muteDepth--; }
+
+private:
+    enum class Op : uint8_t {
+        FILL_SCREEN,
+        PIXELS,
+        LINE,
+        H_LINE,
+        V_LINE,
+        RECT,
+        FILL_RECT,
+        INVERTED_BITMAP,
+        COMPRESSED_BITMAP,
+        STIPPLE,
+        TEXT,
+    };
+
+    // 12 bytes; the meaning of a and b depends on the op
+    struct Command {
+        Op op;
+        uint8_t ref; // Font, bitmap or stipple in refs
+        uint16_t color;
+        int16_t x;
+        int16_t y;
+        int16_t a; // LINE: x1, H_LINE: w, V_LINE: h, RECT/BITMAP/STIPPLE: w, PIXELS: x/y step, TEXT: offset
+        int16_t b; // LINE: y1, RECT/BITMAP/STIPPLE: h, PIXELS: count, TEXT: length
+    };
+
+    void add(Op op, uint16_t color, int16_t x, int16_t y, int16_t a, int16_t b, uint8_t ref = 0);
+    uint8_t reference(const void* data);
+    static bool rowsOverlap(int16_t y0, int16_t y1, int16_t top, int16_t bottom);
+
+    std::vector<Command> commands;
+    std::vector<const void*> refs;
+    std::vector<uint8_t> textRuns;
+    uint8_t muteDepth = 0;
+    bool overflowed = false;
+
+    static DisplayList* active;
+};
+
+/**
+ * The e-paper panel. Draws into the frame buffer, or into the recording DisplayList.
+ */
+class RecordingDisplay : public EpdPanel {
+public:
+    using EpdPanel::EpdPanel;
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override;
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+    void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+
+    /**
+     * Draws a run-length compressed icon from icons_compressed.h (see getCompressedBitmap()).
+     * Same result as drawInvertedBitmap() with the raw icon: the runs are decoded
+     * row by row and each foreground run is drawn as a line, without unpacking the icon.
+     */
+    void drawCompressedBitmap(int16_t x, int16_t y, const uint8_t runs[], int16_t w, int16_t h, uint16_t color);
+
+    /**
+     * Fills the area with a repeating pattern. The area is clipped to the panel once, and
+     * each row is expanded to 32-pixel words, so only the set pixels are visited and none
+     * is bounds-checked or dispatched through the virtual drawPixel() again.
+     */
+    void fillStipple(int16_t x, int16_t y, int16_t w, int16_t h, const Stipple& pattern, uint16_t color);
+
+    /**
+     * Sends the pixels drawn until endCapture() to a 1bpp band instead of the frame buffer:
+     * columns [x, x + w) of rows [y, y + h), MSB first, a set bit for every color but white.
+     * Pixels outside the band are dropped. LayerCache rasterizes its layers this way.
+     */
+    void beginCapture(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t* bits);
+    void endCapture() { captureBits = nullptr; }
+
+private:
+    uint8_t* captureBits = nullptr;
+    int16_t captureX = 0;
+    int16_t captureY = 0;
+    int16_t captureW = 0;
+    int16_t captureH = 0;
+};
+
+/**
+ * U8g2 font renderer. Characters the fonts lack are printed as their Fonts::printable()
+ * fallback, and printed text is recorded as runs while a DisplayList is recording.
+ * The library has no getters for the font and colors, so they are tracked here.
+ */
+class RecordingU8g2 : public U8G2_FOR_ADAFRUIT_GFX {
+public:
+    void setFont(const uint8_t* font);
+    void setForegroundColor(uint16_t color);
+    const uint8_t* getFont() const { return font; }
+
+    using U8G2_FOR_ADAFRUIT_GFX::write;
+    size_t write(uint8_t v) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+
+private:
+    size_t writeGlyphs(const uint8_t* buffer, size_t size);
+
+    const uint8_t* font = nullptr;
+    uint16_t foreground = GxEPD_BLACK;
+    uint8_t pending[3]; // Start of a UTF-8 sequence not completed by the last write
+    uint8_t pendingLength = 0;
+};
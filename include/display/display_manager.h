@@ -2,6 +2,8 @@
 #include "icons.h"
 #include "api/dwd_weather_api.h"
 #include "api/rmv_api.h"
+#include "display/display_list.h"
+#include "display/refresh_planner.h"
 
 // Display constants - centralized configuration
 namespace DisplayConstants {
@@ -11,18 +13,23 @@ namespace DisplayConstants {
     constexpr int16_t MARGIN_HORIZONTAL = 10;
 }
 
-// Update regions - what parts of the display need updating
-enum class UpdateRegion {
-    NONE = 0, // No data to display
-    WEATHER_ONLY = 1, // Only weather needs update
-    DEPARTURE_ONLY = 2, // Only departure needs update
-    BOTH = 3 // Both weather and departure need update
-};
-
 class DisplayManager {
 public:
+    /**
+     * Each region of the frame is fingerprinted and compared with the image still on
+     * the panel: an identical frame is not pushed at all, changed transport data or
+     * footer only refresh their window partially, changed weather refreshes fully.
+     */
     static void displayHalfNHalf(const WeatherInfo& weather, const DepartureData& departures);
     static void displayHalfNHalfTrip(const WeatherInfo& weather, const TripData& tripData);
+
+    /**
+     * Rasterize the weather half ahead of displayHalfNHalf()/displayHalfNHalfTrip(),
+     * e.g. while the transport fetch is still running. Only draws into the frame
+     * buffer, the panel is not touched; the next half-and-half call then adds the
+     * footer and the right half and pushes the frame. weather must not change in between.
+     */
+    static void prepareWeatherHalf(const WeatherInfo& weather);
     static void displayWeatherFull(const WeatherInfo& weather);
     static void displayDeparturesFull(const DepartureData& departures);
 
@@ -44,7 +51,10 @@ public:
     static void displayOTAUpToDate(const char* currentVersion);
 
     // Utility functions
+    // Powers the panel off; hibernates it unless the frame may be refreshed partially next wake
     static void hibernate();
+    // The controller still holds the last frame (init the display with initial = false)
+    static bool panelRetained();
 
 private:
     // Internal state
@@ -52,10 +62,22 @@ private:
     static int16_t screenHeight;
     static int16_t halfWidth;
     static int16_t halfHeight;
+    static bool weatherHalfPrepared;
+    static bool framePlanned;
 
     static void displayCenteredErrorIcon(icon_name_t iconName, uint8_t iconSize, const char* message);
     // Display update methods for each case
     static void updateWeatherHalf(const WeatherInfo& weather);
+    static void drawWeatherHalfLayout(const WeatherInfo& weather);
+    static void drawWeatherHalfFooter();
+    static bool takePreparedFrame();
+    // Full refresh of what is drawn in between; a DISPLAY_LIST build records the layout once and replays it per page
+    static void beginFrame(DisplayList& frame);
+    static void endFrame(DisplayList& frame);
+    static void pushFrame(ScreenLayout layout, const FrameContent& content);
+    static uint32_t weatherFingerprint(const WeatherInfo& weather);
+    static uint32_t departuresFingerprint(const DepartureData& departures);
+    static uint32_t tripFingerprint(const TripData& tripData);
     static void updateDepartureHalf(const DepartureData& departures);
     static void displayVerticalLine(const int16_t contentY);
     static void calculateDimensions();
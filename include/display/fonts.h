@@ -0,0 +1,55 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <U8g2_for_Adafruit_GFX.h>
+
+/**
+ * The U8g2 fonts the UI draws with.
+ *
+ * Builds with custom_font_subset = yes link glyph subsets of the helvB fonts that
+ * tools/subset_fonts.py generates before the build (FONT_SUBSET=1): printable ASCII, German
+ * letters, and every character found in the firmware's string literals and the API fixtures.
+ * Otherwise (every board for now, or the U8g2 sources not installed yet) the full _tf fonts are used.
+ */
+namespace Fonts {
+#if FONT_SUBSET
+extern const uint8_t SUBSET_HELVB08[];
+extern const uint8_t SUBSET_HELVB10[];
+extern const uint8_t SUBSET_HELVB12[];
+extern const uint8_t SUBSET_HELVB14[];
+extern const uint8_t SUBSET_HELVB18[];
+extern const uint8_t SUBSET_HELVB24[];
+extern const uint8_t SUBSET_GLYPHS[32]; // Bit per Latin-1 code point kept in the subsets
+
+constexpr const uint8_t* HELVB08 = SUBSET_HELVB08;
+constexpr const uint8_t* HELVB10 = SUBSET_HELVB10;
+constexpr const uint8_t* HELVB12 = SUBSET_HELVB12;
+constexpr const uint8_t* HELVB14 = SUBSET_HELVB14;
+constexpr const uint8_t* HELVB18 = SUBSET_HELVB18;
+constexpr const uint8_t* HELVB24 = SUBSET_HELVB24;
+#else
+constexpr const uint8_t* HELVB08 = u8g2_font_helvB08_tf;
+constexpr const uint8_t* HELVB10 = u8g2_font_helvB10_tf;
+constexpr const uint8_t* HELVB12 = u8g2_font_helvB12_tf;
+constexpr const uint8_t* HELVB14 = u8g2_font_helvB14_tf;
+constexpr const uint8_t* HELVB18 = u8g2_font_helvB18_tf;
+constexpr const uint8_t* HELVB24 = u8g2_font_helvB24_tf;
+#endif
+
+/**
+ * Code point to draw for codepoint: itself if the fonts have it, otherwise a fallback
+ * (accented letters lose the accent, typographic quotes and dashes become ASCII, anything
+ * else becomes '?'). U8g2 silently skips missing glyphs, which would merge the words around them.
+ */
+uint16_t printable(uint16_t codepoint);
+
+/**
+ * Decodes the code point at p and advances p past it, like U8g2 does: up to three bytes,
+ * and a byte that does not start a valid sequence stands for itself. end may be nullptr
+ * for NUL-terminated text.
+ */
+uint16_t nextCodepoint(const uint8_t*& p, const uint8_t* end);
+
+// Writes codepoint as UTF-8 into out (room for 3 bytes), returns the length
+size_t encodeUtf8(uint16_t codepoint, char* out);
+} // namespace Fonts
@@ -0,0 +1,74 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+#include "display/display_list.h"
+
+/**
+ * Pre-rasterized static parts of the screens: the departure column headers, the weather
+ * graph's rain axis and legend, the setup instructions.
+ *
+ * The first draw of a layer records it, rasterizes the recording band by band and keeps it
+ * run-length compressed in the icon format (see RecordingDisplay::drawCompressedBitmap()).
+ * Later draws blit the runs instead of running the text layout again. Layers up to
+ * MAX_STORED_BYTES are also written to NVS so they survive deep sleep, and flash is only
+ * written when a layer changes.
+ *
+ * A layer is keyed by LAYOUT_VERSION, the firmware build, its size and the content
+ * fingerprint the caller passes for whatever it draws besides fixed texts. A changed layout,
+ * a firmware update or a config that moves or resizes the layer therefore redraws it.
+ *
+ * Only pixels drawn in a color other than white are kept, so a layer belongs on an area that
+ * is white underneath. Its runs stay valid for the rest of the wake unless the same layer is
+ * drawn with another key, so a recording DisplayList may reference them.
+ */
+class LayerCache {
+public:
+    enum class Layer : uint8_t {
+        TRANSPORT_HEADER,
+        RAIN_AXIS,
+        GRAPH_LEGEND,
+        SETUP_INSTRUCTIONS,
+        COUNT,
+    };
+
+    // Bump when the drawing code of a cached layer changes
+    static const uint16_t LAYOUT_VERSION = 1;
+    static const size_t MAX_STORED_BYTES = 1536; // Larger layers are only cached for the current wake
+
+    /**
+     * Draws the layer that render() draws into (x, y, w, h). render() only runs when the
+     * layer is not cached with the same key; it must not draw outside the area.
+     */
+    template <typename Render>
+    static void draw(Layer layer, int16_t x, int16_t y, int16_t w, int16_t h, uint32_t content, Render render) {
+        uint32_t key = keyFor(layer, w, h, content);
+        if (!load(layer, key)) {
+            DisplayList recording;
+            beginRaster(recording);
+            render();
+            endRaster(recording, layer, key, x, y, w, h);
+        }
+        blit(layer, x, y);
+    }
+
+    // Drops the copies in RAM, the next draw of each layer loads it from NVS again
+    static void clear();
+    // Drops the layers in RAM and NVS
+    static void erase();
+
+    // Layers rasterized since boot
+    static uint32_t rasterizations() { return rasterized; }
+    // Compressed size of a cached layer, 0 if it is not in RAM
+    static size_t bytes(Layer layer);
+
+private:
+    static uint32_t keyFor(Layer layer, int16_t w, int16_t h, uint32_t content);
+    static bool load(Layer layer, uint32_t key);
+    static void beginRaster(DisplayList& recording);
+    static void endRaster(DisplayList& recording, Layer layer, uint32_t key, int16_t x, int16_t y, int16_t w,
+                          int16_t h);
+    static void blit(Layer layer, int16_t x, int16_t y);
+
+    static DisplayList* suspended;
+    static uint32_t rasterized;
+};
@@ -0,0 +1,103 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Update regions - what parts of the display need updating
+enum class UpdateRegion {
+    NONE = 0, // No data to display
+    WEATHER_ONLY = 1, // Only weather needs update
+    DEPARTURE_ONLY = 2, // Only departure needs update
+    BOTH = 3 // Both weather and departure need update
+};
+
+// Screens the planner can refresh partially; everything else is always a full refresh
+enum class ScreenLayout : uint8_t {
+    NONE = 0,
+    HALF_DEPARTURES = 1,
+    HALF_TRIP = 2,
+};
+
+/**
+ * Incremental FNV-1a over everything a screen region is drawn from.
+ * Equal fingerprints mean the region would be drawn with the same pixels.
+ */
+class ContentHash {
+public:
+    ContentHash& add(const void* data, size_t len) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < len; i++) {
+            value ^= bytes[i];
+            value *= 16777619u;
+        }
+        return *this;
+    }
+
+    // Includes the terminator, so "ab" + "c" and "a" + "bc" differ
+    ContentHash& add(const char* str) {
+        return add(str, strLength(str) + 1);
+    }
+
+    uint32_t get() const { return value; }
+
+private:
+    static size_t strLength(const char* str) {
+        size_t len = 0;
+        while (str[len]) len++;
+        return len;
+    }
+
+    uint32_t value = 2166136261u;
+};
+
+// Fingerprints of the three regions of a half-and-half frame
+struct FrameContent {
+    uint32_t weather;   // Left half above the footer
+    uint32_t footer;    // Time, WiFi and battery strip under the weather
+    uint32_t transport; // Right half
+};
+
+struct RefreshWindow {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+struct RefreshPlan {
+    bool full;
+    uint8_t windowCount; // Partial windows to push when !full; none at all means the panel is left alone
+    RefreshWindow windows[2];
+};
+
+// What the panel currently shows, kept in RTC memory across deep sleep
+struct RefreshState {
+    ScreenLayout layout;       // Layout of the image on the panel, NONE if unknown
+    uint8_t partialsSinceFull;
+    bool panelKept;            // Controller left powered (not hibernated), so its RAM still holds that image
+    FrameContent content;      // Fingerprints of that image
+};
+
+/**
+ * Chooses between a full refresh, partial windows, or no refresh for the next frame.
+ *
+ * A partial refresh only updates the pixels that differ from the image the
+ * controller still holds, so it needs that image: the panel must have been
+ * powered off (not hibernated) before deep sleep and show the same layout.
+ * Regions whose fingerprint matches the image on the panel are not pushed, so
+ * the dirty windows are the weather half, the footer strip and the transport
+ * half; a frame identical to the panel is not pushed at all. Both halves
+ * changing, a layout change and every FULL_REFRESH_EVERY-th update get a full
+ * refresh, which also clears the ghosting partial updates leave behind.
+ */
+class RefreshPlanner {
+public:
+    static const uint8_t FULL_REFRESH_EVERY = 10;
+
+    // Which data regions differ from the image on the panel (BOTH when it is unknown)
+    static UpdateRegion changedRegion(const RefreshState& state, ScreenLayout layout, const FrameContent& content);
+
+    static RefreshPlan plan(const RefreshState& state, ScreenLayout layout, const FrameContent& content,
+                            int16_t width, int16_t height, int16_t footerHeight);
+    static void record(RefreshState& state, ScreenLayout layout, const FrameContent& content,
+                       const RefreshPlan& plan);
+};
@@ -22,9 +22,12 @@ public:
     static void setFont18px_margin22px(); // Extra large font - 18px height, 22px margin
     static void setFont24px_margin28px(); // Huge font - 24px height, 28px margin
 
-    // Text measurement and fitting functions
+    // Text measurement and fitting functions. Widths come from per-font glyph advance
+    // tables filled on first use, so measuring walks the UTF-8 string once.
     static int16_t getTextWidth(const String& text);
+    static int16_t getTextWidth(const char* text);
     static String shortenTextToFit(const String& text, int16_t maxWidth);
+    static String shortenTextToFit(const char* text, int16_t maxWidth);
 
     // Font metrics utilities
     static int16_t getCurrentFontHeight();
@@ -36,6 +39,9 @@ public:
     static void printTextAtTopMargin(int16_t x, int16_t topY, const String& text);
     static void printStrikethroughTextAtTopMargin(int16_t x, int16_t topY, const String& text);
     static int16_t getFontAscent(); // Get current font ascent for calculations
+
+private:
+    static void glyphWidths(uint16_t codepoint, uint8_t& advance, uint8_t& extent);
 };
 
 #endif // TEXT_UTILS_H
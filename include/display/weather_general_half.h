@@ -13,6 +13,7 @@ public:
                                             int16_t y, int16_t h);
 
     static void drawWeatherFooter(int16_t x, int16_t y, int16_t h);
+    static uint32_t footerFingerprint();
 
 private:
     // Weather-specific column drawing functions
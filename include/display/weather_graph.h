@@ -1,5 +1,6 @@
 #pragma once
 #include "api/dwd_weather_api.h"
+#include "util/spline.h"
 #include <Arduino.h>
 
 class WeatherGraph {
@@ -23,10 +24,11 @@ private:
                                     float minTemp, float maxTemp);
     static void drawRainAxis(int16_t x, int16_t y, int16_t w, int16_t h);
     static void drawTimeAxis(int16_t x, int16_t y, int16_t w, int16_t h, const WeatherInfo& weather);
-    static void drawTemperatureLine(const WeatherInfo& weather,
-                                    int16_t graphX, int16_t graphY,
-                                    int16_t graphW, int16_t graphH,
-                                    float minTemp, float maxTemp);
+    static void buildTemperatureCurve(const WeatherInfo& weather,
+                                      int16_t graphX, int16_t graphY,
+                                      int16_t graphW, int16_t graphH,
+                                      float minTemp, float maxTemp, Spline::Polyline& curve);
+    static void drawTemperatureLine(const Spline::Polyline& curve);
     static void drawRainBars(const WeatherInfo& weather,
                              int16_t graphX, int16_t graphY,
                              int16_t graphW, int16_t graphH);
@@ -34,9 +36,10 @@ private:
     static void drawGraphLegend(int16_t x, int16_t y, int16_t w, int16_t h);
 
     // Humidity drawing functions
-    static void drawHumidityLine(const WeatherInfo& weather,
-                                 int16_t graphX, int16_t graphY,
-                                 int16_t graphW, int16_t graphH);
+    static void buildHumidityCurve(const WeatherInfo& weather,
+                                   int16_t graphX, int16_t graphY,
+                                   int16_t graphW, int16_t graphH, Spline::Polyline& curve);
+    static void drawHumidityLine(const Spline::Polyline& curve);
     static void drawDottedLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
 
     // Utility functions
@@ -53,4 +56,6 @@ private:
     static const int16_t LEGEND_MARGIN = 35; // Space for legend labels
     static const int HOURS_TO_SHOW = 13; // 13 hours as specified, line graph needs start and end point
     static const int HOURS_TO_SHOW_BAR = HOURS_TO_SHOW - 1; // Bar graph doesn't need end datapoint than line graph
+    static const uint8_t TEMPERATURE_CURVE_STEPS = 8; // Curve samples per hour
+    static const uint8_t HUMIDITY_CURVE_STEPS = 3;
 };
@@ -26,7 +26,6 @@ static const float VOLTAGE_DIVIDER_RATIO = 2.0f; // 2:1 voltage divider
 static const int ADC_MAX_VALUE = 4095; // 12-bit ADC
 static const float ADC_REFERENCE_VOLTAGE = 3.6f; // Actual reference voltage for ESP32-S3
 static const float CALIBRATION_FACTOR = 0.968f; // Calibration factor from OG DIY Kit
-static bool batteryInitialized = false;
 
 class BatteryManager {
 public:
@@ -67,6 +66,13 @@ public:
      */
     static bool isCharging();
 
+    /**
+     * Update the discharge estimate with this wake's voltage and stretch the update
+     * intervals so the battery lasts until the configured charge day (see EnergyPolicy)
+     * @param voltage Battery voltage read at wake, before WiFi loads the battery
+     */
+    static void updateEnergyPlan(float voltage);
+
 private:
     static float voltageToPercentage(float voltage);
     static const int BATTERY_SAMPLES = 10; // Number of samples for averaging
@@ -0,0 +1,100 @@
+#pragma once
+#include <stdint.h>
+
+// Where a wake spends its time. The lifecycle phases cover whatever no sub-phase does.
+enum class EnergyPhase : uint8_t {
+    INIT,
+    START,
+    RUNNING,
+    STOP,
+    WIFI_CONNECT,
+    TIME_SYNC,
+    HTTP_FETCH,
+    JSON_PARSE,
+    PANEL_REFRESH,
+    COUNT,
+};
+
+static const uint8_t ENERGY_PHASE_COUNT = (uint8_t)EnergyPhase::COUNT;
+
+// Average current draw of the board per phase and in deep sleep
+struct CurrentProfile {
+    float phaseMilliamps[ENERGY_PHASE_COUNT];
+    float sleepMicroamps;
+    uint16_t batteryMilliampHours; // 0 without a battery
+};
+
+// One wake in the RTC ring
+struct WakeRecord {
+    uint32_t startedAt;                   // Epoch seconds, 0 if the clock was not set
+    uint32_t sleepSeconds;                // Deep sleep requested at the end of the wake
+    uint16_t phaseMs[ENERGY_PHASE_COUNT]; // Capped at 65535
+};
+
+struct EnergySummary {
+    uint8_t wakes;           // Wakes the figures are based on, 0 if none were recorded yet
+    float mAhPerWake;        // Average charge of a wake
+    float mAhPerDay;         // Wakes and deep sleep over the recorded span
+    EnergyPhase topPhase;    // Phase with the largest share of the wake charge
+    uint8_t topPhasePercent;
+    float runtimeDays;       // Projected from the battery level, 0 if unknown
+};
+
+/**
+ * Per-wake energy accounting.
+ *
+ * The wake's time is split into phases on the timeline of the task that called beginWake():
+ * ActivityManager enters the lifecycle phases, Scope marks the sub-phases (WiFi connect, NTP,
+ * HTTP fetches, JSON parsing, panel refresh) and hands back to the enclosing phase when it
+ * ends. Phases are exclusive, so each millisecond is charged once. Scopes opened on other
+ * tasks (the parallel fetch workers) leave the timeline alone; their time shows up in
+ * whatever the wake task does meanwhile, usually waiting for them in HTTP_FETCH.
+ *
+ * endWake() multiplies the durations by the board's CurrentProfile and keeps the wake in
+ * an RTC ring of the last LOG_SIZE wakes. summary() turns the ring into mAh per wake,
+ * mAh per day including deep sleep, and a projected runtime.
+ */
+class EnergyMeter {
+public:
+    static const uint8_t LOG_SIZE = 16;
+
+    // Starts a wake in INIT; the startup before setup() counts as INIT as well
+    static void beginWake();
+    // Switches the wake's timeline to phase and returns the phase it was in
+    static EnergyPhase enter(EnergyPhase phase);
+    // Closes the wake and adds it to the ring
+    static void endWake(uint32_t startedAt, uint32_t sleepSeconds);
+
+    // Marks a sub-phase for as long as it is in scope
+    class Scope {
+    public:
+        explicit Scope(EnergyPhase phase) : previous(enter(phase)) {}
+        ~Scope() { enter(previous); }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        EnergyPhase previous;
+    };
+
+    // Summary of the recorded wakes; batteryPercent < 0 if unknown
+    static EnergySummary summary(int batteryPercent);
+
+    static const CurrentProfile& profile();
+    static const char* phaseName(EnergyPhase phase);
+
+    static float wakeMilliampHours(const WakeRecord& wake, const CurrentProfile& profile);
+    // records in wake order, oldest first
+    static EnergySummary summarize(const WakeRecord* records, uint8_t count, const CurrentProfile& profile,
+                                   int batteryPercent);
+
+#ifdef NATIVE_TEST
+    // Stands in for esp_timer_get_time()
+    static void setNativeMicros(uint64_t micros);
+    static void clearLog();
+#endif
+
+private:
+    static uint64_t nowMicros();
+    static bool onWakeTask();
+};
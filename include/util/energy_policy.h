@@ -0,0 +1,62 @@
+#pragma once
+#include <stdint.h>
+
+// Discharge estimate kept in RTC memory across deep sleep
+struct DischargeState {
+    float anchorVoltage;    // Reading the next rate sample is measured from, 0 if none yet
+    uint32_t anchorTime;    // When anchorVoltage was read
+    float voltsPerHour;     // Smoothed discharge rate, 0 until the first sample
+    uint16_t stretchPercent; // Interval stretch the rate was measured at, 0 counts as 100
+};
+
+// What the battery should last for and how far the intervals may be stretched to get there
+struct EnergyTarget {
+    uint32_t emptyBy;         // Timestamp of the next charge, 0 for no target
+    uint32_t transportSeconds; // Configured intervals
+    uint32_t maxTransportSeconds;
+    uint32_t weatherSeconds;
+    uint32_t maxWeatherSeconds;
+};
+
+struct EnergyPlan {
+    uint16_t stretchPercent;    // Factor applied to the configured intervals, 100 = as configured
+    uint32_t transportSeconds;  // Stretched intervals, within the target's bounds
+    uint32_t weatherSeconds;
+    uint32_t secondsToEmpty;    // Projected at the new stretch, 0 while the rate is unknown
+};
+
+/**
+ * Stretches the update intervals as the battery drains, so it lasts until the next charge
+ * instead of hitting the low-battery cutoff.
+ *
+ * Each wake passes the battery voltage. A discharge rate is sampled once the voltage has
+ * dropped by MIN_SAMPLE_DROP (or after MAX_SAMPLE_SECONDS), which keeps ADC noise out of
+ * it, and smoothed across samples. Most of the energy is spent on wakes, so the rate is
+ * taken to scale with the inverse of the stretch it was measured at: the stretch needed to
+ * reach the target is the current one times the target's remaining time over the projected
+ * time to empty. Below RESERVE_FRACTION of charge the intervals are stretched as well,
+ * target or not. The stretch never drops below 100 % and changes by at most MAX_STEP per
+ * wake, and the intervals stay within the configured and maximum intervals.
+ *
+ * A rise in voltage means the battery was charged; the sampling then starts over.
+ * No hardware or globals are touched, so voltage traces can be replayed natively.
+ */
+class EnergyPolicy {
+public:
+    static constexpr uint32_t MIN_SAMPLE_SECONDS = 2 * 3600;
+    static constexpr uint32_t MAX_SAMPLE_SECONDS = 24 * 3600;
+    static constexpr float MIN_SAMPLE_DROP = 0.02f;   // Volts; readings vary by about 10 mV
+    static constexpr float CHARGE_RISE = 0.05f;       // Volts above the anchor that count as charged
+    static constexpr float SMOOTHING = 0.3f;          // Weight of a new rate sample
+    static constexpr float RESERVE_FRACTION = 0.2f;   // Charge below which the reserve stretch applies
+    static constexpr uint16_t RESERVE_STRETCH = 300;  // Stretch at empty without a target
+    static constexpr float MAX_STEP = 1.5f;           // Largest stretch change per wake, either way
+
+    static EnergyPlan plan(DischargeState& state, float voltage, uint32_t now, const EnergyTarget& target);
+
+    // Timestamp of the end of the next `weekday` (0 = Sunday), today included, local time
+    static uint32_t endOfNextWeekday(uint8_t weekday, uint32_t now);
+
+    // Interval stretched by percent, never below `seconds` or above max(seconds, maxSeconds)
+    static uint32_t stretchInterval(uint32_t seconds, uint32_t maxSeconds, uint16_t stretchPercent);
+};
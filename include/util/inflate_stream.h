@@ -0,0 +1,98 @@
+#pragma once
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Streaming gzip / zlib / raw deflate decoder (RFC 1950-1952).
+ *
+ * Wraps the HTTP body stream the same way ChunkDecodingStream does, so a
+ * parser reading from it gets decompressed bytes without the body ever being
+ * buffered:
+ *
+ *   ChunkDecodingStream chunked(http.getStream());
+ *   InflateStream inflated(chunked);
+ *   deserializeJson(doc, inflated);
+ *
+ * The container format is detected from the first bytes. Decoded bytes are
+ * kept in the 32 KB history window deflate requires (PSRAM when available),
+ * which doubles as the read buffer; it is allocated on the first read, so an
+ * InflateStream that ends up unused costs nothing. Compressed input is pulled
+ * in small slices, blocking only as long as the upstream stream's timeout.
+ * The trailer is consumed as well, leaving a keep-alive connection clean.
+ */
+class InflateStream : public Stream {
+public:
+    static const size_t WINDOW_SIZE = 32768; // Largest distance deflate may reference
+    static const size_t INPUT_SIZE = 256;
+    static const size_t FILL_TARGET = 1024; // Decoded ahead per fill before returning to the reader
+
+    explicit InflateStream(Stream& upstream);
+    ~InflateStream();
+
+    // true for a Content-Encoding this class decodes ("gzip", "x-gzip", "deflate")
+    static bool isCompressed(const char* contentEncoding);
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override;
+    size_t write(uint8_t) { return 0; } // Read-only; required by Arduino's Print
+
+    bool isDone() const { return state == State::DONE; }
+    bool hasError() const { return state == State::FAILED; }
+    size_t compressedBytes() const { return compressedIn; }
+    size_t decompressedBytes() const { return produced; }
+
+private:
+    enum class State : uint8_t { WRAPPER_HEADER, BLOCK_HEADER, STORED, HUFFMAN, TRAILER, DONE, FAILED };
+    enum class Format : uint8_t { RAW, ZLIB, GZIP };
+
+    static const uint16_t MAX_LIT_CODES = 288;
+    static const uint16_t MAX_DIST_CODES = 32;
+    static const uint8_t MAX_CODE_BITS = 15;
+
+    bool fill();
+    void step();
+    void readWrapperHeader();
+    void readBlockHeader();
+    void readDynamicTables();
+    void inflateStored();
+    void inflateHuffman();
+    void readTrailer();
+    void fail(const char* reason);
+
+    int nextByte();
+    bool needBits(uint8_t n);
+    int bits(uint8_t n);
+    void alignToByte();
+
+    static bool buildTable(uint16_t* count, uint16_t* symbol, const uint8_t* lengths, uint16_t n);
+    int decodeSymbol(const uint16_t* count, const uint16_t* symbol);
+
+    size_t pending() const { return produced - consumed; }
+    void put(uint8_t b) { window[produced++ & (WINDOW_SIZE - 1)] = b; }
+
+    Stream& upstream;
+    uint8_t* window;
+    size_t produced; // Total decoded bytes (also the window write position)
+    size_t consumed; // Total bytes handed to the reader
+
+    uint8_t input[INPUT_SIZE];
+    uint16_t inputPos;
+    uint16_t inputLen;
+    size_t compressedIn;
+
+    uint32_t bitBuf;
+    uint8_t bitCount;
+
+    State state;
+    Format format;
+    bool finalBlock;
+    uint16_t storedLeft;
+
+    uint16_t litCount[MAX_CODE_BITS + 1];
+    uint16_t litSymbol[MAX_LIT_CODES];
+    uint16_t distCount[MAX_CODE_BITS + 1];
+    uint16_t distSymbol[MAX_DIST_CODES];
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * One network fetch for ParallelFetch::run().
+ *
+ * run(arg) does the fetch and writes its result through arg. A job that
+ * misses its deadline is abandoned, not killed (that would leak the TLS
+ * session and socket), so it may still write after join() has returned:
+ * arg must point to static storage that the caller only reads when the
+ * job reports ok.
+ */
+struct FetchJob {
+    const char* name;
+    bool (*run)(void* arg);
+    void* arg;
+    uint32_t deadlineMs; // measured from ParallelFetch::start()
+    uint32_t stackSize;
+
+    // Filled in by ParallelFetch
+    bool ok;
+    bool timedOut;
+    uint32_t durationMs;
+    uint32_t startedAt;
+    int8_t slot; // task slot while running, -1 otherwise
+};
+
+/**
+ * Runs independent fetches (weather, transport) side by side.
+ *
+ * With PARALLEL_FETCH (dual-core S3 boards) every job gets its own FreeRTOS
+ * task and stack; join() returns once the given jobs have finished or passed
+ * their deadline, so the wake costs about the slowest fetch instead of the
+ * sum. Between start() and join() the caller is free to do other work, e.g.
+ * render the parts of the screen whose data is already there.
+ * Without it (C3) start() runs the jobs one after another on the calling
+ * task and join() has nothing left to wait for; the deadline is only
+ * reported, the HTTP timeouts bound each fetch.
+ */
+class ParallelFetch {
+public:
+    static const uint8_t MAX_JOBS = 4;
+
+    static void start(FetchJob* jobs, uint8_t count);
+    // May be called for a subset of the started jobs, e.g. weather first
+    static void join(FetchJob* jobs, uint8_t count);
+
+    static void run(FetchJob* jobs, uint8_t count) {
+        start(jobs, count);
+        join(jobs, count);
+    }
+};
@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * Catmull-Rom curves in integer arithmetic, for the weather graph.
+ *
+ * Each sample is the weighted sum of four control points divided by one common
+ * denominator (2 * steps^3, a shift for 8 steps), so no floating point is involved and
+ * every sample is exact. The result is truncated toward zero, like the float formula
+ * cast to int16_t that the graph used before.
+ */
+class Spline {
+public:
+    static const uint8_t MAX_STEPS = 16;
+    static const uint8_t MAX_POINTS = 12 * 8 + 1; // 13 hourly points at 8 steps per hour
+
+    // Samples of a curve, consecutive samples are joined by straight lines
+    struct Polyline {
+        int16_t x[MAX_POINTS];
+        int16_t y[MAX_POINTS];
+        uint8_t count = 0;
+    };
+
+    /**
+     * Samples the curve through the count points (xs, ys), `steps` samples per segment,
+     * plus the last point. The end segments repeat their end point as outer control point.
+     * Points that would not fit into a Polyline are left out.
+     */
+    static void catmullRom(const int16_t* xs, const int16_t* ys, uint8_t count, uint8_t steps, Polyline& out);
+};
@@ -0,0 +1,65 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Per-wake string arena with interning.
+ *
+ * Strings are appended to a fixed static arena and deduplicated through a
+ * small open-addressing hash table, so repeated values ("S6", the same
+ * direction or disruption text) are stored once. Records keep 16-bit arena
+ * offsets instead of owning copies. Nothing is freed individually: the whole
+ * pool is released with reset() once a wake cycle has finished rendering,
+ * which keeps the heap untouched and unfragmented across deep sleep cycles.
+ */
+class StringPool {
+public:
+    static const size_t ARENA_SIZE = 4096;
+    static const size_t TABLE_SIZE = 512; // Power of two
+
+    // Build a string in place at the arena tail, then commit() it
+    static void begin();
+    static bool append(char c);
+    static size_t pendingLength() { return pendingLen; }
+    static const char* pending() { return arena + used; }
+    static void truncatePending(size_t len);
+    static uint16_t commit();
+
+    static uint16_t intern(const char* str);
+    static const char* get(uint16_t ref) { return arena + ref; }
+
+    // Release every string at once; all outstanding references become invalid
+    static void reset();
+
+    static size_t bytesUsed() { return used; }
+    static size_t stringCount() { return count; }
+    static size_t internHits() { return hits; }
+    static size_t droppedStrings() { return dropped; }
+
+private:
+    static uint32_t hash(const char* str, size_t len);
+
+    static char arena[ARENA_SIZE];
+    static uint16_t table[TABLE_SIZE]; // Arena offsets, 0 = free slot
+    static size_t used;
+    static size_t pendingLen;
+    static bool pendingOverflow;
+    static size_t count;
+    static size_t hits;
+    static size_t dropped;
+};
+
+// Reference to an interned string; the zero value is the empty string
+struct PooledString {
+    uint16_t ref;
+
+    const char* c_str() const { return StringPool::get(ref); }
+    bool isEmpty() const { return ref == 0; }
+
+    // Interned duplicates share an offset; strcmp only runs for strings stored while the table was full
+    bool operator==(const PooledString& other) const {
+        return ref == other.ref || strcmp(c_str(), other.c_str()) == 0;
+    }
+    bool operator!=(const PooledString& other) const { return !(*this == other); }
+};
@@ -7,6 +7,8 @@ public:
     static void printCurrentTime();
     static bool isTimeSet();
     static bool getCurrentLocalTime(tm& timeinfo);
+    // Sets the German timezone; TZ does not survive deep sleep, so call it before any localtime_r()
+    static void applyTimezone();
 
     // Enhanced time management for deep sleep optimization
     static bool needsPeriodicSync();
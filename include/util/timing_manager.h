@@ -1,11 +1,16 @@
 #pragma once
 
 #include <Arduino.h>
+#include "util/wake_schedule.h"
 
 // Maximum jitter added to sleep duration to spread API requests across devices.
 // With 1000 devices, a 60-second window yields ~17 requests/second instead of a spike.
 static constexpr uint32_t MAX_JITTER_SECONDS = 60;
 
+// Longest the departure board may go without a fetch when it waits for its first departure to leave.
+// Bounds how long real-time delays and cancellations can go unnoticed at quiet stops.
+static constexpr uint32_t MAX_DEPARTURE_STALENESS_SECONDS = 30 * 60;
+
 class TimingManager {
 public:
     // Get next sleep duration based on mode and next required update
@@ -17,10 +22,30 @@ public:
     // Check if we're in weekend mode
     static bool isWeekend();
 
+    // Compiles the config's transport, sleep and OTA times into the RTC wake schedule (see
+    // WakeScheduler). Called when the config is loaded or saved; the sleep calculation also
+    // recompiles when it finds the config changed.
+    static void compileSchedule();
+
     // Update last refresh timestamps
     static void markWeatherUpdated();
     static void markTransportUpdated();
 
+    // When the shown departure list changes next: its first departure can no longer be reached
+    // (departure minus walking time). 0 when unknown, e.g. in trip mode or after a failed fetch.
+    // Transport wakes are then deferred until that time, at most MAX_DEPARTURE_STALENESS_SECONDS
+    // after the last fetch, but never earlier than the configured interval.
+    static void setNextDepartureChange(uint32_t timestamp);
+    static uint32_t getNextDepartureChange();
+
+    // Percent the configured update intervals are stretched by (see EnergyPolicy), within
+    // config.maxTransportInterval and config.maxWeatherInterval; 100 = as configured
+    static void setIntervalStretch(uint16_t percent);
+    static uint16_t getIntervalStretch();
+
+    // Timestamp of a departure clock time ("HH:MM" or "HH:MM:SS") near now, past midnight if need be
+    static uint32_t departureTimestamp(const String& clock, uint32_t now);
+
     // Check if it's time for a specific update type
     static bool isTimeForWeatherUpdate();
 
@@ -29,6 +54,10 @@ public:
 
     // Device-unique jitter seed derived from MAC address (deterministic per device)
     static uint32_t getDeviceJitterSeed();
+#ifdef NATIVE_TEST
+    // Stands in for the MAC address of a simulated device
+    static void setDeviceJitterSeed(uint32_t seed);
+#endif
 
     // RTC timestamp management (public for testing)
     static uint32_t getLastWeatherUpdate();
@@ -42,13 +71,12 @@ public:
 private:
     // Time utility helpers
     static int parseTimeString(const String& timeStr);
-    static bool isTimeInRange(uint32_t currentMinutes, uint32_t startMinutes, uint32_t endMinutes);
-    static uint16_t getCurrentMin();
-    static uint16_t getSleepStartMin();
-    static uint16_t getSleepEndMin();
-    static bool isWeekend(time_t timestamp);
-    static bool isInDeepSleepPeriod();
-    static bool isInDeepSleepPeriod(uint32_t timestamp);
+    // The compiled schedule, recompiled first if the config changed
+    static WakeSchedule& schedule();
+
+    // Configured intervals with the stretch applied
+    static uint32_t weatherIntervalSeconds();
+    static uint32_t transportIntervalSeconds();
 
     // Sleep duration calculation helpers
     static uint32_t calculateNextOTACheckTime(uint32_t currentTimeSeconds);
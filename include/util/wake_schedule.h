@@ -0,0 +1,74 @@
+#pragma once
+#include <stdint.h>
+
+struct RTCConfigData;
+
+// Minutes since Sunday 00:00 local time, [start, end). An interval running past Saturday
+// midnight wraps: its end lies beyond MINUTES_PER_WEEK.
+struct MinuteInterval {
+    uint16_t start;
+    uint16_t end;
+};
+
+// The config's time windows for a whole week, kept in RTC memory across deep sleep
+struct WakeSchedule {
+    static const uint8_t MAX_INTERVALS = 14; // Two pieces per day for windows across midnight
+
+    uint32_t fingerprint;   // Of the config fields it was compiled from, 0 if not compiled
+    MinuteInterval active[MAX_INTERVALS]; // Transport active windows, sorted and merged
+    MinuteInterval sleep[MAX_INTERVALS];  // Deep sleep windows, sorted and merged
+    uint8_t activeCount;
+    uint8_t sleepCount;
+    uint16_t transportStart[7]; // Configured transport window start per weekday, minute of day
+    uint16_t otaMinute;         // Minute of day of the OTA check
+
+    // UTC offset, valid from offsetFrom until the next DST change
+    int32_t utcOffset;
+    uint32_t offsetFrom;
+    uint32_t offsetUntil;
+};
+
+/**
+ * Compiles the config's transport, sleep and OTA times into a WakeSchedule once, so the sleep
+ * calculation answers its questions with table lookups instead of parsing "HH:MM" strings
+ * and calling localtime_r() for every candidate.
+ *
+ * Each day uses the weekday or weekend windows of its own date. A window with its start after
+ * its end covers the evening and the morning of the same day, as TimingManager always treated
+ * it; the evening piece and the next morning's piece then join into one night.
+ *
+ * Local time comes from a cached UTC offset. It is looked up again, together with the next
+ * DST change, only when a timestamp falls outside the range it was found valid for. The
+ * lookup sets the timezone first, since TZ is lost in deep sleep and an offset taken in UTC
+ * would stay cached for days.
+ */
+class WakeScheduler {
+public:
+    static const uint16_t MINUTES_PER_DAY = 24 * 60;
+    static const uint16_t MINUTES_PER_WEEK = 7 * MINUTES_PER_DAY;
+
+    // Fingerprint of the config fields the schedule depends on, never 0
+    static uint32_t fingerprint(const RTCConfigData& config);
+    static void compile(WakeSchedule& schedule, const RTCConfigData& config);
+
+    // Local minute of the week of a timestamp, 0 = Sunday 00:00
+    static uint16_t minuteOfWeek(WakeSchedule& schedule, uint32_t timestamp);
+
+    static bool isTransportActive(const WakeSchedule& schedule, uint16_t minuteOfWeek);
+    static bool isInSleep(const WakeSchedule& schedule, uint16_t minuteOfWeek);
+    // Minutes until the sleep window around minuteOfWeek ends, 0 outside of one
+    static uint16_t minutesUntilSleepEnd(const WakeSchedule& schedule, uint16_t minuteOfWeek);
+    // Minutes until the transport window starts: later today, otherwise tomorrow
+    static uint16_t minutesUntilTransportStart(const WakeSchedule& schedule, uint16_t minuteOfWeek);
+    // Minutes until the OTA check time: later today, otherwise tomorrow
+    static uint16_t minutesUntilOTACheck(const WakeSchedule& schedule, uint16_t minuteOfWeek);
+
+    // Parses "HH:MM" into minutes since midnight, 0 if there is no colon
+    static uint16_t parseClock(const char* clock);
+
+private:
+    static uint8_t addWindow(MinuteInterval* intervals, uint8_t count, uint8_t day, uint16_t start, uint16_t end);
+    static uint8_t sortAndMerge(MinuteInterval* intervals, uint8_t count);
+    static const MinuteInterval* find(const MinuteInterval* intervals, uint8_t count, uint16_t minuteOfWeek);
+    static int32_t utcOffsetAt(uint32_t timestamp);
+};
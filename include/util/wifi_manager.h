@@ -17,4 +17,12 @@ public:
 
 private:
   static const int FULL_CONNECT_TIMEOUT_MS = 10000; // 10 seconds
+  static const int FAST_CONNECT_TIMEOUT_MS = 2000;  // Known AP answers in a few hundred ms
+  static const uint8_t FULL_CONNECT_EVERY_N_WAKES = 24; // Re-run DHCP regularly so the cached lease stays ours
+
+  static bool connectFast(const wifi_config_t& saved);
+  static bool connectFull(const wifi_config_t& saved);
+  static bool waitForConnection(int timeoutMs, int pollMs);
+  static void saveFastConnect(const wifi_config_t& saved);
+  static void recordConnect(bool fast, uint32_t durationMs);
 };
@@ -0,0 +1,2046 @@
+// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`
+// Run-length compressed icons, drawn with RecordingDisplay::drawCompressedBitmap()
+
+#ifndef __ICONS_COMPRESSED_H__
+#define __ICONS_COMPRESSED_H__
+
+#include "icons.h"
+
+const unsigned char Battery_1_24x24_rle[] PROGMEM = {
+  0xf8, 0x5f, 0x00, 0x8f, 0x02, 0x72, 0xd2, 0x72, 0xd2, 0x72, 0xe2, 0x62,
+  0xe2, 0x62, 0xe2, 0x62, 0xe2, 0x62, 0xd2, 0x72, 0xd2, 0x7f, 0x02, 0x8f,
+  0x00, 0xf8, 0x60,
+};
+const unsigned char Battery_2_24x24_rle[] PROGMEM = {
+  0xf8, 0x5f, 0x00, 0x8f, 0x02, 0x72, 0xd2, 0x72, 0x12, 0xa2, 0x72, 0x12,
+  0xb2, 0x62, 0x12, 0xb2, 0x62, 0x12, 0xb2, 0x62, 0x12, 0xb2, 0x62, 0x12,
+  0xa2, 0x72, 0xd2, 0x7f, 0x02, 0x8f, 0x00, 0xf8, 0x60,
+};
+const unsigned char Battery_3_24x24_rle[] PROGMEM = {
+  0xf8, 0x5f, 0x00, 0x8f, 0x02, 0x72, 0xd2, 0x72, 0x12, 0x12, 0x72, 0x72,
+  0x12, 0x12, 0x82, 0x62, 0x12, 0x12, 0x82, 0x62, 0x12, 0x12, 0x82, 0x62,
+  0x12, 0x12, 0x82, 0x62, 0x12, 0x12, 0x72, 0x72, 0xd2, 0x7f, 0x02, 0x8f,
+  0x00, 0xf8, 0x60,
+};
+const unsigned char Battery_4_24x24_rle[] PROGMEM = {
+  0xf8, 0x5f, 0x00, 0x8f, 0x02, 0x72, 0xd2, 0x72, 0x12, 0x12, 0x12, 0x42,
+  0x72, 0x12, 0x12, 0x12, 0x52, 0x62, 0x12, 0x12, 0x12, 0x52, 0x62, 0x12,
+  0x12, 0x12, 0x52, 0x62, 0x12, 0x12, 0x12, 0x52, 0x62, 0x12, 0x12, 0x12,
+  0x42, 0x72, 0xd2, 0x7f, 0x02, 0x8f, 0x00, 0xf8, 0x60,
+};
+const unsigned char Battery_5_24x24_rle[] PROGMEM = {
+  0xf8, 0x5f, 0x00, 0x8f, 0x02, 0x72, 0xd2, 0x72, 0x12, 0x12, 0x12, 0x12,
+  0x12, 0x72, 0x12, 0x12, 0x12, 0x12, 0x22, 0x62, 0x12, 0x12, 0x12, 0x12,
+  0x22, 0x62, 0x12, 0x12, 0x12, 0x12, 0x22, 0x62, 0x12, 0x12, 0x12, 0x12,
+  0x22, 0x62, 0x12, 0x12, 0x12, 0x12, 0x12, 0x72, 0xd2, 0x7f, 0x02, 0x8f,
+  0x00, 0xf8, 0x60,
+};
+const unsigned char refresh_24x24_rle[] PROGMEM = {
+  0xf4, 0x26, 0xc2, 0x2a, 0xa2, 0x13, 0x63, 0x95, 0x83, 0x84, 0xa3, 0x76,
+  0x92, 0x76, 0xa2, 0xf0, 0x72, 0xf0, 0x72, 0x62, 0xf0, 0x72, 0xf0, 0x72,
+  0xa6, 0x72, 0x96, 0x73, 0xa4, 0x83, 0x85, 0x94, 0x53, 0x12, 0xaa, 0x22,
+  0xc6, 0xf4, 0x20,
+};
+const unsigned char wi_0_day_sunny_24x24_rle[] PROGMEM = {
+  0xf5, 0xc2, 0xf0, 0x72, 0xf0, 0x22, 0x82, 0xd1, 0x81, 0xf0, 0x16, 0xf0,
+  0x22, 0x41, 0xf0, 0x22, 0x51, 0xc2, 0x21, 0x61, 0x22, 0xc1, 0x61, 0xf0,
+  0x12, 0x42, 0xf0, 0x26, 0xf0, 0x44, 0xf0, 0x12, 0x82, 0xc1, 0xa1, 0xf0,
+  0x22, 0xf0, 0x72, 0xf5, 0xc0,
+};
+const unsigned char wi_1_day_sunny_overcast_24x24_rle[] PROGMEM = {
+  0xf1, 0x51, 0xf0, 0x72, 0xf0, 0x81, 0xf0, 0x12, 0xa2, 0xb2, 0x92, 0xf0,
+  0x04, 0xf0, 0x47, 0xf0, 0x12, 0x51, 0xf0, 0x11, 0x62, 0xa2, 0x22, 0x62,
+  0x22, 0xa4, 0x42, 0xd2, 0x22, 0x32, 0xc2, 0x45, 0xc2, 0x63, 0xd2, 0x72,
+  0x21, 0xa2, 0x72, 0x22, 0xa9, 0x41, 0xc5, 0xf7, 0x50,
+};
+const unsigned char wi_45_day_fog_24x24_rle[] PROGMEM = {
+  0xf1, 0x81, 0xf0, 0x81, 0xf0, 0x21, 0x51, 0x41, 0xd1, 0x82, 0xf0, 0x14,
+  0xf0, 0x07, 0x12, 0xd2, 0x23, 0x32, 0xb1, 0x61, 0x41, 0xa2, 0x62, 0x31,
+  0x23, 0x43, 0x66, 0x82, 0xb3, 0xf2, 0x9f, 0x01, 0x11, 0xf0, 0xdf, 0x00,
+  0x9f, 0x00, 0xf1, 0x5f, 0x01, 0xf5, 0x50,
+};
+const unsigned char wi_51_rain_mix_24x24_rle[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x23, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x42, 0x41, 0x31, 0x82,
+  0xc2, 0x93, 0x11, 0x21, 0x11, 0x13, 0xf0, 0x12, 0xf0, 0x41, 0x51, 0xf0,
+  0x21, 0x21, 0x21, 0xf1, 0xc1, 0xf2, 0xe0,
+};
+const unsigned char wi_56_rain_mix_24x24_rle[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x23, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x42, 0x41, 0x31, 0x82,
+  0xc2, 0x93, 0x11, 0x21, 0x11, 0x13, 0xf0, 0x12, 0xf0, 0x41, 0x51, 0xf0,
+  0x21, 0x21, 0x21, 0xf1, 0xc1, 0xf2, 0xe0,
+};
+const unsigned char wi_61_rain_24x24_rle[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x23, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x42, 0x11, 0x21, 0x31,
+  0x82, 0x31, 0x21, 0x12, 0x22, 0x93, 0x11, 0x12, 0x11, 0x13, 0xd2, 0x12,
+  0x11, 0xf0, 0x21, 0x21, 0x12, 0xf0, 0x51, 0xf0, 0x72, 0xf0, 0x71, 0xf2,
+  0xe0,
+};
+const unsigned char wi_66_rain_mix_24x24_rle[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x23, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x42, 0x41, 0x31, 0x82,
+  0xc2, 0x93, 0x11, 0x21, 0x11, 0x13, 0xf0, 0x12, 0xf0, 0x41, 0x51, 0xf0,
+  0x21, 0x21, 0x21, 0xf1, 0xc1, 0xf2, 0xe0,
+};
+const unsigned char wi_71_snow_wind_24x24_rle[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x23, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0xe1, 0x82, 0x52, 0x52,
+  0x93, 0x11, 0x41, 0x13, 0xf1, 0x91, 0xf0, 0x51, 0x41, 0xf1, 0xd1, 0xf2,
+  0xe0,
+};
+const unsigned char wi_77_day_snow_wind_24x24_rle[] PROGMEM = {
+  0xf1, 0x71, 0xf0, 0x81, 0xf0, 0x21, 0xa1, 0xc2, 0x82, 0xf0, 0x14, 0xf0,
+  0x0a, 0xd2, 0x23, 0x32, 0xb1, 0x61, 0x41, 0xa2, 0x62, 0x31, 0x23, 0x43,
+  0x66, 0x82, 0xb3, 0x72, 0xd2, 0x72, 0xd2, 0x72, 0xd2, 0x11, 0x62, 0x51,
+  0x52, 0xa2, 0x71, 0x12, 0xf1, 0xa1, 0xf0, 0x51, 0x41, 0xf1, 0xd1, 0xf3,
+  0x00,
+};
+const unsigned char wi_81_showers_24x24_rle[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x32, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x42, 0x41, 0x31, 0x82,
+  0x31, 0x51, 0x22, 0x93, 0x83, 0xf0, 0x12, 0xf0, 0x42, 0x32, 0xf0, 0x21,
+  0xf0, 0xa2, 0xf0, 0x71, 0xf2, 0xe0,
+};
+const unsigned char wi_85_snow_wind_24x24_rle[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x23, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0xe1, 0x82, 0x52, 0x52,
+  0x93, 0x11, 0x41, 0x13, 0xf1, 0x91, 0xf0, 0x51, 0x41, 0xf1, 0xd1, 0xf2,
+  0xe0,
+};
+const unsigned char wi_95_thunderstorm_24x24_rle[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x32, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x32, 0x21, 0x21, 0x31,
+  0x82, 0x13, 0x21, 0x12, 0x22, 0x94, 0x22, 0x15, 0xb3, 0x22, 0x11, 0xf0,
+  0x04, 0x11, 0x21, 0xf0, 0x21, 0x21, 0xf0, 0x42, 0x12, 0xf0, 0x41, 0x21,
+  0xf2, 0xe0,
+};
+const unsigned char wi_99_thunderstorm_24x24_rle[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x32, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x32, 0x21, 0x21, 0x31,
+  0x82, 0x13, 0x21, 0x12, 0x22, 0x94, 0x22, 0x15, 0xb3, 0x22, 0x11, 0xf0,
+  0x04, 0x11, 0x21, 0xf0, 0x21, 0x21, 0xf0, 0x42, 0x12, 0xf0, 0x41, 0x21,
+  0xf2, 0xe0,
+};
+const unsigned char wi_cloud_down_24x24_rle[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x32, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0x62, 0x61, 0x81, 0x62, 0x61, 0x81, 0x46, 0x41,
+  0x82, 0x44, 0x42, 0x93, 0x32, 0x33, 0xf9, 0xe0,
+};
+const unsigned char wi_moon_alt_full_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x82, 0xb2, 0xa2, 0xa1, 0xc1, 0x91, 0xe1, 0x81, 0xe1,
+  0x71, 0xf0, 0x11, 0x61, 0xf0, 0x11, 0x61, 0xf0, 0x11, 0x61, 0xf0, 0x11,
+  0x61, 0xf0, 0x11, 0x71, 0xe1, 0x81, 0xe1, 0x91, 0xc2, 0x92, 0xa2, 0xb2,
+  0x82, 0xe3, 0x23, 0xf0, 0x42, 0xf4, 0x40,
+};
+const unsigned char wi_moon_alt_third_quarter_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x46, 0xb2, 0x57, 0xa1, 0x67, 0x91, 0x78, 0x81, 0x78,
+  0x71, 0x89, 0x61, 0x89, 0x61, 0x89, 0x61, 0x89, 0x61, 0x89, 0x71, 0x78,
+  0x81, 0x78, 0x91, 0x67, 0xa2, 0x57, 0xb2, 0x46, 0xe3, 0x14, 0xf0, 0x42,
+  0xf4, 0x40,
+};
+const unsigned char wi_moon_alt_waning_crescent_4_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x37, 0xb2, 0x39, 0xa1, 0x49, 0x91, 0x5a, 0x81, 0x4b,
+  0x71, 0x5c, 0x61, 0x5c, 0x61, 0x5c, 0x61, 0x5c, 0x61, 0x5c, 0x71, 0x4b,
+  0x81, 0x4b, 0x91, 0x49, 0xa2, 0x39, 0xb2, 0x37, 0xe8, 0xf0, 0x42, 0xf4,
+  0x40,
+};
+const unsigned char wi_moon_alt_waning_crescent_5_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x28, 0xb2, 0x2a, 0xa1, 0x3a, 0x91, 0x3c, 0x81, 0x3c,
+  0x71, 0x4d, 0x61, 0x3e, 0x61, 0x3e, 0x61, 0x3e, 0x61, 0x3e, 0x71, 0x3c,
+  0x81, 0x3c, 0x91, 0x2b, 0xa2, 0x2a, 0xb2, 0x28, 0xe8, 0xf0, 0x42, 0xf4,
+  0x40,
+};
+const unsigned char wi_moon_alt_waning_crescent_6_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x28, 0xb2, 0x2a, 0xa1, 0x2b, 0x91, 0x2d, 0x81, 0x2d,
+  0x71, 0x3e, 0x61, 0x3e, 0x61, 0x2f, 0x00, 0x61, 0x3e, 0x61, 0x3e, 0x71,
+  0x2d, 0x81, 0x2d, 0x91, 0x2b, 0xa2, 0x1b, 0xb2, 0x19, 0xe8, 0xf0, 0x42,
+  0xf4, 0x40,
+};
+const unsigned char wi_moon_alt_waning_gibbous_1_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xf0, 0x01, 0x73, 0xb2, 0x93, 0xa1, 0xa3, 0x91, 0xc3, 0x81,
+  0xc3, 0x71, 0xe3, 0x61, 0xe3, 0x61, 0xe3, 0x61, 0xe3, 0x61, 0xe3, 0x71,
+  0xd3, 0x71, 0xc3, 0x91, 0xb3, 0x92, 0x93, 0xb2, 0x73, 0xe3, 0x23, 0xf0,
+  0x42, 0xf4, 0x40,
+};
+const unsigned char wi_moon_alt_waning_gibbous_2_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x64, 0xb2, 0x84, 0xa1, 0x94, 0x91, 0xb4, 0x81, 0xb4,
+  0x71, 0xc5, 0x61, 0xd4, 0x61, 0xd4, 0x61, 0xd4, 0x61, 0xd4, 0x71, 0xb4,
+  0x81, 0xb4, 0x91, 0xa3, 0xa2, 0x84, 0xb2, 0x64, 0xe3, 0x23, 0xf0, 0x42,
+  0xf4, 0x40,
+};
+const unsigned char wi_moon_alt_waning_gibbous_3_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x55, 0xb2, 0x75, 0xa1, 0x94, 0x91, 0xa5, 0x81, 0xa5,
+  0x71, 0xb6, 0x61, 0xc5, 0x61, 0xc5, 0x61, 0xc5, 0x61, 0xc5, 0x71, 0xa5,
+  0x81, 0xa5, 0x91, 0x94, 0xa2, 0x75, 0xb2, 0x64, 0xe3, 0x23, 0xf0, 0x42,
+  0xf4, 0x40,
+};
+const unsigned char wi_moon_alt_waning_gibbous_4_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x55, 0xb2, 0x66, 0xa1, 0x85, 0x91, 0x96, 0x81, 0x96,
+  0x71, 0xb6, 0x61, 0xb6, 0x61, 0xb6, 0x61, 0xb6, 0x61, 0xb6, 0x71, 0x96,
+  0x81, 0x96, 0x91, 0x85, 0xa2, 0x75, 0xb2, 0x55, 0xe3, 0x14, 0xf0, 0x42,
+  0xf4, 0x40,
+};
+const unsigned char wi_moon_alt_waning_gibbous_5_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x55, 0xb2, 0x66, 0xa1, 0x76, 0x91, 0x96, 0x81, 0x96,
+  0x71, 0xa7, 0x61, 0xa7, 0x61, 0xa7, 0x61, 0xa7, 0x61, 0xa7, 0x71, 0x96,
+  0x81, 0x96, 0x91, 0x85, 0xa2, 0x66, 0xb2, 0x55, 0xe3, 0x14, 0xf0, 0x42,
+  0xf4, 0x40,
+};
+const unsigned char wi_moon_alt_waning_gibbous_6_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x46, 0xb2, 0x66, 0xa1, 0x76, 0x91, 0x87, 0x81, 0x87,
+  0x71, 0x98, 0x61, 0x98, 0x61, 0x98, 0x61, 0x98, 0x61, 0x98, 0x71, 0x87,
+  0x81, 0x87, 0x91, 0x76, 0xa2, 0x66, 0xb2, 0x46, 0xe3, 0x14, 0xf0, 0x42,
+  0xf4, 0x40,
+};
+const unsigned char wi_moon_full_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xec, 0xbe, 0xae, 0x9f, 0x01, 0x8f, 0x01, 0x7f, 0x03, 0x6f,
+  0x03, 0x6f, 0x03, 0x6f, 0x03, 0x6f, 0x03, 0x6f, 0x02, 0x8f, 0x01, 0x8f,
+  0x01, 0x9e, 0xbc, 0xe8, 0xf0, 0x42, 0xf4, 0x40,
+};
+const unsigned char wi_strong_wind_24x24_rle[] PROGMEM = {
+  0xfa, 0xb2, 0xf0, 0x73, 0xf0, 0x81, 0x6f, 0x03, 0x6f, 0x02, 0xf1, 0x0d,
+  0xf0, 0x82, 0xf0, 0x81, 0xf0, 0x54, 0xfa, 0x00,
+};
+const unsigned char wi_sunrise_24x24_rle[] PROGMEM = {
+  0xf4, 0x42, 0xf0, 0x72, 0xf0, 0x11, 0x52, 0x51, 0xa2, 0xa2, 0xb2, 0x82,
+  0xf0, 0x06, 0xf0, 0x22, 0x42, 0xf0, 0x11, 0x61, 0xf0, 0x02, 0x62, 0x93,
+  0x22, 0x62, 0x23, 0x92, 0x62, 0xf0, 0x01, 0x22, 0x21, 0xf0, 0x34, 0xf0,
+  0x24, 0x24, 0xfa, 0x00,
+};
+const unsigned char wi_sunset_24x24_rle[] PROGMEM = {
+  0xf4, 0x42, 0xf0, 0x72, 0xf0, 0x11, 0x52, 0x51, 0xa2, 0xa2, 0xb2, 0x82,
+  0xf0, 0x06, 0xf0, 0x23, 0x23, 0xf0, 0x11, 0x61, 0xf0, 0x02, 0x62, 0x94,
+  0x12, 0x62, 0x14, 0x92, 0x62, 0xf0, 0x01, 0x61, 0xf1, 0x84, 0x24, 0xf0,
+  0x16, 0xf0, 0x53, 0xf7, 0x30,
+};
+const unsigned char wi_time_5_24x24_rle[] PROGMEM = {
+  0xf4, 0x18, 0xec, 0xb4, 0x64, 0xa2, 0x42, 0x42, 0x92, 0x52, 0x52, 0x82,
+  0x52, 0x52, 0x72, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x71, 0x62, 0x62, 0x72, 0x52, 0x72, 0x71, 0x42, 0x82, 0xc2, 0x83, 0xa3,
+  0x93, 0x83, 0xb5, 0x25, 0xe8, 0xf0, 0x42, 0xf4, 0x40,
+};
+const unsigned char wifi_24x24_rle[] PROGMEM = {
+  0xf7, 0x26, 0xf0, 0x0c, 0xa5, 0x65, 0x74, 0xa4, 0x62, 0x46, 0x42, 0xaa,
+  0xd3, 0x63, 0xb3, 0x83, 0xf0, 0x04, 0xf0, 0x46, 0xf0, 0x22, 0x42, 0xf1,
+  0xc2, 0xf0, 0x72, 0xf7, 0x40,
+};
+const unsigned char wifi_1_bar_24x24_rle[] PROGMEM = {
+  0xff, 0xf0, 0xf8, 0x62, 0xf0, 0x72, 0xf7, 0x40,
+};
+const unsigned char wifi_2_bar_24x24_rle[] PROGMEM = {
+  0xff, 0xf0, 0xf2, 0x54, 0xf0, 0x46, 0xf0, 0x22, 0x42, 0xf1, 0xc2, 0xf0,
+  0x72, 0xf7, 0x40,
+};
+const unsigned char wifi_3_bar_24x24_rle[] PROGMEM = {
+  0xfd, 0x26, 0xf0, 0x1a, 0xd3, 0x63, 0xb3, 0x83, 0xf0, 0x04, 0xf0, 0x46,
+  0xf0, 0x22, 0x42, 0xf1, 0xc2, 0xf0, 0x72, 0xf7, 0x40,
+};
+const unsigned char wifi_off_24x24_rle[] PROGMEM = {
+  0xf2, 0x32, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x36, 0xd3, 0x19, 0xa5,
+  0x65, 0x77, 0x83, 0x62, 0x33, 0x31, 0x42, 0xa5, 0x14, 0xd7, 0x14, 0xb3,
+  0x33, 0x23, 0xf0, 0x05, 0xf0, 0x37, 0xf0, 0x12, 0x43, 0xf0, 0x73, 0xf0,
+  0x22, 0x33, 0xf0, 0x12, 0x43, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x72, 0xf2,
+  0x30,
+};
+const unsigned char Battery_1_32x32_rle[] PROGMEM = {
+  0xff, 0x7f, 0x03, 0xdf, 0x06, 0xaf, 0x07, 0xa3, 0xf0, 0x23, 0x93, 0xf0,
+  0x23, 0x93, 0xf0, 0x24, 0x83, 0xf0, 0x33, 0x83, 0xf0, 0x33, 0x83, 0xf0,
+  0x33, 0x83, 0xf0, 0x33, 0x83, 0xf0, 0x24, 0x83, 0xf0, 0x23, 0x93, 0xf0,
+  0x23, 0x9f, 0x07, 0xbf, 0x06, 0xcf, 0x03, 0xff, 0x90,
+};
+const unsigned char Battery_2_32x32_rle[] PROGMEM = {
+  0xff, 0x7f, 0x03, 0xdf, 0x06, 0xaf, 0x07, 0xa3, 0xf0, 0x23, 0x93, 0x12,
+  0xe3, 0x93, 0x13, 0xd4, 0x83, 0x13, 0xe3, 0x83, 0x13, 0xe3, 0x83, 0x13,
+  0xe3, 0x83, 0x13, 0xe3, 0x83, 0x13, 0xd4, 0x83, 0x12, 0xe3, 0x93, 0xf0,
+  0x23, 0x9f, 0x07, 0xbf, 0x06, 0xcf, 0x03, 0xff, 0x90,
+};
+const unsigned char Battery_3_32x32_rle[] PROGMEM = {
+  0xff, 0x7f, 0x03, 0xdf, 0x06, 0xaf, 0x07, 0xa3, 0xf0, 0x23, 0x93, 0x12,
+  0x22, 0xa3, 0x93, 0x13, 0x13, 0x94, 0x83, 0x13, 0x13, 0xa3, 0x83, 0x13,
+  0x13, 0xa3, 0x83, 0x13, 0x13, 0xa3, 0x83, 0x13, 0x13, 0xa3, 0x83, 0x13,
+  0x13, 0x94, 0x83, 0x12, 0x22, 0xa3, 0x93, 0xf0, 0x23, 0x9f, 0x07, 0xbf,
+  0x06, 0xcf, 0x03, 0xff, 0x90,
+};
+const unsigned char Battery_4_32x32_rle[] PROGMEM = {
+  0xff, 0x7f, 0x03, 0xdf, 0x06, 0xaf, 0x07, 0xa3, 0xf0, 0x23, 0x93, 0x12,
+  0x22, 0x22, 0x63, 0x93, 0x13, 0x13, 0x13, 0x54, 0x83, 0x13, 0x13, 0x13,
+  0x63, 0x83, 0x13, 0x13, 0x13, 0x63, 0x83, 0x13, 0x13, 0x13, 0x63, 0x83,
+  0x13, 0x13, 0x13, 0x63, 0x83, 0x13, 0x13, 0x13, 0x54, 0x83, 0x12, 0x22,
+  0x22, 0x63, 0x93, 0xf0, 0x23, 0x9f, 0x07, 0xbf, 0x06, 0xcf, 0x03, 0xff,
+  0x90,
+};
+const unsigned char Battery_5_32x32_rle[] PROGMEM = {
+  0xff, 0x7f, 0x03, 0xdf, 0x06, 0xaf, 0x07, 0xa3, 0xf0, 0x23, 0x93, 0x12,
+  0x22, 0x22, 0x22, 0x23, 0x93, 0x13, 0x13, 0x13, 0x13, 0x14, 0x83, 0x13,
+  0x13, 0x13, 0x13, 0x23, 0x83, 0x13, 0x13, 0x13, 0x13, 0x23, 0x83, 0x13,
+  0x13, 0x13, 0x13, 0x23, 0x83, 0x13, 0x13, 0x13, 0x13, 0x23, 0x83, 0x13,
+  0x13, 0x13, 0x13, 0x14, 0x83, 0x12, 0x22, 0x22, 0x22, 0x23, 0x93, 0xf0,
+  0x23, 0x9f, 0x07, 0xbf, 0x06, 0xcf, 0x03, 0xff, 0x90,
+};
+const unsigned char refresh_32x32_rle[] PROGMEM = {
+  0xf7, 0xe6, 0xf0, 0x31, 0x4c, 0xe3, 0x2e, 0xd3, 0x14, 0x84, 0xc6, 0xc3,
+  0xb5, 0xe3, 0xa5, 0xf0, 0x03, 0x98, 0xc3, 0x98, 0xd3, 0xf0, 0xe3, 0xf0,
+  0xe3, 0xf0, 0xf2, 0x82, 0xf0, 0xf3, 0xf0, 0xe3, 0xf0, 0xe3, 0xd8, 0x93,
+  0xc8, 0x93, 0xf0, 0x05, 0xa3, 0xe5, 0xb4, 0xb6, 0xc4, 0x84, 0x13, 0xde,
+  0x23, 0xec, 0x41, 0xf0, 0x36, 0xf7, 0xe0,
+};
+const unsigned char wi_0_day_sunny_32x32_rle[] PROGMEM = {
+  0xfa, 0x02, 0xf0, 0xf2, 0xf0, 0x81, 0x62, 0x61, 0xf0, 0x12, 0xc2, 0xf0,
+  0x22, 0xa2, 0xf0, 0x84, 0xf0, 0xb8, 0xf0, 0x83, 0x43, 0xf0, 0x72, 0x62,
+  0xf0, 0x71, 0x81, 0xf0, 0x14, 0x12, 0x82, 0x14, 0xb2, 0x31, 0x81, 0x32,
+  0xf0, 0x22, 0x62, 0xf0, 0x73, 0x43, 0xf0, 0x88, 0xf0, 0xa6, 0xf0, 0x72,
+  0xa2, 0xf0, 0x22, 0xc2, 0xf0, 0x11, 0x62, 0x61, 0xf0, 0x82, 0xf0, 0xf2,
+  0xf0, 0xf2, 0xfa, 0x00,
+};
+const unsigned char wi_1_day_sunny_overcast_32x32_rle[] PROGMEM = {
+  0xf2, 0x11, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0x72, 0x71, 0x72,
+  0xd3, 0xd3, 0xe3, 0xb3, 0xf0, 0x11, 0x45, 0xf0, 0xa8, 0xf0, 0x83, 0x43,
+  0xf0, 0x72, 0x72, 0xf0, 0x52, 0x82, 0xe3, 0x32, 0x92, 0x23, 0x74, 0x34,
+  0x72, 0x24, 0xc6, 0x53, 0xf0, 0x23, 0x23, 0x42, 0xf0, 0x23, 0x44, 0x13,
+  0xf0, 0x14, 0x56, 0xf0, 0x13, 0x93, 0xf0, 0x22, 0xb2, 0x22, 0xd2, 0xb2,
+  0x23, 0xd2, 0x93, 0x33, 0xcd, 0x51, 0xf0, 0x09, 0xfe, 0x00,
+};
+const unsigned char wi_45_day_fog_32x32_rle[] PROGMEM = {
+  0xf2, 0x51, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0x82, 0x61, 0x61, 0xf0, 0x12,
+  0xc2, 0xf0, 0xe2, 0xf0, 0x85, 0xf0, 0x5d, 0xf0, 0x29, 0x52, 0xf0, 0x03,
+  0x52, 0x62, 0xe2, 0x72, 0x52, 0x32, 0x82, 0x92, 0x42, 0x24, 0x63, 0x95,
+  0x12, 0xa4, 0xa7, 0xb2, 0xf0, 0x13, 0xb1, 0xf0, 0x32, 0xf1, 0xcf, 0x05,
+  0x22, 0x7f, 0x07, 0x12, 0xf1, 0x01, 0xf1, 0x5f, 0x07, 0xf4, 0x0f, 0x07,
+  0xbf, 0x05, 0xf9, 0x70,
+};
+const unsigned char wi_51_rain_mix_32x32_rle[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x61, 0x61, 0x42, 0xa2, 0x52, 0x52, 0x42, 0xb2,
+  0x42, 0x61, 0x32, 0xc4, 0xc4, 0xd3, 0x21, 0x22, 0x21, 0x23, 0xf0, 0x72,
+  0xf0, 0xb1, 0x62, 0xf0, 0x82, 0x12, 0x22, 0xf2, 0xb1, 0xf1, 0x01, 0xf1,
+  0x01, 0xf4, 0x20,
+};
+const unsigned char wi_56_rain_mix_32x32_rle[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x61, 0x61, 0x42, 0xa2, 0x52, 0x52, 0x42, 0xb2,
+  0x42, 0x61, 0x32, 0xc4, 0xc4, 0xd3, 0x21, 0x22, 0x21, 0x23, 0xf0, 0x72,
+  0xf0, 0xb1, 0x62, 0xf0, 0x82, 0x12, 0x22, 0xf2, 0xb1, 0xf1, 0x01, 0xf1,
+  0x01, 0xf4, 0x20,
+};
+const unsigned char wi_61_rain_32x32_rle[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x61, 0x21, 0x31, 0x42, 0xa2, 0x52, 0x22, 0x12,
+  0x42, 0xb2, 0x42, 0x21, 0x22, 0x32, 0xc4, 0x22, 0x12, 0x22, 0x14, 0xd3,
+  0x12, 0x22, 0x21, 0x23, 0xf0, 0x32, 0x22, 0x12, 0xf0, 0x82, 0x12, 0x22,
+  0xf0, 0x81, 0x22, 0x22, 0xf0, 0xb2, 0xf0, 0xf2, 0xf0, 0xe2, 0xf6, 0x20,
+};
+const unsigned char wi_66_rain_mix_32x32_rle[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x61, 0x61, 0x42, 0xa2, 0x52, 0x52, 0x42, 0xb2,
+  0x42, 0x61, 0x32, 0xc4, 0xc4, 0xd3, 0x21, 0x22, 0x21, 0x23, 0xf0, 0x72,
+  0xf0, 0xb1, 0x62, 0xf0, 0x82, 0x12, 0x22, 0xf2, 0xb1, 0xf1, 0x01, 0xf1,
+  0x01, 0xf4, 0x20,
+};
+const unsigned char wi_71_snow_wind_32x32_rle[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0xf0, 0x32, 0xa2, 0xf0, 0x32, 0xb2, 0x72, 0x72,
+  0xc4, 0xc4, 0xd3, 0x21, 0x61, 0x23, 0xf2, 0x71, 0xf2, 0xc1, 0x61, 0xf2,
+  0xc1, 0xf6, 0x20,
+};
+const unsigned char wi_77_day_snow_wind_32x32_rle[] PROGMEM = {
+  0xf2, 0x32, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0x81, 0x62, 0x61, 0xf0, 0x12,
+  0xc2, 0xf0, 0xe2, 0xf0, 0x76, 0xf0, 0x45, 0x18, 0xf0, 0x29, 0x43, 0xf0,
+  0x02, 0x53, 0x52, 0xe2, 0x82, 0x51, 0x32, 0x92, 0x82, 0x52, 0x14, 0x64,
+  0x85, 0x12, 0xb4, 0xa7, 0xa3, 0xf0, 0x13, 0xa2, 0xf0, 0x32, 0xa2, 0xf0,
+  0x32, 0xa2, 0xf0, 0x32, 0x11, 0x82, 0xf0, 0x32, 0x12, 0x73, 0x72, 0x72,
+  0x31, 0x84, 0xc3, 0xe3, 0x21, 0x52, 0x13, 0xf2, 0x72, 0xf0, 0xc1, 0xf1,
+  0x01, 0x61, 0xf2, 0xc1, 0xf6, 0x50,
+};
+const unsigned char wi_81_showers_32x32_rle[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x61, 0x61, 0x42, 0xa2, 0x52, 0x61, 0x42, 0xb2,
+  0x42, 0x52, 0x32, 0xc4, 0xc4, 0xd3, 0x52, 0x53, 0xf0, 0x31, 0x32, 0xf0,
+  0xb2, 0x52, 0xf0, 0x81, 0x62, 0xf2, 0xb1, 0xf0, 0xf2, 0xf6, 0x20,
+};
+const unsigned char wi_85_snow_wind_32x32_rle[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0xf0, 0x32, 0xa2, 0xf0, 0x32, 0xb2, 0x72, 0x72,
+  0xc4, 0xc4, 0xd3, 0x21, 0x61, 0x23, 0xf2, 0x71, 0xf2, 0xc1, 0x61, 0xf2,
+  0xc1, 0xf6, 0x20,
+};
+const unsigned char wi_95_thunderstorm_32x32_rle[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x43, 0x21, 0x31, 0x42, 0xa2, 0x33, 0x32, 0x12,
+  0x42, 0xb2, 0x23, 0x31, 0x22, 0x32, 0xc6, 0x32, 0x22, 0x14, 0xd5, 0x32,
+  0x22, 0x13, 0xf0, 0x14, 0x22, 0x12, 0xf0, 0x55, 0x21, 0x22, 0xf0, 0x73,
+  0x12, 0x22, 0xf0, 0x72, 0x22, 0xf0, 0xb1, 0x32, 0xf0, 0xb1, 0x31, 0xf6,
+  0x20,
+};
+const unsigned char wi_99_thunderstorm_32x32_rle[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x43, 0x21, 0x31, 0x42, 0xa2, 0x33, 0x32, 0x12,
+  0x42, 0xb2, 0x23, 0x31, 0x22, 0x32, 0xc6, 0x32, 0x22, 0x14, 0xd5, 0x32,
+  0x22, 0x13, 0xf0, 0x14, 0x22, 0x12, 0xf0, 0x55, 0x21, 0x22, 0xf0, 0x73,
+  0x12, 0x22, 0xf0, 0x72, 0x22, 0xf0, 0xb1, 0x32, 0xf0, 0xb1, 0x31, 0xf6,
+  0x20,
+};
+const unsigned char wi_cloud_down_32x32_rle[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x63, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0x72, 0x72, 0xb2, 0x82, 0x82,
+  0xa2, 0x82, 0x82, 0xa2, 0x82, 0x82, 0xa2, 0x52, 0x12, 0x12, 0x52, 0xb2,
+  0x56, 0x52, 0xc4, 0x44, 0x44, 0xd3, 0x52, 0x53, 0xff, 0xf0, 0xf0, 0xa0,
+};
+const unsigned char wi_moon_alt_full_32x32_rle[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x83, 0xf0, 0x22, 0xc2, 0xf0, 0x02,
+  0xe2, 0xd2, 0xf0, 0x12, 0xc1, 0xf0, 0x31, 0xb2, 0xf0, 0x41, 0xa1, 0xf0,
+  0x51, 0x92, 0xf0, 0x52, 0x81, 0xf0, 0x71, 0x81, 0xf0, 0x71, 0x81, 0xf0,
+  0x71, 0x81, 0xf0, 0x71, 0x82, 0xf0, 0x61, 0x82, 0xf0, 0x52, 0x91, 0xf0,
+  0x51, 0xa2, 0xf0, 0x32, 0xb1, 0xf0, 0x31, 0xc2, 0xf0, 0x12, 0xd2, 0xe2,
+  0xf0, 0x02, 0xc2, 0xf0, 0x33, 0x72, 0xf0, 0x6a, 0xf9, 0xc0,
+};
+const unsigned char wi_moon_alt_third_quarter_32x32_rle[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x47, 0xf0, 0x22, 0x68, 0xf0, 0x02,
+  0x79, 0xd2, 0x8a, 0xc1, 0x9a, 0xb2, 0x9b, 0xa1, 0xab, 0x92, 0xac, 0x81,
+  0xbc, 0x81, 0xbc, 0x81, 0xbc, 0x81, 0xbc, 0x82, 0xac, 0x82, 0xac, 0x91,
+  0xab, 0xa2, 0x9b, 0xb1, 0x9a, 0xc2, 0x8a, 0xd2, 0x79, 0xf0, 0x02, 0x68,
+  0xf0, 0x33, 0x36, 0xf0, 0x69, 0xf9, 0xd0,
+};
+const unsigned char wi_moon_alt_waning_crescent_4_32x32_rle[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x38, 0xf0, 0x22, 0x4a, 0xf0, 0x02,
+  0x5b, 0xd2, 0x5d, 0xc1, 0x6d, 0xb1, 0x7e, 0xa1, 0x6f, 0x00, 0x92, 0x6f,
+  0x01, 0x81, 0x7f, 0x01, 0x81, 0x7f, 0x01, 0x81, 0x7f, 0x01, 0x81, 0x7f,
+  0x01, 0x81, 0x7f, 0x01, 0x82, 0x6f, 0x01, 0x91, 0x6f, 0x00, 0xa2, 0x5f,
+  0x00, 0xb1, 0x6d, 0xc2, 0x5d, 0xd2, 0x5b, 0xf0, 0x02, 0x4a, 0xf0, 0x32,
+  0x37, 0xf0, 0x69, 0xf9, 0xd0,
+};
+const unsigned char wi_moon_alt_waning_crescent_5_32x32_rle[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x29, 0xf0, 0x22, 0x3b, 0xf0, 0x02,
+  0x3d, 0xd2, 0x4e, 0xc1, 0x4f, 0x00, 0xb2, 0x4f, 0x01, 0xa1, 0x4f, 0x02,
+  0x92, 0x4f, 0x03, 0x81, 0x5f, 0x03, 0x81, 0x5f, 0x03, 0x81, 0x5f, 0x03,
+  0x81, 0x5f, 0x03, 0x82, 0x4f, 0x03, 0x82, 0x4f, 0x03, 0x91, 0x4f, 0x02,
+  0xa2, 0x3f, 0x02, 0xb1, 0x4f, 0x00, 0xc2, 0x3f, 0x00, 0xd2, 0x3d, 0xf0,
+  0x02, 0x3b, 0xf0, 0x32, 0x28, 0xf0, 0x69, 0xf9, 0xd0,
+};
+const unsigned char wi_moon_alt_waning_crescent_6_32x32_rle[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x1a, 0xf0, 0x22, 0x2c, 0xf0, 0x02,
+  0x2e, 0xd2, 0x3f, 0x00, 0xc1, 0x3f, 0x01, 0xb1, 0x4f, 0x02, 0xa1, 0x3f,
+  0x03, 0x92, 0x3f, 0x04, 0x81, 0x4f, 0x04, 0x81, 0x4f, 0x04, 0x81, 0x4f,
+  0x04, 0x81, 0x4f, 0x04, 0x81, 0x4f, 0x04, 0x82, 0x3f, 0x04, 0x91, 0x3f,
+  0x03, 0xa2, 0x2f, 0x03, 0xb1, 0x3f, 0x01, 0xc2, 0x2f, 0x01, 0xd2, 0x2e,
+  0xf0, 0x02, 0x2c, 0xf0, 0x3c, 0xf0, 0x69, 0xf9, 0xd0,
+};
+const unsigned char wi_moon_alt_waning_gibbous_1_32x32_rle[] PROGMEM = {
+  0xf5, 0xf4, 0xf0, 0xaa, 0xf0, 0x53, 0x74, 0xf0, 0x22, 0xa4, 0xf0, 0x02,
+  0xc4, 0xd2, 0xe4, 0xc1, 0xf0, 0x04, 0xb2, 0xf0, 0x14, 0xa1, 0xf0, 0x24,
+  0x92, 0xf0, 0x25, 0x81, 0xf0, 0x44, 0x81, 0xf0, 0x44, 0x81, 0xf0, 0x44,
+  0x81, 0xf0, 0x44, 0x82, 0xf0, 0x34, 0x82, 0xf0, 0x34, 0x91, 0xf0, 0x24,
+  0xa2, 0xf0, 0x14, 0xb1, 0xf0, 0x13, 0xc2, 0xe4, 0xd2, 0xc4, 0xf0, 0x02,
+  0xa4, 0xf0, 0x33, 0x63, 0xf0, 0x6a, 0xf9, 0xc0,
+};
+const unsigned char wi_moon_alt_waning_gibbous_2_32x32_rle[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x65, 0xf0, 0x22, 0x95, 0xf0, 0x02,
+  0xb5, 0xd2, 0xc6, 0xc1, 0xe5, 0xb2, 0xe6, 0xa1, 0xf0, 0x15, 0x92, 0xf0,
+  0x16, 0x81, 0xf0, 0x26, 0x81, 0xf0, 0x26, 0x81, 0xf0, 0x26, 0x81, 0xf0,
+  0x26, 0x82, 0xf0, 0x16, 0x82, 0xf0, 0x16, 0x91, 0xf0, 0x15, 0xa2, 0xe6,
+  0xb1, 0xe5, 0xc2, 0xd5, 0xd2, 0xb5, 0xf0, 0x02, 0x95, 0xf0, 0x33, 0x54,
+  0xf0, 0x69, 0xf9, 0xd0,
+};
+const unsigned char wi_moon_alt_waning_gibbous_3_32x32_rle[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x56, 0xf0, 0x22, 0x86, 0xf0, 0x02,
+  0xa6, 0xd2, 0xb7, 0xc1, 0xd6, 0xb2, 0xd7, 0xa1, 0xe7, 0x92, 0xf0, 0x07,
+  0x81, 0xf0, 0x17, 0x81, 0xf0, 0x17, 0x81, 0xf0, 0x17, 0x81, 0xf0, 0x17,
+  0x82, 0xf0, 0x07, 0x82, 0xf0, 0x07, 0x91, 0xe7, 0xa2, 0xd7, 0xb1, 0xd6,
+  0xc2, 0xc6, 0xd2, 0xa6, 0xf0, 0x02, 0x86, 0xf0, 0x33, 0x45, 0xf0, 0x69,
+  0xf9, 0xd0,
+};
+const unsigned char wi_moon_alt_waning_gibbous_4_32x32_rle[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x56, 0xf0, 0x22, 0x77, 0xf0, 0x02,
+  0x97, 0xd2, 0xa8, 0xc1, 0xc7, 0xb2, 0xc8, 0xa1, 0xd8, 0x92, 0xd9, 0x81,
+  0xe9, 0x81, 0xe9, 0x81, 0xf0, 0x08, 0x81, 0xe9, 0x82, 0xd9, 0x82, 0xd9,
+  0x91, 0xd8, 0xa2, 0xc8, 0xb1, 0xc7, 0xc2, 0xb7, 0xd2, 0x97, 0xf0, 0x02,
+  0x86, 0xf0, 0x33, 0x45, 0xf0, 0x69, 0xf9, 0xd0,
+};
+const unsigned char wi_moon_alt_waning_gibbous_5_32x32_rle[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x56, 0xf0, 0x22, 0x77, 0xf0, 0x02,
+  0x97, 0xd2, 0xa8, 0xc1, 0xb8, 0xb2, 0xb9, 0xa1, 0xc9, 0x92, 0xd9, 0x81,
+  0xe9, 0x81, 0xe9, 0x81, 0xe9, 0x81, 0xe9, 0x82, 0xd9, 0x82, 0xd9, 0x91,
+  0xd8, 0xa2, 0xb9, 0xb1, 0xb8, 0xc2, 0xa8, 0xd2, 0x97, 0xf0, 0x02, 0x77,
+  0xf0, 0x33, 0x45, 0xf0, 0x69, 0xf9, 0xd0,
+};
+const unsigned char wi_moon_alt_waning_gibbous_6_32x32_rle[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x56, 0xf0, 0x22, 0x77, 0xf0, 0x02,
+  0x88, 0xd2, 0x99, 0xc1, 0xa9, 0xb2, 0xaa, 0xa1, 0xba, 0x92, 0xbb, 0x81,
+  0xcb, 0x81, 0xcb, 0x81, 0xcb, 0x81, 0xcb, 0x82, 0xbb, 0x82, 0xbb, 0x91,
+  0xba, 0xa2, 0xaa, 0xb1, 0xa9, 0xc2, 0x99, 0xd2, 0x88, 0xf0, 0x02, 0x77,
+  0xf0, 0x33, 0x45, 0xf0, 0x69, 0xf9, 0xd0,
+};
+const unsigned char wi_moon_full_32x32_rle[] PROGMEM = {
+  0xf5, 0xf4, 0xf0, 0xaa, 0xf0, 0x5e, 0xf0, 0x2f, 0x01, 0xf0, 0x0f, 0x03,
+  0xdf, 0x05, 0xcf, 0x05, 0xbf, 0x07, 0xaf, 0x07, 0x9f, 0x09, 0x8f, 0x09,
+  0x8f, 0x09, 0x8f, 0x09, 0x8f, 0x09, 0x8f, 0x09, 0x8f, 0x09, 0x9f, 0x07,
+  0xaf, 0x07, 0xbf, 0x05, 0xcf, 0x05, 0xdf, 0x03, 0xf0, 0x0f, 0x01, 0xf0,
+  0x3c, 0xf0, 0x6a, 0xf9, 0xc0,
+};
+const unsigned char wi_strong_wind_32x32_rle[] PROGMEM = {
+  0xff, 0xf0, 0xf3, 0xb4, 0xf0, 0xc5, 0xf1, 0x02, 0xf0, 0xe2, 0x7f, 0x0a,
+  0x8f, 0x07, 0xf1, 0xbf, 0x02, 0xef, 0x04, 0xf1, 0x02, 0xf0, 0xf2, 0xf0,
+  0xc5, 0xf0, 0xc4, 0xff, 0xf0, 0xf0, 0xd0,
+};
+const unsigned char wi_sunrise_32x32_rle[] PROGMEM = {
+  0xf8, 0x02, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0x72, 0x62, 0x62, 0xe3, 0xc3,
+  0xf0, 0x02, 0xc2, 0xf0, 0x21, 0x44, 0x41, 0xf0, 0x68, 0xf0, 0x83, 0x43,
+  0xf0, 0x63, 0x63, 0xf0, 0x52, 0x82, 0xe3, 0x32, 0x82, 0x33, 0x74, 0x32,
+  0x82, 0x34, 0xd2, 0x82, 0xf0, 0x52, 0x32, 0x32, 0xf0, 0x94, 0xf0, 0xc6,
+  0xf0, 0x76, 0x26, 0xf0, 0x35, 0x45, 0xff, 0xf0, 0xf0, 0xc0,
+};
+const unsigned char wi_sunset_32x32_rle[] PROGMEM = {
+  0xf8, 0x02, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0x71, 0x72, 0x71, 0xe2, 0xe2,
+  0xf0, 0x02, 0xc2, 0xf0, 0x21, 0x44, 0x41, 0xf0, 0x68, 0xf0, 0x84, 0x24,
+  0xf0, 0x63, 0x63, 0xf0, 0x52, 0x82, 0xf0, 0x52, 0x82, 0xd5, 0x22, 0x82,
+  0x25, 0x73, 0x32, 0x82, 0x33, 0xe2, 0x82, 0xf4, 0x45, 0x45, 0xf0, 0x36,
+  0x26, 0xf0, 0x76, 0xf0, 0xc4, 0xf0, 0xe2, 0xfc, 0x00,
+};
+const unsigned char wi_time_5_32x32_rle[] PROGMEM = {
+  0xf5, 0xf3, 0xf0, 0xba, 0xf0, 0x5e, 0xf0, 0x25, 0x65, 0xf0, 0x04, 0xa4,
+  0xd4, 0x52, 0x54, 0xc3, 0x62, 0x63, 0xb3, 0x72, 0x73, 0xa3, 0x72, 0x73,
+  0x93, 0x82, 0x83, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83,
+  0x83, 0x92, 0x73, 0x83, 0x92, 0x73, 0x83, 0xa2, 0x63, 0x93, 0x92, 0x53,
+  0xa3, 0xa1, 0x53, 0xb3, 0xe3, 0xc4, 0xc4, 0xd4, 0xa4, 0xf0, 0x06, 0x46,
+  0xf0, 0x3c, 0xf0, 0x6a, 0xf9, 0xc0,
+};
+const unsigned char wifi_32x32_rle[] PROGMEM = {
+  0xfd, 0xca, 0xf0, 0x4f, 0x01, 0xf0, 0x07, 0x47, 0xc5, 0xc5, 0x94, 0xf0,
+  0x14, 0x74, 0x66, 0x64, 0x72, 0x4c, 0x42, 0xde, 0xf0, 0x24, 0x84, 0xf0,
+  0x04, 0xa4, 0xf0, 0x01, 0x62, 0x61, 0xf0, 0x58, 0xf0, 0x8a, 0xf0, 0x73,
+  0x43, 0xf4, 0xb2, 0xf0, 0xf2, 0xfe, 0x00,
+};
+const unsigned char wifi_1_bar_32x32_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xfc, 0x42, 0xf0, 0xf2, 0xfe, 0x00,
+};
+const unsigned char wifi_2_bar_32x32_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf0, 0x42, 0xf0, 0xc8, 0xf0, 0x8a, 0xf0, 0x73,
+  0x43, 0xf4, 0xb2, 0xf0, 0xf2, 0xfe, 0x00,
+};
+const unsigned char wifi_3_bar_32x32_rle[] PROGMEM = {
+  0xff, 0xf0, 0xf7, 0x06, 0xf0, 0x8c, 0xf0, 0x4e, 0xf0, 0x24, 0x84, 0xf0,
+  0x04, 0xa4, 0xf0, 0x01, 0x62, 0x61, 0xf0, 0x58, 0xf0, 0x8a, 0xf0, 0x73,
+  0x43, 0xf4, 0xb2, 0xf0, 0xf2, 0xfe, 0x00,
+};
+const unsigned char wifi_off_32x32_rle[] PROGMEM = {
+  0xf5, 0x42, 0xf0, 0xf3, 0xf0, 0xf3, 0xf0, 0xf3, 0xf0, 0xf3, 0x39, 0xf0,
+  0x34, 0x1c, 0xf0, 0x04, 0x77, 0xc7, 0xa5, 0x94, 0x23, 0xb4, 0x74, 0x44,
+  0xa4, 0x72, 0x45, 0x34, 0x42, 0xd7, 0x25, 0xf0, 0x24, 0x23, 0x34, 0xf0,
+  0x03, 0x53, 0x43, 0xf0, 0x01, 0x64, 0x41, 0xf0, 0x58, 0xf0, 0x8a, 0xf0,
+  0x73, 0x44, 0xf0, 0xe4, 0xf0, 0xf3, 0xf0, 0x82, 0x53, 0xf0, 0x72, 0x63,
+  0xf0, 0xf3, 0xf0, 0xf3, 0xf0, 0xf3, 0xf0, 0xf2, 0xf5, 0x40,
+};
+const unsigned char Battery_1_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf1, 0xff, 0x0b, 0xf0, 0x5f, 0x0f, 0xf0, 0x2f,
+  0x11, 0xf0, 0x1f, 0x11, 0xf0, 0x05, 0xf0, 0x95, 0xe4, 0xf0, 0xb4, 0xe4,
+  0xf0, 0xb5, 0xd4, 0xf0, 0xb6, 0xc4, 0xf0, 0xb6, 0xc4, 0xf0, 0xc5, 0xc4,
+  0xf0, 0xd4, 0xc4, 0xf0, 0xd4, 0xc4, 0xf0, 0xd4, 0xc4, 0xf0, 0xd4, 0xc4,
+  0xf0, 0xc5, 0xc4, 0xf0, 0xb6, 0xc4, 0xf0, 0xb6, 0xc4, 0xf0, 0xb5, 0xd4,
+  0xf0, 0xb4, 0xe5, 0xf0, 0x95, 0xf0, 0x0f, 0x11, 0xf0, 0x1f, 0x11, 0xf0,
+  0x2f, 0x0f, 0xf0, 0x5f, 0x0b, 0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x10,
+};
+const unsigned char Battery_2_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf1, 0xff, 0x0b, 0xf0, 0x5f, 0x0f, 0xf0, 0x2f,
+  0x11, 0xf0, 0x1f, 0x11, 0xf0, 0x05, 0xf0, 0x95, 0xe4, 0xf0, 0xb4, 0xe4,
+  0x32, 0xf0, 0x65, 0xd4, 0x24, 0xf0, 0x56, 0xc4, 0x24, 0xf0, 0x56, 0xc4,
+  0x24, 0xf0, 0x65, 0xc4, 0x24, 0xf0, 0x74, 0xc4, 0x24, 0xf0, 0x74, 0xc4,
+  0x24, 0xf0, 0x74, 0xc4, 0x24, 0xf0, 0x74, 0xc4, 0x24, 0xf0, 0x65, 0xc4,
+  0x24, 0xf0, 0x56, 0xc4, 0x24, 0xf0, 0x56, 0xc4, 0x32, 0xf0, 0x65, 0xd4,
+  0xf0, 0xb4, 0xe5, 0xf0, 0x95, 0xf0, 0x0f, 0x11, 0xf0, 0x1f, 0x11, 0xf0,
+  0x2f, 0x0f, 0xf0, 0x5f, 0x0b, 0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x10,
+};
+const unsigned char Battery_3_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf1, 0xff, 0x0b, 0xf0, 0x5f, 0x0f, 0xf0, 0x2f,
+  0x11, 0xf0, 0x1f, 0x11, 0xf0, 0x05, 0xf0, 0x95, 0xe4, 0xf0, 0xb4, 0xe4,
+  0x32, 0x42, 0xf0, 0x05, 0xd4, 0x24, 0x24, 0xe6, 0xc4, 0x24, 0x24, 0xe6,
+  0xc4, 0x24, 0x24, 0xf0, 0x05, 0xc4, 0x24, 0x24, 0xf0, 0x14, 0xc4, 0x24,
+  0x24, 0xf0, 0x14, 0xc4, 0x24, 0x24, 0xf0, 0x14, 0xc4, 0x24, 0x24, 0xf0,
+  0x14, 0xc4, 0x24, 0x24, 0xf0, 0x05, 0xc4, 0x24, 0x24, 0xe6, 0xc4, 0x24,
+  0x24, 0xe6, 0xc4, 0x32, 0x42, 0xf0, 0x05, 0xd4, 0xf0, 0xb4, 0xe5, 0xf0,
+  0x95, 0xf0, 0x0f, 0x11, 0xf0, 0x1f, 0x11, 0xf0, 0x2f, 0x0f, 0xf0, 0x5f,
+  0x0b, 0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x10,
+};
+const unsigned char Battery_4_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf1, 0xff, 0x0b, 0xf0, 0x5f, 0x0f, 0xf0, 0x2f,
+  0x11, 0xf0, 0x1f, 0x11, 0xf0, 0x05, 0xf0, 0x95, 0xe4, 0xf0, 0xb4, 0xe4,
+  0x32, 0x42, 0x42, 0x95, 0xd4, 0x24, 0x24, 0x24, 0x86, 0xc4, 0x24, 0x24,
+  0x24, 0x86, 0xc4, 0x24, 0x24, 0x24, 0x95, 0xc4, 0x24, 0x24, 0x24, 0xa4,
+  0xc4, 0x24, 0x24, 0x24, 0xa4, 0xc4, 0x24, 0x24, 0x24, 0xa4, 0xc4, 0x24,
+  0x24, 0x24, 0xa4, 0xc4, 0x24, 0x24, 0x24, 0x95, 0xc4, 0x24, 0x24, 0x24,
+  0x86, 0xc4, 0x24, 0x24, 0x24, 0x86, 0xc4, 0x32, 0x42, 0x42, 0x95, 0xd4,
+  0xf0, 0xb4, 0xe5, 0xf0, 0x95, 0xf0, 0x0f, 0x11, 0xf0, 0x1f, 0x11, 0xf0,
+  0x2f, 0x0f, 0xf0, 0x5f, 0x0b, 0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x10,
+};
+const unsigned char Battery_5_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf1, 0xff, 0x0b, 0xf0, 0x5f, 0x0f, 0xf0, 0x2f,
+  0x11, 0xf0, 0x1f, 0x11, 0xf0, 0x05, 0xf0, 0x95, 0xe4, 0xf0, 0xb4, 0xe4,
+  0x32, 0x42, 0x42, 0x42, 0x35, 0xd4, 0x24, 0x24, 0x24, 0x24, 0x26, 0xc4,
+  0x24, 0x24, 0x24, 0x24, 0x26, 0xc4, 0x24, 0x24, 0x24, 0x24, 0x35, 0xc4,
+  0x24, 0x24, 0x24, 0x24, 0x44, 0xc4, 0x24, 0x24, 0x24, 0x24, 0x44, 0xc4,
+  0x24, 0x24, 0x24, 0x24, 0x44, 0xc4, 0x24, 0x24, 0x24, 0x24, 0x44, 0xc4,
+  0x24, 0x24, 0x24, 0x24, 0x35, 0xc4, 0x24, 0x24, 0x24, 0x24, 0x26, 0xc4,
+  0x24, 0x24, 0x24, 0x24, 0x26, 0xc4, 0x32, 0x42, 0x42, 0x42, 0x35, 0xd4,
+  0xf0, 0xb4, 0xe5, 0xf0, 0x95, 0xf0, 0x0f, 0x11, 0xf0, 0x1f, 0x11, 0xf0,
+  0x2f, 0x0f, 0xf0, 0x5f, 0x0b, 0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x10,
+};
+const unsigned char refresh_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xf1, 0x78, 0xf1, 0x6e, 0xf0, 0x92, 0x6f, 0x03, 0xf0, 0x64,
+  0x3f, 0x07, 0xf0, 0x44, 0x28, 0x79, 0xf0, 0x34, 0x17, 0xc7, 0xf0, 0x2a,
+  0xf0, 0x16, 0xf0, 0x19, 0xf0, 0x36, 0xf0, 0x08, 0xf0, 0x55, 0xf0, 0x07,
+  0xf0, 0x75, 0xeb, 0xf0, 0x44, 0xec, 0xf0, 0x35, 0xdc, 0xf0, 0x44, 0xea,
+  0xf0, 0x54, 0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0xd4, 0xf1, 0xe2, 0xe2, 0xf1,
+  0xe4, 0xf1, 0xd4, 0xf1, 0xd4, 0xf1, 0xe4, 0xf0, 0x5a, 0xe4, 0xf0, 0x4c,
+  0xd5, 0xf0, 0x3c, 0xe4, 0xf0, 0x4b, 0xe5, 0xf0, 0x77, 0xf0, 0x05, 0xf0,
+  0x58, 0xf0, 0x06, 0xf0, 0x39, 0xf0, 0x16, 0xf0, 0x1a, 0xf0, 0x27, 0xc7,
+  0x14, 0xf0, 0x39, 0x78, 0x24, 0xf0, 0x4f, 0x07, 0x34, 0xf0, 0x6f, 0x03,
+  0x62, 0xf0, 0x9e, 0xf1, 0x68, 0xff, 0xf0, 0xf1, 0x70,
+};
+const unsigned char wi_0_day_sunny_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xf4, 0xa2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0x42,
+  0x92, 0x92, 0xf0, 0x93, 0xf0, 0x33, 0xf0, 0x94, 0xf0, 0x14, 0xf0, 0xa4,
+  0xf0, 0x03, 0xf0, 0xc2, 0x56, 0x52, 0xf1, 0x2a, 0xf1, 0x6c, 0xf1, 0x44,
+  0x64, 0xf1, 0x33, 0x83, 0xf1, 0x23, 0xa3, 0xf1, 0x13, 0xa3, 0xf0, 0x86,
+  0x32, 0xc2, 0x36, 0xe6, 0x32, 0xc2, 0x36, 0xf0, 0x04, 0x42, 0xc2, 0x44,
+  0xf0, 0x93, 0xa3, 0xf1, 0x13, 0xa3, 0xf1, 0x23, 0x83, 0xf1, 0x35, 0x44,
+  0xf1, 0x5c, 0xf1, 0x78, 0xf1, 0x32, 0x64, 0x62, 0xf0, 0xc3, 0xf0, 0x13,
+  0xf0, 0xa4, 0xf0, 0x14, 0xf0, 0x93, 0xf0, 0x33, 0xf0, 0x92, 0x92, 0x92,
+  0xf1, 0x42, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xff, 0xf0, 0xf7, 0xa0,
+};
+const unsigned char wi_1_day_sunny_overcast_48x48_rle[] PROGMEM = {
+  0xf6, 0x83, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0x22,
+  0xa3, 0xa2, 0xf0, 0x54, 0xa1, 0xa4, 0xf0, 0x54, 0xf0, 0x45, 0xf0, 0x55,
+  0xf0, 0x25, 0xf0, 0x74, 0xf0, 0x24, 0xf0, 0x92, 0x67, 0x62, 0xf1, 0x0b,
+  0xf1, 0x5d, 0xf1, 0x35, 0x55, 0xf1, 0x14, 0x94, 0xf1, 0x03, 0xb3, 0xf0,
+  0xf4, 0xb4, 0xf0, 0xe3, 0xd3, 0xf0, 0x45, 0x53, 0xd3, 0x45, 0xa6, 0x45,
+  0xb3, 0x36, 0xa5, 0x48, 0x93, 0x45, 0xf0, 0x3a, 0x83, 0xf0, 0xb5, 0x34,
+  0x64, 0xf0, 0xb4, 0x54, 0x44, 0xf0, 0xb4, 0x75, 0x15, 0xf0, 0x96, 0x7a,
+  0xf0, 0xa5, 0x89, 0xf0, 0xa4, 0xe4, 0xf0, 0xb3, 0xf0, 0x13, 0x42, 0xf0,
+  0x53, 0xf0, 0x13, 0x34, 0xf0, 0x43, 0xf0, 0x13, 0x35, 0xf0, 0x34, 0xe4,
+  0x45, 0xf0, 0x3f, 0x05, 0x64, 0xf0, 0x4f, 0x03, 0x91, 0xf0, 0x6f, 0x01,
+  0xff, 0xf0, 0xff, 0xf0, 0x90,
+};
+const unsigned char wi_45_day_fog_48x48_rle[] PROGMEM = {
+  0xf6, 0xe3, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0x32, 0x93, 0x91,
+  0xf0, 0x93, 0xf0, 0x43, 0xf0, 0x93, 0xf0, 0x23, 0xf0, 0xb1, 0xf0, 0x23,
+  0xf1, 0x45, 0x52, 0xf1, 0x39, 0xf0, 0xf6, 0x2b, 0xf0, 0xcd, 0x54, 0xf0,
+  0x9e, 0x74, 0xf0, 0x84, 0x64, 0x83, 0xf0, 0x73, 0xa3, 0x82, 0xf0, 0x63,
+  0xc3, 0x73, 0x35, 0xc3, 0xc3, 0x73, 0x35, 0xb3, 0xe5, 0x43, 0x35, 0x95,
+  0xe7, 0x23, 0xf0, 0x16, 0xeb, 0xf0, 0x14, 0xf0, 0x76, 0xf0, 0x04, 0xf0,
+  0xa3, 0xf0, 0x13, 0xf0, 0xb3, 0xf6, 0x2f, 0x10, 0x31, 0xcf, 0x11, 0x23,
+  0xbf, 0x11, 0x33, 0xf1, 0xf1, 0xf2, 0x8f, 0x10, 0xf0, 0x2f, 0x11, 0xf0,
+  0x1f, 0x11, 0xf6, 0x8f, 0x10, 0xf0, 0x2f, 0x11, 0xf0, 0x1f, 0x11, 0xff,
+  0xf0, 0xf6, 0xb0,
+};
+const unsigned char wi_51_rain_mix_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x96, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x35,
+  0x64, 0xf1, 0x23, 0xa3, 0xf1, 0x03, 0xb4, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3,
+  0xd6, 0xf0, 0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0,
+  0x24, 0xf0, 0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0,
+  0x03, 0xf0, 0xd3, 0xe3, 0x92, 0x91, 0x73, 0xf0, 0x02, 0x92, 0x83, 0x62,
+  0xf0, 0x13, 0x73, 0x83, 0x53, 0xf0, 0x13, 0x73, 0x83, 0x53, 0xf0, 0x24,
+  0xf0, 0x74, 0xf0, 0x45, 0x31, 0x42, 0x85, 0xf0, 0x64, 0x23, 0x32, 0x33,
+  0x24, 0xf0, 0x92, 0x32, 0x23, 0x32, 0x32, 0xf1, 0x52, 0xf1, 0x91, 0xa1,
+  0xf1, 0x43, 0x31, 0x43, 0xf1, 0x33, 0x23, 0x33, 0xf1, 0x41, 0x42, 0x32,
+  0xf4, 0x92, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xf1, 0xf9, 0xb0,
+};
+const unsigned char wi_56_rain_mix_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x96, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x35,
+  0x64, 0xf1, 0x23, 0xa3, 0xf1, 0x03, 0xb4, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3,
+  0xd6, 0xf0, 0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0,
+  0x24, 0xf0, 0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0,
+  0x03, 0xf0, 0xd3, 0xe3, 0x92, 0x91, 0x73, 0xf0, 0x02, 0x92, 0x83, 0x62,
+  0xf0, 0x13, 0x73, 0x83, 0x53, 0xf0, 0x13, 0x73, 0x83, 0x53, 0xf0, 0x24,
+  0xf0, 0x74, 0xf0, 0x45, 0x31, 0x42, 0x85, 0xf0, 0x64, 0x23, 0x32, 0x33,
+  0x24, 0xf0, 0x92, 0x32, 0x23, 0x32, 0x32, 0xf1, 0x52, 0xf1, 0x91, 0xa1,
+  0xf1, 0x43, 0x31, 0x43, 0xf1, 0x33, 0x23, 0x33, 0xf1, 0x41, 0x42, 0x32,
+  0xf4, 0x92, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xf1, 0xf9, 0xb0,
+};
+const unsigned char wi_61_rain_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x96, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x35,
+  0x64, 0xf1, 0x23, 0xa3, 0xf1, 0x03, 0xb4, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3,
+  0xd6, 0xf0, 0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0,
+  0x24, 0xf0, 0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0,
+  0x03, 0xf0, 0xd3, 0xe3, 0x92, 0x41, 0x41, 0x73, 0xf0, 0x02, 0x92, 0x33,
+  0x23, 0x62, 0xf0, 0x13, 0x73, 0x33, 0x23, 0x53, 0xf0, 0x13, 0x73, 0x23,
+  0x33, 0x53, 0xf0, 0x24, 0x53, 0x23, 0x32, 0x44, 0xf0, 0x45, 0x23, 0x33,
+  0x23, 0x25, 0xf0, 0x64, 0x23, 0x32, 0x33, 0x24, 0xf0, 0x92, 0x23, 0x23,
+  0x32, 0x32, 0xf0, 0xf2, 0x33, 0x23, 0xf1, 0x33, 0x33, 0x23, 0xf1, 0x33,
+  0x23, 0x33, 0xf1, 0x32, 0x33, 0x32, 0xf1, 0x93, 0xf1, 0xe2, 0xf1, 0xe3,
+  0xf1, 0xe3, 0xf1, 0xf1, 0xfc, 0xb0,
+};
+const unsigned char wi_66_rain_mix_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x96, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x35,
+  0x64, 0xf1, 0x23, 0xa3, 0xf1, 0x03, 0xb4, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3,
+  0xd6, 0xf0, 0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0,
+  0x24, 0xf0, 0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0,
+  0x03, 0xf0, 0xd3, 0xe3, 0x92, 0x91, 0x73, 0xf0, 0x02, 0x92, 0x83, 0x62,
+  0xf0, 0x13, 0x73, 0x83, 0x53, 0xf0, 0x13, 0x73, 0x83, 0x53, 0xf0, 0x24,
+  0xf0, 0x74, 0xf0, 0x45, 0x31, 0x42, 0x85, 0xf0, 0x64, 0x23, 0x32, 0x33,
+  0x24, 0xf0, 0x92, 0x32, 0x23, 0x32, 0x32, 0xf1, 0x52, 0xf1, 0x91, 0xa1,
+  0xf1, 0x43, 0x31, 0x43, 0xf1, 0x33, 0x23, 0x33, 0xf1, 0x41, 0x42, 0x32,
+  0xf4, 0x92, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xf1, 0xf9, 0xb0,
+};
+const unsigned char wi_71_snow_wind_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x96, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x34,
+  0x74, 0xf1, 0x23, 0xa3, 0xf1, 0x03, 0xb4, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3,
+  0xd6, 0xf0, 0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0,
+  0x24, 0xf0, 0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0,
+  0x03, 0xf0, 0xd2, 0xf0, 0x03, 0xf0, 0xd3, 0xf0, 0x02, 0xf0, 0xd2, 0xf0,
+  0x13, 0xf0, 0xb3, 0xf0, 0x13, 0xc2, 0xc3, 0xf0, 0x24, 0xa2, 0xa4, 0xf0,
+  0x36, 0x31, 0xa1, 0x35, 0xf0, 0x64, 0x32, 0x82, 0x34, 0xf0, 0x83, 0x32,
+  0x82, 0x32, 0xf1, 0x51, 0xf1, 0xf3, 0xf1, 0xe2, 0xf1, 0xa1, 0x92, 0xf1,
+  0x43, 0x82, 0xf1, 0x51, 0x92, 0xf1, 0x92, 0xf1, 0xf2, 0xf1, 0xf2, 0xfc,
+  0xa0,
+};
+const unsigned char wi_77_day_snow_wind_48x48_rle[] PROGMEM = {
+  0xf6, 0xc3, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0x32, 0x93, 0x91,
+  0xf0, 0x93, 0xf0, 0x43, 0xf0, 0x84, 0xf0, 0x23, 0xf0, 0xa2, 0xf0, 0x23,
+  0xf1, 0x45, 0x52, 0xf1, 0x39, 0xf0, 0xf6, 0x2b, 0xf0, 0xcd, 0x54, 0xf0,
+  0x9e, 0x74, 0xf0, 0x75, 0x64, 0x83, 0xf0, 0x73, 0xa3, 0x83, 0xf0, 0x53,
+  0xc3, 0x73, 0x35, 0xc3, 0xc3, 0x73, 0x35, 0xb3, 0xe5, 0x43, 0x35, 0x95,
+  0xe7, 0x23, 0xf0, 0x16, 0xeb, 0xf0, 0x14, 0xf0, 0x76, 0xf0, 0x04, 0xf0,
+  0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x13, 0xf0, 0xc2, 0xf0, 0x12, 0xf0,
+  0xd3, 0xf0, 0x02, 0xf0, 0xd3, 0x21, 0xc2, 0xf0, 0xd2, 0x23, 0xb3, 0xf0,
+  0xb3, 0x24, 0xa4, 0xb2, 0xc3, 0x33, 0xb4, 0xa2, 0xa4, 0xf0, 0x45, 0x32,
+  0x91, 0x35, 0xf0, 0x64, 0x32, 0x83, 0x24, 0xf0, 0x92, 0x32, 0x82, 0x32,
+  0xf1, 0x51, 0xf1, 0xf3, 0xf1, 0xe2, 0xf1, 0xa2, 0x82, 0xf1, 0x43, 0x82,
+  0xf1, 0x51, 0x91, 0xf1, 0xa2, 0xf1, 0xf2, 0xf1, 0xf2, 0xfc, 0xf0,
+};
+const unsigned char wi_81_showers_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x87, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x34,
+  0x74, 0xf1, 0x23, 0xa3, 0xf1, 0x03, 0xc3, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3,
+  0xd6, 0xf0, 0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0,
+  0x24, 0xf0, 0xa3, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0,
+  0x03, 0xf0, 0xd3, 0xe3, 0x92, 0x91, 0x73, 0xf0, 0x02, 0x92, 0x83, 0x62,
+  0xf0, 0x13, 0x73, 0x83, 0x53, 0xf0, 0x13, 0x73, 0x83, 0x53, 0xf0, 0x24,
+  0x61, 0xa1, 0x44, 0xf0, 0x45, 0x82, 0x85, 0xf0, 0x64, 0x82, 0x84, 0xf0,
+  0x92, 0x73, 0x83, 0xf0, 0xe2, 0x33, 0x32, 0xf1, 0x33, 0x41, 0x33, 0xf1,
+  0x33, 0x83, 0xf1, 0x33, 0x82, 0xf4, 0x92, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1,
+  0xe3, 0xfc, 0xa0,
+};
+const unsigned char wi_85_snow_wind_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x96, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x34,
+  0x74, 0xf1, 0x23, 0xa3, 0xf1, 0x03, 0xb4, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3,
+  0xd6, 0xf0, 0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0,
+  0x24, 0xf0, 0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0,
+  0x03, 0xf0, 0xd2, 0xf0, 0x03, 0xf0, 0xd3, 0xf0, 0x02, 0xf0, 0xd2, 0xf0,
+  0x13, 0xf0, 0xb3, 0xf0, 0x13, 0xc2, 0xc3, 0xf0, 0x24, 0xa2, 0xa4, 0xf0,
+  0x36, 0x31, 0xa1, 0x35, 0xf0, 0x64, 0x32, 0x82, 0x34, 0xf0, 0x83, 0x32,
+  0x82, 0x32, 0xf1, 0x51, 0xf1, 0xf3, 0xf1, 0xe2, 0xf1, 0xa1, 0x92, 0xf1,
+  0x43, 0x82, 0xf1, 0x51, 0x92, 0xf1, 0x92, 0xf1, 0xf2, 0xf1, 0xf2, 0xfc,
+  0xa0,
+};
+const unsigned char wi_95_thunderstorm_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x87, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x34,
+  0x74, 0xf1, 0x23, 0xa3, 0xf1, 0x03, 0xc3, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3,
+  0xd6, 0xf0, 0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0,
+  0x24, 0xf0, 0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0,
+  0x03, 0xf0, 0xd3, 0xe3, 0x65, 0x41, 0x41, 0x73, 0xf0, 0x02, 0x56, 0x33,
+  0x23, 0x62, 0xf0, 0x13, 0x45, 0x43, 0x23, 0x53, 0xf0, 0x14, 0x35, 0x33,
+  0x33, 0x44, 0xf0, 0x24, 0x15, 0x43, 0x32, 0x44, 0xf0, 0x49, 0x43, 0x23,
+  0x25, 0xf0, 0x67, 0x52, 0x33, 0x24, 0xf0, 0x94, 0x53, 0x33, 0x22, 0xf0,
+  0xb8, 0x13, 0x32, 0xf0, 0xf8, 0x23, 0x23, 0xf0, 0xf7, 0x32, 0x33, 0xf1,
+  0x33, 0x23, 0x32, 0xf1, 0x33, 0x33, 0xf1, 0x82, 0x43, 0xf1, 0x82, 0x42,
+  0xf1, 0x91, 0x43, 0xf1, 0x81, 0x62, 0xfc, 0xa0,
+};
+const unsigned char wi_99_thunderstorm_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x87, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x34,
+  0x74, 0xf1, 0x23, 0xa3, 0xf1, 0x03, 0xc3, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3,
+  0xd6, 0xf0, 0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0,
+  0x24, 0xf0, 0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0,
+  0x03, 0xf0, 0xd3, 0xe3, 0x65, 0x41, 0x41, 0x73, 0xf0, 0x02, 0x56, 0x33,
+  0x23, 0x62, 0xf0, 0x13, 0x45, 0x43, 0x23, 0x53, 0xf0, 0x14, 0x35, 0x33,
+  0x33, 0x44, 0xf0, 0x24, 0x15, 0x43, 0x32, 0x44, 0xf0, 0x49, 0x43, 0x23,
+  0x25, 0xf0, 0x67, 0x52, 0x33, 0x24, 0xf0, 0x94, 0x53, 0x33, 0x22, 0xf0,
+  0xb8, 0x13, 0x32, 0xf0, 0xf8, 0x23, 0x23, 0xf0, 0xf7, 0x32, 0x33, 0xf1,
+  0x33, 0x23, 0x32, 0xf1, 0x33, 0x33, 0xf1, 0x82, 0x43, 0xf1, 0x82, 0x42,
+  0xf1, 0x91, 0x43, 0xf1, 0x81, 0x62, 0xfc, 0xa0,
+};
+const unsigned char wi_cloud_down_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x87, 0xf1, 0x8b, 0xf1, 0x5d, 0xf1, 0x34,
+  0x74, 0xf1, 0x23, 0xa3, 0xf1, 0x03, 0xc3, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3,
+  0xd6, 0xf0, 0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0,
+  0x24, 0xb2, 0xb4, 0xf0, 0x13, 0xc2, 0xc3, 0xf0, 0x12, 0xd2, 0xd2, 0xf0,
+  0x03, 0xd2, 0xd3, 0xe3, 0xd2, 0xd3, 0xf0, 0x02, 0x92, 0x22, 0x22, 0x92,
+  0xf0, 0x13, 0x83, 0x12, 0x13, 0x83, 0xf0, 0x13, 0x8a, 0x83, 0xf0, 0x24,
+  0x78, 0x74, 0xf0, 0x45, 0x66, 0x65, 0xf0, 0x64, 0x74, 0x74, 0xf0, 0x92,
+  0x82, 0x82, 0xff, 0xf0, 0xff, 0xf0, 0xf5, 0x20,
+};
+const unsigned char wi_moon_alt_full_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x85, 0xf0, 0xd4, 0xe4, 0xf0, 0xa3,
+  0xf0, 0x33, 0xf0, 0x83, 0xf0, 0x53, 0xf0, 0x63, 0xf0, 0x73, 0xf0, 0x43,
+  0xf0, 0x93, 0xf0, 0x32, 0xf0, 0xb2, 0xf0, 0x22, 0xf0, 0xd2, 0xf0, 0x12,
+  0xf0, 0xd2, 0xf0, 0x02, 0xf0, 0xf2, 0xe2, 0xf0, 0xf2, 0xe2, 0xf0, 0xf2,
+  0xd2, 0xf1, 0x12, 0xc2, 0xf1, 0x12, 0xc2, 0xf1, 0x12, 0xc2, 0xf1, 0x12,
+  0xc2, 0xf1, 0x12, 0xc2, 0xf1, 0x12, 0xc2, 0xf1, 0x12, 0xc2, 0xf1, 0x12,
+  0xd2, 0xf1, 0x01, 0xe2, 0xf0, 0xf2, 0xe2, 0xf0, 0xf2, 0xf0, 0x02, 0xf0,
+  0xd2, 0xf0, 0x12, 0xf0, 0xd2, 0xf0, 0x22, 0xf0, 0xb2, 0xf0, 0x33, 0xf0,
+  0x93, 0xf0, 0x43, 0xf0, 0x73, 0xf0, 0x63, 0xf0, 0x53, 0xf0, 0x83, 0xf0,
+  0x33, 0xf0, 0xa4, 0xe4, 0xf0, 0xd4, 0xa4, 0xf1, 0x1e, 0xf1, 0x5a, 0xff,
+  0xf0, 0xf4, 0x60,
+};
+const unsigned char wi_moon_alt_third_quarter_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x49, 0xf0, 0xd4, 0x7a, 0xf0, 0xb4,
+  0x8c, 0xf0, 0x83, 0xad, 0xf0, 0x63, 0xbe, 0xf0, 0x43, 0xcf, 0x00, 0xf0,
+  0x32, 0xdf, 0x00, 0xf0, 0x22, 0xef, 0x01, 0xf0, 0x12, 0xef, 0x01, 0xf0,
+  0x02, 0xf0, 0x0f, 0x02, 0xe2, 0xf0, 0x0f, 0x02, 0xe2, 0xf0, 0x0f, 0x02,
+  0xd2, 0xf0, 0x1f, 0x03, 0xc2, 0xf0, 0x1f, 0x03, 0xc2, 0xf0, 0x1f, 0x03,
+  0xc2, 0xf0, 0x1f, 0x03, 0xc2, 0xf0, 0x1f, 0x03, 0xc2, 0xf0, 0x1f, 0x03,
+  0xc2, 0xf0, 0x1f, 0x03, 0xc2, 0xf0, 0x1f, 0x03, 0xd2, 0xf0, 0x0f, 0x02,
+  0xe2, 0xf0, 0x0f, 0x02, 0xe2, 0xf0, 0x0f, 0x02, 0xf0, 0x02, 0xef, 0x01,
+  0xf0, 0x12, 0xef, 0x01, 0xf0, 0x22, 0xdf, 0x00, 0xf0, 0x33, 0xcf, 0x00,
+  0xf0, 0x43, 0xbe, 0xf0, 0x63, 0xad, 0xf0, 0x83, 0x9c, 0xf0, 0xa4, 0x7b,
+  0xf0, 0xd4, 0x59, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0xf4, 0x60,
+};
+const unsigned char wi_moon_alt_waning_crescent_4_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x3a, 0xf0, 0xd4, 0x5c, 0xf0, 0xb3,
+  0x7e, 0xf0, 0x83, 0x7f, 0x01, 0xf0, 0x63, 0x7f, 0x03, 0xf0, 0x43, 0x8f,
+  0x04, 0xf0, 0x32, 0x9f, 0x04, 0xf0, 0x22, 0x9f, 0x06, 0xf0, 0x12, 0x9f,
+  0x06, 0xf0, 0x02, 0xaf, 0x07, 0xe2, 0x9f, 0x08, 0xe2, 0x9f, 0x08, 0xd2,
+  0xaf, 0x09, 0xc2, 0xaf, 0x09, 0xc2, 0xaf, 0x09, 0xc2, 0xaf, 0x09, 0xc2,
+  0xaf, 0x09, 0xc2, 0xaf, 0x09, 0xc2, 0xaf, 0x09, 0xc2, 0xaf, 0x09, 0xd2,
+  0x9f, 0x08, 0xe2, 0x9f, 0x08, 0xe2, 0x9f, 0x08, 0xf0, 0x02, 0x9f, 0x06,
+  0xf0, 0x12, 0x9f, 0x06, 0xf0, 0x22, 0x8f, 0x05, 0xf0, 0x33, 0x7f, 0x05,
+  0xf0, 0x43, 0x7f, 0x03, 0xf0, 0x63, 0x6f, 0x02, 0xf0, 0x83, 0x6f, 0x00,
+  0xf0, 0xa4, 0x5d, 0xf0, 0xd4, 0x4a, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0,
+  0xf4, 0x60,
+};
+const unsigned char wi_moon_alt_waning_crescent_5_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x2b, 0xf0, 0xd4, 0x4d, 0xf0, 0xb4,
+  0x4f, 0x01, 0xf0, 0x83, 0x5f, 0x03, 0xf0, 0x63, 0x5f, 0x05, 0xf0, 0x43,
+  0x5f, 0x07, 0xf0, 0x32, 0x6f, 0x07, 0xf0, 0x22, 0x6f, 0x09, 0xf0, 0x12,
+  0x6f, 0x09, 0xf0, 0x02, 0x7f, 0x0a, 0xe2, 0x6f, 0x0b, 0xe2, 0x6f, 0x0b,
+  0xd2, 0x7f, 0x0c, 0xc2, 0x7f, 0x0c, 0xc2, 0x7f, 0x0c, 0xc2, 0x7f, 0x0c,
+  0xc2, 0x7f, 0x0c, 0xc2, 0x7f, 0x0c, 0xc2, 0x7f, 0x0c, 0xc2, 0x7f, 0x0c,
+  0xd2, 0x6f, 0x0b, 0xe2, 0x6f, 0x0b, 0xe2, 0x6f, 0x0b, 0xf0, 0x02, 0x6f,
+  0x09, 0xf0, 0x12, 0x6f, 0x09, 0xf0, 0x22, 0x5f, 0x08, 0xf0, 0x33, 0x5f,
+  0x07, 0xf0, 0x43, 0x4f, 0x06, 0xf0, 0x63, 0x4f, 0x04, 0xf0, 0x83, 0x4f,
+  0x02, 0xf0, 0xa4, 0x3f, 0x00, 0xf0, 0xd4, 0x2c, 0xf1, 0x1e, 0xf1, 0x5a,
+  0xff, 0xf0, 0xf4, 0x60,
+};
+const unsigned char wi_moon_alt_waning_crescent_6_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x1c, 0xf0, 0xd4, 0x3e, 0xf0, 0xb3,
+  0x4f, 0x02, 0xf0, 0x83, 0x4f, 0x04, 0xf0, 0x63, 0x4f, 0x06, 0xf0, 0x43,
+  0x4f, 0x08, 0xf0, 0x32, 0x5f, 0x08, 0xf0, 0x22, 0x5f, 0x0a, 0xf0, 0x12,
+  0x5f, 0x0a, 0xf0, 0x02, 0x5f, 0x0c, 0xe2, 0x5f, 0x0c, 0xe2, 0x5f, 0x0c,
+  0xd2, 0x5f, 0x0e, 0xc2, 0x5f, 0x0e, 0xc2, 0x5f, 0x0e, 0xc2, 0x5f, 0x0e,
+  0xc2, 0x5f, 0x0e, 0xc2, 0x5f, 0x0e, 0xc2, 0x5f, 0x0e, 0xc2, 0x5f, 0x0e,
+  0xd2, 0x4f, 0x0d, 0xe2, 0x5f, 0x0c, 0xe2, 0x5f, 0x0c, 0xf0, 0x02, 0x4f,
+  0x0b, 0xf0, 0x12, 0x4f, 0x0b, 0xf0, 0x22, 0x4f, 0x09, 0xf0, 0x33, 0x3f,
+  0x09, 0xf0, 0x43, 0x3f, 0x07, 0xf0, 0x63, 0x3f, 0x05, 0xf0, 0x83, 0x3f,
+  0x03, 0xf0, 0xa4, 0x2f, 0x01, 0xf0, 0xd4, 0x1d, 0xf1, 0x1e, 0xf1, 0x5a,
+  0xff, 0xf0, 0xf4, 0x60,
+};
+const unsigned char wi_moon_alt_waning_gibbous_1_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x76, 0xf0, 0xd4, 0xc6, 0xf0, 0xa4,
+  0xe6, 0xf0, 0x83, 0xf0, 0x26, 0xf0, 0x63, 0xf0, 0x46, 0xf0, 0x43, 0xf0,
+  0x66, 0xf0, 0x32, 0xf0, 0x76, 0xf0, 0x22, 0xf0, 0x96, 0xf0, 0x12, 0xf0,
+  0x96, 0xf0, 0x02, 0xf0, 0xb6, 0xe2, 0xf0, 0xb6, 0xe2, 0xf0, 0xb6, 0xd2,
+  0xf0, 0xc7, 0xc2, 0xf0, 0xd6, 0xc2, 0xf0, 0xd6, 0xc2, 0xf0, 0xd6, 0xc2,
+  0xf0, 0xd6, 0xc2, 0xf0, 0xd6, 0xc2, 0xf0, 0xd6, 0xc2, 0xf0, 0xd6, 0xd2,
+  0xf0, 0xb6, 0xe2, 0xf0, 0xb6, 0xe2, 0xf0, 0xb6, 0xf0, 0x02, 0xf0, 0xa5,
+  0xf0, 0x12, 0xf0, 0x96, 0xf0, 0x22, 0xf0, 0x85, 0xf0, 0x33, 0xf0, 0x66,
+  0xf0, 0x43, 0xf0, 0x55, 0xf0, 0x63, 0xf0, 0x35, 0xf0, 0x83, 0xf0, 0x15,
+  0xf0, 0xa4, 0xd5, 0xf0, 0xd4, 0x95, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0,
+  0xf4, 0x60,
+};
+const unsigned char wi_moon_alt_waning_gibbous_2_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x67, 0xf0, 0xd4, 0xa7, 0xf0, 0xb4,
+  0xc8, 0xf0, 0x83, 0xf0, 0x08, 0xf0, 0x63, 0xf0, 0x28, 0xf0, 0x43, 0xf0,
+  0x39, 0xf0, 0x32, 0xf0, 0x58, 0xf0, 0x22, 0xf0, 0x78, 0xf0, 0x12, 0xf0,
+  0x78, 0xf0, 0x02, 0xf0, 0x89, 0xe2, 0xf0, 0x98, 0xe2, 0xf0, 0x98, 0xd2,
+  0xf0, 0xa9, 0xc2, 0xf0, 0xa9, 0xc2, 0xf0, 0xa9, 0xc2, 0xf0, 0xa9, 0xc2,
+  0xf0, 0xa9, 0xc2, 0xf0, 0xa9, 0xc2, 0xf0, 0xa9, 0xc2, 0xf0, 0xa9, 0xd2,
+  0xf0, 0x98, 0xe2, 0xf0, 0x98, 0xe2, 0xf0, 0x98, 0xf0, 0x02, 0xf0, 0x78,
+  0xf0, 0x12, 0xf0, 0x78, 0xf0, 0x22, 0xf0, 0x67, 0xf0, 0x33, 0xf0, 0x48,
+  0xf0, 0x43, 0xf0, 0x37, 0xf0, 0x63, 0xf0, 0x17, 0xf0, 0x83, 0xe7, 0xf0,
+  0xa4, 0xb7, 0xf0, 0xd4, 0x86, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0xf4,
+  0x60,
+};
+const unsigned char wi_moon_alt_waning_gibbous_3_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x58, 0xf0, 0xd4, 0x98, 0xf0, 0xb4,
+  0xb9, 0xf0, 0x83, 0xe9, 0xf0, 0x63, 0xf0, 0x0a, 0xf0, 0x43, 0xf0, 0x2a,
+  0xf0, 0x32, 0xf0, 0x3a, 0xf0, 0x22, 0xf0, 0x5a, 0xf0, 0x12, 0xf0, 0x5a,
+  0xf0, 0x02, 0xf0, 0x6b, 0xe2, 0xf0, 0x7a, 0xe2, 0xf0, 0x7a, 0xd2, 0xf0,
+  0x8b, 0xc2, 0xf0, 0x8b, 0xc2, 0xf0, 0x8b, 0xc2, 0xf0, 0x8b, 0xc2, 0xf0,
+  0x8b, 0xc2, 0xf0, 0x8b, 0xc2, 0xf0, 0x8b, 0xc2, 0xf0, 0x8b, 0xd2, 0xf0,
+  0x7a, 0xe2, 0xf0, 0x7a, 0xe2, 0xf0, 0x7a, 0xf0, 0x02, 0xf0, 0x5a, 0xf0,
+  0x12, 0xf0, 0x5a, 0xf0, 0x22, 0xf0, 0x49, 0xf0, 0x33, 0xf0, 0x39, 0xf0,
+  0x43, 0xf0, 0x19, 0xf0, 0x63, 0xe9, 0xf0, 0x83, 0xd8, 0xf0, 0xa4, 0xa8,
+  0xf0, 0xd4, 0x77, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0xf4, 0x60,
+};
+const unsigned char wi_moon_alt_waning_gibbous_4_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x58, 0xf0, 0xd4, 0x89, 0xf0, 0xb4,
+  0xaa, 0xf0, 0x83, 0xda, 0xf0, 0x63, 0xeb, 0xf0, 0x43, 0xf0, 0x1b, 0xf0,
+  0x32, 0xf0, 0x2b, 0xf0, 0x22, 0xf0, 0x3c, 0xf0, 0x12, 0xf0, 0x3c, 0xf0,
+  0x02, 0xf0, 0x5c, 0xe2, 0xf0, 0x5c, 0xe2, 0xf0, 0x5c, 0xd2, 0xf0, 0x6d,
+  0xc2, 0xf0, 0x6d, 0xc2, 0xf0, 0x6d, 0xc2, 0xf0, 0x6d, 0xc2, 0xf0, 0x6d,
+  0xc2, 0xf0, 0x6d, 0xc2, 0xf0, 0x6d, 0xc2, 0xf0, 0x6d, 0xd2, 0xf0, 0x5c,
+  0xe2, 0xf0, 0x5c, 0xe2, 0xf0, 0x5c, 0xf0, 0x02, 0xf0, 0x4b, 0xf0, 0x12,
+  0xf0, 0x3c, 0xf0, 0x22, 0xf0, 0x2b, 0xf0, 0x33, 0xf0, 0x1b, 0xf0, 0x43,
+  0xf0, 0x0a, 0xf0, 0x63, 0xda, 0xf0, 0x83, 0xc9, 0xf0, 0xa4, 0x99, 0xf0,
+  0xd4, 0x68, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0xf4, 0x60,
+};
+const unsigned char wi_moon_alt_waning_gibbous_5_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x58, 0xf0, 0xd4, 0x89, 0xf0, 0xb4,
+  0xaa, 0xf0, 0x83, 0xcb, 0xf0, 0x63, 0xeb, 0xf0, 0x43, 0xf0, 0x0c, 0xf0,
+  0x32, 0xf0, 0x1c, 0xf0, 0x22, 0xf0, 0x2d, 0xf0, 0x12, 0xf0, 0x2d, 0xf0,
+  0x02, 0xf0, 0x4d, 0xe2, 0xf0, 0x4d, 0xe2, 0xf0, 0x4d, 0xd2, 0xf0, 0x5e,
+  0xc2, 0xf0, 0x5e, 0xc2, 0xf0, 0x5e, 0xc2, 0xf0, 0x5e, 0xc2, 0xf0, 0x5e,
+  0xc2, 0xf0, 0x5e, 0xc2, 0xf0, 0x5e, 0xc2, 0xf0, 0x5e, 0xd2, 0xf0, 0x4d,
+  0xe2, 0xf0, 0x4d, 0xe2, 0xf0, 0x4d, 0xf0, 0x02, 0xf0, 0x3c, 0xf0, 0x12,
+  0xf0, 0x3c, 0xf0, 0x22, 0xf0, 0x1c, 0xf0, 0x33, 0xf0, 0x0c, 0xf0, 0x43,
+  0xeb, 0xf0, 0x63, 0xda, 0xf0, 0x83, 0xba, 0xf0, 0xa4, 0x99, 0xf0, 0xd4,
+  0x68, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0xf4, 0x60,
+};
+const unsigned char wi_moon_alt_waning_gibbous_6_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x58, 0xf0, 0xd4, 0x89, 0xf0, 0xb4,
+  0x9b, 0xf0, 0x83, 0xbc, 0xf0, 0x63, 0xcd, 0xf0, 0x43, 0xed, 0xf0, 0x32,
+  0xf0, 0x0d, 0xf0, 0x22, 0xf0, 0x1e, 0xf0, 0x12, 0xf0, 0x1e, 0xf0, 0x02,
+  0xf0, 0x2f, 0x00, 0xe2, 0xf0, 0x2f, 0x00, 0xe2, 0xf0, 0x2f, 0x00, 0xd2,
+  0xf0, 0x3f, 0x01, 0xc2, 0xf0, 0x3f, 0x01, 0xc2, 0xf0, 0x3f, 0x01, 0xc2,
+  0xf0, 0x3f, 0x01, 0xc2, 0xf0, 0x3f, 0x01, 0xc2, 0xf0, 0x3f, 0x01, 0xc2,
+  0xf0, 0x3f, 0x01, 0xc2, 0xf0, 0x3f, 0x01, 0xd2, 0xf0, 0x2f, 0x00, 0xe2,
+  0xf0, 0x2f, 0x00, 0xe2, 0xf0, 0x2f, 0x00, 0xf0, 0x02, 0xf0, 0x1e, 0xf0,
+  0x12, 0xf0, 0x1e, 0xf0, 0x22, 0xf0, 0x0d, 0xf0, 0x33, 0xed, 0xf0, 0x43,
+  0xdc, 0xf0, 0x63, 0xbc, 0xf0, 0x83, 0xab, 0xf0, 0xa4, 0x8a, 0xf0, 0xd4,
+  0x68, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0xf4, 0x60,
+};
+const unsigned char wi_moon_full_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x1f, 0x03, 0xf0, 0xdf, 0x07, 0xf0, 0xaf,
+  0x09, 0xf0, 0x8f, 0x0b, 0xf0, 0x6f, 0x0d, 0xf0, 0x4f, 0x0f, 0xf0, 0x3f,
+  0x0f, 0xf0, 0x2f, 0x11, 0xf0, 0x1f, 0x11, 0xf0, 0x0f, 0x13, 0xef, 0x13,
+  0xef, 0x13, 0xdf, 0x15, 0xcf, 0x15, 0xcf, 0x15, 0xcf, 0x15, 0xcf, 0x15,
+  0xcf, 0x15, 0xcf, 0x15, 0xcf, 0x15, 0xdf, 0x13, 0xef, 0x13, 0xef, 0x13,
+  0xf0, 0x0f, 0x11, 0xf0, 0x1f, 0x11, 0xf0, 0x2f, 0x0f, 0xf0, 0x3f, 0x0f,
+  0xf0, 0x4f, 0x0d, 0xf0, 0x6f, 0x0b, 0xf0, 0x8f, 0x09, 0xf0, 0xaf, 0x07,
+  0xf0, 0xdf, 0x03, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0xf4, 0x60,
+};
+const unsigned char wi_strong_wind_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf9, 0xa3, 0xf1, 0xd5, 0xf1, 0xb7, 0xf1, 0xa3,
+  0x14, 0xf1, 0xe3, 0xf1, 0xe3, 0xbf, 0x16, 0xaf, 0x16, 0xbf, 0x15, 0xf8,
+  0xdf, 0x0c, 0xf0, 0x6f, 0x0d, 0xf0, 0x6f, 0x0d, 0xf1, 0xe3, 0xf1, 0xf2,
+  0xf1, 0xa2, 0x23, 0xf1, 0x98, 0xf1, 0xa6, 0xf1, 0xd2, 0xff, 0xf0, 0xff,
+  0xf0, 0xf5, 0x60,
+};
+const unsigned char wi_sunrise_48x48_rle[] PROGMEM = {
+  0xff, 0x82, 0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0xd4, 0xf1, 0xd4, 0xf1, 0x21,
+  0xb3, 0xa1, 0xf0, 0x63, 0xa2, 0xa3, 0xf0, 0x54, 0xf0, 0x54, 0xf0, 0x64,
+  0xf0, 0x34, 0xf0, 0x83, 0xf0, 0x33, 0xf0, 0xa2, 0x66, 0x62, 0xf1, 0x1a,
+  0xf1, 0x6c, 0xf1, 0x45, 0x45, 0xf1, 0x24, 0x84, 0xf1, 0x04, 0xa4, 0xf0,
+  0xf3, 0xc3, 0xf0, 0xf3, 0xc3, 0xf0, 0x56, 0x43, 0xc3, 0x46, 0x97, 0x33,
+  0xd4, 0x37, 0x96, 0x43, 0xc3, 0x46, 0xf0, 0x53, 0xc3, 0xf0, 0xf3, 0x51,
+  0x63, 0xf0, 0xf4, 0x34, 0x34, 0xf1, 0x56, 0xf1, 0xa8, 0xf1, 0x8a, 0xf1,
+  0x1a, 0x2a, 0xf0, 0xb9, 0x49, 0xf0, 0xb8, 0x68, 0xff, 0xf0, 0xff, 0xf0,
+  0xf5, 0x20,
+};
+const unsigned char wi_sunset_48x48_rle[] PROGMEM = {
+  0xff, 0x91, 0xf1, 0xf2, 0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0xd4, 0xf1, 0xd4,
+  0xf1, 0x13, 0xa2, 0xa3, 0xf0, 0x54, 0xf0, 0x54, 0xf0, 0x64, 0xf0, 0x34,
+  0xf0, 0x84, 0xf0, 0x23, 0xf0, 0xa2, 0x74, 0x72, 0xf1, 0x1a, 0xf1, 0x6c,
+  0xf1, 0x46, 0x26, 0xf1, 0x24, 0x84, 0xf1, 0x13, 0xa3, 0xf1, 0x03, 0xc3,
+  0xf0, 0xf3, 0xc3, 0xf0, 0x56, 0x43, 0xc3, 0x46, 0xa6, 0x43, 0xc4, 0x36,
+  0xa6, 0x43, 0xc3, 0x46, 0xf0, 0x53, 0xc3, 0xf0, 0xf3, 0xc3, 0xf0, 0xf4,
+  0xa4, 0xf9, 0xd8, 0x68, 0xf0, 0xb9, 0x49, 0xf0, 0xc9, 0x2a, 0xf1, 0x1a,
+  0xf1, 0x88, 0xf1, 0xb4, 0xf1, 0xe2, 0xff, 0xf0, 0xfa, 0xa0,
+};
+const unsigned char wi_time_5_48x48_rle[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x1f, 0x03, 0xf0, 0xef, 0x06, 0xf0, 0xa9,
+  0x69, 0xf0, 0x87, 0xc7, 0xf0, 0x66, 0x72, 0x76, 0xf0, 0x46, 0x82, 0x86,
+  0xf0, 0x35, 0x92, 0x95, 0xf0, 0x25, 0xa2, 0xa5, 0xf0, 0x14, 0xb2, 0xb4,
+  0xf0, 0x05, 0xb2, 0xb5, 0xe4, 0xc2, 0xc4, 0xe4, 0xc2, 0xc4, 0xd4, 0xd2,
+  0xd4, 0xc4, 0xd2, 0xd4, 0xc4, 0xd2, 0xd4, 0xc4, 0xd2, 0xd4, 0xc4, 0xd3,
+  0xc4, 0xc4, 0xd3, 0xc4, 0xc4, 0xe3, 0xb4, 0xc4, 0xe3, 0xb4, 0xd4, 0xe3,
+  0x94, 0xe4, 0xe3, 0x94, 0xe5, 0xe3, 0x84, 0xf0, 0x04, 0xf0, 0x01, 0x84,
+  0xf0, 0x15, 0xf0, 0x75, 0xf0, 0x25, 0xf0, 0x55, 0xf0, 0x36, 0xf0, 0x36,
+  0xf0, 0x46, 0xf0, 0x16, 0xf0, 0x66, 0xe6, 0xf0, 0x88, 0x88, 0xf0, 0xaf,
+  0x07, 0xf0, 0xdf, 0x03, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0xf4, 0x60,
+};
+const unsigned char wifi_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfd, 0x6a, 0xf1, 0x3f, 0x03, 0xf0, 0xdf, 0x07, 0xf0, 0x9f,
+  0x0b, 0xf0, 0x5a, 0xaa, 0xf0, 0x28, 0xf0, 0x18, 0xf0, 0x07, 0xf0, 0x57,
+  0xd6, 0xf0, 0x96, 0xb6, 0x98, 0x96, 0xa4, 0x8e, 0x84, 0xb2, 0x7f, 0x03,
+  0x72, 0xf0, 0x4f, 0x07, 0xf0, 0xa8, 0x88, 0xf0, 0x87, 0xc7, 0xf0, 0x75,
+  0xf0, 0x15, 0xf0, 0x74, 0xf0, 0x34, 0xf0, 0x81, 0x86, 0x81, 0xf1, 0x0a,
+  0xf1, 0x5e, 0xf1, 0x3e, 0xf1, 0x26, 0x46, 0xf1, 0x23, 0x83, 0xf7, 0x92,
+  0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0xe2, 0xff, 0xf0, 0xfd, 0xa0,
+};
+const unsigned char wifi_1_bar_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0,
+  0xf1, 0x42, 0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0xe2, 0xff, 0xf0, 0xfd, 0xa0,
+};
+const unsigned char wifi_2_bar_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfa, 0xe6, 0xf1, 0x9a,
+  0xf1, 0x5e, 0xf1, 0x3e, 0xf1, 0x26, 0x46, 0xf1, 0x23, 0x83, 0xf7, 0x92,
+  0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0xe2, 0xff, 0xf0, 0xfd, 0xa0,
+};
+const unsigned char wifi_3_bar_48x48_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf3, 0xb8, 0xf1, 0x6e, 0xf1, 0x1f,
+  0x03, 0xf0, 0xdf, 0x07, 0xf0, 0xa8, 0x88, 0xf0, 0x87, 0xc7, 0xf0, 0x75,
+  0xf0, 0x15, 0xf0, 0x74, 0xf0, 0x34, 0xf0, 0x81, 0x86, 0x81, 0xf1, 0x0a,
+  0xf1, 0x5e, 0xf1, 0x3e, 0xf1, 0x26, 0x46, 0xf1, 0x23, 0x83, 0xf7, 0x92,
+  0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0xe2, 0xff, 0xf0, 0xfd, 0xa0,
+};
+const unsigned char wifi_off_48x48_rle[] PROGMEM = {
+  0xfb, 0x62, 0xf1, 0xe4, 0xf1, 0xd5, 0xf1, 0xd5, 0xf1, 0xd5, 0xf1, 0xd5,
+  0xf1, 0xd5, 0x79, 0xf0, 0xd5, 0x5e, 0xf0, 0xa6, 0x2f, 0x02, 0xf0, 0x95,
+  0x3f, 0x03, 0xf0, 0x58, 0xca, 0xf0, 0x2a, 0xe8, 0xf0, 0x0c, 0xf0, 0x07,
+  0xd6, 0x35, 0xf0, 0x16, 0xb6, 0x56, 0xf0, 0x06, 0xa4, 0x76, 0x54, 0x75,
+  0xb2, 0x78, 0x46, 0x72, 0xf0, 0x4b, 0x38, 0xf0, 0xad, 0x38, 0xf0, 0x87,
+  0x35, 0x47, 0xf0, 0x75, 0x65, 0x55, 0xf0, 0x74, 0x85, 0x54, 0xf0, 0x81,
+  0x88, 0x61, 0xf1, 0x0b, 0xf1, 0x4e, 0xf1, 0x3f, 0x00, 0xf1, 0x16, 0x47,
+  0xf1, 0x13, 0x86, 0xf1, 0xc6, 0xf1, 0xd5, 0xf1, 0x42, 0x75, 0xf1, 0x24,
+  0x75, 0xf1, 0x14, 0x85, 0xf1, 0x12, 0xa5, 0xf1, 0xd5, 0xf1, 0xd5, 0xf1,
+  0xd5, 0xf1, 0xd5, 0xf1, 0xd4, 0xf1, 0xe2, 0xfb, 0x60,
+};
+const unsigned char Battery_1_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfd, 0x4f, 0x14, 0xf0, 0xcf, 0x18,
+  0xf0, 0x9f, 0x1a, 0xf0, 0x7f, 0x1c, 0xf0, 0x6f, 0x1c, 0xf0, 0x57, 0xf1,
+  0x07, 0xf0, 0x46, 0xf1, 0x35, 0xf0, 0x45, 0xf1, 0x45, 0xf0, 0x45, 0xf1,
+  0x46, 0xf0, 0x35, 0xf1, 0x47, 0xf0, 0x25, 0xf1, 0x48, 0xf0, 0x15, 0xf1,
+  0x57, 0xf0, 0x15, 0xf1, 0x66, 0xf0, 0x15, 0xf1, 0x75, 0xf0, 0x15, 0xf1,
+  0x75, 0xf0, 0x15, 0xf1, 0x75, 0xf0, 0x15, 0xf1, 0x75, 0xf0, 0x15, 0xf1,
+  0x75, 0xf0, 0x15, 0xf1, 0x75, 0xf0, 0x15, 0xf1, 0x66, 0xf0, 0x15, 0xf1,
+  0x57, 0xf0, 0x15, 0xf1, 0x48, 0xf0, 0x15, 0xf1, 0x47, 0xf0, 0x25, 0xf1,
+  0x46, 0xf0, 0x35, 0xf1, 0x45, 0xf0, 0x46, 0xf1, 0x26, 0xf0, 0x47, 0xf1,
+  0x07, 0xf0, 0x5f, 0x1c, 0xf0, 0x6f, 0x1c, 0xf0, 0x7f, 0x1a, 0xf0, 0x9f,
+  0x18, 0xf0, 0xcf, 0x14, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfd, 0x70,
+};
+const unsigned char Battery_2_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfd, 0x4f, 0x14, 0xf0, 0xcf, 0x18,
+  0xf0, 0x9f, 0x1a, 0xf0, 0x7f, 0x1c, 0xf0, 0x6f, 0x1c, 0xf0, 0x57, 0xf1,
+  0x07, 0xf0, 0x46, 0xf1, 0x35, 0xf0, 0x45, 0xf1, 0x45, 0xf0, 0x45, 0x43,
+  0xf0, 0xd6, 0xf0, 0x35, 0x35, 0xf0, 0xc7, 0xf0, 0x25, 0x35, 0xf0, 0xc8,
+  0xf0, 0x15, 0x35, 0xf0, 0xd7, 0xf0, 0x15, 0x35, 0xf0, 0xe6, 0xf0, 0x15,
+  0x35, 0xf0, 0xf5, 0xf0, 0x15, 0x35, 0xf0, 0xf5, 0xf0, 0x15, 0x35, 0xf0,
+  0xf5, 0xf0, 0x15, 0x35, 0xf0, 0xf5, 0xf0, 0x15, 0x35, 0xf0, 0xf5, 0xf0,
+  0x15, 0x35, 0xf0, 0xf5, 0xf0, 0x15, 0x35, 0xf0, 0xe6, 0xf0, 0x15, 0x35,
+  0xf0, 0xd7, 0xf0, 0x15, 0x35, 0xf0, 0xc8, 0xf0, 0x15, 0x35, 0xf0, 0xc7,
+  0xf0, 0x25, 0x43, 0xf0, 0xd6, 0xf0, 0x35, 0xf1, 0x45, 0xf0, 0x46, 0xf1,
+  0x26, 0xf0, 0x47, 0xf1, 0x07, 0xf0, 0x5f, 0x1c, 0xf0, 0x6f, 0x1c, 0xf0,
+  0x7f, 0x1a, 0xf0, 0x9f, 0x18, 0xf0, 0xcf, 0x14, 0xff, 0xf0, 0xff, 0xf0,
+  0xff, 0xf0, 0xfd, 0x70,
+};
+const unsigned char Battery_3_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfd, 0x4f, 0x14, 0xf0, 0xcf, 0x18,
+  0xf0, 0x9f, 0x1a, 0xf0, 0x7f, 0x1c, 0xf0, 0x6f, 0x1c, 0xf0, 0x57, 0xf1,
+  0x07, 0xf0, 0x46, 0xf1, 0x35, 0xf0, 0x45, 0xf1, 0x45, 0xf0, 0x45, 0x43,
+  0x53, 0xf0, 0x56, 0xf0, 0x35, 0x35, 0x35, 0xf0, 0x47, 0xf0, 0x25, 0x35,
+  0x35, 0xf0, 0x48, 0xf0, 0x15, 0x35, 0x35, 0xf0, 0x57, 0xf0, 0x15, 0x35,
+  0x35, 0xf0, 0x66, 0xf0, 0x15, 0x35, 0x35, 0xf0, 0x75, 0xf0, 0x15, 0x35,
+  0x35, 0xf0, 0x75, 0xf0, 0x15, 0x35, 0x35, 0xf0, 0x75, 0xf0, 0x15, 0x35,
+  0x35, 0xf0, 0x75, 0xf0, 0x15, 0x35, 0x35, 0xf0, 0x75, 0xf0, 0x15, 0x35,
+  0x35, 0xf0, 0x75, 0xf0, 0x15, 0x35, 0x35, 0xf0, 0x66, 0xf0, 0x15, 0x35,
+  0x35, 0xf0, 0x57, 0xf0, 0x15, 0x35, 0x35, 0xf0, 0x48, 0xf0, 0x15, 0x35,
+  0x35, 0xf0, 0x47, 0xf0, 0x25, 0x43, 0x53, 0xf0, 0x56, 0xf0, 0x35, 0xf1,
+  0x45, 0xf0, 0x46, 0xf1, 0x26, 0xf0, 0x47, 0xf1, 0x07, 0xf0, 0x5f, 0x1c,
+  0xf0, 0x6f, 0x1c, 0xf0, 0x7f, 0x1a, 0xf0, 0x9f, 0x18, 0xf0, 0xcf, 0x14,
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfd, 0x70,
+};
+const unsigned char Battery_4_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfd, 0x4f, 0x14, 0xf0, 0xcf, 0x18,
+  0xf0, 0x9f, 0x1a, 0xf0, 0x7f, 0x1c, 0xf0, 0x6f, 0x1c, 0xf0, 0x57, 0xf1,
+  0x07, 0xf0, 0x46, 0xf1, 0x35, 0xf0, 0x45, 0xf1, 0x45, 0xf0, 0x45, 0x43,
+  0x53, 0x53, 0xc6, 0xf0, 0x35, 0x35, 0x35, 0x35, 0xb7, 0xf0, 0x25, 0x35,
+  0x35, 0x35, 0xb8, 0xf0, 0x15, 0x35, 0x35, 0x35, 0xc7, 0xf0, 0x15, 0x35,
+  0x35, 0x35, 0xd6, 0xf0, 0x15, 0x35, 0x35, 0x35, 0xe5, 0xf0, 0x15, 0x35,
+  0x35, 0x35, 0xe5, 0xf0, 0x15, 0x35, 0x35, 0x35, 0xe5, 0xf0, 0x15, 0x35,
+  0x35, 0x35, 0xe5, 0xf0, 0x15, 0x35, 0x35, 0x35, 0xe5, 0xf0, 0x15, 0x35,
+  0x35, 0x35, 0xe5, 0xf0, 0x15, 0x35, 0x35, 0x35, 0xd6, 0xf0, 0x15, 0x35,
+  0x35, 0x35, 0xc7, 0xf0, 0x15, 0x35, 0x35, 0x35, 0xb8, 0xf0, 0x15, 0x35,
+  0x35, 0x35, 0xb7, 0xf0, 0x25, 0x43, 0x53, 0x53, 0xc6, 0xf0, 0x35, 0xf1,
+  0x45, 0xf0, 0x46, 0xf1, 0x26, 0xf0, 0x47, 0xf1, 0x07, 0xf0, 0x5f, 0x1c,
+  0xf0, 0x6f, 0x1c, 0xf0, 0x7f, 0x1a, 0xf0, 0x9f, 0x18, 0xf0, 0xcf, 0x14,
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfd, 0x70,
+};
+const unsigned char Battery_5_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfd, 0x4f, 0x14, 0xf0, 0xcf, 0x18,
+  0xf0, 0x9f, 0x1a, 0xf0, 0x7f, 0x1c, 0xf0, 0x6f, 0x1c, 0xf0, 0x57, 0xf1,
+  0x07, 0xf0, 0x46, 0xf1, 0x35, 0xf0, 0x45, 0xf1, 0x45, 0xf0, 0x45, 0x43,
+  0x53, 0x53, 0x53, 0x46, 0xf0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x37, 0xf0,
+  0x25, 0x35, 0x35, 0x35, 0x35, 0x38, 0xf0, 0x15, 0x35, 0x35, 0x35, 0x35,
+  0x47, 0xf0, 0x15, 0x35, 0x35, 0x35, 0x35, 0x56, 0xf0, 0x15, 0x35, 0x35,
+  0x35, 0x35, 0x65, 0xf0, 0x15, 0x35, 0x35, 0x35, 0x35, 0x65, 0xf0, 0x15,
+  0x35, 0x35, 0x35, 0x35, 0x65, 0xf0, 0x15, 0x35, 0x35, 0x35, 0x35, 0x65,
+  0xf0, 0x15, 0x35, 0x35, 0x35, 0x35, 0x65, 0xf0, 0x15, 0x35, 0x35, 0x35,
+  0x35, 0x65, 0xf0, 0x15, 0x35, 0x35, 0x35, 0x35, 0x56, 0xf0, 0x15, 0x35,
+  0x35, 0x35, 0x35, 0x47, 0xf0, 0x15, 0x35, 0x35, 0x35, 0x35, 0x38, 0xf0,
+  0x15, 0x35, 0x35, 0x35, 0x35, 0x37, 0xf0, 0x25, 0x43, 0x53, 0x53, 0x53,
+  0x46, 0xf0, 0x35, 0xf1, 0x45, 0xf0, 0x46, 0xf1, 0x26, 0xf0, 0x47, 0xf1,
+  0x07, 0xf0, 0x5f, 0x1c, 0xf0, 0x6f, 0x1c, 0xf0, 0x7f, 0x1a, 0xf0, 0x9f,
+  0x18, 0xf0, 0xcf, 0x14, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfd, 0x70,
+};
+const unsigned char refresh_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xea, 0xf2, 0x4f, 0x01, 0xf1, 0xef, 0x07, 0xf0, 0xf4,
+  0x6f, 0x0a, 0xf0, 0xd5, 0x5f, 0x0d, 0xf0, 0xb5, 0x4d, 0x4d, 0xf0, 0xa5,
+  0x3a, 0xca, 0xf0, 0x95, 0x28, 0xf0, 0x38, 0xf0, 0x8e, 0xf0, 0x58, 0xf0,
+  0x7c, 0xf0, 0x97, 0xf0, 0x6b, 0xf0, 0xb7, 0xf0, 0x5a, 0xf0, 0xd6, 0xf0,
+  0x59, 0xf0, 0xf6, 0xf0, 0x4e, 0xf0, 0xa7, 0xf0, 0x3f, 0x00, 0xf0, 0xa6,
+  0xf0, 0x3f, 0x01, 0xf0, 0xa5, 0xf0, 0x3f, 0x01, 0xf0, 0xa6, 0xf0, 0x3e,
+  0xf0, 0xc5, 0xf0, 0x4c, 0xf0, 0xd5, 0xf2, 0xc6, 0xf2, 0xb6, 0xf2, 0xc5,
+  0xf2, 0xc5, 0xf2, 0xd3, 0xf0, 0x33, 0xf2, 0xd5, 0xf2, 0xc5, 0xf2, 0xc6,
+  0xf2, 0xb6, 0xf2, 0xc5, 0xf0, 0xdc, 0xf0, 0x45, 0xf0, 0xce, 0xf0, 0x36,
+  0xf0, 0xaf, 0x01, 0xf0, 0x35, 0xf0, 0xaf, 0x01, 0xf0, 0x36, 0xf0, 0xaf,
+  0x00, 0xf0, 0x37, 0xf0, 0xae, 0xf0, 0x46, 0xf0, 0xf9, 0xf0, 0x56, 0xf0,
+  0xda, 0xf0, 0x57, 0xf0, 0xbb, 0xf0, 0x67, 0xf0, 0x9c, 0xf0, 0x78, 0xf0,
+  0x5e, 0xf0, 0x88, 0xf0, 0x38, 0x25, 0xf0, 0x9a, 0xca, 0x35, 0xf0, 0xad,
+  0x4d, 0x45, 0xf0, 0xbf, 0x0d, 0x55, 0xf0, 0xdf, 0x09, 0x74, 0xf0, 0xff,
+  0x07, 0xf1, 0xef, 0x01, 0xf2, 0x4a, 0xff, 0xf0, 0xff, 0xe0,
+};
+const unsigned char wi_0_day_sunny_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xf3, 0x34, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4,
+  0xf2, 0xd4, 0xf2, 0xd4, 0xf1, 0xf3, 0xb4, 0xb3, 0xf1, 0x05, 0xf0, 0x94,
+  0xf1, 0x15, 0xf0, 0x75, 0xf1, 0x25, 0xf0, 0x55, 0xf1, 0x44, 0xf0, 0x54,
+  0xf1, 0x63, 0x76, 0x73, 0xf1, 0xfa, 0xf2, 0x5e, 0xf2, 0x2f, 0x01, 0xf2,
+  0x06, 0x66, 0xf1, 0xe5, 0xa4, 0xf1, 0xe4, 0xc4, 0xf1, 0xd3, 0xe3, 0xf1,
+  0xc4, 0xe4, 0xf1, 0x15, 0x54, 0xe4, 0x55, 0xf0, 0x58, 0x44, 0xe4, 0x47,
+  0xf0, 0x48, 0x44, 0xf0, 0x03, 0x48, 0xf0, 0x47, 0x44, 0xe4, 0x47, 0xf1,
+  0x04, 0xe4, 0xf1, 0xb4, 0xe4, 0xf1, 0xc4, 0xc4, 0xf1, 0xd5, 0xa5, 0xf1,
+  0xe5, 0x85, 0xf2, 0x06, 0x46, 0xf2, 0x2e, 0xf2, 0x4c, 0xf1, 0xe2, 0x78,
+  0x72, 0xf1, 0x64, 0xf0, 0x54, 0xf1, 0x45, 0xf0, 0x55, 0xf1, 0x25, 0xf0,
+  0x75, 0xf1, 0x14, 0xf0, 0x94, 0xf1, 0x13, 0xc2, 0xc3, 0xf1, 0x12, 0xc4,
+  0xc2, 0xf1, 0xf4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2,
+  0xe2, 0xff, 0xf0, 0xff, 0xf0, 0xf7, 0x40,
+};
+const unsigned char wi_1_day_sunny_overcast_64x64_rle[] PROGMEM = {
+  0xfd, 0x03, 0xf2, 0xe4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4,
+  0xf2, 0xd4, 0xf1, 0xc4, 0xd4, 0xd3, 0xf0, 0xc5, 0xd1, 0xe5, 0xf0, 0xb6,
+  0xf0, 0xb6, 0xf0, 0xc5, 0xf0, 0xa6, 0xf0, 0xe5, 0xf0, 0x86, 0xf1, 0x04,
+  0xf0, 0x85, 0xf1, 0x23, 0x88, 0x83, 0xf1, 0xbd, 0xf2, 0x3f, 0x00, 0xf2,
+  0x1f, 0x03, 0xf1, 0xe7, 0x66, 0xf1, 0xd6, 0xa5, 0xf1, 0xb6, 0xc5, 0xf1,
+  0xa5, 0xe4, 0xf1, 0xa4, 0xf0, 0x05, 0xf1, 0x85, 0xf0, 0x14, 0xf1, 0x84,
+  0xf0, 0x24, 0xf0, 0xb7, 0x64, 0xf0, 0x24, 0x57, 0xe7, 0x67, 0xe4, 0x57,
+  0xe7, 0x69, 0xc4, 0x57, 0xf0, 0x05, 0x5c, 0xb4, 0x65, 0xf0, 0xae, 0xa4,
+  0xf1, 0x56, 0x36, 0x85, 0xf1, 0x45, 0x66, 0x74, 0xf1, 0x54, 0x86, 0x55,
+  0xf1, 0x36, 0x98, 0x15, 0xf1, 0x37, 0x9e, 0xf1, 0x27, 0xad, 0xf1, 0x26,
+  0xf0, 0x18, 0xf1, 0x35, 0xf0, 0x45, 0xf1, 0x35, 0xf0, 0x64, 0x52, 0xf0,
+  0xc5, 0xf0, 0x64, 0x45, 0xf0, 0xa5, 0xf0, 0x64, 0x46, 0xf0, 0xa4, 0xf0,
+  0x64, 0x56, 0xf0, 0x95, 0xf0, 0x45, 0x65, 0xf0, 0x9f, 0x0d, 0x85, 0xf0,
+  0x9f, 0x0c, 0x93, 0xf0, 0xbf, 0x0a, 0xb1, 0xf0, 0xdf, 0x07, 0xff, 0xf0,
+  0xff, 0xf0, 0xff, 0xf0, 0xfa, 0x30,
+};
+const unsigned char wi_45_day_fog_64x64_rle[] PROGMEM = {
+  0xf9, 0x83, 0xf2, 0xe3, 0xf2, 0xe3, 0xf2, 0xe3, 0xf2, 0xe3, 0xf2, 0xe3,
+  0xf2, 0x02, 0xc3, 0xc3, 0xf1, 0x04, 0xc2, 0xb4, 0xf1, 0x05, 0xf0, 0x85,
+  0xf1, 0x14, 0xf0, 0x75, 0xf1, 0x32, 0xf0, 0x84, 0xf2, 0xd3, 0xf1, 0xf9,
+  0x62, 0xf1, 0xed, 0xf1, 0x89, 0x2f, 0x00, 0xf1, 0x5f, 0x03, 0x56, 0xf1,
+  0x3f, 0x02, 0x95, 0xf1, 0x18, 0x28, 0xa4, 0xf1, 0x05, 0x95, 0xb4, 0xf0,
+  0xe5, 0xb5, 0xa4, 0xf0, 0xd5, 0xd5, 0xa3, 0xf0, 0xd4, 0xf0, 0x04, 0xa4,
+  0x47, 0xf0, 0x13, 0xf0, 0x24, 0x94, 0x38, 0xf0, 0x04, 0xf0, 0x25, 0x84,
+  0x47, 0xd6, 0xf0, 0x29, 0x44, 0xf0, 0x78, 0xf0, 0x3a, 0x23, 0xf0, 0x78,
+  0xf0, 0x4f, 0x00, 0xf0, 0x66, 0xf0, 0xd9, 0xf0, 0x64, 0xf1, 0x16, 0xf0,
+  0x64, 0xf1, 0x34, 0xf0, 0x74, 0xf1, 0x44, 0xfc, 0x7f, 0x19, 0x52, 0xf0,
+  0x0f, 0x1d, 0x24, 0xef, 0x1d, 0x25, 0xef, 0x1b, 0x44, 0xf2, 0xe3, 0xf7,
+  0x9f, 0x1c, 0xf0, 0x6f, 0x1c, 0xf0, 0x6f, 0x1c, 0xf0, 0x7f, 0x1a, 0xfd,
+  0x0f, 0x1c, 0xf0, 0x6f, 0x1d, 0xf0, 0x5f, 0x1c, 0xff, 0xf0, 0xff, 0xf0,
+  0xfa, 0x00,
+};
+const unsigned char wi_51_rain_mix_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x27, 0xf2, 0x7d, 0xf2, 0x3f,
+  0x00, 0xf2, 0x18, 0x18, 0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5,
+  0xd5, 0xf1, 0xa4, 0xf0, 0x04, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x84, 0xf0,
+  0x24, 0xf1, 0x66, 0xf0, 0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0,
+  0x4b, 0xf0, 0xa7, 0xf0, 0xc6, 0xf0, 0x94, 0xf1, 0x14, 0xf0, 0x84, 0xf1,
+  0x34, 0xf0, 0x74, 0xf1, 0x34, 0xf0, 0x64, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xc1, 0xf0, 0x93, 0xf0, 0x54,
+  0xb3, 0xb4, 0x74, 0xf0, 0x54, 0xb3, 0xb4, 0x74, 0xf0, 0x54, 0xa4, 0xb3,
+  0x84, 0xf0, 0x64, 0x94, 0xb3, 0x74, 0xf0, 0x75, 0x92, 0xc3, 0x65, 0xf0,
+  0x86, 0xf0, 0xd6, 0xf0, 0xa7, 0x42, 0x52, 0x52, 0x47, 0xf0, 0xc7, 0x23,
+  0x44, 0x34, 0x36, 0xf0, 0xf5, 0x23, 0x44, 0x34, 0x34, 0xf1, 0x41, 0x42,
+  0x44, 0x42, 0x41, 0xf2, 0x23, 0xf2, 0x71, 0xd2, 0xf2, 0x03, 0xb4, 0xf1,
+  0xf3, 0x43, 0x44, 0xf1, 0xf3, 0x43, 0x43, 0xf2, 0x03, 0x43, 0x43, 0xfa,
+  0x62, 0xf2, 0xe4, 0xf2, 0xd4, 0xf2, 0xd3, 0xf2, 0xf1, 0xff, 0xf0, 0xf0,
+  0x60,
+};
+const unsigned char wi_56_rain_mix_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x27, 0xf2, 0x7d, 0xf2, 0x3f,
+  0x00, 0xf2, 0x18, 0x18, 0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5,
+  0xd5, 0xf1, 0xa4, 0xf0, 0x04, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x84, 0xf0,
+  0x24, 0xf1, 0x66, 0xf0, 0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0,
+  0x4b, 0xf0, 0xa7, 0xf0, 0xc6, 0xf0, 0x94, 0xf1, 0x14, 0xf0, 0x84, 0xf1,
+  0x34, 0xf0, 0x74, 0xf1, 0x34, 0xf0, 0x64, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xc1, 0xf0, 0x93, 0xf0, 0x54,
+  0xb3, 0xb4, 0x74, 0xf0, 0x54, 0xb3, 0xb4, 0x74, 0xf0, 0x54, 0xa4, 0xb3,
+  0x84, 0xf0, 0x64, 0x94, 0xb3, 0x74, 0xf0, 0x75, 0x92, 0xc3, 0x65, 0xf0,
+  0x86, 0xf0, 0xd6, 0xf0, 0xa7, 0x42, 0x52, 0x52, 0x47, 0xf0, 0xc7, 0x23,
+  0x44, 0x34, 0x36, 0xf0, 0xf5, 0x23, 0x44, 0x34, 0x34, 0xf1, 0x41, 0x42,
+  0x44, 0x42, 0x41, 0xf2, 0x23, 0xf2, 0x71, 0xd2, 0xf2, 0x03, 0xb4, 0xf1,
+  0xf3, 0x43, 0x44, 0xf1, 0xf3, 0x43, 0x43, 0xf2, 0x03, 0x43, 0x43, 0xfa,
+  0x62, 0xf2, 0xe4, 0xf2, 0xd4, 0xf2, 0xd3, 0xf2, 0xf1, 0xff, 0xf0, 0xf0,
+  0x60,
+};
+const unsigned char wi_61_rain_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x27, 0xf2, 0x7d, 0xf2, 0x3f,
+  0x00, 0xf2, 0x18, 0x18, 0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5,
+  0xd5, 0xf1, 0xa4, 0xf0, 0x04, 0xf1, 0x94, 0xf0, 0x23, 0xf1, 0x94, 0xf0,
+  0x24, 0xf1, 0x66, 0xf0, 0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0,
+  0x4b, 0xf0, 0xa6, 0xf0, 0xd6, 0xf0, 0x94, 0xf1, 0x14, 0xf0, 0x84, 0xf1,
+  0x34, 0xf0, 0x74, 0xf1, 0x34, 0xf0, 0x64, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xc1, 0x61, 0x62, 0x84, 0xf0,
+  0x54, 0xb3, 0x43, 0x44, 0x74, 0xf0, 0x54, 0xb3, 0x44, 0x34, 0x74, 0xf0,
+  0x54, 0xa4, 0x43, 0x43, 0x84, 0xf0, 0x64, 0x94, 0x34, 0x34, 0x74, 0xf0,
+  0x75, 0x84, 0x34, 0x34, 0x65, 0xf0, 0x86, 0x54, 0x43, 0x44, 0x46, 0xf0,
+  0xa7, 0x34, 0x34, 0x43, 0x37, 0xf0, 0xc6, 0x34, 0x34, 0x34, 0x36, 0xf0,
+  0xf4, 0x33, 0x44, 0x34, 0x34, 0xf1, 0x41, 0x24, 0x43, 0x43, 0x41, 0xf1,
+  0xa4, 0x34, 0x34, 0xf1, 0xf4, 0x34, 0x34, 0xf1, 0xf3, 0x44, 0x34, 0xf1,
+  0xe4, 0x43, 0x43, 0xf2, 0x03, 0x34, 0x43, 0xf2, 0x64, 0xf2, 0xd3, 0xf2,
+  0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd3, 0xf2, 0xf1, 0xff, 0xf0, 0xf4,
+  0x60,
+};
+const unsigned char wi_66_rain_mix_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x27, 0xf2, 0x7d, 0xf2, 0x3f,
+  0x00, 0xf2, 0x18, 0x18, 0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5,
+  0xd5, 0xf1, 0xa4, 0xf0, 0x04, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x84, 0xf0,
+  0x24, 0xf1, 0x66, 0xf0, 0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0,
+  0x4b, 0xf0, 0xa7, 0xf0, 0xc6, 0xf0, 0x94, 0xf1, 0x14, 0xf0, 0x84, 0xf1,
+  0x34, 0xf0, 0x74, 0xf1, 0x34, 0xf0, 0x64, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xc1, 0xf0, 0x93, 0xf0, 0x54,
+  0xb3, 0xb4, 0x74, 0xf0, 0x54, 0xb3, 0xb4, 0x74, 0xf0, 0x54, 0xa4, 0xb3,
+  0x84, 0xf0, 0x64, 0x94, 0xb3, 0x74, 0xf0, 0x75, 0x92, 0xc3, 0x65, 0xf0,
+  0x86, 0xf0, 0xd6, 0xf0, 0xa7, 0x42, 0x52, 0x52, 0x47, 0xf0, 0xc7, 0x23,
+  0x44, 0x34, 0x36, 0xf0, 0xf5, 0x23, 0x44, 0x34, 0x34, 0xf1, 0x41, 0x42,
+  0x44, 0x42, 0x41, 0xf2, 0x23, 0xf2, 0x71, 0xd2, 0xf2, 0x03, 0xb4, 0xf1,
+  0xf3, 0x43, 0x44, 0xf1, 0xf3, 0x43, 0x43, 0xf2, 0x03, 0x43, 0x43, 0xfa,
+  0x62, 0xf2, 0xe4, 0xf2, 0xd4, 0xf2, 0xd3, 0xf2, 0xf1, 0xff, 0xf0, 0xf0,
+  0x60,
+};
+const unsigned char wi_71_snow_wind_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x18, 0xf2, 0x7d, 0xf2, 0x3f,
+  0x00, 0xf2, 0x17, 0x28, 0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5,
+  0xd5, 0xf1, 0xa4, 0xf0, 0x04, 0xf1, 0x94, 0xf0, 0x23, 0xf1, 0x94, 0xf0,
+  0x24, 0xf1, 0x66, 0xf0, 0x29, 0xf0, 0xf7, 0xf0, 0x3a, 0xf0, 0xd8, 0xf0,
+  0x4b, 0xf0, 0xa6, 0xf0, 0xd6, 0xf0, 0x94, 0xf1, 0x14, 0xf0, 0x84, 0xf1,
+  0x34, 0xf0, 0x73, 0xf1, 0x44, 0xf0, 0x64, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x53, 0xf1, 0x64, 0xf0, 0x53, 0xf1, 0x64, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x64, 0xf0,
+  0x04, 0xf0, 0x04, 0xf0, 0x75, 0xe4, 0xe5, 0xf0, 0x86, 0xd2, 0xd6, 0xf0,
+  0xa7, 0x42, 0xc2, 0x47, 0xf0, 0xc6, 0x43, 0xa4, 0x27, 0xf0, 0xe5, 0x43,
+  0xa4, 0x25, 0xf1, 0x41, 0x51, 0xc1, 0x51, 0xf2, 0x22, 0xf2, 0xe4, 0xf2,
+  0xe3, 0xf2, 0xe2, 0xf2, 0x73, 0xb2, 0xf2, 0x13, 0xa4, 0xf2, 0x03, 0xb3,
+  0xf6, 0x62, 0xf2, 0xf3, 0xf2, 0xe3, 0xff, 0xf0, 0xf8, 0x40,
+};
+const unsigned char wi_77_day_snow_wind_64x64_rle[] PROGMEM = {
+  0xf9, 0x62, 0xf2, 0xe4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4,
+  0xf1, 0xf2, 0xc4, 0xc2, 0xf1, 0x04, 0xc2, 0xc3, 0xf1, 0x05, 0xf0, 0x94,
+  0xf1, 0x14, 0xf0, 0x85, 0xf1, 0x23, 0xf0, 0x75, 0xf2, 0xc4, 0xf1, 0xf8,
+  0x72, 0xf1, 0xec, 0xf1, 0x98, 0x3e, 0xf1, 0x6f, 0x03, 0x46, 0xf1, 0x3f,
+  0x03, 0x85, 0xf1, 0x18, 0x28, 0xa5, 0xf0, 0xf6, 0x86, 0xa4, 0xf0, 0xe5,
+  0xc4, 0xb4, 0xf0, 0xd4, 0xe4, 0xa4, 0xf0, 0xc4, 0xf0, 0x13, 0xa4, 0x47,
+  0xf0, 0x14, 0xf0, 0x14, 0x94, 0x48, 0xf0, 0x03, 0xf0, 0x33, 0x94, 0x47,
+  0xe5, 0xf0, 0x38, 0x44, 0x55, 0xd7, 0xf0, 0x3a, 0x24, 0xf0, 0x78, 0xf0,
+  0x3f, 0x00, 0xf0, 0x76, 0xf0, 0xc9, 0xf0, 0x65, 0xf1, 0x06, 0xf0, 0x65,
+  0xf1, 0x25, 0xf0, 0x64, 0xf1, 0x44, 0xf0, 0x64, 0xf1, 0x44, 0xf0, 0x63,
+  0xf1, 0x63, 0xf0, 0x54, 0xf1, 0x63, 0xf0, 0x54, 0xf1, 0x63, 0x41, 0xf0,
+  0x04, 0xf1, 0x63, 0x33, 0xf0, 0x03, 0xf1, 0x54, 0x34, 0xe4, 0xf0, 0x21,
+  0xf0, 0x24, 0x34, 0xe5, 0xf0, 0x03, 0xf0, 0x05, 0x43, 0xf0, 0x05, 0xe3,
+  0xe5, 0xf0, 0x95, 0xd3, 0xc6, 0xf0, 0xa8, 0x42, 0xb2, 0x47, 0xf0, 0xd6,
+  0x33, 0xb3, 0x36, 0xf0, 0xf5, 0x33, 0xb3, 0x35, 0xf1, 0x41, 0x41, 0xd1,
+  0x41, 0xf2, 0x23, 0xf2, 0xe3, 0xf2, 0xe3, 0xf2, 0xf1, 0xf2, 0x73, 0xb3,
+  0xf2, 0x04, 0xa3, 0xf2, 0x03, 0xb3, 0xf6, 0x63, 0xf2, 0xe3, 0xf2, 0xe3,
+  0xff, 0xf0, 0xf8, 0xb0,
+};
+const unsigned char wi_81_showers_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x19, 0xf2, 0x6d, 0xf2, 0x3f,
+  0x00, 0xf2, 0x17, 0x29, 0xf1, 0xe5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5,
+  0xd5, 0xf1, 0xa4, 0xf0, 0x04, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x84, 0xf0,
+  0x24, 0xf1, 0x66, 0xf0, 0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0,
+  0x4b, 0xf0, 0xa6, 0xf0, 0xd6, 0xf0, 0x85, 0xf1, 0x15, 0xf0, 0x74, 0xf1,
+  0x34, 0xf0, 0x65, 0xf1, 0x44, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xf1, 0x63, 0xf0, 0x54, 0xc1, 0xf0, 0x93, 0xf0, 0x54,
+  0xb3, 0xb4, 0x74, 0xf0, 0x54, 0xb3, 0xb4, 0x74, 0xf0, 0x54, 0xa4, 0xb4,
+  0x74, 0xf0, 0x64, 0x94, 0xb3, 0x74, 0xf0, 0x75, 0x92, 0xc3, 0x65, 0xf0,
+  0x86, 0xf0, 0xd6, 0xf0, 0xa7, 0xb2, 0xb7, 0xf0, 0xc6, 0xa4, 0xa6, 0xf0,
+  0xf4, 0xa4, 0xa4, 0xf1, 0x41, 0xa4, 0xa1, 0xf1, 0xa3, 0x53, 0x43, 0xf1,
+  0xf4, 0x52, 0x34, 0xf1, 0xf3, 0xb4, 0xf1, 0xe4, 0xb3, 0xf2, 0x03, 0xb3,
+  0xf6, 0x62, 0xf2, 0xf3, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd3,
+  0xff, 0xf0, 0xf4, 0x50,
+};
+const unsigned char wi_85_snow_wind_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x18, 0xf2, 0x7d, 0xf2, 0x3f,
+  0x00, 0xf2, 0x17, 0x28, 0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5,
+  0xd5, 0xf1, 0xa4, 0xf0, 0x04, 0xf1, 0x94, 0xf0, 0x23, 0xf1, 0x94, 0xf0,
+  0x24, 0xf1, 0x66, 0xf0, 0x29, 0xf0, 0xf7, 0xf0, 0x3a, 0xf0, 0xd8, 0xf0,
+  0x4b, 0xf0, 0xa6, 0xf0, 0xd6, 0xf0, 0x94, 0xf1, 0x14, 0xf0, 0x84, 0xf1,
+  0x34, 0xf0, 0x73, 0xf1, 0x44, 0xf0, 0x64, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x53, 0xf1, 0x64, 0xf0, 0x53, 0xf1, 0x64, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x64, 0xf0,
+  0x04, 0xf0, 0x04, 0xf0, 0x75, 0xe4, 0xe5, 0xf0, 0x86, 0xd2, 0xd6, 0xf0,
+  0xa7, 0x42, 0xc2, 0x47, 0xf0, 0xc6, 0x43, 0xa4, 0x27, 0xf0, 0xe5, 0x43,
+  0xa4, 0x25, 0xf1, 0x41, 0x51, 0xc1, 0x51, 0xf2, 0x22, 0xf2, 0xe4, 0xf2,
+  0xe3, 0xf2, 0xe2, 0xf2, 0x73, 0xb2, 0xf2, 0x13, 0xa4, 0xf2, 0x03, 0xb3,
+  0xf6, 0x62, 0xf2, 0xf3, 0xf2, 0xe3, 0xff, 0xf0, 0xf8, 0x40,
+};
+const unsigned char wi_95_thunderstorm_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x19, 0xf2, 0x6d, 0xf2, 0x3f,
+  0x00, 0xf2, 0x17, 0x37, 0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5,
+  0xd5, 0xf1, 0xa4, 0xf0, 0x04, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x84, 0xf0,
+  0x25, 0xf1, 0x56, 0xf0, 0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0,
+  0x4b, 0xf0, 0xa6, 0xf0, 0xd6, 0xf0, 0x85, 0xf1, 0x15, 0xf0, 0x74, 0xf1,
+  0x34, 0xf0, 0x74, 0xf1, 0x44, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xf1, 0x63, 0xf0, 0x54, 0x77, 0x52, 0x52, 0x93, 0xf0,
+  0x54, 0x77, 0x43, 0x44, 0x74, 0xf0, 0x54, 0x67, 0x54, 0x34, 0x74, 0xf0,
+  0x54, 0x67, 0x53, 0x43, 0x84, 0xf0, 0x64, 0x56, 0x54, 0x43, 0x74, 0xf0,
+  0x75, 0x37, 0x54, 0x34, 0x65, 0xf0, 0x86, 0x16, 0x64, 0x34, 0x46, 0xf0,
+  0xac, 0x63, 0x43, 0x37, 0xf0, 0xca, 0x64, 0x43, 0x36, 0xf0, 0xf8, 0x64,
+  0x34, 0x34, 0xf1, 0x26, 0x73, 0x44, 0x31, 0xf1, 0x5b, 0x23, 0x43, 0xf1,
+  0xaa, 0x24, 0x43, 0xf1, 0x9a, 0x34, 0x34, 0xf1, 0xe5, 0x33, 0x44, 0xf1,
+  0xe4, 0x43, 0x52, 0xf1, 0xe4, 0x44, 0xf2, 0x53, 0x54, 0xf2, 0x53, 0x53,
+  0xf2, 0x62, 0x54, 0xf2, 0x61, 0x64, 0xf2, 0x52, 0x64, 0xf2, 0x51, 0xff,
+  0xf0, 0xf4, 0xf0,
+};
+const unsigned char wi_99_thunderstorm_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x19, 0xf2, 0x6d, 0xf2, 0x3f,
+  0x00, 0xf2, 0x17, 0x37, 0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5,
+  0xd5, 0xf1, 0xa4, 0xf0, 0x04, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x84, 0xf0,
+  0x25, 0xf1, 0x56, 0xf0, 0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0,
+  0x4b, 0xf0, 0xa6, 0xf0, 0xd6, 0xf0, 0x85, 0xf1, 0x15, 0xf0, 0x74, 0xf1,
+  0x34, 0xf0, 0x74, 0xf1, 0x44, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xf1, 0x63, 0xf0, 0x54, 0x77, 0x52, 0x52, 0x93, 0xf0,
+  0x54, 0x77, 0x43, 0x44, 0x74, 0xf0, 0x54, 0x67, 0x54, 0x34, 0x74, 0xf0,
+  0x54, 0x67, 0x53, 0x43, 0x84, 0xf0, 0x64, 0x56, 0x54, 0x43, 0x74, 0xf0,
+  0x75, 0x37, 0x54, 0x34, 0x65, 0xf0, 0x86, 0x16, 0x64, 0x34, 0x46, 0xf0,
+  0xac, 0x63, 0x43, 0x37, 0xf0, 0xca, 0x64, 0x43, 0x36, 0xf0, 0xf8, 0x64,
+  0x34, 0x34, 0xf1, 0x26, 0x73, 0x44, 0x31, 0xf1, 0x5b, 0x23, 0x43, 0xf1,
+  0xaa, 0x24, 0x43, 0xf1, 0x9a, 0x34, 0x34, 0xf1, 0xe5, 0x33, 0x44, 0xf1,
+  0xe4, 0x43, 0x52, 0xf1, 0xe4, 0x44, 0xf2, 0x53, 0x54, 0xf2, 0x53, 0x53,
+  0xf2, 0x62, 0x54, 0xf2, 0x61, 0x64, 0xf2, 0x52, 0x64, 0xf2, 0x51, 0xff,
+  0xf0, 0xf4, 0xf0,
+};
+const unsigned char wi_cloud_down_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x19, 0xf2, 0x6d, 0xf2, 0x3f,
+  0x00, 0xf2, 0x08, 0x37, 0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5,
+  0xd5, 0xf1, 0xa4, 0xf0, 0x04, 0xf1, 0x94, 0xf0, 0x23, 0xf1, 0x94, 0xf0,
+  0x24, 0xf1, 0x66, 0xf0, 0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0,
+  0x4b, 0xf0, 0xa6, 0xf0, 0xd6, 0xf0, 0x85, 0xf0, 0x02, 0xf0, 0x05, 0xf0,
+  0x74, 0xf0, 0x04, 0xf0, 0x04, 0xf0, 0x64, 0xf0, 0x14, 0xf0, 0x14, 0xf0,
+  0x54, 0xf0, 0x14, 0xf0, 0x14, 0xf0, 0x54, 0xf0, 0x14, 0xf0, 0x14, 0xf0,
+  0x54, 0xf0, 0x14, 0xf0, 0x23, 0xf0, 0x54, 0xf0, 0x14, 0xf0, 0x23, 0xf0,
+  0x54, 0xf0, 0x14, 0xf0, 0x14, 0xf0, 0x54, 0xb3, 0x24, 0x23, 0xb4, 0xf0,
+  0x54, 0xb4, 0x14, 0x14, 0xb4, 0xf0, 0x64, 0xae, 0xa4, 0xf0, 0x75, 0xac,
+  0xa5, 0xf0, 0x86, 0x9a, 0x96, 0xf0, 0xa7, 0x88, 0x87, 0xf0, 0xc6, 0x96,
+  0x96, 0xf0, 0xf4, 0xa4, 0xa4, 0xf1, 0x41, 0xb1, 0xc1, 0xff, 0xf0, 0xff,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf0, 0xc0,
+};
+const unsigned char wi_moon_alt_full_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xd8, 0x68, 0xf1, 0x96,
+  0xe6, 0xf1, 0x65, 0xf0, 0x35, 0xf1, 0x35, 0xf0, 0x75, 0xf1, 0x04, 0xf0,
+  0xb4, 0xf0, 0xe4, 0xf0, 0xd4, 0xf0, 0xc4, 0xf0, 0xf4, 0xf0, 0xb3, 0xf1,
+  0x13, 0xf0, 0xa3, 0xf1, 0x33, 0xf0, 0x83, 0xf1, 0x53, 0xf0, 0x73, 0xf1,
+  0x53, 0xf0, 0x63, 0xf1, 0x73, 0xf0, 0x53, 0xf1, 0x73, 0xf0, 0x43, 0xf1,
+  0x93, 0xf0, 0x33, 0xf1, 0x93, 0xf0, 0x32, 0xf1, 0xb2, 0xf0, 0x32, 0xf1,
+  0xb2, 0xf0, 0x23, 0xf1, 0xb3, 0xf0, 0x13, 0xf1, 0xb3, 0xf0, 0x13, 0xf1,
+  0xb3, 0xf0, 0x13, 0xf1, 0xb3, 0xf0, 0x13, 0xf1, 0xc2, 0xf0, 0x13, 0xf1,
+  0xb3, 0xf0, 0x13, 0xf1, 0xb3, 0xf0, 0x13, 0xf1, 0xb3, 0xf0, 0x13, 0xf1,
+  0xb3, 0xf0, 0x13, 0xf1, 0xb3, 0xf0, 0x22, 0xf1, 0xb2, 0xf0, 0x33, 0xf1,
+  0x93, 0xf0, 0x33, 0xf1, 0x93, 0xf0, 0x42, 0xf1, 0x92, 0xf0, 0x53, 0xf1,
+  0x73, 0xf0, 0x62, 0xf1, 0x73, 0xf0, 0x63, 0xf1, 0x53, 0xf0, 0x83, 0xf1,
+  0x33, 0xf0, 0x93, 0xf1, 0x33, 0xf0, 0xa3, 0xf1, 0x13, 0xf0, 0xc3, 0xf0,
+  0xf3, 0xf0, 0xe4, 0xf0, 0xc3, 0xf1, 0x04, 0xf0, 0x94, 0xf1, 0x25, 0xf0,
+  0x64, 0xf1, 0x46, 0xf0, 0x25, 0xf1, 0x76, 0xc6, 0xf1, 0xbf, 0x05, 0xf1,
+  0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0xff, 0xf0, 0xf3, 0x10,
+};
+const unsigned char wi_moon_alt_third_quarter_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x2b, 0xf1, 0x96,
+  0x7d, 0xf1, 0x65, 0x9e, 0xf1, 0x35, 0xbf, 0x01, 0xf1, 0x04, 0xdf, 0x02,
+  0xf0, 0xe4, 0xef, 0x03, 0xf0, 0xc4, 0xf0, 0x0f, 0x03, 0xf0, 0xc3, 0xf0,
+  0x1f, 0x04, 0xf0, 0xa3, 0xf0, 0x2f, 0x05, 0xf0, 0x83, 0xf0, 0x3f, 0x06,
+  0xf0, 0x73, 0xf0, 0x3f, 0x06, 0xf0, 0x63, 0xf0, 0x4f, 0x07, 0xf0, 0x53,
+  0xf0, 0x4f, 0x07, 0xf0, 0x52, 0xf0, 0x5f, 0x07, 0xf0, 0x43, 0xf0, 0x5f,
+  0x08, 0xf0, 0x33, 0xf0, 0x5f, 0x08, 0xf0, 0x32, 0xf0, 0x6f, 0x08, 0xf0,
+  0x23, 0xf0, 0x6f, 0x09, 0xf0, 0x13, 0xf0, 0x6f, 0x09, 0xf0, 0x13, 0xf0,
+  0x6f, 0x09, 0xf0, 0x13, 0xf0, 0x6f, 0x09, 0xf0, 0x13, 0xf0, 0x6f, 0x09,
+  0xf0, 0x13, 0xf0, 0x6f, 0x09, 0xf0, 0x13, 0xf0, 0x6f, 0x09, 0xf0, 0x13,
+  0xf0, 0x6f, 0x09, 0xf0, 0x13, 0xf0, 0x6f, 0x09, 0xf0, 0x13, 0xf0, 0x6f,
+  0x09, 0xf0, 0x22, 0xf0, 0x6f, 0x08, 0xf0, 0x33, 0xf0, 0x5f, 0x08, 0xf0,
+  0x33, 0xf0, 0x5f, 0x08, 0xf0, 0x42, 0xf0, 0x5f, 0x07, 0xf0, 0x53, 0xf0,
+  0x4f, 0x07, 0xf0, 0x62, 0xf0, 0x4f, 0x06, 0xf0, 0x73, 0xf0, 0x3f, 0x06,
+  0xf0, 0x83, 0xf0, 0x2f, 0x05, 0xf0, 0x93, 0xf0, 0x2f, 0x05, 0xf0, 0xa3,
+  0xf0, 0x1f, 0x04, 0xf0, 0xc3, 0xf0, 0x0f, 0x03, 0xf0, 0xe4, 0xdf, 0x02,
+  0xf1, 0x04, 0xcf, 0x01, 0xf1, 0x25, 0xaf, 0x00, 0xf1, 0x46, 0x8e, 0xf1,
+  0x76, 0x6c, 0xf1, 0xbf, 0x05, 0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0,
+  0xff, 0xf0, 0xf3, 0x10,
+};
+const unsigned char wi_moon_alt_waning_crescent_4_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xdf, 0x07, 0xf1, 0x96,
+  0x5f, 0x00, 0xf1, 0x65, 0x7f, 0x01, 0xf1, 0x35, 0x8f, 0x04, 0xf1, 0x04,
+  0x9f, 0x06, 0xf0, 0xe4, 0xaf, 0x07, 0xf0, 0xc4, 0xaf, 0x08, 0xf0, 0xc3,
+  0xbf, 0x09, 0xf0, 0xa3, 0xbf, 0x0b, 0xf0, 0x83, 0xcf, 0x0c, 0xf0, 0x73,
+  0xcf, 0x0c, 0xf0, 0x63, 0xcf, 0x0e, 0xf0, 0x53, 0xcf, 0x0e, 0xf0, 0x52,
+  0xdf, 0x0e, 0xf0, 0x43, 0xdf, 0x0f, 0xf0, 0x33, 0xcf, 0x10, 0xf0, 0x32,
+  0xdf, 0x10, 0xf0, 0x23, 0xdf, 0x11, 0xf0, 0x13, 0xdf, 0x11, 0xf0, 0x13,
+  0xdf, 0x11, 0xf0, 0x13, 0xdf, 0x11, 0xf0, 0x13, 0xdf, 0x11, 0xf0, 0x13,
+  0xdf, 0x11, 0xf0, 0x13, 0xdf, 0x11, 0xf0, 0x13, 0xdf, 0x11, 0xf0, 0x13,
+  0xdf, 0x11, 0xf0, 0x13, 0xdf, 0x11, 0xf0, 0x22, 0xdf, 0x10, 0xf0, 0x33,
+  0xcf, 0x10, 0xf0, 0x33, 0xcf, 0x10, 0xf0, 0x42, 0xdf, 0x0e, 0xf0, 0x53,
+  0xcf, 0x0e, 0xf0, 0x62, 0xcf, 0x0d, 0xf0, 0x73, 0xbf, 0x0d, 0xf0, 0x83,
+  0xbf, 0x0b, 0xf0, 0x93, 0xbf, 0x0b, 0xf0, 0xa3, 0xaf, 0x0a, 0xf0, 0xc3,
+  0xaf, 0x08, 0xf0, 0xe4, 0x8f, 0x07, 0xf1, 0x04, 0x8f, 0x05, 0xf1, 0x24,
+  0x8f, 0x03, 0xf1, 0x46, 0x5f, 0x02, 0xf1, 0x76, 0x4e, 0xf1, 0xbf, 0x05,
+  0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0xff, 0xf0, 0xf3, 0x10,
+};
+const unsigned char wi_moon_alt_waning_crescent_5_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xdf, 0x07, 0xf1, 0x96,
+  0x4f, 0x01, 0xf1, 0x65, 0x4f, 0x04, 0xf1, 0x35, 0x5f, 0x07, 0xf1, 0x04,
+  0x7f, 0x08, 0xf0, 0xe4, 0x7f, 0x0a, 0xf0, 0xc4, 0x7f, 0x0b, 0xf0, 0xc3,
+  0x7f, 0x0d, 0xf0, 0xa3, 0x8f, 0x0e, 0xf0, 0x83, 0x8f, 0x10, 0xf0, 0x73,
+  0x8f, 0x10, 0xf0, 0x63, 0x8f, 0x12, 0xf0, 0x53, 0x8f, 0x12, 0xf0, 0x52,
+  0x9f, 0x12, 0xf0, 0x43, 0x8f, 0x14, 0xf0, 0x33, 0x8f, 0x14, 0xf0, 0x32,
+  0x9f, 0x14, 0xf0, 0x23, 0x9f, 0x15, 0xf0, 0x13, 0x9f, 0x15, 0xf0, 0x13,
+  0x9f, 0x15, 0xf0, 0x13, 0x9f, 0x15, 0xf0, 0x13, 0x8f, 0x16, 0xf0, 0x13,
+  0x8f, 0x16, 0xf0, 0x13, 0x9f, 0x15, 0xf0, 0x13, 0x9f, 0x15, 0xf0, 0x13,
+  0x9f, 0x15, 0xf0, 0x13, 0x9f, 0x15, 0xf0, 0x22, 0x9f, 0x14, 0xf0, 0x33,
+  0x8f, 0x14, 0xf0, 0x33, 0x8f, 0x14, 0xf0, 0x42, 0x8f, 0x13, 0xf0, 0x53,
+  0x8f, 0x12, 0xf0, 0x62, 0x8f, 0x11, 0xf0, 0x73, 0x7f, 0x11, 0xf0, 0x83,
+  0x7f, 0x0f, 0xf0, 0x93, 0x7f, 0x0f, 0xf0, 0xa3, 0x7f, 0x0d, 0xf0, 0xc3,
+  0x6f, 0x0c, 0xf0, 0xe4, 0x5f, 0x0a, 0xf1, 0x04, 0x5f, 0x08, 0xf1, 0x25,
+  0x4f, 0x06, 0xf1, 0x46, 0x3f, 0x04, 0xf1, 0x76, 0x3f, 0x00, 0xf1, 0xbf,
+  0x05, 0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0xff, 0xf0, 0xf3, 0x10,
+};
+const unsigned char wi_moon_alt_waning_crescent_6_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xdf, 0x07, 0xf1, 0x96,
+  0x3f, 0x02, 0xf1, 0x65, 0x3f, 0x05, 0xf1, 0x35, 0x4f, 0x08, 0xf1, 0x04,
+  0x5f, 0x0a, 0xf0, 0xe4, 0x5f, 0x0c, 0xf0, 0xc4, 0x5f, 0x0d, 0xf0, 0xc3,
+  0x6f, 0x0e, 0xf0, 0xa3, 0x6f, 0x10, 0xf0, 0x83, 0x6f, 0x12, 0xf0, 0x73,
+  0x6f, 0x12, 0xf0, 0x63, 0x6f, 0x14, 0xf0, 0x53, 0x6f, 0x14, 0xf0, 0x52,
+  0x7f, 0x14, 0xf0, 0x43, 0x6f, 0x16, 0xf0, 0x33, 0x6f, 0x16, 0xf0, 0x32,
+  0x7f, 0x16, 0xf0, 0x23, 0x7f, 0x17, 0xf0, 0x13, 0x6f, 0x18, 0xf0, 0x13,
+  0x6f, 0x18, 0xf0, 0x13, 0x6f, 0x18, 0xf0, 0x13, 0x6f, 0x18, 0xf0, 0x13,
+  0x6f, 0x18, 0xf0, 0x13, 0x6f, 0x18, 0xf0, 0x13, 0x6f, 0x18, 0xf0, 0x13,
+  0x6f, 0x18, 0xf0, 0x13, 0x7f, 0x17, 0xf0, 0x22, 0x7f, 0x16, 0xf0, 0x33,
+  0x6f, 0x16, 0xf0, 0x33, 0x6f, 0x16, 0xf0, 0x42, 0x6f, 0x15, 0xf0, 0x53,
+  0x6f, 0x14, 0xf0, 0x62, 0x6f, 0x13, 0xf0, 0x73, 0x5f, 0x13, 0xf0, 0x83,
+  0x5f, 0x11, 0xf0, 0x93, 0x5f, 0x11, 0xf0, 0xa3, 0x5f, 0x0f, 0xf0, 0xc3,
+  0x5f, 0x0d, 0xf0, 0xe4, 0x4f, 0x0b, 0xf1, 0x04, 0x4f, 0x09, 0xf1, 0x24,
+  0x4f, 0x07, 0xf1, 0x45, 0x3f, 0x05, 0xf1, 0x76, 0x1f, 0x02, 0xf1, 0xbf,
+  0x05, 0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0xff, 0xf0, 0xf3, 0x10,
+};
+const unsigned char wi_moon_alt_waning_gibbous_1_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x58, 0xf1, 0x96,
+  0xc8, 0xf1, 0x65, 0xf0, 0x17, 0xf1, 0x44, 0xf0, 0x48, 0xf1, 0x04, 0xf0,
+  0x78, 0xf0, 0xe4, 0xf0, 0x98, 0xf0, 0xd3, 0xf0, 0xb8, 0xf0, 0xb3, 0xf0,
+  0xc8, 0xf0, 0xa3, 0xf0, 0xe8, 0xf0, 0x83, 0xf1, 0x08, 0xf0, 0x73, 0xf1,
+  0x08, 0xf0, 0x63, 0xf1, 0x28, 0xf0, 0x53, 0xf1, 0x28, 0xf0, 0x43, 0xf1,
+  0x39, 0xf0, 0x33, 0xf1, 0x48, 0xf0, 0x33, 0xf1, 0x48, 0xf0, 0x32, 0xf1,
+  0x58, 0xf0, 0x23, 0xf1, 0x59, 0xf0, 0x13, 0xf1, 0x59, 0xf0, 0x13, 0xf1,
+  0x68, 0xf0, 0x13, 0xf1, 0x68, 0xf0, 0x13, 0xf1, 0x68, 0xf0, 0x13, 0xf1,
+  0x68, 0xf0, 0x13, 0xf1, 0x68, 0xf0, 0x13, 0xf1, 0x68, 0xf0, 0x13, 0xf1,
+  0x59, 0xf0, 0x13, 0xf1, 0x59, 0xf0, 0x22, 0xf1, 0x58, 0xf0, 0x33, 0xf1,
+  0x48, 0xf0, 0x33, 0xf1, 0x48, 0xf0, 0x42, 0xf1, 0x47, 0xf0, 0x53, 0xf1,
+  0x28, 0xf0, 0x62, 0xf1, 0x27, 0xf0, 0x73, 0xf1, 0x17, 0xf0, 0x83, 0xf0,
+  0xf7, 0xf0, 0x94, 0xf0, 0xe7, 0xf0, 0xa3, 0xf0, 0xd7, 0xf0, 0xc3, 0xf0,
+  0xb7, 0xf0, 0xe4, 0xf0, 0x87, 0xf1, 0x04, 0xf0, 0x67, 0xf1, 0x25, 0xf0,
+  0x37, 0xf1, 0x46, 0xf0, 0x07, 0xf1, 0x76, 0xb7, 0xf1, 0xbf, 0x05, 0xf1,
+  0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0xff, 0xf0, 0xf3, 0x10,
+};
+const unsigned char wi_moon_alt_waning_gibbous_2_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x49, 0xf1, 0x96,
+  0xaa, 0xf1, 0x65, 0xe9, 0xf1, 0x35, 0xf0, 0x2a, 0xf1, 0x04, 0xf0, 0x4b,
+  0xf0, 0xe4, 0xf0, 0x6b, 0xf0, 0xc4, 0xf0, 0x8a, 0xf0, 0xc3, 0xf0, 0xaa,
+  0xf0, 0xa3, 0xf0, 0xbb, 0xf0, 0x83, 0xf0, 0xdb, 0xf0, 0x73, 0xf0, 0xdb,
+  0xf0, 0x63, 0xf0, 0xfb, 0xf0, 0x53, 0xf0, 0xfb, 0xf0, 0x52, 0xf1, 0x0b,
+  0xf0, 0x43, 0xf1, 0x0c, 0xf0, 0x33, 0xf1, 0x1b, 0xf0, 0x32, 0xf1, 0x2b,
+  0xf0, 0x23, 0xf1, 0x2c, 0xf0, 0x13, 0xf1, 0x2c, 0xf0, 0x13, 0xf1, 0x2c,
+  0xf0, 0x13, 0xf1, 0x2c, 0xf0, 0x13, 0xf1, 0x2c, 0xf0, 0x13, 0xf1, 0x2c,
+  0xf0, 0x13, 0xf1, 0x2c, 0xf0, 0x13, 0xf1, 0x2c, 0xf0, 0x13, 0xf1, 0x2c,
+  0xf0, 0x13, 0xf1, 0x2c, 0xf0, 0x22, 0xf1, 0x2b, 0xf0, 0x33, 0xf1, 0x1b,
+  0xf0, 0x33, 0xf1, 0x1b, 0xf0, 0x42, 0xf1, 0x0b, 0xf0, 0x53, 0xf0, 0xfb,
+  0xf0, 0x62, 0xf0, 0xfa, 0xf0, 0x73, 0xf0, 0xea, 0xf0, 0x83, 0xf0, 0xca,
+  0xf0, 0x93, 0xf0, 0xca, 0xf0, 0xa3, 0xf0, 0xaa, 0xf0, 0xc3, 0xf0, 0x8a,
+  0xf0, 0xe4, 0xf0, 0x69, 0xf1, 0x04, 0xf0, 0x49, 0xf1, 0x25, 0xf0, 0x19,
+  0xf1, 0x46, 0xd9, 0xf1, 0x76, 0x99, 0xf1, 0xbf, 0x05, 0xf1, 0xff, 0x01,
+  0xf2, 0x58, 0xff, 0xf0, 0xff, 0xf0, 0xf3, 0x10,
+};
+const unsigned char wi_moon_alt_waning_gibbous_3_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x3a, 0xf1, 0x96,
+  0x9b, 0xf1, 0x65, 0xcb, 0xf1, 0x35, 0xf0, 0x0c, 0xf1, 0x04, 0xf0, 0x3c,
+  0xf0, 0xe4, 0xf0, 0x4d, 0xf0, 0xc4, 0xf0, 0x6c, 0xf0, 0xc3, 0xf0, 0x8c,
+  0xf0, 0xa3, 0xf0, 0x9d, 0xf0, 0x83, 0xf0, 0xae, 0xf0, 0x73, 0xf0, 0xbd,
+  0xf0, 0x63, 0xf0, 0xce, 0xf0, 0x53, 0xf0, 0xce, 0xf0, 0x52, 0xf0, 0xed,
+  0xf0, 0x43, 0xf0, 0xee, 0xf0, 0x33, 0xf0, 0xee, 0xf0, 0x32, 0xf0, 0xfe,
+  0xf0, 0x23, 0xf0, 0xff, 0x00, 0xf0, 0x13, 0xf1, 0x0e, 0xf0, 0x13, 0xf1,
+  0x0e, 0xf0, 0x13, 0xf1, 0x0e, 0xf0, 0x13, 0xf1, 0x0e, 0xf0, 0x13, 0xf1,
+  0x0e, 0xf0, 0x13, 0xf1, 0x0e, 0xf0, 0x13, 0xf1, 0x0e, 0xf0, 0x13, 0xf1,
+  0x0e, 0xf0, 0x13, 0xf1, 0x0e, 0xf0, 0x22, 0xf0, 0xfe, 0xf0, 0x33, 0xf0,
+  0xee, 0xf0, 0x33, 0xf0, 0xee, 0xf0, 0x42, 0xf0, 0xed, 0xf0, 0x53, 0xf0,
+  0xdd, 0xf0, 0x62, 0xf0, 0xcd, 0xf0, 0x73, 0xf0, 0xbd, 0xf0, 0x83, 0xf0,
+  0xac, 0xf0, 0x93, 0xf0, 0x9d, 0xf0, 0xa3, 0xf0, 0x8c, 0xf0, 0xc3, 0xf0,
+  0x6c, 0xf0, 0xe4, 0xf0, 0x4b, 0xf1, 0x04, 0xf0, 0x2b, 0xf1, 0x25, 0xeb,
+  0xf1, 0x46, 0xbb, 0xf1, 0x76, 0x8a, 0xf1, 0xbf, 0x05, 0xf1, 0xff, 0x01,
+  0xf2, 0x58, 0xff, 0xf0, 0xff, 0xf0, 0xf3, 0x10,
+};
+const unsigned char wi_moon_alt_waning_gibbous_4_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x2b, 0xf1, 0x96,
+  0x8c, 0xf1, 0x65, 0xbc, 0xf1, 0x35, 0xed, 0xf1, 0x04, 0xf0, 0x1e, 0xf0,
+  0xe4, 0xf0, 0x3e, 0xf0, 0xc4, 0xf0, 0x4e, 0xf0, 0xc3, 0xf0, 0x6e, 0xf0,
+  0xa3, 0xf0, 0x7f, 0x00, 0xf0, 0x83, 0xf0, 0x8f, 0x01, 0xf0, 0x73, 0xf0,
+  0x9f, 0x00, 0xf0, 0x63, 0xf0, 0xaf, 0x01, 0xf0, 0x53, 0xf0, 0xaf, 0x01,
+  0xf0, 0x52, 0xf0, 0xbf, 0x01, 0xf0, 0x43, 0xf0, 0xbf, 0x02, 0xf0, 0x33,
+  0xf0, 0xcf, 0x01, 0xf0, 0x32, 0xf0, 0xdf, 0x01, 0xf0, 0x23, 0xf0, 0xdf,
+  0x02, 0xf0, 0x13, 0xf0, 0xdf, 0x02, 0xf0, 0x13, 0xf0, 0xdf, 0x02, 0xf0,
+  0x13, 0xf0, 0xdf, 0x02, 0xf0, 0x13, 0xf0, 0xdf, 0x02, 0xf0, 0x13, 0xf0,
+  0xdf, 0x02, 0xf0, 0x13, 0xf0, 0xdf, 0x02, 0xf0, 0x13, 0xf0, 0xdf, 0x02,
+  0xf0, 0x13, 0xf0, 0xdf, 0x02, 0xf0, 0x13, 0xf0, 0xdf, 0x02, 0xf0, 0x22,
+  0xf0, 0xdf, 0x01, 0xf0, 0x33, 0xf0, 0xcf, 0x01, 0xf0, 0x33, 0xf0, 0xcf,
+  0x01, 0xf0, 0x42, 0xf0, 0xbf, 0x01, 0xf0, 0x53, 0xf0, 0xaf, 0x01, 0xf0,
+  0x62, 0xf0, 0xaf, 0x00, 0xf0, 0x73, 0xf0, 0x9f, 0x00, 0xf0, 0x83, 0xf0,
+  0x8e, 0xf0, 0x93, 0xf0, 0x7f, 0x00, 0xf0, 0xa3, 0xf0, 0x6e, 0xf0, 0xc3,
+  0xf0, 0x4e, 0xf0, 0xe4, 0xf0, 0x2d, 0xf1, 0x04, 0xf0, 0x0d, 0xf1, 0x25,
+  0xdc, 0xf1, 0x46, 0xac, 0xf1, 0x76, 0x7b, 0xf1, 0xbf, 0x05, 0xf1, 0xff,
+  0x01, 0xf2, 0x58, 0xff, 0xf0, 0xff, 0xf0, 0xf3, 0x10,
+};
+const unsigned char wi_moon_alt_waning_gibbous_5_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x3a, 0xf1, 0x96,
+  0x9b, 0xf1, 0x65, 0xbc, 0xf1, 0x35, 0xde, 0xf1, 0x04, 0xf0, 0x1e, 0xf0,
+  0xe4, 0xf0, 0x2f, 0x00, 0xf0, 0xc4, 0xf0, 0x4e, 0xf0, 0xc3, 0xf0, 0x5f,
+  0x00, 0xf0, 0xa3, 0xf0, 0x6f, 0x01, 0xf0, 0x83, 0xf0, 0x7f, 0x02, 0xf0,
+  0x73, 0xf0, 0x7f, 0x02, 0xf0, 0x63, 0xf0, 0x9f, 0x02, 0xf0, 0x53, 0xf0,
+  0x9f, 0x02, 0xf0, 0x52, 0xf0, 0xaf, 0x02, 0xf0, 0x43, 0xf0, 0xaf, 0x03,
+  0xf0, 0x33, 0xf0, 0xaf, 0x03, 0xf0, 0x32, 0xf0, 0xbf, 0x03, 0xf0, 0x23,
+  0xf0, 0xbf, 0x04, 0xf0, 0x13, 0xf0, 0xbf, 0x04, 0xf0, 0x13, 0xf0, 0xbf,
+  0x04, 0xf0, 0x13, 0xf0, 0xbf, 0x04, 0xf0, 0x13, 0xf0, 0xbf, 0x04, 0xf0,
+  0x13, 0xf0, 0xbf, 0x04, 0xf0, 0x13, 0xf0, 0xbf, 0x04, 0xf0, 0x13, 0xf0,
+  0xbf, 0x04, 0xf0, 0x13, 0xf0, 0xbf, 0x04, 0xf0, 0x13, 0xf0, 0xbf, 0x04,
+  0xf0, 0x22, 0xf0, 0xbf, 0x03, 0xf0, 0x33, 0xf0, 0xaf, 0x03, 0xf0, 0x33,
+  0xf0, 0xaf, 0x03, 0xf0, 0x42, 0xf0, 0xaf, 0x02, 0xf0, 0x53, 0xf0, 0x9f,
+  0x02, 0xf0, 0x62, 0xf0, 0x9f, 0x01, 0xf0, 0x73, 0xf0, 0x8f, 0x01, 0xf0,
+  0x83, 0xf0, 0x6f, 0x01, 0xf0, 0x93, 0xf0, 0x6f, 0x01, 0xf0, 0xa3, 0xf0,
+  0x5f, 0x00, 0xf0, 0xc3, 0xf0, 0x4e, 0xf0, 0xe4, 0xf0, 0x1e, 0xf1, 0x04,
+  0xf0, 0x0d, 0xf1, 0x25, 0xdc, 0xf1, 0x46, 0xac, 0xf1, 0x76, 0x8a, 0xf1,
+  0xbf, 0x05, 0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0xff, 0xf0, 0xf3,
+  0x10,
+};
+const unsigned char wi_moon_alt_waning_gibbous_6_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x2b, 0xf1, 0x96,
+  0x8c, 0xf1, 0x65, 0xad, 0xf1, 0x35, 0xcf, 0x00, 0xf1, 0x04, 0xf0, 0x0f,
+  0x00, 0xf0, 0xe4, 0xf0, 0x1f, 0x01, 0xf0, 0xc4, 0xf0, 0x2f, 0x01, 0xf0,
+  0xc3, 0xf0, 0x3f, 0x02, 0xf0, 0xa3, 0xf0, 0x4f, 0x03, 0xf0, 0x83, 0xf0,
+  0x5f, 0x04, 0xf0, 0x73, 0xf0, 0x5f, 0x04, 0xf0, 0x63, 0xf0, 0x6f, 0x05,
+  0xf0, 0x53, 0xf0, 0x7f, 0x04, 0xf0, 0x52, 0xf0, 0x8f, 0x04, 0xf0, 0x43,
+  0xf0, 0x8f, 0x05, 0xf0, 0x33, 0xf0, 0x8f, 0x05, 0xf0, 0x32, 0xf0, 0x9f,
+  0x05, 0xf0, 0x23, 0xf0, 0x9f, 0x06, 0xf0, 0x13, 0xf0, 0x9f, 0x06, 0xf0,
+  0x13, 0xf0, 0x9f, 0x06, 0xf0, 0x13, 0xf0, 0x9f, 0x06, 0xf0, 0x13, 0xf0,
+  0x9f, 0x06, 0xf0, 0x13, 0xf0, 0x9f, 0x06, 0xf0, 0x13, 0xf0, 0x9f, 0x06,
+  0xf0, 0x13, 0xf0, 0x9f, 0x06, 0xf0, 0x13, 0xf0, 0x9f, 0x06, 0xf0, 0x13,
+  0xf0, 0x9f, 0x06, 0xf0, 0x22, 0xf0, 0x9f, 0x05, 0xf0, 0x33, 0xf0, 0x8f,
+  0x05, 0xf0, 0x33, 0xf0, 0x8f, 0x05, 0xf0, 0x42, 0xf0, 0x8f, 0x04, 0xf0,
+  0x53, 0xf0, 0x7f, 0x04, 0xf0, 0x62, 0xf0, 0x7f, 0x03, 0xf0, 0x73, 0xf0,
+  0x5f, 0x04, 0xf0, 0x83, 0xf0, 0x4f, 0x03, 0xf0, 0x93, 0xf0, 0x4f, 0x03,
+  0xf0, 0xa3, 0xf0, 0x3f, 0x02, 0xf0, 0xc3, 0xf0, 0x2f, 0x01, 0xf0, 0xe4,
+  0xf0, 0x0f, 0x00, 0xf1, 0x04, 0xee, 0xf1, 0x25, 0xbe, 0xf1, 0x46, 0x9d,
+  0xf1, 0x76, 0x7b, 0xf1, 0xbf, 0x05, 0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff,
+  0xf0, 0xff, 0xf0, 0xf3, 0x10,
+};
+const unsigned char wi_moon_full_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xdf, 0x07, 0xf1, 0x9f,
+  0x0b, 0xf1, 0x6f, 0x0d, 0xf1, 0x3f, 0x11, 0xf1, 0x0f, 0x13, 0xf0, 0xef,
+  0x15, 0xf0, 0xdf, 0x15, 0xf0, 0xcf, 0x17, 0xf0, 0xaf, 0x19, 0xf0, 0x8f,
+  0x1b, 0xf0, 0x7f, 0x1b, 0xf0, 0x6f, 0x1d, 0xf0, 0x5f, 0x1d, 0xf0, 0x4f,
+  0x1f, 0xf0, 0x3f, 0x1f, 0xf0, 0x3f, 0x1f, 0xf0, 0x3f, 0x1f, 0xf0, 0x2f,
+  0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f,
+  0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f,
+  0x21, 0xf0, 0x1f, 0x20, 0xf0, 0x3f, 0x1f, 0xf0, 0x3f, 0x1f, 0xf0, 0x3f,
+  0x1f, 0xf0, 0x4f, 0x1d, 0xf0, 0x5f, 0x1d, 0xf0, 0x6f, 0x1b, 0xf0, 0x7f,
+  0x1b, 0xf0, 0x8f, 0x19, 0xf0, 0x9f, 0x19, 0xf0, 0xaf, 0x17, 0xf0, 0xcf,
+  0x15, 0xf0, 0xef, 0x13, 0xf1, 0x0f, 0x11, 0xf1, 0x2f, 0x0f, 0xf1, 0x4f,
+  0x0d, 0xf1, 0x7f, 0x09, 0xf1, 0xbf, 0x05, 0xf1, 0xff, 0x01, 0xf2, 0x58,
+  0xff, 0xf0, 0xff, 0xf0, 0xf3, 0x10,
+};
+const unsigned char wi_strong_wind_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfa, 0xa4, 0xf2, 0xc7,
+  0xf2, 0x99, 0xf2, 0x8a, 0xf2, 0x73, 0x34, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2,
+  0xd4, 0xf0, 0x0f, 0x22, 0xef, 0x22, 0xf0, 0x0f, 0x21, 0xf0, 0x1f, 0x20,
+  0xfc, 0x3f, 0x12, 0xf0, 0xff, 0x15, 0xf0, 0xdf, 0x16, 0xf0, 0xcf, 0x17,
+  0xf2, 0xd5, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0x72, 0x44, 0xf2, 0x6b, 0xf2,
+  0x6a, 0xf2, 0x88, 0xf2, 0xa6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+  0xf0, 0xf4, 0xe0,
+};
+const unsigned char wi_sunrise_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfc, 0x14, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4,
+  0xf2, 0xd4, 0xf2, 0xd4, 0xf1, 0xc4, 0xd4, 0xd4, 0xf0, 0xb5, 0xd2, 0xd5,
+  0xf0, 0xb6, 0xf0, 0xb6, 0xf0, 0xc6, 0xf0, 0x96, 0xf0, 0xe5, 0xf0, 0x95,
+  0xf1, 0x05, 0xf0, 0x84, 0xf1, 0x23, 0x96, 0x93, 0xf1, 0xcc, 0xf2, 0x3f,
+  0x01, 0xf2, 0x0f, 0x03, 0xf1, 0xe8, 0x48, 0xf1, 0xd5, 0xa5, 0xf1, 0xc5,
+  0xc5, 0xf1, 0xa5, 0xe5, 0xf1, 0x94, 0xf0, 0x14, 0xf1, 0x94, 0xf0, 0x14,
+  0xf1, 0x85, 0xf0, 0x15, 0xf0, 0xa8, 0x54, 0xf0, 0x34, 0x58, 0xc9, 0x44,
+  0xf0, 0x34, 0x49, 0xc9, 0x44, 0xf0, 0x34, 0x49, 0xd7, 0x54, 0xf0, 0x25,
+  0x57, 0xf0, 0xb5, 0xf0, 0x15, 0xf1, 0x84, 0x71, 0x84, 0xf1, 0x95, 0x54,
+  0x55, 0xf1, 0xa4, 0x46, 0x44, 0xf2, 0x28, 0xf2, 0x8a, 0xf2, 0x6c, 0xf2,
+  0x46, 0x26, 0xf1, 0xcc, 0x4d, 0xf1, 0x3c, 0x6c, 0xf1, 0x4a, 0x8b, 0xf1,
+  0x58, 0xa9, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf0, 0xb0,
+};
+const unsigned char wi_sunset_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfc, 0x22, 0xf2, 0xe4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4,
+  0xf2, 0xd4, 0xf2, 0xd4, 0xf1, 0xd2, 0xe4, 0xe2, 0xf0, 0xc4, 0xd4, 0xd4,
+  0xf0, 0xb5, 0xf0, 0xd5, 0xf0, 0xc5, 0xf0, 0xb5, 0xf0, 0xe5, 0xf0, 0x95,
+  0xf1, 0x05, 0xf0, 0x75, 0xf1, 0x24, 0x94, 0xa3, 0xf1, 0x42, 0x7a, 0x72,
+  0xf1, 0xce, 0xf2, 0x2f, 0x01, 0xf2, 0x0f, 0x03, 0xf1, 0xe6, 0x86, 0xf1,
+  0xc6, 0xa6, 0xf1, 0xb5, 0xc5, 0xf1, 0xa5, 0xe5, 0xf1, 0x94, 0xf0, 0x14,
+  0xf1, 0x94, 0xf0, 0x14, 0xf0, 0xc7, 0x64, 0xf0, 0x15, 0x57, 0xd9, 0x44,
+  0xf0, 0x34, 0x49, 0xc9, 0x44, 0xf0, 0x34, 0x49, 0xd7, 0x55, 0xf0, 0x15,
+  0x57, 0xf0, 0xc4, 0xf0, 0x14, 0xf1, 0x94, 0xf0, 0x14, 0xf1, 0x95, 0xe5,
+  0xf1, 0xa4, 0xe4, 0xfe, 0xc7, 0xf1, 0x6a, 0x8a, 0xf1, 0x4c, 0x6c, 0xf1,
+  0x4c, 0x4c, 0xf1, 0x6c, 0x2c, 0xf1, 0xec, 0xf2, 0x6a, 0xf2, 0x88, 0xf2,
+  0xa6, 0xf2, 0xc4, 0xf2, 0xe1, 0xff, 0xf0, 0xff, 0xf0, 0xfb, 0x50,
+};
+const unsigned char wi_time_5_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xfb, 0xdc, 0xf2, 0x2f, 0x03, 0xf1, 0xdf, 0x07, 0xf1, 0x9f,
+  0x0b, 0xf1, 0x6f, 0x0d, 0xf1, 0x4b, 0x8c, 0xf1, 0x0a, 0xea, 0xf0, 0xe9,
+  0xf0, 0x39, 0xf0, 0xd7, 0xa2, 0xa8, 0xf0, 0xb7, 0xa4, 0xa7, 0xf0, 0xa7,
+  0xb4, 0xb7, 0xf0, 0x87, 0xc4, 0xc7, 0xf0, 0x76, 0xd4, 0xd6, 0xf0, 0x66,
+  0xe4, 0xe6, 0xf0, 0x56, 0xe4, 0xe6, 0xf0, 0x46, 0xf0, 0x04, 0xf0, 0x05,
+  0xf0, 0x46, 0xf0, 0x04, 0xf0, 0x06, 0xf0, 0x35, 0xf0, 0x14, 0xf0, 0x15,
+  0xf0, 0x35, 0xf0, 0x14, 0xf0, 0x15, 0xf0, 0x26, 0xf0, 0x14, 0xf0, 0x16,
+  0xf0, 0x16, 0xf0, 0x14, 0xf0, 0x16, 0xf0, 0x15, 0xf0, 0x24, 0xf0, 0x25,
+  0xf0, 0x15, 0xf0, 0x24, 0xf0, 0x25, 0xf0, 0x15, 0xf0, 0x24, 0xf0, 0x25,
+  0xf0, 0x15, 0xf0, 0x24, 0xf0, 0x25, 0xf0, 0x15, 0xf0, 0x34, 0xf0, 0x15,
+  0xf0, 0x15, 0xf0, 0x34, 0xf0, 0x15, 0xf0, 0x16, 0xf0, 0x34, 0xe6, 0xf0,
+  0x16, 0xf0, 0x35, 0xd6, 0xf0, 0x25, 0xf0, 0x44, 0xd5, 0xf0, 0x35, 0xf0,
+  0x54, 0xc5, 0xf0, 0x36, 0xf0, 0x44, 0xb6, 0xf0, 0x45, 0xf0, 0x53, 0xb5,
+  0xf0, 0x56, 0xf0, 0x43, 0xa6, 0xf0, 0x57, 0xf0, 0xf6, 0xf0, 0x76, 0xf0,
+  0xf6, 0xf0, 0x86, 0xf0, 0xd6, 0xf0, 0x97, 0xf0, 0xb7, 0xf0, 0xa7, 0xf0,
+  0x97, 0xf0, 0xc8, 0xf0, 0x58, 0xf0, 0xe8, 0xf0, 0x38, 0xf1, 0x0a, 0xca,
+  0xf1, 0x2d, 0x3e, 0xf1, 0x4f, 0x0d, 0xf1, 0x7f, 0x09, 0xf1, 0xbf, 0x05,
+  0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0xff, 0xf0, 0xf3, 0x10,
+};
+const unsigned char wifi_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x46, 0xf2, 0x5f, 0x03, 0xf1,
+  0xcf, 0x09, 0xf1, 0x7f, 0x0e, 0xf1, 0x2f, 0x11, 0xf0, 0xff, 0x15, 0xf0,
+  0xbd, 0xed, 0xf0, 0x8b, 0xf0, 0x5b, 0xf0, 0x69, 0xf0, 0xb9, 0xf0, 0x49,
+  0xf0, 0xe9, 0xf0, 0x18, 0xf1, 0x19, 0xe7, 0xda, 0xd7, 0xe6, 0xbf, 0x01,
+  0xb6, 0xe5, 0x9f, 0x07, 0x95, 0xf0, 0x03, 0x9f, 0x0a, 0x83, 0xf0, 0xbf,
+  0x0d, 0xf1, 0x4d, 0x4d, 0xf1, 0x2a, 0xca, 0xf1, 0x08, 0xf0, 0x38, 0xf0,
+  0xe8, 0xf0, 0x58, 0xf0, 0xd6, 0xf0, 0x96, 0xf0, 0xe4, 0xf0, 0xb4, 0xf1,
+  0x01, 0xaa, 0xa1, 0xf1, 0xae, 0xf2, 0x2f, 0x01, 0xf2, 0x0f, 0x03, 0xf1,
+  0xef, 0x05, 0xf1, 0xd7, 0x67, 0xf1, 0xd5, 0xa5, 0xf1, 0xe3, 0xc3, 0xfa,
+  0x72, 0xf2, 0xe4, 0xf2, 0xc6, 0xf2, 0xb6, 0xf2, 0xc4, 0xf2, 0xe2, 0xff,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x60,
+};
+const unsigned char wifi_1_bar_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0,
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfc, 0x42, 0xf2, 0xe4,
+  0xf2, 0xc6, 0xf2, 0xb6, 0xf2, 0xc4, 0xf2, 0xe2, 0xff, 0xf0, 0xff, 0xf0,
+  0xff, 0xf0, 0xf2, 0x60,
+};
+const unsigned char wifi_2_bar_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0,
+  0xff, 0xf0, 0xff, 0xf0, 0xf5, 0xca, 0xf2, 0x5e, 0xf2, 0x2f, 0x01, 0xf2,
+  0x0f, 0x03, 0xf1, 0xef, 0x05, 0xf1, 0xd7, 0x67, 0xf1, 0xd5, 0xa5, 0xf1,
+  0xe3, 0xc3, 0xfa, 0x72, 0xf2, 0xe4, 0xf2, 0xc6, 0xf2, 0xb6, 0xf2, 0xc4,
+  0xf2, 0xe2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x60,
+};
+const unsigned char wifi_3_bar_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfc, 0x6a,
+  0xf2, 0x4f, 0x01, 0xf1, 0xef, 0x07, 0xf1, 0xaf, 0x0a, 0xf1, 0x6f, 0x0d,
+  0xf1, 0x4d, 0x4d, 0xf1, 0x2a, 0xca, 0xf1, 0x08, 0xf0, 0x38, 0xf0, 0xe8,
+  0xf0, 0x58, 0xf0, 0xd6, 0xf0, 0x96, 0xf0, 0xe4, 0xf0, 0xb4, 0xf1, 0x01,
+  0xaa, 0xa1, 0xf1, 0xae, 0xf2, 0x2f, 0x01, 0xf2, 0x0f, 0x03, 0xf1, 0xef,
+  0x05, 0xf1, 0xd7, 0x67, 0xf1, 0xd5, 0xa5, 0xf1, 0xe3, 0xc3, 0xfa, 0x72,
+  0xf2, 0xe4, 0xf2, 0xc6, 0xf2, 0xb6, 0xf2, 0xc4, 0xf2, 0xe2, 0xff, 0xf0,
+  0xff, 0xf0, 0xff, 0xf0, 0xf2, 0x60,
+};
+const unsigned char wifi_off_64x64_rle[] PROGMEM = {
+  0xff, 0xf0, 0xf2, 0xa2, 0xf2, 0xe4, 0xf2, 0xc6, 0xf2, 0xb7, 0xf2, 0xb7,
+  0xf2, 0xb7, 0xf2, 0xb7, 0xf2, 0xb7, 0xf2, 0xb7, 0xc6, 0xf1, 0x97, 0x7f,
+  0x01, 0xf1, 0x47, 0x6f, 0x04, 0xf1, 0x27, 0x4f, 0x07, 0xf1, 0x17, 0x4f,
+  0x08, 0xf0, 0xf8, 0x4f, 0x09, 0xf0, 0xbb, 0xf0, 0x1d, 0xf0, 0x8d, 0xf0,
+  0x3b, 0xf0, 0x6f, 0x00, 0xf0, 0x59, 0xf0, 0x49, 0x17, 0xf0, 0x59, 0xf0,
+  0x28, 0x47, 0xf0, 0x68, 0xf0, 0x07, 0x77, 0xf0, 0x68, 0xe6, 0x97, 0x83,
+  0xb6, 0xe5, 0x99, 0x67, 0x95, 0xf0, 0x03, 0x9b, 0x58, 0x93, 0xf0, 0xbe,
+  0x4a, 0xf1, 0x4f, 0x01, 0x3b, 0xf1, 0x2a, 0x17, 0x4a, 0xf1, 0x08, 0x57,
+  0x68, 0xf0, 0xe8, 0x77, 0x68, 0xf0, 0xd6, 0xa7, 0x76, 0xf0, 0xe4, 0xc7,
+  0x74, 0xf1, 0x01, 0xac, 0x72, 0xf1, 0xaf, 0x00, 0xf2, 0x1f, 0x02, 0xf1,
+  0xff, 0x04, 0xf1, 0xdf, 0x06, 0xf1, 0xc7, 0x69, 0xf1, 0xb5, 0xa8, 0xf1,
+  0xb3, 0xc8, 0xf2, 0xb7, 0xf2, 0xb7, 0xf2, 0x02, 0x97, 0xf1, 0xe4, 0x97,
+  0xf1, 0xc6, 0x97, 0xf1, 0xb6, 0xa7, 0xf1, 0xb4, 0xc7, 0xf1, 0xb2, 0xe7,
+  0xf2, 0xb7, 0xf2, 0xb7, 0xf2, 0xb7, 0xf2, 0xb7, 0xf2, 0xb7, 0xf2, 0xb6,
+  0xf2, 0xc4, 0xf2, 0xe2, 0xff, 0xf0, 0xf2, 0xa0,
+};
+
+inline const unsigned char* getCompressedBitmap(icon_name_t icon, size_t size)
+{
+  switch (icon) {
+  case Battery_1:
+    switch (size) {
+    case 24: return Battery_1_24x24_rle;
+    case 32: return Battery_1_32x32_rle;
+    case 48: return Battery_1_48x48_rle;
+    case 64: return Battery_1_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case Battery_2:
+    switch (size) {
+    case 24: return Battery_2_24x24_rle;
+    case 32: return Battery_2_32x32_rle;
+    case 48: return Battery_2_48x48_rle;
+    case 64: return Battery_2_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case Battery_3:
+    switch (size) {
+    case 24: return Battery_3_24x24_rle;
+    case 32: return Battery_3_32x32_rle;
+    case 48: return Battery_3_48x48_rle;
+    case 64: return Battery_3_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case Battery_4:
+    switch (size) {
+    case 24: return Battery_4_24x24_rle;
+    case 32: return Battery_4_32x32_rle;
+    case 48: return Battery_4_48x48_rle;
+    case 64: return Battery_4_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case Battery_5:
+    switch (size) {
+    case 24: return Battery_5_24x24_rle;
+    case 32: return Battery_5_32x32_rle;
+    case 48: return Battery_5_48x48_rle;
+    case 64: return Battery_5_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case refresh:
+    switch (size) {
+    case 24: return refresh_24x24_rle;
+    case 32: return refresh_32x32_rle;
+    case 48: return refresh_48x48_rle;
+    case 64: return refresh_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_0_day_sunny:
+    switch (size) {
+    case 24: return wi_0_day_sunny_24x24_rle;
+    case 32: return wi_0_day_sunny_32x32_rle;
+    case 48: return wi_0_day_sunny_48x48_rle;
+    case 64: return wi_0_day_sunny_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_1_day_sunny_overcast:
+    switch (size) {
+    case 24: return wi_1_day_sunny_overcast_24x24_rle;
+    case 32: return wi_1_day_sunny_overcast_32x32_rle;
+    case 48: return wi_1_day_sunny_overcast_48x48_rle;
+    case 64: return wi_1_day_sunny_overcast_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_45_day_fog:
+    switch (size) {
+    case 24: return wi_45_day_fog_24x24_rle;
+    case 32: return wi_45_day_fog_32x32_rle;
+    case 48: return wi_45_day_fog_48x48_rle;
+    case 64: return wi_45_day_fog_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_51_rain_mix:
+    switch (size) {
+    case 24: return wi_51_rain_mix_24x24_rle;
+    case 32: return wi_51_rain_mix_32x32_rle;
+    case 48: return wi_51_rain_mix_48x48_rle;
+    case 64: return wi_51_rain_mix_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_56_rain_mix:
+    switch (size) {
+    case 24: return wi_56_rain_mix_24x24_rle;
+    case 32: return wi_56_rain_mix_32x32_rle;
+    case 48: return wi_56_rain_mix_48x48_rle;
+    case 64: return wi_56_rain_mix_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_61_rain:
+    switch (size) {
+    case 24: return wi_61_rain_24x24_rle;
+    case 32: return wi_61_rain_32x32_rle;
+    case 48: return wi_61_rain_48x48_rle;
+    case 64: return wi_61_rain_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_66_rain_mix:
+    switch (size) {
+    case 24: return wi_66_rain_mix_24x24_rle;
+    case 32: return wi_66_rain_mix_32x32_rle;
+    case 48: return wi_66_rain_mix_48x48_rle;
+    case 64: return wi_66_rain_mix_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_71_snow_wind:
+    switch (size) {
+    case 24: return wi_71_snow_wind_24x24_rle;
+    case 32: return wi_71_snow_wind_32x32_rle;
+    case 48: return wi_71_snow_wind_48x48_rle;
+    case 64: return wi_71_snow_wind_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_77_day_snow_wind:
+    switch (size) {
+    case 24: return wi_77_day_snow_wind_24x24_rle;
+    case 32: return wi_77_day_snow_wind_32x32_rle;
+    case 48: return wi_77_day_snow_wind_48x48_rle;
+    case 64: return wi_77_day_snow_wind_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_81_showers:
+    switch (size) {
+    case 24: return wi_81_showers_24x24_rle;
+    case 32: return wi_81_showers_32x32_rle;
+    case 48: return wi_81_showers_48x48_rle;
+    case 64: return wi_81_showers_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_85_snow_wind:
+    switch (size) {
+    case 24: return wi_85_snow_wind_24x24_rle;
+    case 32: return wi_85_snow_wind_32x32_rle;
+    case 48: return wi_85_snow_wind_48x48_rle;
+    case 64: return wi_85_snow_wind_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_95_thunderstorm:
+    switch (size) {
+    case 24: return wi_95_thunderstorm_24x24_rle;
+    case 32: return wi_95_thunderstorm_32x32_rle;
+    case 48: return wi_95_thunderstorm_48x48_rle;
+    case 64: return wi_95_thunderstorm_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_99_thunderstorm:
+    switch (size) {
+    case 24: return wi_99_thunderstorm_24x24_rle;
+    case 32: return wi_99_thunderstorm_32x32_rle;
+    case 48: return wi_99_thunderstorm_48x48_rle;
+    case 64: return wi_99_thunderstorm_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_cloud_down:
+    switch (size) {
+    case 24: return wi_cloud_down_24x24_rle;
+    case 32: return wi_cloud_down_32x32_rle;
+    case 48: return wi_cloud_down_48x48_rle;
+    case 64: return wi_cloud_down_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_moon_alt_full:
+    switch (size) {
+    case 24: return wi_moon_alt_full_24x24_rle;
+    case 32: return wi_moon_alt_full_32x32_rle;
+    case 48: return wi_moon_alt_full_48x48_rle;
+    case 64: return wi_moon_alt_full_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_moon_alt_third_quarter:
+    switch (size) {
+    case 24: return wi_moon_alt_third_quarter_24x24_rle;
+    case 32: return wi_moon_alt_third_quarter_32x32_rle;
+    case 48: return wi_moon_alt_third_quarter_48x48_rle;
+    case 64: return wi_moon_alt_third_quarter_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_moon_alt_waning_crescent_4:
+    switch (size) {
+    case 24: return wi_moon_alt_waning_crescent_4_24x24_rle;
+    case 32: return wi_moon_alt_waning_crescent_4_32x32_rle;
+    case 48: return wi_moon_alt_waning_crescent_4_48x48_rle;
+    case 64: return wi_moon_alt_waning_crescent_4_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_moon_alt_waning_crescent_5:
+    switch (size) {
+    case 24: return wi_moon_alt_waning_crescent_5_24x24_rle;
+    case 32: return wi_moon_alt_waning_crescent_5_32x32_rle;
+    case 48: return wi_moon_alt_waning_crescent_5_48x48_rle;
+    case 64: return wi_moon_alt_waning_crescent_5_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_moon_alt_waning_crescent_6:
+    switch (size) {
+    case 24: return wi_moon_alt_waning_crescent_6_24x24_rle;
+    case 32: return wi_moon_alt_waning_crescent_6_32x32_rle;
+    case 48: return wi_moon_alt_waning_crescent_6_48x48_rle;
+    case 64: return wi_moon_alt_waning_crescent_6_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_moon_alt_waning_gibbous_1:
+    switch (size) {
+    case 24: return wi_moon_alt_waning_gibbous_1_24x24_rle;
+    case 32: return wi_moon_alt_waning_gibbous_1_32x32_rle;
+    case 48: return wi_moon_alt_waning_gibbous_1_48x48_rle;
+    case 64: return wi_moon_alt_waning_gibbous_1_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_moon_alt_waning_gibbous_2:
+    switch (size) {
+    case 24: return wi_moon_alt_waning_gibbous_2_24x24_rle;
+    case 32: return wi_moon_alt_waning_gibbous_2_32x32_rle;
+    case 48: return wi_moon_alt_waning_gibbous_2_48x48_rle;
+    case 64: return wi_moon_alt_waning_gibbous_2_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_moon_alt_waning_gibbous_3:
+    switch (size) {
+    case 24: return wi_moon_alt_waning_gibbous_3_24x24_rle;
+    case 32: return wi_moon_alt_waning_gibbous_3_32x32_rle;
+    case 48: return wi_moon_alt_waning_gibbous_3_48x48_rle;
+    case 64: return wi_moon_alt_waning_gibbous_3_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_moon_alt_waning_gibbous_4:
+    switch (size) {
+    case 24: return wi_moon_alt_waning_gibbous_4_24x24_rle;
+    case 32: return wi_moon_alt_waning_gibbous_4_32x32_rle;
+    case 48: return wi_moon_alt_waning_gibbous_4_48x48_rle;
+    case 64: return wi_moon_alt_waning_gibbous_4_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_moon_alt_waning_gibbous_5:
+    switch (size) {
+    case 24: return wi_moon_alt_waning_gibbous_5_24x24_rle;
+    case 32: return wi_moon_alt_waning_gibbous_5_32x32_rle;
+    case 48: return wi_moon_alt_waning_gibbous_5_48x48_rle;
+    case 64: return wi_moon_alt_waning_gibbous_5_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_moon_alt_waning_gibbous_6:
+    switch (size) {
+    case 24: return wi_moon_alt_waning_gibbous_6_24x24_rle;
+    case 32: return wi_moon_alt_waning_gibbous_6_32x32_rle;
+    case 48: return wi_moon_alt_waning_gibbous_6_48x48_rle;
+    case 64: return wi_moon_alt_waning_gibbous_6_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_moon_full:
+    switch (size) {
+    case 24: return wi_moon_full_24x24_rle;
+    case 32: return wi_moon_full_32x32_rle;
+    case 48: return wi_moon_full_48x48_rle;
+    case 64: return wi_moon_full_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_strong_wind:
+    switch (size) {
+    case 24: return wi_strong_wind_24x24_rle;
+    case 32: return wi_strong_wind_32x32_rle;
+    case 48: return wi_strong_wind_48x48_rle;
+    case 64: return wi_strong_wind_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_sunrise:
+    switch (size) {
+    case 24: return wi_sunrise_24x24_rle;
+    case 32: return wi_sunrise_32x32_rle;
+    case 48: return wi_sunrise_48x48_rle;
+    case 64: return wi_sunrise_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_sunset:
+    switch (size) {
+    case 24: return wi_sunset_24x24_rle;
+    case 32: return wi_sunset_32x32_rle;
+    case 48: return wi_sunset_48x48_rle;
+    case 64: return wi_sunset_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wi_time_5:
+    switch (size) {
+    case 24: return wi_time_5_24x24_rle;
+    case 32: return wi_time_5_32x32_rle;
+    case 48: return wi_time_5_48x48_rle;
+    case 64: return wi_time_5_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wifi:
+    switch (size) {
+    case 24: return wifi_24x24_rle;
+    case 32: return wifi_32x32_rle;
+    case 48: return wifi_48x48_rle;
+    case 64: return wifi_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wifi_1_bar:
+    switch (size) {
+    case 24: return wifi_1_bar_24x24_rle;
+    case 32: return wifi_1_bar_32x32_rle;
+    case 48: return wifi_1_bar_48x48_rle;
+    case 64: return wifi_1_bar_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wifi_2_bar:
+    switch (size) {
+    case 24: return wifi_2_bar_24x24_rle;
+    case 32: return wifi_2_bar_32x32_rle;
+    case 48: return wifi_2_bar_48x48_rle;
+    case 64: return wifi_2_bar_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wifi_3_bar:
+    switch (size) {
+    case 24: return wifi_3_bar_24x24_rle;
+    case 32: return wifi_3_bar_32x32_rle;
+    case 48: return wifi_3_bar_48x48_rle;
+    case 64: return wifi_3_bar_64x64_rle;
+    default:
+      return nullptr;
+    }
+  case wifi_off:
+    switch (size) {
+    case 24: return wifi_off_24x24_rle;
+    case 32: return wifi_off_32x32_rle;
+    case 48: return wifi_off_48x48_rle;
+    case 64: return wifi_off_64x64_rle;
+    default:
+      return nullptr;
+    }
+  default:
+    return nullptr;
+  }
+}
+
+#endif
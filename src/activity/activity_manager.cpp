@@ -2,12 +2,14 @@
 
 #include "build_config.h"
 #include "util/battery_manager.h"
+#include "util/energy_meter.h"
 #include "util/device_mode_manager.h"
 #include "util/button_manager.h"
 #include "util/device_mode_manager.h"
 #include "ota/ota_manager.h"
 #include "util/sleep_utils.h"
 #include "util/system_init.h"
+#include "util/time_manager.h"
 #include "util/timing_manager.h"
 #include "config/config_manager.h"
 #include "display/display_manager.h"
@@ -16,6 +18,9 @@
 static Lifecycle currentLifecycle = Lifecycle::ON_INIT;
 static Lifecycle nextLifecycle = Lifecycle::ON_START;
 static const char* TAG = "ACTIVITY_MGR";
+#if SHOW_BATTERY_STATUS
+static float wakeVoltage = -1.0f; // Read before WiFi draws on the battery
+#endif
 
 Lifecycle ActivityManager::getCurrentActivityLifecycle() {
     return currentLifecycle;
@@ -47,6 +52,7 @@ const char* ActivityManager::lifecycleToString(Lifecycle lifecycle) {
 }
 
 void ActivityManager::onInit() {
+    EnergyMeter::beginWake();
     setCurrentActivityLifecycle(Lifecycle::ON_INIT);
     DEBUG_ONLY(SystemInit::initSerialConnector(););
     printWakeupReason();
@@ -56,6 +62,7 @@ void ActivityManager::onInit() {
     BatteryManager::init();
 #if SHOW_BATTERY_STATUS
     float batteryVoltage = BatteryManager::getBatteryVoltage();
+    wakeVoltage = batteryVoltage;
     // 0V means no battery connected (USB-only power) — skip the check
     if (batteryVoltage > 0.1f && batteryVoltage <= BATTERY_VOLTAGE_MIN) {
         DisplayManager::displayErrorIfBatteryLow();
@@ -76,6 +83,7 @@ void ActivityManager::onInit() {
 }
 
 void ActivityManager::onStart() {
+    EnergyMeter::enter(EnergyPhase::START);
     setCurrentActivityLifecycle(Lifecycle::ON_START);
 
     // Start configuration Phase 1 if needed : Wifi Manager Configuration
@@ -85,7 +93,10 @@ void ActivityManager::onStart() {
     }
 
     // Start Wifi connection. If gets failed, show Wifi Error Screen
-    MyWiFiManager::reconnectWiFi();
+    {
+        EnergyMeter::Scope connecting(EnergyPhase::WIFI_CONNECT);
+        MyWiFiManager::reconnectWiFi();
+    }
 
     if (WiFi.status() != WL_CONNECTED) {
         DisplayManager::displayErrorIfWifiConnectionError();
@@ -97,7 +108,10 @@ void ActivityManager::onStart() {
     ButtonManager::checkAndRestartIfButtonPressed();
 
     // Set up Time if it needed
-    DeviceModeManager::setupConnectivityAndTime();
+    {
+        EnergyMeter::Scope syncing(EnergyPhase::TIME_SYNC);
+        DeviceModeManager::setupConnectivityAndTime();
+    }
 
     // Set temporary display mode (from short-press EXT1 wakeup or long-press synthetic mode)
     ButtonManager::handleWakeupMode();
@@ -106,6 +120,7 @@ void ActivityManager::onStart() {
 }
 
 void ActivityManager::onRunning() {
+    EnergyMeter::enter(EnergyPhase::RUNNING);
     setCurrentActivityLifecycle(Lifecycle::ON_RUNNING);
 
     // Start configuration Phase 2 if needed : Application Configuration
@@ -144,8 +159,14 @@ void ActivityManager::onRunning() {
 static uint64_t sleepTimeSeconds = 0;
 
 void ActivityManager::onStop() {
+    EnergyMeter::enter(EnergyPhase::STOP);
     setCurrentActivityLifecycle(Lifecycle::ON_STOP);
 
+#if SHOW_BATTERY_STATUS
+    // Stretch the update intervals if the battery would not last until the charge day
+    BatteryManager::updateEnergyPlan(wakeVoltage);
+#endif
+
     // Calculate next wake-up time - To Move
     sleepTimeSeconds = TimingManager::getNextSleepDurationSeconds();
 
@@ -169,6 +190,10 @@ void ActivityManager::onShutdown() {
         sleepTimeSeconds = 3600; // 1 hour fallback
     }
 
+    // Charge this wake to the energy log shown on the Application Info screen
+    uint32_t startedAt = TimeManager::isTimeSet() ? (uint32_t)time(nullptr) - (uint32_t)(millis() / 1000) : 0;
+    EnergyMeter::endWake(startedAt, (uint32_t)sleepTimeSeconds);
+
     // Enter deep sleep mode
     enterDeepSleep(sleepTimeSeconds);
 }
@@ -0,0 +1,99 @@
+#include "api/dns_cache.h"
+#include <WiFi.h>
+#include <esp_log.h>
+#include <string.h>
+#include <time.h>
+
+static const char* TAG = "DNS_CACHE";
+
+RTC_DATA_ATTR static DnsCacheEntry dnsEntries[DnsCache::MAX_HOSTS];
+
+// Weather and transport fetches may resolve their hosts concurrently (ParallelFetch)
+static portMUX_TYPE cacheLock = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t nowSeconds() {
+    return static_cast<uint32_t>(time(nullptr));
+}
+
+bool DnsCache::resolve(const char* host, IPAddress& ip, bool& fromCache) {
+    portENTER_CRITICAL(&cacheLock);
+    DnsCacheEntry* entry = find(host);
+    if (entry) ip = IPAddress(entry->address);
+    portEXIT_CRITICAL(&cacheLock);
+
+    fromCache = entry != nullptr;
+    if (fromCache) {
+        ESP_LOGD(TAG, "%s -> %s (cached)", host, ip.toString().c_str());
+        return true;
+    }
+
+    uint32_t start = millis();
+    if (!WiFi.hostByName(host, ip)) {
+        ESP_LOGE(TAG, "DNS lookup failed for %s", host);
+        return false;
+    }
+    ESP_LOGI(TAG, "%s -> %s (resolved in %u ms)", host, ip.toString().c_str(), millis() - start);
+
+    store(host, ip);
+    return true;
+}
+
+void DnsCache::evict(const char* host) {
+    portENTER_CRITICAL(&cacheLock);
+    for (uint8_t i = 0; i < MAX_HOSTS; i++) {
+        if (strcmp(dnsEntries[i].host, host) == 0) {
+            dnsEntries[i].host[0] = '\0';
+        }
+    }
+    portEXIT_CRITICAL(&cacheLock);
+}
+
+void DnsCache::clear() {
+    memset(dnsEntries, 0, sizeof(dnsEntries));
+}
+
+DnsCacheEntry* DnsCache::find(const char* host) {
+    // Called with cacheLock held
+    uint32_t now = nowSeconds();
+    for (uint8_t i = 0; i < MAX_HOSTS; i++) {
+        DnsCacheEntry& entry = dnsEntries[i];
+        if (entry.host[0] == '\0' || strcmp(entry.host, host) != 0) continue;
+
+        // A clock jump backwards (e.g. before the first NTP sync) also invalidates the entry
+        if (now < entry.savedAt || now - entry.savedAt >= entry.ttl) {
+            entry.host[0] = '\0';
+            return nullptr;
+        }
+        return &entry;
+    }
+    return nullptr;
+}
+
+void DnsCache::store(const char* host, const IPAddress& ip) {
+    if (strlen(host) >= sizeof(dnsEntries[0].host)) return;
+
+    uint32_t now = nowSeconds();
+
+    // Reuse the host's slot, else a free one, else the oldest
+    portENTER_CRITICAL(&cacheLock);
+    DnsCacheEntry* slot = nullptr;
+    for (uint8_t i = 0; i < MAX_HOSTS && !slot; i++) {
+        if (strcmp(dnsEntries[i].host, host) == 0) slot = &dnsEntries[i];
+    }
+    for (uint8_t i = 0; i < MAX_HOSTS && !slot; i++) {
+        if (dnsEntries[i].host[0] == '\0') slot = &dnsEntries[i];
+    }
+    if (!slot) {
+        slot = &dnsEntries[0];
+        for (uint8_t i = 1; i < MAX_HOSTS; i++) {
+            if (dnsEntries[i].savedAt < slot->savedAt) slot = &dnsEntries[i];
+        }
+    }
+
+    memset(slot, 0, sizeof(*slot));
+    strncpy(slot->host, host, sizeof(slot->host) - 1);
+    slot->address = static_cast<uint32_t>(ip);
+    slot->ttl = DEFAULT_TTL_S;
+    slot->savedAt = now;
+    portEXIT_CRITICAL(&cacheLock);
+}
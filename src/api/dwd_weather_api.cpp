@@ -1,6 +1,10 @@
 #include "api/dwd_weather_api.h"
 #include "config/config_struct.h"
 #include "config/config_manager.h"
+#include "api/http_body_stream.h"
+#include "api/http_connection_pool.h"
+#include "util/energy_meter.h"
+#include "util/inflate_stream.h"
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 #include <esp_log.h>
@@ -11,8 +15,7 @@ static const char* TAG = "WEATHER_API";
 String getCityFromLatLon(float lat, float lon) {
     String url = "https://nominatim.openstreetmap.org/reverse?format=json&lat=" + String(lat, 6) + "&lon=" +
         String(lon, 6) + "&zoom=10&addressdetails=1";
-    HTTPClient http;
-    http.begin(url);
+    HTTPClient& http = HttpConnectionPool::begin(url);
     // Nominatim requires a valid User-Agent with contact info per their usage policy
     // https://operations.osmfoundation.org/policies/nominatim/
     http.addHeader("User-Agent", "MyStation-ESP32/1.0 (https://github.com/gogo-boot/mystation)");
@@ -41,7 +44,7 @@ String getCityFromLatLon(float lat, float lon) {
         ESP_LOGW("DWD_CITY", "HTTP request failed, code: %d, error: %s", httpCode,
                  http.errorToString(httpCode).c_str());
     }
-    http.end();
+    HttpConnectionPool::end(http, httpCode == HTTP_CODE_OK);
     // return city if found, otherwise empty string
     if (city.isEmpty()) {
         ESP_LOGW("DWD_CITY", "No city found for lat: %.6f, lon: %.6f", lat, lon);
@@ -68,13 +71,30 @@ bool getGeneralWeatherFull(float lat, float lon, WeatherInfo& weather) {
     }
 
     ESP_LOGI(TAG, "Fetching weather from: %s\n", url.c_str());
-    HTTPClient http;
-    http.begin(url);
+    HTTPClient& http = HttpConnectionPool::begin(url);
+    http.addHeader("Accept-Encoding", "gzip, deflate");
+    const char* keys[] = {"Transfer-Encoding", "Content-Encoding"};
+    http.collectHeaders(keys, 2);
     int httpCode = http.GET();
+    bool bodyRead = false;
     if (httpCode > 0) {
-        String payload = http.getString();
         JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, payload);
+        DeserializationError error;
+        {
+            EnergyMeter::Scope parsing(EnergyPhase::JSON_PARSE);
+            if (InflateStream::isCompressed(http.header("Content-Encoding").c_str())) {
+                // Decode while parsing instead of buffering the compressed body with getString()
+                HttpBodyStream body(http.getStream(), http.header("Transfer-Encoding") == "chunked", http.getSize());
+                InflateStream response(body);
+                error = deserializeJson(doc, response);
+                // The gzip trailer and the chunk terminator follow the closing brace
+                bodyRead = !error && body.skipRest();
+            } else {
+                String payload = http.getString();
+                error = deserializeJson(doc, payload);
+                bodyRead = true;
+            }
+        }
         if (!error) {
             // Parse current weather
             if (doc["current"].is<JsonObject>()) {
@@ -172,11 +192,11 @@ bool getGeneralWeatherFull(float lat, float lon, WeatherInfo& weather) {
                 weather.dailyForecastCount = count;
             }
 
-            http.end();
+            HttpConnectionPool::end(http, bodyRead);
             return true;
         }
     }
-    http.end();
+    HttpConnectionPool::end(http, bodyRead);
     return false;
 }
 
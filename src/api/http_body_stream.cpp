@@ -0,0 +1,153 @@
+#include "api/http_body_stream.h"
+#include <esp_log.h>
+
+static const char* TAG = "HTTP_BODY";
+
+HttpBodyStream::HttpBodyStream(Stream& upstream, bool chunked, int contentLength)
+    : upstream(upstream), state(State::UNBOUNDED), chunked(chunked), remaining(0), chunkSize(0), lineLength(0),
+      delivered(0) {
+    if (chunked) {
+        state = State::CHUNK_SIZE;
+    } else if (contentLength >= 0) {
+        remaining = static_cast<size_t>(contentLength);
+        state = remaining > 0 ? State::DATA : State::DONE;
+    }
+}
+
+int HttpBodyStream::available() {
+    advance(false);
+    if (state != State::DATA && state != State::UNBOUNDED) return 0;
+    int n = upstream.available();
+    if (n <= 0) return 0;
+    if (state == State::DATA && static_cast<size_t>(n) > remaining) return static_cast<int>(remaining);
+    return n;
+}
+
+int HttpBodyStream::read() {
+    if (!advance(true)) return -1;
+    char c;
+    if (upstream.readBytes(&c, 1) != 1) return -1;
+    consumed(1);
+    return static_cast<uint8_t>(c);
+}
+
+int HttpBodyStream::peek() {
+    if (!advance(true)) return -1;
+    return upstream.peek();
+}
+
+size_t HttpBodyStream::readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    // Only the first read may wait for a chunk header; after that, return what has arrived
+    while (count < length && advance(count == 0)) {
+        size_t want = length - count;
+        if (state == State::DATA && want > remaining) want = remaining;
+        size_t n = upstream.readBytes(buffer + count, want);
+        consumed(n);
+        count += n;
+        if (n < want) break; // Upstream timed out
+    }
+    return count;
+}
+
+bool HttpBodyStream::skipRest(size_t maxBytes) {
+    if (state == State::UNBOUNDED) return false; // Only the server closing the connection ends it
+
+    char scratch[64];
+    size_t skipped = 0;
+    while (advance(true)) {
+        if (skipped >= maxBytes) {
+            ESP_LOGD(TAG, "Over %u body bytes left, not skipped", static_cast<unsigned>(maxBytes));
+            return false;
+        }
+        size_t want = remaining < sizeof(scratch) ? remaining : sizeof(scratch);
+        size_t n = upstream.readBytes(scratch, want);
+        consumed(n);
+        skipped += n;
+        if (n < want) return false; // Upstream timed out
+    }
+    if (skipped > 0) ESP_LOGD(TAG, "Skipped %u body bytes", static_cast<unsigned>(skipped));
+    return state == State::DONE;
+}
+
+// Parse framing until body data can be read; false at the end of the body, on an error,
+// or when the next framing byte has not arrived (wait) or is not available yet (!wait)
+bool HttpBodyStream::advance(bool wait) {
+    while (state != State::DATA && state != State::UNBOUNDED) {
+        if (state == State::DONE || state == State::FAILED) return false;
+        int c = nextFramingByte(wait);
+        if (c < 0) return false;
+        frame(static_cast<uint8_t>(c));
+    }
+    return true;
+}
+
+int HttpBodyStream::nextFramingByte(bool wait) {
+    if (wait) {
+        char c;
+        return upstream.readBytes(&c, 1) == 1 ? static_cast<uint8_t>(c) : -1;
+    }
+    return upstream.available() > 0 ? upstream.read() : -1;
+}
+
+void HttpBodyStream::frame(uint8_t c) {
+    switch (state) {
+    case State::CHUNK_SIZE:
+    case State::CHUNK_EXTENSION:
+        if (c == '\n') {
+            if (lineLength == 0) {
+                ESP_LOGW(TAG, "Chunk header without a size");
+                state = State::FAILED;
+            } else if (chunkSize == 0) {
+                state = State::TRAILER; // Last chunk; trailer fields and an empty line follow
+            } else {
+                remaining = chunkSize;
+                state = State::DATA;
+            }
+            lineLength = 0;
+        } else if (c == '\r' || state == State::CHUNK_EXTENSION) {
+            // Skipped: chunk extensions are not used
+        } else if (c == ';' || c == ' ' || c == '\t') {
+            state = State::CHUNK_EXTENSION;
+        } else {
+            int digit = (c >= '0' && c <= '9') ? c - '0'
+                      : (c >= 'a' && c <= 'f') ? c - 'a' + 10
+                      : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+            if (digit < 0 || chunkSize > (SIZE_MAX >> 4)) {
+                ESP_LOGW(TAG, "Bad chunk size byte 0x%02x", c);
+                state = State::FAILED;
+                return;
+            }
+            chunkSize = (chunkSize << 4) | static_cast<size_t>(digit);
+            lineLength = 1;
+        }
+        break;
+    case State::DATA_END:
+        // CRLF after the chunk data
+        if (c == '\n') {
+            chunkSize = 0;
+            state = State::CHUNK_SIZE;
+        } else if (c != '\r') {
+            ESP_LOGW(TAG, "Chunk data longer than its size");
+            state = State::FAILED;
+        }
+        break;
+    case State::TRAILER:
+        if (c == '\n') {
+            if (lineLength == 0) state = State::DONE;
+            lineLength = 0;
+        } else if (c != '\r') {
+            lineLength = 1;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void HttpBodyStream::consumed(size_t n) {
+    delivered += n;
+    if (state != State::DATA) return;
+    remaining -= n;
+    if (remaining == 0) state = chunked ? State::DATA_END : State::DONE;
+}
@@ -0,0 +1,121 @@
+#include "api/http_connection_pool.h"
+#include <esp_log.h>
+#include <string.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+static const char* TAG = "HTTP_POOL";
+
+HttpConnectionPool::Slot HttpConnectionPool::slots[MAX_HOSTS] = {};
+uint16_t HttpConnectionPool::opened = 0;
+uint16_t HttpConnectionPool::reused = 0;
+uint32_t HttpConnectionPool::sequence = 0;
+
+// Weather and transport fetches may run as concurrent tasks (ParallelFetch)
+static StaticSemaphore_t poolMutexBuffer;
+static SemaphoreHandle_t poolMutex = xSemaphoreCreateMutexStatic(&poolMutexBuffer);
+
+HTTPClient& HttpConnectionPool::begin(const char* url) {
+    char host[sizeof(slots[0].host)];
+    if (!parseHost(url, host, sizeof(host))) {
+        ESP_LOGW(TAG, "Cannot parse host from URL, using a shared slot");
+        host[0] = '\0';
+    }
+
+    xSemaphoreTake(poolMutex, portMAX_DELAY);
+    Slot* slot = slotFor(host);
+    slot->lastUsed = ++sequence;
+    slot->inUse = true;
+
+    bool reusing = slot->client->connected();
+    if (reusing) {
+        reused++;
+    } else {
+        opened++;
+    }
+    xSemaphoreGive(poolMutex);
+    ESP_LOGD(TAG, "%s connection to %s", reusing ? "Reusing" : "Opening", host);
+
+    slot->http->setReuse(true);
+    slot->http->begin(*slot->client, url);
+    return *slot->http;
+}
+
+void HttpConnectionPool::end(HTTPClient& http, bool bodyRead) {
+    for (uint8_t i = 0; i < MAX_HOSTS; i++) {
+        if (slots[i].http != &http) continue;
+        // Unread body bytes would be taken for the next response's status line
+        if (!bodyRead) slots[i].client->stop();
+        // Keeps the connection open unless it was stopped above or the server sent "Connection: close"
+        http.end();
+        xSemaphoreTake(poolMutex, portMAX_DELAY);
+        slots[i].inUse = false;
+        xSemaphoreGive(poolMutex);
+        return;
+    }
+}
+
+void HttpConnectionPool::closeAll() {
+    if (opened == 0 && reused == 0) return;
+
+    xSemaphoreTake(poolMutex, portMAX_DELAY);
+    for (uint8_t i = 0; i < MAX_HOSTS; i++) {
+        Slot& slot = slots[i];
+        if (!slot.http) continue;
+        if (slot.inUse) {
+            // A fetch that missed its deadline is still running; deep sleep will reclaim it
+            ESP_LOGW(TAG, "Connection to %s still in use, leaving it open", slot.host);
+            continue;
+        }
+        slot.client->stop();
+        delete slot.http;
+        delete slot.client;
+        memset(&slot, 0, sizeof(slot));
+    }
+    xSemaphoreGive(poolMutex);
+
+    ESP_LOGI(TAG, "HTTP connections this wake: %u opened, %u reused", opened, reused);
+    opened = 0;
+    reused = 0;
+}
+
+bool HttpConnectionPool::parseHost(const char* url, char* host, size_t size) {
+    const char* start = strstr(url, "://");
+    if (!start) return false;
+    start += 3;
+
+    size_t len = strcspn(start, ":/?#");
+    if (len == 0 || len >= size) return false;
+
+    memcpy(host, start, len);
+    host[len] = '\0';
+    return true;
+}
+
+HttpConnectionPool::Slot* HttpConnectionPool::slotFor(const char* host) {
+    // Called with poolMutex held. There are fewer concurrent fetches than
+    // slots, so an idle slot to hand over always exists.
+    Slot* freeSlot = nullptr;
+    Slot* oldest = nullptr;
+    for (uint8_t i = 0; i < MAX_HOSTS; i++) {
+        Slot& slot = slots[i];
+        if (slot.inUse) continue;
+        if (slot.http && strcmp(slot.host, host) == 0) return &slot;
+        if (!slot.http && !freeSlot) freeSlot = &slot;
+        if (slot.http && (!oldest || slot.lastUsed < oldest->lastUsed)) oldest = &slot;
+    }
+
+    Slot* slot = freeSlot;
+    if (!slot) {
+        ESP_LOGD(TAG, "All slots busy, closing connection to %s", oldest->host);
+        oldest->client->stop();
+        slot = oldest;
+    } else {
+        slot->client = new ResumableTlsClient();
+        slot->http = new HTTPClient();
+    }
+
+    strncpy(slot->host, host, sizeof(slot->host) - 1);
+    slot->host[sizeof(slot->host) - 1] = '\0';
+    return slot;
+}
@@ -1,12 +1,16 @@
 #include "api/rmv_api.h"
 #include "api/rmv_json_parser.h"
+#include "api/http_body_stream.h"
+#include "api/http_connection_pool.h"
+#include <ArduinoJson.h>
 #include <HTTPClient.h>
 #include <vector>
 #include <Arduino.h>
 #include "util/util.h"
+#include "util/energy_meter.h"
+#include "util/inflate_stream.h"
 #include "util/time_manager.h"
 #include <esp_log.h>
-#include <StreamUtils.h>
 #include "config/config_struct.h"
 #include "config/config_manager.h"
 #include "config/config_page_data.h"
@@ -15,25 +19,8 @@
 #include <time.h>
 
 static const char* TAG = "RMV_API";
-// const size_t JSON_CAPACITY = 16384; // 16KB - safer for API responses
-const size_t JSON_CAPACITY = 10240; // 10KB - safer for API responses
 
 namespace {
-    JsonDocument departureFilter;
-
-    void initDepartureFilter() {
-        departureFilter["Departure"][0]["time"] = true;
-        departureFilter["Departure"][0]["track"] = true;
-        departureFilter["Departure"][0]["rtTime"] = true;
-        departureFilter["Departure"][0]["cancelled"] = true;
-        departureFilter["Departure"][0]["direction"] = true;
-        departureFilter["Departure"][0]["directionFlag"] = true;
-
-        departureFilter["Departure"][0]["Product"][0]["line"] = true;
-        departureFilter["Departure"][0]["Product"][0]["catOut"] = true;
-        departureFilter["Departure"][0]["Messages"]["Message"][0]["head"] = true;
-    }
-
     // Build RMV products parameter based on filter flags
     String buildProductsFilter(uint8_t filterFlags) {
         if (filterFlags == 0) {
@@ -88,7 +75,6 @@ namespace {
 void getNearbyStops(float lat, float lon) {
     std::vector<Station> stations;
     Util::printFreeHeap("Before RMV request:");
-    HTTPClient http;
 
     // Use static utility method for secure API key decryption (no caching)
     std::string decrypted = AESCrypto::getRMVAPIKey();
@@ -107,7 +93,7 @@ void getNearbyStops(float lat, float lon) {
         }
         ESP_LOGI(TAG, "Requesting nearby stops: %s", urlForLog.c_str());
     );
-    http.begin(url);
+    HTTPClient& http = HttpConnectionPool::begin(url);
     http.setTimeout(10000);
     int httpCode = http.GET();
     if (httpCode > 0) {
@@ -141,101 +127,16 @@ void getNearbyStops(float lat, float lon) {
     } else {
         ESP_LOGE(TAG, "HTTP GET failed, error: %s", http.errorToString(httpCode).c_str());
     }
-    http.end();
+    HttpConnectionPool::end(http, httpCode > 0);
     Util::printFreeHeap("After RMV request:");
 }
 
-// Populate departure data from JSON document
-bool populateDepartureData(const JsonDocument& doc, DepartureData& departData) {
-    ESP_LOGI(TAG, "Populating departure data from JSON response");
-
-    // Clear existing departures
-    departData.departures.clear();
-    departData.departureCount = 0;
-
-    // Use JsonArrayConst for const document
-    JsonArrayConst departures = doc["Departure"];
-    if (departures.size() == 0) {
-        ESP_LOGW(TAG, "Departure array is empty");
-        return true; // ← Also return true for empty array
-    }
-    ESP_LOGI(TAG, "Found %d departures in response", departures.size());
-
-    // Reserve capacity to avoid multiple reallocations
-    departData.departures.reserve(departures.size());
-
-    for (JsonVariantConst departureVariant : departures) {
-        DepartureInfo depInfo;
-
-        /*
-        {
-          "Departure": [
-            {
-              "Product": [
-                {
-                  "line": "S6",
-                  "catOut": "Bus"
-                }
-              ],
-              "Messages": {
-                "Message": [
-                  {
-                    "head": "S3, S4, S5: nächtliche Teilausfälle mit Ersatzverkehr"
-                  }
-                ]
-              },
-              "time": "22:37:00",
-              "rtTime": "22:37:00",
-              "cancelled": true,
-              "direction": "Frankfurt (Main) Hauptbahnhof Südseite",
-              "directionFlag": "1"
-            }
-        */
-        // Extract basic departure information with safe string conversion
-        depInfo.direction = safeJsonString(departureVariant, "direction");
-        depInfo.directionFlag = safeJsonString(departureVariant, "directionFlag");
-        depInfo.time = safeJsonString(departureVariant, "time");
-        depInfo.rtTime = safeJsonString(departureVariant, "rtTime");
-        depInfo.cancelled = departureVariant["cancelled"].as<bool>();
-        depInfo.track = safeJsonString(departureVariant, "track");
-
-        // Extract category from Product array with safety checks
-        if (departureVariant["Product"].size() > 0) {
-            depInfo.category = safeJsonString(departureVariant["Product"][0], "catOut");
-            depInfo.line = safeJsonString(departureVariant["Product"][0], "line");
-        }
-
-        // Extract category from Product array with safety checks
-        if (departureVariant["Messages"]["Message"].size() > 0) {
-            // Direct path access
-            const char* head = departureVariant["Messages"]["Message"][0]["head"];
-            depInfo.text = head ? String(head) : "";
-        }
-
-        // Add to departures vector
-        departData.departures.push_back(depInfo);
-
-        ESP_LOGD(TAG, "Added: %s -> %s at %s (RT: %s) [%s]",
-                 depInfo.line.c_str(),
-                 depInfo.direction.c_str(),
-                 depInfo.time.c_str(),
-                 depInfo.rtTime.c_str(),
-                 depInfo.category.c_str());
-    }
-
-    departData.departureCount = static_cast<int>(departData.departures.size());
-    ESP_LOGI(TAG, "Successfully populated %d departures", departData.departureCount);
-
-    return true;
-}
-
 bool getDepartureFromRMV(const char* stopId, DepartureData& departData) {
     ESP_LOGI(TAG, "Fetching departure data for stop: %s", stopId);
 
     // Use static utility method for secure API key decryption (no caching)
     std::string decrypted = AESCrypto::getRMVAPIKey();
 
-    HTTPClient http;
     String encodedId = Util::urlEncode(String(stopId));
 
     // Get configured vehicle type filters from ConfigManager
@@ -250,8 +151,8 @@ bool getDepartureFromRMV(const char* stopId, DepartureData& departData) {
 
     char url[512];
     snprintf(url, sizeof(url),
-        "https://www.rmv.de/hapi/departureBoard?accessId=%s&id=%s&format=json&maxJourneys=22&duration=90%s&time=%s",
-        decrypted.c_str(), encodedId.c_str(), productsParam.c_str(), departureTime.c_str());
+        "https://www.rmv.de/hapi/departureBoard?accessId=%s&id=%s&format=json&maxJourneys=%d&duration=90%s&time=%s",
+        decrypted.c_str(), encodedId.c_str(), RMV_MAX_DEPARTURES, productsParam.c_str(), departureTime.c_str());
 
     DEBUG_ONLY(
         String urlForLog = url;
@@ -265,65 +166,53 @@ bool getDepartureFromRMV(const char* stopId, DepartureData& departData) {
         ESP_LOGI(TAG, "Walking time: %d minutes, departure time filter: %s", config.walkingTime, departureTime.c_str());
     );
 
-    http.begin(url);
+    HTTPClient& http = HttpConnectionPool::begin(url);
     http.setTimeout(10000);
 
-    const char* keys[] = {"Transfer-Encoding"};
-    http.collectHeaders(keys, 1);
+    // The departure board JSON shrinks to roughly a tenth with gzip
+    http.addHeader("Accept-Encoding", "gzip, deflate");
+    const char* keys[] = {"Transfer-Encoding", "Content-Encoding"};
+    http.collectHeaders(keys, 2);
 
     int httpCode = http.GET();
 
     if (httpCode != HTTP_CODE_OK) {
         ESP_LOGE(TAG, "HTTP GET failed, error: %s", http.errorToString(httpCode).c_str());
-        http.end();
+        HttpConnectionPool::end(http, false);
         return false;
     }
 
-    static bool filterReady = false;
-    if (!filterReady) { initDepartureFilter(); filterReady = true; }
-
-    // Create the raw and decoded stream
-    Stream& rawStream = http.getStream();
-    ChunkDecodingStream decodedStream(http.getStream());
+    // Frame the body ourselves, so whatever the parser leaves can be skipped to the body's end
+    HttpBodyStream body(http.getStream(), http.header("Transfer-Encoding") == "chunked", http.getSize());
 
-    // Choose the stream based on the Transfer-Encoding header
-    Stream& response = http.header("Transfer-Encoding") == "chunked" ? decodedStream : rawStream;
+    // Then undo the Content-Encoding, if the server used one
+    InflateStream inflatedStream(body);
+    Stream& response = InflateStream::isCompressed(http.header("Content-Encoding").c_str()) ? inflatedStream : body;
 
-    JsonDocument doc;
-    DeserializationOption::NestingLimit nestingLimit(20);
-
-    // Always check for memory errors
-    DeserializationError error = deserializeJson(doc, response, DeserializationOption::Filter(departureFilter),
-                                                 nestingLimit);
+    // Parse straight from the socket into the fixed-size departure records
+    RMVStreamParser parser(departData);
+    unsigned long parseStart = millis();
+    bool parsed;
+    {
+        EnergyMeter::Scope parsing(EnergyPhase::JSON_PARSE);
+        parsed = parser.parseResponse(response);
+    }
+    // The parser stops at the end of the Departure array; the closing fields, the gzip trailer
+    // and the chunk terminator are skipped
+    HttpConnectionPool::end(http, parsed && body.skipRest());
 
-    if (error) {
-        ESP_LOGE(TAG, "JSON parse failed: %s", error.c_str());
-        if (error == DeserializationError::NoMemory) {
-            ESP_LOGE(TAG, "Increase JSON_CAPACITY (current: %d)", JSON_CAPACITY);
-        }
+    if (!parsed) {
+        ESP_LOGE(TAG, "Departure parse failed after %u bytes", parser.bytesRead());
         return false;
     }
 
-    http.end();
-
-#if CORE_DEBUG_LEVEL >= 4
-    String prettyJson;
-    serializeJsonPretty(doc, prettyJson);
-    ESP_LOGD(TAG, "JSON Document (pretty):\n%s", prettyJson.c_str());
-#endif
-
-    // Check actual memory usage
-    ESP_LOGI(TAG, "Memory used: %u bytes, Free heap: %u bytes", doc.memoryUsage(), ESP.getFreeHeap());
+    ESP_LOGI(TAG, "Parsed %d departures from %u bytes in %lu ms (buffer peak %u bytes), free heap: %u bytes",
+             departData.departureCount, parser.bytesRead(), millis() - parseStart, parser.peakBuffered(),
+             ESP.getFreeHeap());
 
     // Set basic departure data
     departData.stopId = String(stopId);
 
-    // Populate departure data from JSON
-    if (!populateDepartureData(doc, departData)) {
-        ESP_LOGE(TAG, "Failed to populate departure data");
-        return false;
-    }
-
     return true;
 }
 
@@ -378,17 +267,17 @@ bool getTripFromRMV(const char* originId, const char* destId, TripData& tripData
 
     ESP_LOGI(TAG, "Trip API request (time=%s, products=%d)", departureTime, config.filterFlags);
 
-    HTTPClient http;
-    http.begin(url);
+    HTTPClient& http = HttpConnectionPool::begin(url);
     http.setTimeout(10000);
 
-    const char* keys[] = {"Transfer-Encoding"};
-    http.collectHeaders(keys, 1);
+    http.addHeader("Accept-Encoding", "gzip, deflate");
+    const char* keys[] = {"Transfer-Encoding", "Content-Encoding"};
+    http.collectHeaders(keys, 2);
 
     int httpCode = http.GET();
     if (httpCode != HTTP_CODE_OK) {
         ESP_LOGE(TAG, "Trip HTTP GET failed: %s", http.errorToString(httpCode).c_str());
-        http.end();
+        HttpConnectionPool::end(http, false);
         return false;
     }
 
@@ -407,16 +296,21 @@ bool getTripFromRMV(const char* originId, const char* destId, TripData& tripData
     filter["Trip"][0]["LegList"]["Leg"][0]["cancelled"] = true;
 
     // Stream and parse
-    Stream& rawStream = http.getStream();
-    ChunkDecodingStream decodedStream(http.getStream());
-    Stream& response = http.header("Transfer-Encoding") == "chunked" ? decodedStream : rawStream;
+    HttpBodyStream body(http.getStream(), http.header("Transfer-Encoding") == "chunked", http.getSize());
+    InflateStream inflatedStream(body);
+    Stream& response = InflateStream::isCompressed(http.header("Content-Encoding").c_str()) ? inflatedStream : body;
 
     JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, response,
-        DeserializationOption::Filter(filter),
-        DeserializationOption::NestingLimit(20));
+    DeserializationError error;
+    {
+        EnergyMeter::Scope parsing(EnergyPhase::JSON_PARSE);
+        error = deserializeJson(doc, response,
+            DeserializationOption::Filter(filter),
+            DeserializationOption::NestingLimit(20));
+    }
 
-    http.end();
+    // deserializeJson() stops at the closing brace, before the gzip trailer and the chunk terminator
+    HttpConnectionPool::end(http, !error && body.skipRest());
 
     if (error) {
         ESP_LOGE(TAG, "Trip JSON parse failed: %s", error.c_str());
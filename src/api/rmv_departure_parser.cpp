@@ -0,0 +1,407 @@
+#include "api/rmv_departure_parser.h"
+#include <string.h>
+#include <esp_log.h>
+
+static const char* TAG = "RMV_PARSER";
+
+namespace {
+    inline bool isWhitespace(char c) {
+        return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
+    inline bool isLiteralChar(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'E';
+    }
+
+    // Longest value kept per field; longer values are cut on a UTF-8 character boundary
+    namespace FieldLimits {
+        constexpr size_t LINE = 11;
+        constexpr size_t DIRECTION = 63;
+        constexpr size_t DIRECTION_FLAG = 3;
+        constexpr size_t TIME = 8;
+        constexpr size_t TRACK = 7;
+        constexpr size_t CATEGORY = 11;
+        constexpr size_t TEXT = 95;
+    }
+
+    inline int hexValue(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+}
+
+RMVDepartureParser::RMVDepartureParser(DepartureData& out, size_t maxDepartures)
+    : out(out), maxDepartures(maxDepartures) {
+    reset();
+}
+
+void RMVDepartureParser::reset() {
+    out.departures.clear();
+    out.departures.reserve(maxDepartures); // Single allocation for the whole response
+    out.departureCount = 0;
+
+    depth = 0;
+    state = State::VALUE;
+    stringIsKey = false;
+    done = false;
+    error = false;
+    consumed = 0;
+    keyLen = 0;
+    keyOverflow = false;
+    pendingCtx = Ctx::ROOT;
+    target = nullptr;
+    targetMax = 0;
+    targetLen = 0;
+    targetTruncated = false;
+    wantCancelled = false;
+    literalLen = 0;
+    unicode = 0;
+    unicodeDigits = 0;
+    current = -1;
+}
+
+bool RMVDepartureParser::feed(const char* data, size_t len) {
+    size_t i = 0;
+    while (i < len && !done && !error) {
+        char c = data[i];
+
+        switch (state) {
+        case State::STRING:
+            if (!stringIsKey && !target) {
+                // Skipped value - most of the response ends up here, so scan ahead
+                while (i < len && data[i] != '"' && data[i] != '\\') i++;
+                if (i == len) break;
+                c = data[i];
+            }
+            if (c == '"') {
+                endString();
+            } else if (c == '\\') {
+                state = State::ESCAPE;
+            } else {
+                putStringByte(c);
+            }
+            i++;
+            break;
+
+        case State::ESCAPE:
+            state = State::STRING;
+            switch (c) {
+            case '"':
+            case '\\':
+            case '/': putStringByte(c);
+                break;
+            case 'b': putStringByte('\b');
+                break;
+            case 'f': putStringByte('\f');
+                break;
+            case 'n': putStringByte('\n');
+                break;
+            case 'r': putStringByte('\r');
+                break;
+            case 't': putStringByte('\t');
+                break;
+            case 'u':
+                unicode = 0;
+                unicodeDigits = 0;
+                state = State::UNICODE;
+                break;
+            default: error = true;
+                break;
+            }
+            i++;
+            break;
+
+        case State::UNICODE: {
+            int v = hexValue(c);
+            if (v < 0) {
+                error = true;
+                break;
+            }
+            unicode = (unicode << 4) | static_cast<uint32_t>(v);
+            if (++unicodeDigits == 4) {
+                putCodepoint(unicode);
+                state = State::STRING;
+            }
+            i++;
+            break;
+        }
+
+        case State::LITERAL:
+            if (isLiteralChar(c)) {
+                if (literalLen < sizeof(literal) - 1) literal[literalLen++] = c;
+                i++;
+            } else {
+                endLiteral(); // Terminator is handled by the next state
+            }
+            break;
+
+        case State::VALUE:
+            i++;
+            if (isWhitespace(c)) break;
+            if (c == '{') {
+                beginValue();
+                openContainer(false);
+            } else if (c == '[') {
+                beginValue();
+                openContainer(true);
+            } else if (c == ']' && depth > 0 && stack[depth - 1].isArray && stack[depth - 1].index == 0) {
+                closeContainer(true); // Empty array
+            } else if (c == '"') {
+                beginValue();
+                stringIsKey = false;
+                state = State::STRING;
+            } else if (isLiteralChar(c)) {
+                beginValue();
+                literal[0] = c;
+                literalLen = 1;
+                state = State::LITERAL;
+            } else {
+                error = true;
+            }
+            break;
+
+        case State::KEY_OR_END:
+        case State::KEY:
+            i++;
+            if (isWhitespace(c)) break;
+            if (c == '"') {
+                keyLen = 0;
+                keyOverflow = false;
+                stringIsKey = true;
+                state = State::STRING;
+            } else if (c == '}' && state == State::KEY_OR_END) {
+                closeContainer(false);
+            } else {
+                error = true;
+            }
+            break;
+
+        case State::COLON:
+            i++;
+            if (isWhitespace(c)) break;
+            if (c == ':') {
+                onKey();
+                state = State::VALUE;
+            } else {
+                error = true;
+            }
+            break;
+
+        case State::COMMA_OR_END:
+            i++;
+            if (isWhitespace(c)) break;
+            if (c == ',') {
+                state = stack[depth - 1].isArray ? State::VALUE : State::KEY;
+            } else if (c == '}' || c == ']') {
+                closeContainer(c == ']');
+            } else {
+                error = true;
+            }
+            break;
+
+        case State::END:
+            i++;
+            if (!isWhitespace(c)) error = true;
+            break;
+        }
+    }
+
+    consumed += i;
+    return !error;
+}
+
+void RMVDepartureParser::beginValue() {
+    if (depth == 0 || !stack[depth - 1].isArray) return; // Object member: onKey() already decided
+
+    // Array element: only the first Product / Message is of interest
+    Frame& parent = stack[depth - 1];
+    target = nullptr;
+    wantCancelled = false;
+    switch (parent.ctx) {
+    case Ctx::DEPARTURE_LIST: pendingCtx = Ctx::DEPARTURE;
+        break;
+    case Ctx::PRODUCT_LIST: pendingCtx = parent.index == 0 ? Ctx::PRODUCT : Ctx::SKIP;
+        break;
+    case Ctx::MESSAGE_LIST: pendingCtx = parent.index == 0 ? Ctx::MESSAGE : Ctx::SKIP;
+        break;
+    default: pendingCtx = Ctx::SKIP;
+        break;
+    }
+    if (parent.index < UINT16_MAX) parent.index++;
+}
+
+bool RMVDepartureParser::openContainer(bool isArray) {
+    if (depth == MAX_DEPTH) {
+        ESP_LOGE(TAG, "Nesting deeper than %d levels", MAX_DEPTH);
+        error = true;
+        return false;
+    }
+
+    Ctx ctx = pendingCtx;
+    bool wantsArray = ctx == Ctx::DEPARTURE_LIST || ctx == Ctx::PRODUCT_LIST || ctx == Ctx::MESSAGE_LIST;
+    if (ctx != Ctx::SKIP && wantsArray != isArray) ctx = Ctx::SKIP; // Unexpected shape
+
+    if (ctx == Ctx::DEPARTURE) {
+        if (out.departures.size() >= maxDepartures) {
+            done = true; // Enough departures - no need to read the rest of the body
+            return true;
+        }
+        out.departures.push_back(DepartureInfo()); // Value-initialized: all fields empty
+        current = static_cast<int>(out.departures.size()) - 1;
+        out.departureCount = current + 1;
+    }
+
+    stack[depth].ctx = ctx;
+    stack[depth].isArray = isArray;
+    stack[depth].index = 0;
+    depth++;
+
+    pendingCtx = Ctx::SKIP;
+    state = isArray ? State::VALUE : State::KEY_OR_END;
+    return true;
+}
+
+bool RMVDepartureParser::closeContainer(bool isArray) {
+    if (depth == 0 || stack[depth - 1].isArray != isArray) {
+        error = true;
+        return false;
+    }
+
+    Ctx closed = stack[--depth].ctx;
+    if (closed == Ctx::DEPARTURE) current = -1;
+    if (closed == Ctx::DEPARTURE_LIST) done = true;
+
+    if (depth == 0) {
+        done = true;
+        state = State::END;
+    } else {
+        afterValue();
+    }
+    return true;
+}
+
+void RMVDepartureParser::afterValue() {
+    target = nullptr;
+    wantCancelled = false;
+    pendingCtx = Ctx::SKIP;
+    state = State::COMMA_OR_END;
+}
+
+void RMVDepartureParser::onKey() {
+    target = nullptr;
+    wantCancelled = false;
+    pendingCtx = Ctx::SKIP;
+    if (keyOverflow || depth == 0) return;
+
+    PooledString* field = nullptr;
+    size_t fieldMax = 0;
+#define RMV_FIELD(name, member, limit)                                             \
+    if (strcmp(key, name) == 0) {                                                  \
+        field = &out.departures[current].member;                                   \
+        fieldMax = FieldLimits::limit;                                             \
+    }
+
+    switch (stack[depth - 1].ctx) {
+    case Ctx::ROOT:
+        if (strcmp(key, "Departure") == 0) pendingCtx = Ctx::DEPARTURE_LIST;
+        break;
+    case Ctx::DEPARTURE:
+        RMV_FIELD("time", time, TIME)
+        else RMV_FIELD("rtTime", rtTime, TIME)
+        else RMV_FIELD("track", track, TRACK)
+        else RMV_FIELD("direction", direction, DIRECTION)
+        else RMV_FIELD("directionFlag", directionFlag, DIRECTION_FLAG)
+        else if (strcmp(key, "cancelled") == 0) wantCancelled = true;
+        else if (strcmp(key, "Product") == 0) pendingCtx = Ctx::PRODUCT_LIST;
+        else if (strcmp(key, "Messages") == 0) pendingCtx = Ctx::MESSAGES;
+        break;
+    case Ctx::PRODUCT:
+        RMV_FIELD("line", line, LINE)
+        else RMV_FIELD("catOut", category, CATEGORY)
+        break;
+    case Ctx::MESSAGES:
+        if (strcmp(key, "Message") == 0) pendingCtx = Ctx::MESSAGE_LIST;
+        break;
+    case Ctx::MESSAGE:
+        RMV_FIELD("head", text, TEXT)
+        break;
+    default:
+        break;
+    }
+#undef RMV_FIELD
+
+    if (field) {
+        target = field;
+        targetMax = fieldMax;
+        targetLen = 0;
+        targetTruncated = false;
+        StringPool::begin();
+    }
+}
+
+void RMVDepartureParser::putStringByte(char c) {
+    if (stringIsKey) {
+        if (keyLen < KEY_SIZE - 1) {
+            key[keyLen++] = c;
+        } else {
+            keyOverflow = true;
+        }
+    } else if (target) {
+        if (targetLen < targetMax) {
+            StringPool::append(c);
+            targetLen++;
+        } else {
+            targetTruncated = true;
+        }
+    }
+}
+
+void RMVDepartureParser::putCodepoint(uint32_t cp) {
+    if (cp >= 0xD800 && cp <= 0xDFFF) cp = '?'; // Surrogate pairs are not used by RMV
+    if (cp < 0x80) {
+        putStringByte(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+        putStringByte(static_cast<char>(0xC0 | (cp >> 6)));
+        putStringByte(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+        putStringByte(static_cast<char>(0xE0 | (cp >> 12)));
+        putStringByte(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        putStringByte(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+}
+
+void RMVDepartureParser::endString() {
+    if (stringIsKey) {
+        key[keyLen] = '\0';
+        stringIsKey = false;
+        state = State::COLON;
+        return;
+    }
+
+    if (target) {
+        if (targetTruncated) {
+            // Don't leave half a UTF-8 sequence at the end
+            const char* value = StringPool::pending();
+            size_t len = StringPool::pendingLength();
+            size_t start = len;
+            while (start > 0 && (static_cast<uint8_t>(value[start - 1]) & 0xC0) == 0x80) start--;
+            if (start > 0) {
+                uint8_t lead = static_cast<uint8_t>(value[start - 1]);
+                size_t need = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+                if (len - (start - 1) < need) StringPool::truncatePending(start - 1);
+            }
+        }
+        target->ref = StringPool::commit();
+    }
+    afterValue();
+}
+
+void RMVDepartureParser::endLiteral() {
+    if (wantCancelled && current >= 0) {
+        literal[literalLen] = '\0';
+        out.departures[current].cancelled = strcmp(literal, "true") == 0;
+    }
+    afterValue();
+}
@@ -0,0 +1,387 @@
+#include "api/tls_session_cache.h"
+#include "api/dns_cache.h"
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#include <mbedtls/net_sockets.h>
+#include <errno.h>
+#include <esp_log.h>
+#include <string.h>
+#include <time.h>
+
+static const char* TAG = "TLS_CACHE";
+
+RTC_DATA_ATTR static TlsSessionEntry sessionEntries[TlsSessionCache::MAX_HOSTS];
+
+// Handshake statistics survive deep sleep so full vs. resumed cost can be compared over many wakes
+RTC_DATA_ATTR static uint32_t fullHandshakes = 0;
+RTC_DATA_ATTR static uint32_t fullHandshakeMsTotal = 0;
+RTC_DATA_ATTR static uint32_t resumedHandshakes = 0;
+RTC_DATA_ATTR static uint32_t resumedHandshakeMsTotal = 0;
+
+// Concurrent fetch tasks (ParallelFetch) may look up and store sessions at the same time
+static portMUX_TYPE cacheLock = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t nowSeconds() {
+    return static_cast<uint32_t>(time(nullptr));
+}
+
+// ===== TlsSessionCache =====
+
+bool TlsSessionCache::find(const char* host, TlsSessionEntry& entry) {
+    uint32_t now = nowSeconds();
+    bool found = false;
+    bool expired = false;
+
+    // Copied under the lock: a concurrent store() may overwrite the slot right after
+    portENTER_CRITICAL(&cacheLock);
+    for (uint8_t i = 0; i < MAX_HOSTS; i++) {
+        TlsSessionEntry& slot = sessionEntries[i];
+        if (slot.host[0] == '\0' || strcmp(slot.host, host) != 0) continue;
+
+        // A clock jump backwards (e.g. before the first NTP sync) also invalidates the entry
+        if (now < slot.savedAt || now - slot.savedAt >= slot.lifetime) {
+            slot.host[0] = '\0';
+            expired = true;
+        } else {
+            entry = slot;
+            found = true;
+        }
+        break;
+    }
+    portEXIT_CRITICAL(&cacheLock);
+
+    if (expired) ESP_LOGD(TAG, "Cached session for %s expired", host);
+    return found;
+}
+
+void TlsSessionCache::store(const char* host, const mbedtls_ssl_session& session) {
+    if (strlen(host) >= sizeof(sessionEntries[0].host)) return;
+    if (session.id_len == 0 && session.ticket_len == 0) return; // Server offers no resumption
+
+    uint32_t now = nowSeconds();
+
+    // Reuse the host's slot, else a free one, else the oldest
+    portENTER_CRITICAL(&cacheLock);
+    TlsSessionEntry* slot = nullptr;
+    for (uint8_t i = 0; i < MAX_HOSTS && !slot; i++) {
+        if (strcmp(sessionEntries[i].host, host) == 0) slot = &sessionEntries[i];
+    }
+    for (uint8_t i = 0; i < MAX_HOSTS && !slot; i++) {
+        if (sessionEntries[i].host[0] == '\0') slot = &sessionEntries[i];
+    }
+    if (!slot) {
+        slot = &sessionEntries[0];
+        for (uint8_t i = 1; i < MAX_HOSTS; i++) {
+            if (sessionEntries[i].savedAt < slot->savedAt) slot = &sessionEntries[i];
+        }
+    }
+
+    memset(slot, 0, sizeof(*slot));
+    strncpy(slot->host, host, sizeof(slot->host) - 1);
+    slot->ciphersuite = session.ciphersuite;
+    slot->idLen = static_cast<uint8_t>(session.id_len);
+    memcpy(slot->id, session.id, sizeof(slot->id));
+    memcpy(slot->master, session.master, sizeof(slot->master));
+
+    if (session.ticket && session.ticket_len <= TLS_TICKET_MAX) {
+        slot->ticketLen = static_cast<uint16_t>(session.ticket_len);
+        memcpy(slot->ticket, session.ticket, session.ticket_len);
+    }
+
+    slot->lifetime = SESSION_MAX_AGE_S;
+    if (slot->ticketLen > 0 && session.ticket_lifetime > 0 && session.ticket_lifetime < SESSION_MAX_AGE_S) {
+        slot->lifetime = session.ticket_lifetime;
+    }
+    slot->savedAt = now;
+    portEXIT_CRITICAL(&cacheLock);
+
+    if (session.ticket_len > TLS_TICKET_MAX) {
+        ESP_LOGW(TAG, "Ticket for %s too large (%u bytes), keeping session ID only", host, session.ticket_len);
+    }
+}
+
+void TlsSessionCache::invalidate(const char* host) {
+    portENTER_CRITICAL(&cacheLock);
+    for (uint8_t i = 0; i < MAX_HOSTS; i++) {
+        if (strcmp(sessionEntries[i].host, host) == 0) {
+            sessionEntries[i].host[0] = '\0';
+        }
+    }
+    portEXIT_CRITICAL(&cacheLock);
+}
+
+void TlsSessionCache::clear() {
+    memset(sessionEntries, 0, sizeof(sessionEntries));
+}
+
+void TlsSessionCache::recordHandshake(const char* host, bool resumed, uint32_t durationMs) {
+    if (resumed) {
+        resumedHandshakes++;
+        resumedHandshakeMsTotal += durationMs;
+    } else {
+        fullHandshakes++;
+        fullHandshakeMsTotal += durationMs;
+    }
+    ESP_LOGI(TAG, "%s handshake with %s in %u ms (avg full %u ms over %u, resumed %u ms over %u)",
+             resumed ? "Resumed" : "Full", host, durationMs,
+             fullHandshakes ? fullHandshakeMsTotal / fullHandshakes : 0, fullHandshakes,
+             resumedHandshakes ? resumedHandshakeMsTotal / resumedHandshakes : 0, resumedHandshakes);
+}
+
+// ===== ResumableTlsClient =====
+
+ResumableTlsClient::ResumableTlsClient()
+    : cachedSession(), tlsActive(false), resumed(false), handshakeMs(0), peeked(-1) {
+    hostName[0] = '\0';
+}
+
+ResumableTlsClient::~ResumableTlsClient() {
+    stop();
+}
+
+int ResumableTlsClient::connect(IPAddress ip, uint16_t port) {
+    return connect(ip, port, HANDSHAKE_TIMEOUT_MS);
+}
+
+int ResumableTlsClient::connect(IPAddress ip, uint16_t port, int32_t timeout) {
+    // No host name means no SNI and no cache key; connect without resumption
+    hostName[0] = '\0';
+    return startTls(ip, port, timeout, nullptr) ? 1 : 0;
+}
+
+int ResumableTlsClient::connect(const char* host, uint16_t port) {
+    return connect(host, port, HANDSHAKE_TIMEOUT_MS);
+}
+
+int ResumableTlsClient::connect(const char* host, uint16_t port, int32_t timeout) {
+    IPAddress ip;
+    bool cachedAddress = false;
+    if (!DnsCache::resolve(host, ip, cachedAddress)) return 0;
+
+    strncpy(hostName, host, sizeof(hostName) - 1);
+    hostName[sizeof(hostName) - 1] = '\0';
+
+    if (connectResuming(ip, port, timeout)) return 1;
+    if (!cachedAddress) return 0;
+
+    // The host may have moved since the address was cached; only retry if it did
+    IPAddress freshIp;
+    DnsCache::evict(host);
+    if (!DnsCache::resolve(host, freshIp, cachedAddress) || freshIp == ip) return 0;
+    ESP_LOGW(TAG, "%s moved to %s, retrying", hostName, freshIp.toString().c_str());
+    return connectResuming(freshIp, port, timeout) ? 1 : 0;
+}
+
+bool ResumableTlsClient::connectResuming(const IPAddress& ip, uint16_t port, int32_t timeout) {
+    const TlsSessionEntry* cached = TlsSessionCache::find(hostName, cachedSession) ? &cachedSession : nullptr;
+    if (startTls(ip, port, timeout, cached)) return true;
+
+    if (cached) {
+        // The server may have dropped its ticket key or session cache; a full handshake still works
+        ESP_LOGW(TAG, "Resumption with %s failed, retrying with full handshake", hostName);
+        TlsSessionCache::invalidate(hostName);
+        return startTls(ip, port, timeout, nullptr);
+    }
+    return false;
+}
+
+bool ResumableTlsClient::startTls(const IPAddress& ip, uint16_t port, int32_t timeout,
+                                  const TlsSessionEntry* cached) {
+    stop();
+    resumed = false;
+    peeked = -1;
+
+    if (!WiFiClient::connect(ip, port, timeout)) {
+        ESP_LOGE(TAG, "TCP connect to %s:%u failed", hostName[0] ? hostName : ip.toString().c_str(), port);
+        return false;
+    }
+
+    mbedtls_ssl_init(&ssl);
+    mbedtls_ssl_config_init(&conf);
+    mbedtls_ctr_drbg_init(&drbg);
+    mbedtls_entropy_init(&entropy);
+    tlsActive = true;
+
+    int ret = mbedtls_ctr_drbg_seed(&drbg, mbedtls_entropy_func, &entropy, nullptr, 0);
+    if (ret == 0) {
+        ret = mbedtls_ssl_config_defaults(&conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM,
+                                          MBEDTLS_SSL_PRESET_DEFAULT);
+    }
+    if (ret == 0) {
+        mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_NONE);
+        mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &drbg);
+        mbedtls_ssl_conf_session_tickets(&conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+        ret = mbedtls_ssl_setup(&ssl, &conf);
+    }
+    if (ret == 0 && hostName[0]) {
+        ret = mbedtls_ssl_set_hostname(&ssl, hostName);
+    }
+    if (ret != 0) {
+        ESP_LOGE(TAG, "TLS setup failed: -0x%04x", -ret);
+        stop();
+        return false;
+    }
+    mbedtls_ssl_set_bio(&ssl, this, bioSend, bioRecv, nullptr);
+
+    if (cached) {
+        // set_session copies the session, so the ticket can point straight into the entry
+        mbedtls_ssl_session session;
+        mbedtls_ssl_session_init(&session);
+        session.ciphersuite = cached->ciphersuite;
+        session.id_len = cached->idLen;
+        memcpy(session.id, cached->id, sizeof(session.id));
+        memcpy(session.master, cached->master, sizeof(session.master));
+        session.ticket = cached->ticketLen ? const_cast<uint8_t*>(cached->ticket) : nullptr;
+        session.ticket_len = cached->ticketLen;
+        session.ticket_lifetime = cached->lifetime;
+        ret = mbedtls_ssl_set_session(&ssl, &session);
+        if (ret != 0) {
+            ESP_LOGW(TAG, "Cached session for %s not usable: -0x%04x", hostName, -ret);
+            cached = nullptr;
+        }
+    }
+
+    uint32_t start = millis();
+    while ((ret = mbedtls_ssl_handshake(&ssl)) != 0) {
+        if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+            ESP_LOGE(TAG, "TLS handshake with %s failed: -0x%04x", hostName, -ret);
+            stop();
+            return false;
+        }
+        if (millis() - start > static_cast<uint32_t>(timeout)) {
+            ESP_LOGE(TAG, "TLS handshake with %s timed out", hostName);
+            stop();
+            return false;
+        }
+        delay(1);
+    }
+    handshakeMs = millis() - start;
+
+    mbedtls_ssl_session session;
+    mbedtls_ssl_session_init(&session);
+    if (mbedtls_ssl_get_session(&ssl, &session) == 0) {
+        // An abbreviated handshake keeps the master secret of the cached session
+        resumed = cached && memcmp(session.master, cached->master, sizeof(session.master)) == 0;
+        if (cached && !resumed) {
+            ESP_LOGI(TAG, "Server %s rejected cached session, fell back to full handshake", hostName);
+        }
+        if (hostName[0]) TlsSessionCache::store(hostName, session);
+    }
+    mbedtls_ssl_session_free(&session);
+
+    TlsSessionCache::recordHandshake(hostName[0] ? hostName : "server", resumed, handshakeMs);
+    return true;
+}
+
+int ResumableTlsClient::bioSend(void* ctx, const unsigned char* buf, size_t len) {
+    ResumableTlsClient* client = static_cast<ResumableTlsClient*>(ctx);
+    int sent = ::send(client->fd(), buf, len, 0);
+    if (sent < 0) {
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? MBEDTLS_ERR_SSL_WANT_WRITE : MBEDTLS_ERR_NET_SEND_FAILED;
+    }
+    return sent;
+}
+
+int ResumableTlsClient::bioRecv(void* ctx, unsigned char* buf, size_t len) {
+    ResumableTlsClient* client = static_cast<ResumableTlsClient*>(ctx);
+    int received = ::recv(client->fd(), buf, len, MSG_DONTWAIT);
+    if (received < 0) {
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? MBEDTLS_ERR_SSL_WANT_READ : MBEDTLS_ERR_NET_RECV_FAILED;
+    }
+    if (received == 0) return MBEDTLS_ERR_NET_CONN_RESET;
+    return received;
+}
+
+size_t ResumableTlsClient::write(uint8_t data) {
+    return write(&data, 1);
+}
+
+size_t ResumableTlsClient::write(const uint8_t* buf, size_t size) {
+    if (!tlsActive) return 0;
+
+    size_t written = 0;
+    uint32_t start = millis();
+    while (written < size) {
+        int ret = mbedtls_ssl_write(&ssl, buf + written, size - written);
+        if (ret > 0) {
+            written += ret;
+        } else if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+            if (millis() - start > HANDSHAKE_TIMEOUT_MS) break;
+            delay(1);
+        } else {
+            ESP_LOGE(TAG, "TLS write failed: -0x%04x", -ret);
+            break;
+        }
+    }
+    return written;
+}
+
+int ResumableTlsClient::available() {
+    if (!tlsActive) return 0;
+
+    int pending = peeked >= 0 ? 1 : 0;
+    // A zero-length read processes any record waiting on the socket
+    int ret = mbedtls_ssl_read(&ssl, nullptr, 0);
+    if (ret < 0 && ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+        if (ret != MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) ESP_LOGD(TAG, "TLS read: -0x%04x", -ret);
+        return pending;
+    }
+    return pending + static_cast<int>(mbedtls_ssl_get_bytes_avail(&ssl));
+}
+
+int ResumableTlsClient::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int ResumableTlsClient::read(uint8_t* buf, size_t size) {
+    if (!tlsActive || size == 0) return -1;
+
+    size_t offset = 0;
+    if (peeked >= 0) {
+        buf[offset++] = static_cast<uint8_t>(peeked);
+        peeked = -1;
+        if (offset == size) return 1;
+    }
+
+    int ret = mbedtls_ssl_read(&ssl, buf + offset, size - offset);
+    if (ret > 0) return offset + ret;
+    return offset > 0 ? static_cast<int>(offset) : -1;
+}
+
+int ResumableTlsClient::peek() {
+    if (peeked < 0) {
+        uint8_t c;
+        if (read(&c, 1) == 1) peeked = c;
+    }
+    return peeked;
+}
+
+void ResumableTlsClient::flush() {
+    // Same as WiFiClient: drop received data that has not been read yet
+    uint8_t discard[64];
+    while (available() > 0 && read(discard, sizeof(discard)) > 0) {
+    }
+}
+
+void ResumableTlsClient::stop() {
+    if (tlsActive) {
+        mbedtls_ssl_close_notify(&ssl);
+        freeTls();
+    }
+    peeked = -1;
+    WiFiClient::stop();
+}
+
+uint8_t ResumableTlsClient::connected() {
+    if (!tlsActive) return 0;
+    return (peeked >= 0 || mbedtls_ssl_get_bytes_avail(&ssl) > 0 || WiFiClient::connected()) ? 1 : 0;
+}
+
+void ResumableTlsClient::freeTls() {
+    mbedtls_ssl_free(&ssl);
+    mbedtls_ssl_config_free(&conf);
+    mbedtls_ctr_drbg_free(&drbg);
+    mbedtls_entropy_free(&entropy);
+    tlsActive = false;
+}
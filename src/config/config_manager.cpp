@@ -1,6 +1,7 @@
 #include "config/config_manager.h"
 #include <ArduinoJson.h>
 #include <vector>
+#include "util/timing_manager.h"
 
 static const char* TAG = "CONFIG_MGR";
 
@@ -36,6 +37,9 @@ RTC_DATA_ATTR RTCConfigData ConfigManager::rtcConfig = {
     // filterFlags - Default filters
     false, // tripMode - default to departures (not connections)
     "", // tripDestId - no destination
+    6, // maxWeatherInterval
+    30, // maxTransportInterval
+    -1, // chargeDay - no runtime target
     true, // configMode
     0, // lastUpdate
     false, // inTemporaryMode - default to normal mode
@@ -103,6 +107,9 @@ bool ConfigManager::loadFromNVS(bool force = false) {
     rtcConfig.weatherInterval = preferences.getInt("weatherInt", 3);
     rtcConfig.transportInterval = preferences.getInt("transportInt", 3);
     rtcConfig.walkingTime = preferences.getInt("walkTime", 5);
+    rtcConfig.maxWeatherInterval = preferences.getInt("maxWeatherInt", 6);
+    rtcConfig.maxTransportInterval = preferences.getInt("maxTransInt", 30);
+    rtcConfig.chargeDay = preferences.getChar("chargeDay", -1);
 
     // Load display mode
     rtcConfig.displayMode = preferences.getUChar("displayMode", DISPLAY_MODE_HALF_AND_HALF);
@@ -184,6 +191,7 @@ bool ConfigManager::loadFromNVS(bool force = false) {
 
     preferences.end();
 
+    TimingManager::compileSchedule();
     return true;
 }
 
@@ -215,6 +223,9 @@ bool ConfigManager::saveToNVS() {
     preferences.putInt("weatherInt", rtcConfig.weatherInterval);
     preferences.putInt("transportInt", rtcConfig.transportInterval);
     preferences.putInt("walkTime", rtcConfig.walkingTime);
+    preferences.putInt("maxWeatherInt", rtcConfig.maxWeatherInterval);
+    preferences.putInt("maxTransInt", rtcConfig.maxTransportInterval);
+    preferences.putChar("chargeDay", rtcConfig.chargeDay);
     // Save display mode
     preferences.putUChar("displayMode", rtcConfig.displayMode);
 
@@ -251,6 +262,7 @@ bool ConfigManager::saveToNVS() {
 
     preferences.end();
 
+    TimingManager::compileSchedule();
     ESP_LOGI(TAG, "Configuration saved from RTC memory to NVS");
     return true;
 }
@@ -380,6 +392,9 @@ void ConfigManager::setDefaults() {
     strcpy(rtcConfig.transportActiveStart, "06:00");
     strcpy(rtcConfig.transportActiveEnd, "09:00");
     rtcConfig.walkingTime = 5;
+    rtcConfig.maxWeatherInterval = 6;
+    rtcConfig.maxTransportInterval = 30;
+    rtcConfig.chargeDay = -1;
     strcpy(rtcConfig.sleepStart, "22:30");
     strcpy(rtcConfig.sleepEnd, "05:30");
     rtcConfig.weekendMode = false;
@@ -448,6 +463,11 @@ void ConfigManager::printConfiguration(bool fromNVS = false) {
         ESP_LOGI(TAG, "--- Weather ---");
         ESP_LOGI(TAG, "weatherInterval: %d", rtcConfig.weatherInterval);
 
+        ESP_LOGI(TAG, "--- Battery ---");
+        ESP_LOGI(TAG, "maxWeatherInterval: %d", rtcConfig.maxWeatherInterval);
+        ESP_LOGI(TAG, "maxTransportInterval: %d", rtcConfig.maxTransportInterval);
+        ESP_LOGI(TAG, "chargeDay: %d", rtcConfig.chargeDay);
+
         ESP_LOGI(TAG, "--- Sleep ---");
         ESP_LOGI(TAG, "sleepStart: %s", rtcConfig.sleepStart);
         ESP_LOGI(TAG, "sleepEnd: %s", rtcConfig.sleepEnd);
@@ -487,6 +507,17 @@ void ConfigManager::updateFromJson(const JsonDocument& doc) {
                                                        doc["transportActiveEnd"].as<const char*>(),
                                                        sizeof(config.transportActiveEnd) - 1);
     if (!doc["walkingTime"].isNull()) config.walkingTime = doc["walkingTime"].as<int>();
+    if (!doc["maxWeatherInterval"].isNull()) config.maxWeatherInterval = doc["maxWeatherInterval"].as<int>();
+    if (!doc["maxTransportInterval"].isNull()) config.maxTransportInterval = doc["maxTransportInterval"].as<int>();
+    if (!doc["chargeDay"].isNull()) {
+        // -1 (no charge day) or a weekday, 0 = Sunday; anything else keeps the current value
+        int chargeDay = doc["chargeDay"].as<int>();
+        if (chargeDay >= -1 && chargeDay <= 6) {
+            config.chargeDay = (int8_t)chargeDay;
+        } else {
+            ESP_LOGW(TAG, "Ignoring chargeDay %d, expected -1..6", chargeDay);
+        }
+    }
     if (!doc["sleepStart"].isNull()) strncpy(config.sleepStart, doc["sleepStart"].as<const char*>(),
                                                sizeof(config.sleepStart) - 1);
     if (!doc["sleepEnd"].isNull()) strncpy(config.sleepEnd, doc["sleepEnd"].as<const char*>(),
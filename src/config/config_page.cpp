@@ -67,6 +67,9 @@ static String renderConfigPageHtml() {
             else if (varName == "TRANSPORT_ACTIVE_START") { page += config.transportActiveStart; }
             else if (varName == "TRANSPORT_ACTIVE_END") { page += config.transportActiveEnd; }
             else if (varName == "WALKING_TIME") { page += String(config.walkingTime); }
+            else if (varName == "MAX_WEATHER_INTERVAL") { page += String(config.maxWeatherInterval); }
+            else if (varName == "MAX_TRANSPORT_INTERVAL") { page += String(config.maxTransportInterval); }
+            else if (varName == "CHARGE_DAY") { page += String(config.chargeDay); }
             else if (varName == "SLEEP_START") { page += config.sleepStart; }
             else if (varName == "SLEEP_END") { page += config.sleepEnd; }
             else if (varName == "WEEKEND_MODE") { page += config.weekendMode ? "checked" : ""; }
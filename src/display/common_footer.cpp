@@ -1,9 +1,10 @@
 #include "display/common_footer.h"
 #include "display/text_utils.h"
+#include "display/refresh_planner.h"
 #include "util/time_manager.h"
 #include "util/battery_manager.h"
 #include "util/timing_manager.h"
-#include <icons.h>
+#include <icons_compressed.h>
 #include <WiFi.h>
 #include "global_instances.h"
 #include "build_config.h"
@@ -50,6 +51,32 @@ void CommonFooter::drawFooter(int16_t x, int16_t y, int16_t h, uint8_t elements)
     );
 }
 
+uint32_t CommonFooter::fingerprint(uint8_t elements) {
+    ContentHash hash;
+    hash.add(&elements, sizeof(elements));
+    if (elements & FOOTER_TIME) {
+        hash.add(getTimeString().c_str());
+    }
+    if (elements & FOOTER_WIFI) {
+        icon_name wifiIcon = getWiFiIcon();
+        hash.add(&wifiIcon, sizeof(wifiIcon));
+    }
+    if (elements & FOOTER_BATTERY && SHOW_BATTERY_STATUS) {
+        int iconLevel = BatteryManager::isAvailable() ? BatteryManager::getBatteryIconLevel() : 0;
+        icon_name batteryIcon = getBatteryIcon();
+        int percentage = BatteryManager::getBatteryPercentage();
+        hash.add(&iconLevel, sizeof(iconLevel));
+        hash.add(&batteryIcon, sizeof(batteryIcon));
+        hash.add(&percentage, sizeof(percentage));
+    }
+
+    DEBUG_ONLY(
+        uint32_t sleepSeconds = TimingManager::getNextSleepDurationSeconds();
+        hash.add(&sleepSeconds, sizeof(sleepSeconds));
+    );
+    return hash.get();
+}
+
 String CommonFooter::getTimeString() {
     String footerText = "";
     if (TimeManager::isTimeSet()) {
@@ -70,7 +97,7 @@ String CommonFooter::getTimeString() {
 void CommonFooter::drawWiFiStatus(int16_t& currentX, int16_t y) {
     icon_name wifiIcon = getWiFiIcon();
     int16_t iconY = y - 7; // Center 24px icon with text baseline (adjust ±px if needed)
-    display.drawInvertedBitmap(currentX, iconY, getBitmap(wifiIcon, 24), 24, 24, GxEPD_BLACK);
+    display.drawCompressedBitmap(currentX, iconY, getCompressedBitmap(wifiIcon, 24), 24, 24, GxEPD_BLACK);
     currentX += 28; // Move right
 }
 
@@ -104,7 +131,7 @@ void CommonFooter::drawBatteryStatus(int16_t& currentX, int16_t y) {
 
     icon_name batteryIcon = getBatteryIcon();
     int16_t iconY = y - 7; // Center 24px icon with text baseline (adjust ±px if needed)
-    display.drawInvertedBitmap(currentX, iconY, getBitmap(batteryIcon, 24), 24, 24, GxEPD_BLACK);
+    display.drawCompressedBitmap(currentX, iconY, getCompressedBitmap(batteryIcon, 24), 24, 24, GxEPD_BLACK);
     currentX += 28; // Move right
 }
 
@@ -158,6 +185,6 @@ icon_name CommonFooter::getBatteryIcon() {
 
 void CommonFooter::drawRefreshIcon(int16_t& currentX, int16_t y) {
     int16_t iconY = y - 7; // Center 24px icon with text baseline (adjust ±px if needed)
-    display.drawInvertedBitmap(currentX, iconY, getBitmap(refresh, 24), 24, 24, GxEPD_BLACK);
+    display.drawCompressedBitmap(currentX, iconY, getCompressedBitmap(refresh, 24), 24, 24, GxEPD_BLACK);
     currentX += 28; // Move right
 }
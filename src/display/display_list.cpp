@@ -0,0 +1,463 @@
+#include <Arduino.h>
+#include "display/display_list.h"
+#include "display/fonts.h"
+
+DisplayList* DisplayList::active = nullptr;
+
+DisplayList::~DisplayList() {
+    if (active == this) active = nullptr;
+}
+
+void DisplayList::beginRecording() {
+    commands.clear();
+    refs.clear();
+    textRuns.clear();
+    overflowed = false;
+    muteDepth = 0;
+    active = this;
+}
+
+void DisplayList::endRecording() {
+    if (active == this) active = nullptr;
+}
+
+DisplayList* DisplayList::suspend() {
+    DisplayList* list = active;
+    active = nullptr;
+    return list;
+}
+
+void DisplayList::resume(DisplayList* list) {
+    active = list;
+}
+
+size_t DisplayList::bytes() const {
+    return commands.size() * sizeof(Command) + refs.size() * sizeof(const void*) + textRuns.size();
+}
+
+// ===== RECORDING =====
+
+void DisplayList::add(Op op, uint16_t color, int16_t x, int16_t y, int16_t a, int16_t b, uint8_t ref) {
+    if (muted()) return;
+    commands.push_back({op, ref, color, x, y, a, b});
+}
+
+uint8_t DisplayList::reference(const void* data) {
+    for (size_t i = 0; i < refs.size(); i++) {
+        if (refs[i] == data) return i;
+    }
+    if (refs.size() > UINT8_MAX) {
+        overflowed = true;
+        return 0;
+    }
+    refs.push_back(data);
+    return refs.size() - 1;
+}
+
+void DisplayList::fillScreen(uint16_t color) {
+    if (muted()) return;
+    // Everything recorded so far is painted over
+    commands.clear();
+    refs.clear();
+    textRuns.clear();
+    add(Op::FILL_SCREEN, color, 0, 0, 0, 0);
+}
+
+void DisplayList::pixel(int16_t x, int16_t y, uint16_t color) {
+    if (muted()) return;
+
+    // Dotted lines and hatching are pixels at a fixed step: extend the last run if this one continues it
+    if (!commands.empty()) {
+        Command& last = commands.back();
+        if (last.op == Op::PIXELS && last.color == color) {
+            int16_t dx = x - last.x;
+            int16_t dy = y - last.y;
+            if (last.b == 1 && dx >= INT8_MIN && dx <= INT8_MAX && dy >= INT8_MIN && dy <= INT8_MAX &&
+                (dx || dy)) {
+                last.a = static_cast<int16_t>((static_cast<uint8_t>(dx) << 8) | static_cast<uint8_t>(dy));
+                last.b = 2;
+                return;
+            }
+            int8_t stepX = static_cast<int8_t>(last.a >> 8);
+            int8_t stepY = static_cast<int8_t>(last.a & 0xFF);
+            if (last.b > 1 && last.b < INT16_MAX && dx == stepX * last.b && dy == stepY * last.b) {
+                last.b++;
+                return;
+            }
+        }
+    }
+    add(Op::PIXELS, color, x, y, 0, 1);
+}
+
+void DisplayList::line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    add(Op::LINE, color, x0, y0, x1, y1);
+}
+
+void DisplayList::hLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    add(Op::H_LINE, color, x, y, w, 1);
+}
+
+void DisplayList::vLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    add(Op::V_LINE, color, x, y, 1, h);
+}
+
+void DisplayList::rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    add(Op::RECT, color, x, y, w, h);
+}
+
+void DisplayList::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    add(Op::FILL_RECT, color, x, y, w, h);
+}
+
+void DisplayList::invertedBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h,
+                                 uint16_t color) {
+    if (muted()) return;
+    add(Op::INVERTED_BITMAP, color, x, y, w, h, reference(bitmap));
+}
+
+void DisplayList::compressedBitmap(int16_t x, int16_t y, const uint8_t* runs, int16_t w, int16_t h,
+                                   uint16_t color) {
+    if (muted()) return;
+    add(Op::COMPRESSED_BITMAP, color, x, y, w, h, reference(runs));
+}
+
+void DisplayList::stipple(int16_t x, int16_t y, int16_t w, int16_t h, const Stipple& pattern, uint16_t color) {
+    if (muted()) return;
+    add(Op::STIPPLE, color, x, y, w, h, reference(&pattern));
+}
+
+void DisplayList::text(int16_t x, int16_t y, const uint8_t* font, uint16_t color, const uint8_t* utf8, size_t len) {
+    if (muted() || len == 0) return;
+    if (textRuns.size() + len > INT16_MAX) {
+        overflowed = true;
+        return;
+    }
+    add(Op::TEXT, color, x, y, textRuns.size(), len, reference(font));
+    textRuns.insert(textRuns.end(), utf8, utf8 + len);
+}
+
+// ===== REPLAY =====
+
+bool DisplayList::rowsOverlap(int16_t y0, int16_t y1, int16_t top, int16_t bottom) {
+    if (y0 > y1) {
+        int16_t t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+    return y1 >= top && y0 < bottom;
+}
+
+void DisplayList::replay(RecordingDisplay& gfx, RecordingU8g2& text, int16_t top, int16_t bottom) const {
+    for (const Command& cmd : commands) {
+        switch (cmd.op) {
+        case Op::FILL_SCREEN:
+            gfx.fillScreen(cmd.color);
+            break;
+        case Op::PIXELS: {
+            int8_t stepX = static_cast<int8_t>(cmd.a >> 8);
+            int8_t stepY = static_cast<int8_t>(cmd.a & 0xFF);
+            if (!rowsOverlap(cmd.y, cmd.y + stepY * (cmd.b - 1), top, bottom)) break;
+            for (int16_t i = 0; i < cmd.b; i++) gfx.drawPixel(cmd.x + stepX * i, cmd.y + stepY * i, cmd.color);
+            break;
+        }
+        case Op::LINE:
+            if (rowsOverlap(cmd.y, cmd.b, top, bottom)) gfx.drawLine(cmd.x, cmd.y, cmd.a, cmd.b, cmd.color);
+            break;
+        case Op::H_LINE:
+            if (rowsOverlap(cmd.y, cmd.y, top, bottom)) gfx.drawFastHLine(cmd.x, cmd.y, cmd.a, cmd.color);
+            break;
+        case Op::V_LINE:
+            if (rowsOverlap(cmd.y, cmd.y + cmd.b - 1, top, bottom)) gfx.drawFastVLine(cmd.x, cmd.y, cmd.b, cmd.color);
+            break;
+        case Op::RECT:
+            if (rowsOverlap(cmd.y, cmd.y + cmd.b - 1, top, bottom)) gfx.drawRect(cmd.x, cmd.y, cmd.a, cmd.b, cmd.color);
+            break;
+        case Op::FILL_RECT:
+            if (rowsOverlap(cmd.y, cmd.y + cmd.b - 1, top, bottom)) gfx.fillRect(cmd.x, cmd.y, cmd.a, cmd.b, cmd.color);
+            break;
+        case Op::INVERTED_BITMAP:
+            if (rowsOverlap(cmd.y, cmd.y + cmd.b - 1, top, bottom)) {
+                gfx.drawInvertedBitmap(cmd.x, cmd.y, static_cast<const uint8_t*>(refs[cmd.ref]), cmd.a, cmd.b,
+                                       cmd.color);
+            }
+            break;
+        case Op::COMPRESSED_BITMAP:
+            if (rowsOverlap(cmd.y, cmd.y + cmd.b - 1, top, bottom)) {
+                gfx.drawCompressedBitmap(cmd.x, cmd.y, static_cast<const uint8_t*>(refs[cmd.ref]), cmd.a, cmd.b,
+                                         cmd.color);
+            }
+            break;
+        case Op::STIPPLE:
+            if (rowsOverlap(cmd.y, cmd.y + cmd.b - 1, top, bottom)) {
+                gfx.fillStipple(cmd.x, cmd.y, cmd.a, cmd.b, *static_cast<const Stipple*>(refs[cmd.ref]), cmd.color);
+            }
+            break;
+        case Op::TEXT: {
+            text.setFont(static_cast<const uint8_t*>(refs[cmd.ref]));
+            // Accents and brackets reach above the ascent of 'A', so allow a whole line height above the baseline
+            int16_t lineHeight = text.getFontAscent() - text.getFontDescent();
+            if (!rowsOverlap(cmd.y - lineHeight, cmd.y - text.getFontDescent(), top, bottom)) break;
+            text.setForegroundColor(cmd.color);
+            text.setCursor(cmd.x, cmd.y);
+            text.write(&textRuns[cmd.a], cmd.b);
+            break;
+        }
+        }
+    }
+}
+
+// ===== RECORDING DISPLAY =====
+
+void RecordingDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (captureBits) {
+        if (x < captureX || y < captureY || x >= captureX + captureW || y >= captureY + captureH) return;
+        int16_t col = x - captureX;
+        uint8_t& byte = captureBits[(y - captureY) * ((captureW + 7) / 8) + col / 8];
+        uint8_t mask = 0x80 >> (col & 7);
+        if (color == GxEPD_WHITE) {
+            byte &= ~mask;
+        } else {
+            byte |= mask;
+        }
+        return;
+    }
+    if (DisplayList* list = DisplayList::recording()) {
+        list->pixel(x, y, color);
+        return;
+    }
+    EpdPanel::drawPixel(x, y, color);
+}
+
+void RecordingDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if (DisplayList* list = DisplayList::recording()) {
+        list->hLine(x, y, w, color);
+        return;
+    }
+    EpdPanel::drawFastHLine(x, y, w, color);
+}
+
+void RecordingDisplay::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    if (DisplayList* list = DisplayList::recording()) {
+        list->vLine(x, y, h, color);
+        return;
+    }
+    EpdPanel::drawFastVLine(x, y, h, color);
+}
+
+void RecordingDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (DisplayList* list = DisplayList::recording()) {
+        list->line(x0, y0, x1, y1, color);
+        return;
+    }
+    EpdPanel::drawLine(x0, y0, x1, y1, color);
+}
+
+void RecordingDisplay::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (DisplayList* list = DisplayList::recording()) {
+        list->rect(x, y, w, h, color);
+        return;
+    }
+    EpdPanel::drawRect(x, y, w, h, color);
+}
+
+void RecordingDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (DisplayList* list = DisplayList::recording()) {
+        list->fillRect(x, y, w, h, color);
+        return;
+    }
+    EpdPanel::fillRect(x, y, w, h, color);
+}
+
+void RecordingDisplay::fillScreen(uint16_t color) {
+    if (DisplayList* list = DisplayList::recording()) {
+        list->fillScreen(color);
+        return;
+    }
+    if (captureBits) return; // A layer covers part of the screen, never all of it
+    EpdPanel::fillScreen(color);
+}
+
+void RecordingDisplay::drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+                                          uint16_t color) {
+    if (DisplayList* list = DisplayList::recording()) {
+        list->invertedBitmap(x, y, bitmap, w, h, color);
+        return;
+    }
+    EpdPanel::drawInvertedBitmap(x, y, bitmap, w, h, color);
+}
+
+// Reads the nibble runs written by svg-2-c-array/final_generate_icons_h.py
+class IconRuns {
+public:
+    explicit IconRuns(const uint8_t* data) : data(data) {}
+
+    uint16_t next() {
+        uint8_t run = nibble();
+        if (run < 15) return run;
+        uint8_t high = nibble();
+        return 15 + ((high << 4) | nibble());
+    }
+
+private:
+    uint8_t nibble() {
+        if (low) {
+            low = false;
+            return pgm_read_byte(data++) & 0x0F;
+        }
+        low = true;
+        return pgm_read_byte(data) >> 4;
+    }
+
+    const uint8_t* data;
+    bool low = false;
+};
+
+void RecordingDisplay::drawCompressedBitmap(int16_t x, int16_t y, const uint8_t runs[], int16_t w, int16_t h,
+                                            uint16_t color) {
+    if (DisplayList* list = DisplayList::recording()) {
+        list->compressedBitmap(x, y, runs, w, h, color);
+        return;
+    }
+    if (!runs || w <= 0 || h <= 0) return;
+
+    // Runs alternate background and foreground, starting with background, and may wrap rows
+    IconRuns reader(runs);
+    int16_t row = 0;
+    int16_t col = 0;
+    bool foreground = false;
+    while (row < h) {
+        uint16_t run = reader.next();
+        while (run > 0 && row < h) {
+            int16_t span = run < static_cast<uint16_t>(w - col) ? run : w - col;
+            if (foreground) EpdPanel::drawFastHLine(x + col, y + row, span, color);
+            run -= span;
+            col += span;
+            if (col == w) {
+                col = 0;
+                row++;
+            }
+        }
+        foreground = !foreground;
+    }
+}
+
+// 32 pixels of a row pattern, starting `phase` pixels into it
+static uint32_t stippleWord(uint32_t pattern, uint8_t period, uint8_t phase) {
+    uint32_t periodBits = period >= 32 ? 0xFFFFFFFF : ~(0xFFFFFFFF >> period);
+    pattern &= periodBits;
+    uint32_t word = phase ? ((pattern << phase) | (pattern >> (period - phase))) & periodBits : pattern;
+    for (uint8_t shift = period; shift < 32; shift += period) word |= word >> shift;
+    return word;
+}
+
+void RecordingDisplay::fillStipple(int16_t x, int16_t y, int16_t w, int16_t h, const Stipple& pattern,
+                                   uint16_t color) {
+    if (DisplayList* list = DisplayList::recording()) {
+        list->stipple(x, y, w, h, pattern, color);
+        return;
+    }
+    if (pattern.rowCount == 0 || pattern.period == 0) return;
+
+    int16_t left = x > 0 ? x : 0;
+    int16_t right = x + w < width() ? x + w : width();
+    int16_t top = y > 0 ? y : 0;
+    int16_t bottom = y + h < height() ? y + h : height();
+    for (int16_t row = top; row < bottom; row++) {
+        uint32_t rowPattern = pattern.rows[(row - y) % pattern.rowCount];
+        if (!rowPattern) continue;
+        for (int16_t wordX = left; wordX < right; wordX += 32) {
+            uint32_t word = stippleWord(rowPattern, pattern.period, (wordX - x) % pattern.period);
+            if (right - wordX < 32) word &= ~(0xFFFFFFFF >> (right - wordX));
+            while (word) {
+                int bit = __builtin_clz(word);
+                if (captureBits) {
+                    drawPixel(wordX + bit, row, color);
+                } else {
+                    EpdPanel::drawPixel(wordX + bit, row, color);
+                }
+                word &= ~(0x80000000u >> bit);
+            }
+        }
+    }
+}
+
+void RecordingDisplay::beginCapture(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t* bits) {
+    captureX = x;
+    captureY = y;
+    captureW = w;
+    captureH = h;
+    captureBits = bits;
+    memset(bits, 0, h * ((w + 7) / 8));
+}
+
+// ===== RECORDING U8G2 =====
+
+void RecordingU8g2::setFont(const uint8_t* font) {
+    this->font = font;
+    U8G2_FOR_ADAFRUIT_GFX::setFont(font);
+}
+
+void RecordingU8g2::setForegroundColor(uint16_t color) {
+    foreground = color;
+    U8G2_FOR_ADAFRUIT_GFX::setForegroundColor(color);
+}
+
+size_t RecordingU8g2::write(uint8_t v) {
+    return write(&v, 1);
+}
+
+size_t RecordingU8g2::write(const uint8_t* buffer, size_t size) {
+    bool ascii = pendingLength == 0;
+    for (size_t i = 0; i < size && ascii; i++) ascii = buffer[i] < 0x80;
+    if (ascii) return writeGlyphs(buffer, size);
+
+    // Swap code points the fonts lack for their fallback. A sequence split across calls
+    // (print(char) byte by byte) waits in pending until it is complete.
+    uint8_t chunk[64];
+    size_t used = 0;
+    for (size_t i = 0; i < size; i++) {
+        uint8_t byte = buffer[i];
+        if (used + 3 > sizeof(chunk)) {
+            writeGlyphs(chunk, used);
+            used = 0;
+        }
+        if (pendingLength > 0 && (byte & 0xC0) == 0x80) {
+            pending[pendingLength++] = byte;
+            size_t expected = pending[0] >= 0xE0 ? 3 : 2;
+            if (pendingLength < expected) continue;
+            const uint8_t* p = pending;
+            uint16_t codepoint = Fonts::nextCodepoint(p, pending + pendingLength);
+            used += Fonts::encodeUtf8(Fonts::printable(codepoint), reinterpret_cast<char*>(chunk + used));
+            pendingLength = 0;
+            continue;
+        }
+        // Broken sequences are passed on as they are, U8g2 draws what it makes of them
+        memcpy(chunk + used, pending, pendingLength);
+        used += pendingLength;
+        pendingLength = 0;
+        if (byte >= 0xC0 && byte < 0xF0) {
+            pending[pendingLength++] = byte;
+        } else {
+            chunk[used++] = byte;
+        }
+    }
+    writeGlyphs(chunk, used);
+    return size;
+}
+
+size_t RecordingU8g2::writeGlyphs(const uint8_t* buffer, size_t size) {
+    DisplayList* list = DisplayList::recording();
+    if (!list || list->muted()) {
+        // Print::write() passes each byte to write(uint8_t), which lands here again
+        size_t n = 0;
+        for (size_t i = 0; i < size; i++) n += U8G2_FOR_ADAFRUIT_GFX::write(buffer[i]);
+        return n;
+    }
+
+    // Record the run, then let U8g2 advance the cursor exactly as it would when drawing
+    list->text(getCursorX(), getCursorY(), font, foreground, buffer, size);
+    list->mute();
+    size_t n = writeGlyphs(buffer, size);
+    list->unmute();
+    return n;
+}
@@ -7,14 +7,17 @@
 #include "display/weather_general_half.h"
 #include "display/weather_general_full.h"
 #include "display/common_footer.h"
+#include "display/fonts.h"
+#include "display/layer_cache.h"
 #include "display/trip_display.h"
 #include "display/qr_code_helper.h"
+#include "util/energy_meter.h"
 #include "util/util.h"
 
 #include "WiFiManager.h"
 
 // Include bitmap icons
-#include "icons.h"
+#include "icons_compressed.h"
 
 #include "global_instances.h"
 
@@ -26,6 +29,11 @@ int16_t DisplayManager::screenWidth = display.width(); // Will be read from disp
 int16_t DisplayManager::screenHeight = display.height(); // Will be read from display
 int16_t DisplayManager::halfWidth = display.width() / 2; // Will be calculated
 int16_t DisplayManager::halfHeight = display.height() / 2; // Will be calculated
+bool DisplayManager::weatherHalfPrepared = false;
+bool DisplayManager::framePlanned = false;
+
+// What the panel shows across deep sleep, for partial refresh planning
+RTC_DATA_ATTR static RefreshState refreshState = {};
 
 // ===== INITIALIZATION METHODS =====
 
@@ -40,15 +48,14 @@ void DisplayManager::calculateDimensions() {
 
 // ===== DISPLAY UPDATE METHODS FOR EACH CASE =====
 
-void DisplayManager::displayHalfNHalf(const WeatherInfo& weather,
-                                      const DepartureData& departures) {
-    ESP_LOGI(TAG, "Full update - both halves");
+void DisplayManager::displayHalfNHalf(const WeatherInfo& weather, const DepartureData& departures) {
+    ESP_LOGI(TAG, "Half-and-half update - weather + departures");
 
     const int16_t contentY = 0; // Start from top (no header)
 
-    display.setFullWindow();
-    display.firstPage();
-    do {
+    if (display.pages() != 1) {
+        DisplayList frame;
+        beginFrame(frame);
         display.fillScreen(GxEPD_WHITE);
 
         // Draw both halves
@@ -57,24 +64,152 @@ void DisplayManager::displayHalfNHalf(const WeatherInfo& weather,
 
         // Draw vertical divider
         displayVerticalLine(contentY);
-    } while (display.nextPage());
+        endFrame(frame);
+        return;
+    }
+
+    // Whole frame in RAM: complete it, then let the planner choose what to push
+    if (!takePreparedFrame()) {
+        display.setFullWindow();
+        display.fillScreen(GxEPD_WHITE);
+        drawWeatherHalfLayout(weather);
+    }
+    drawWeatherHalfFooter();
+    updateDepartureHalf(departures);
+    displayVerticalLine(contentY);
+    pushFrame(ScreenLayout::HALF_DEPARTURES, {weatherFingerprint(weather), WeatherHalfDisplay::footerFingerprint(),
+                                              departuresFingerprint(departures)});
 }
 
 void DisplayManager::displayHalfNHalfTrip(const WeatherInfo& weather, const TripData& tripData) {
-    ESP_LOGI(TAG, "Full update - weather + trip connections");
+    ESP_LOGI(TAG, "Half-and-half update - weather + trip connections");
 
-    display.setFullWindow();
-    display.firstPage();
-    do {
+    if (display.pages() != 1) {
+        DisplayList frame;
+        beginFrame(frame);
         display.fillScreen(GxEPD_WHITE);
         updateWeatherHalf(weather);
         TripDisplay::drawTripConnections(tripData, halfWidth + 1, 0, screenWidth - halfWidth - 1, screenHeight);
         displayVerticalLine(0);
+        endFrame(frame);
+        return;
+    }
+
+    if (!takePreparedFrame()) {
+        display.setFullWindow();
+        display.fillScreen(GxEPD_WHITE);
+        drawWeatherHalfLayout(weather);
+    }
+    drawWeatherHalfFooter();
+    TripDisplay::drawTripConnections(tripData, halfWidth + 1, 0, screenWidth - halfWidth - 1, screenHeight);
+    displayVerticalLine(0);
+    pushFrame(ScreenLayout::HALF_TRIP, {weatherFingerprint(weather), WeatherHalfDisplay::footerFingerprint(),
+                                        tripFingerprint(tripData)});
+}
+
+void DisplayManager::pushFrame(ScreenLayout layout, const FrameContent& content) {
+    RefreshPlan plan = RefreshPlanner::plan(refreshState, layout, content, screenWidth, screenHeight,
+                                            DisplayConstants::FOOTER_HEIGHT);
+    framePlanned = true;
+
+    if (!plan.full && plan.windowCount == 0) {
+        // Same pixels as the panel already shows: leave it untouched (it stays powered off)
+        RefreshPlanner::record(refreshState, layout, content, plan);
+        ESP_LOGI(TAG, "Frame unchanged, refresh skipped");
+        return;
+    }
+
+    EnergyMeter::Scope refreshing(EnergyPhase::PANEL_REFRESH);
+    unsigned long start = millis();
+    if (plan.full) {
+        display.display(false);
+    } else {
+        for (uint8_t i = 0; i < plan.windowCount; i++) {
+            const RefreshWindow& window = plan.windows[i];
+            display.displayWindow(window.x, window.y, window.w, window.h);
+        }
+    }
+    display.powerOff();
+
+    RefreshPlanner::record(refreshState, layout, content, plan);
+    ESP_LOGI(TAG, "%s refresh (%u windows) in %lu ms (%u partial updates since last full)",
+             plan.full ? "Full" : "Partial", plan.windowCount, millis() - start, refreshState.partialsSinceFull);
+}
+
+uint32_t DisplayManager::weatherFingerprint(const WeatherInfo& weather) {
+    // WeatherInfo is plain data; the city name in the header comes from the config
+    return ContentHash().add(&weather, sizeof(weather)).add(ConfigManager::getConfig().cityName).get();
+}
+
+uint32_t DisplayManager::departuresFingerprint(const DepartureData& departures) {
+    // Hash the string contents, not the pool offsets, which depend on parse order
+    ContentHash hash;
+    hash.add(ConfigManager::getStopNameFromId().c_str());
+    for (const DepartureInfo& dep : departures.departures) {
+        hash.add(dep.line.c_str()).add(dep.direction.c_str()).add(dep.directionFlag.c_str());
+        hash.add(dep.time.c_str()).add(dep.rtTime.c_str()).add(dep.track.c_str());
+        hash.add(dep.category.c_str()).add(dep.text.c_str()).add(&dep.cancelled, sizeof(dep.cancelled));
+    }
+    return hash.get();
+}
+
+uint32_t DisplayManager::tripFingerprint(const TripData& tripData) {
+    // Connections show "in N min", so the frame changes with every minute
+    time_t minute = time(nullptr) / 60;
+    return ContentHash().add(&tripData, sizeof(tripData)).add(&minute, sizeof(minute)).get();
+}
+
+void DisplayManager::prepareWeatherHalf(const WeatherInfo& weather) {
+    // The frame buffer holds the whole 800x480 frame in RAM, so it doubles as the
+    // off-screen buffer. With a paged buffer everything is drawn at display time instead.
+    if (display.pages() != 1) return;
+
+    unsigned long start = millis();
+    display.setFullWindow();
+    display.fillScreen(GxEPD_WHITE);
+    drawWeatherHalfLayout(weather);
+    weatherHalfPrepared = true;
+    ESP_LOGI(TAG, "Weather half rasterized ahead in %lu ms", millis() - start);
+}
+
+bool DisplayManager::takePreparedFrame() {
+    bool prepared = weatherHalfPrepared;
+    weatherHalfPrepared = false;
+    return prepared;
+}
+
+void DisplayManager::beginFrame(DisplayList& frame) {
+    display.setFullWindow();
+#if DISPLAY_LIST
+    frame.beginRecording();
+#else
+    (void)frame;
+    display.firstPage();
+#endif
+}
+
+void DisplayManager::endFrame(DisplayList& frame) {
+    EnergyMeter::Scope refreshing(EnergyPhase::PANEL_REFRESH);
+#if DISPLAY_LIST
+    frame.endRecording();
+    if (!frame.complete()) ESP_LOGE(TAG, "Display list overflowed, frame is incomplete");
+    ESP_LOGI(TAG, "Frame recorded: %u commands, %u bytes, %u pages", (unsigned)frame.commandCount(),
+             (unsigned)frame.bytes(), display.pages());
+
+    int16_t pageTop = 0;
+    display.firstPage();
+    do {
+        frame.replay(display, u8g2, pageTop, pageTop + display.pageHeight());
+        pageTop += display.pageHeight();
     } while (display.nextPage());
+#else
+    (void)frame;
+    display.nextPage(); // Single page: refreshes the panel
+#endif
 }
 
 void DisplayManager::displayVerticalLine(const int16_t contentY) {
-    display.drawLine(halfWidth, contentY, halfWidth, screenHeight, GxEPD_BLACK);
+    display.drawLine(halfWidth, contentY, halfWidth, screenHeight - 1, GxEPD_BLACK);
 }
 
 // ===== HALF-CONTENT UPDATE METHODS =====
@@ -82,6 +217,11 @@ void DisplayManager::displayVerticalLine(const int16_t contentY) {
 void DisplayManager::updateWeatherHalf(const WeatherInfo& weather) {
     ESP_LOGI(TAG, "Updating weather half");
 
+    drawWeatherHalfLayout(weather);
+    drawWeatherHalfFooter();
+}
+
+void DisplayManager::drawWeatherHalfLayout(const WeatherInfo& weather) {
     const int16_t contentHeight = screenHeight; // Full height
 
     // Landscape: weather is LEFT half (full height)
@@ -94,7 +234,11 @@ void DisplayManager::updateWeatherHalf(const WeatherInfo& weather) {
 
     // Draw weather layout
     WeatherHalfDisplay::drawHalfScreenWeatherLayout(weather, leftMargin, rightMargin, y, contentHeight);
-    WeatherHalfDisplay::drawWeatherFooter(x, screenHeight - DisplayConstants::FOOTER_HEIGHT,
+}
+
+void DisplayManager::drawWeatherHalfFooter() {
+    // Time, WiFi and battery are read at draw time, so the footer is never drawn ahead
+    WeatherHalfDisplay::drawWeatherFooter(0, screenHeight - DisplayConstants::FOOTER_HEIGHT,
                                           DisplayConstants::FOOTER_HEIGHT);
 }
 
@@ -113,33 +257,40 @@ void DisplayManager::updateDepartureHalf(const DepartureData& departures) {
 void DisplayManager::displayWeatherFull(const WeatherInfo& weather) {
     ESP_LOGI(TAG, "Displaying weather only mode");
 
-    display.setFullWindow();
-    display.firstPage();
-
-    do {
-        display.fillScreen(GxEPD_WHITE);
-        WeatherFullDisplay::drawFullScreenWeatherLayout(weather);
-        WeatherFullDisplay::drawWeatherFooter(0, screenHeight - DisplayConstants::FOOTER_HEIGHT,
-                                              DisplayConstants::FOOTER_HEIGHT);
-    } while (display.nextPage());
+    DisplayList frame;
+    beginFrame(frame);
+    display.fillScreen(GxEPD_WHITE);
+    WeatherFullDisplay::drawFullScreenWeatherLayout(weather);
+    WeatherFullDisplay::drawWeatherFooter(0, screenHeight - DisplayConstants::FOOTER_HEIGHT,
+                                          DisplayConstants::FOOTER_HEIGHT);
+    endFrame(frame);
 }
 
 void DisplayManager::displayDeparturesFull(const DepartureData& departures) {
     ESP_LOGI(TAG, "Displaying transports only mode");
 
-    display.setFullWindow();
-    display.firstPage();
-
-    do {
-        display.fillScreen(GxEPD_WHITE);
-        TransportDisplay::drawFullScreenTransportSection(departures, 0, 0,
-                                                         screenWidth, screenHeight);
-    } while (display.nextPage());
+    DisplayList frame;
+    beginFrame(frame);
+    display.fillScreen(GxEPD_WHITE);
+    TransportDisplay::drawFullScreenTransportSection(departures, 0, 0,
+                                                     screenWidth, screenHeight);
+    endFrame(frame);
 }
 
 // ===== POWER MANAGEMENT =====
 
 void DisplayManager::hibernate() {
+    if (framePlanned) {
+        // Power off keeps the controller RAM, which the next partial refresh diffs against
+        display.powerOff();
+        refreshState.panelKept = true;
+        ESP_LOGI(TAG, "Display powered off, frame kept for partial refresh");
+        return;
+    }
+
+    // Any other screen was drawn with a full refresh the planner does not know about
+    refreshState = {};
+
     ESP_LOGI(TAG, "Hibernating display");
 
     // Turn off display
@@ -149,6 +300,10 @@ void DisplayManager::hibernate() {
     ESP_LOGI(TAG, "Display hibernated");
 }
 
+bool DisplayManager::panelRetained() {
+    return refreshState.panelKept;
+}
+
 
 // ===== CONFIGURATION MODE DISPLAY =====
 
@@ -163,94 +318,97 @@ void DisplayManager::displayPhase1WifiSetup() {
     String wifiQR = "WIFI:S:" + apSSID + ";;"; // WiFi connection string (no password)
     String urlQR = "http://10.0.1.1"; // Captive portal URL
 
+    const int16_t qrX = 540; // X position for QR codes (right side)
+    const uint8_t qrVersion = 3; // Version 3 (29x29 modules)
+    const uint8_t qrScale = 4; // 4 pixels per module
+    const int16_t qrSize = QRCodeHelper::getQRCodeSize(qrVersion, qrScale);
+    const int16_t qr1Y = 80;
+    const int16_t qr2Y = qr1Y + qrSize + 60; // Space between QR codes
+
+    // The texts only change with the SSID; with a paged frame buffer they are laid out once, not per page
+    uint32_t textContent = ContentHash().add(apSSID.c_str()).get();
+
     // Start display update
     display.setFullWindow();
     display.firstPage();
     do {
         display.fillScreen(GxEPD_WHITE);
 
-        // Set up fonts
-        u8g2.setFont(u8g2_font_helvB18_tf); // Bold 18pt for title
-        u8g2.setForegroundColor(GxEPD_BLACK);
-        u8g2.setBackgroundColor(GxEPD_WHITE);
-
-        int16_t y = 40; // Start position from top
-        const int16_t lineHeight = 35; // Spacing between lines
-        const int16_t margin = 20; // Left margin
-        const int16_t instructionWidth = 500; // Width for instructions (left side)
+        LayerCache::draw(LayerCache::Layer::SETUP_INSTRUCTIONS, 0, 0, screenWidth, screenHeight, textContent, [&] {
+            // Set up fonts
+            u8g2.setFont(Fonts::HELVB18); // Bold 18pt for title
+            u8g2.setForegroundColor(GxEPD_BLACK);
+            u8g2.setBackgroundColor(GxEPD_WHITE);
 
-        // Draw title
-        u8g2.setCursor(margin, y);
-        u8g2.print("EINRICHTUNG 1/2 : MyStation mit Ihrem WLAN verbinden");
+            int16_t y = 40; // Start position from top
+            const int16_t lineHeight = 35; // Spacing between lines
+            const int16_t margin = 20; // Left margin
+            const int16_t instructionWidth = 500; // Width for instructions (left side)
 
-        // Draw underline for title
-        display.drawFastHLine(margin, y + 5, screenWidth - (2 * margin), GxEPD_BLACK);
+            // Draw title
+            u8g2.setCursor(margin, y);
+            u8g2.print("EINRICHTUNG 1/2 : MyStation mit Ihrem WLAN verbinden");
 
-        y += lineHeight + 5;
+            // Draw underline for title
+            display.drawFastHLine(margin, y + 5, screenWidth - (2 * margin), GxEPD_BLACK);
 
-        // Draw instruction lines in German
-        u8g2.setFont(u8g2_font_helvB10_tf);
+            y += lineHeight + 5;
 
-        y += 10;
-        u8g2.setCursor(margin, y);
-        u8g2.print("1. Gerät einschalten (Schalter auf ON schieben)");
-        y += lineHeight;
+            // Draw instruction lines in German
+            u8g2.setFont(Fonts::HELVB10);
 
-        y += 10;
-        u8g2.setCursor(margin, y);
-        u8g2.print("2. Mit dem MyStation-WLAN verbinden:");
-        y += lineHeight;
+            y += 10;
+            u8g2.setCursor(margin, y);
+            u8g2.print("1. Gerät einschalten (Schalter auf ON schieben)");
+            y += lineHeight;
 
-        u8g2.setCursor(margin + 20, y);
-        u8g2.print("- QR-Code 1 scannen (verbindet automatisch)");
-        y += lineHeight;
+            y += 10;
+            u8g2.setCursor(margin, y);
+            u8g2.print("2. Mit dem MyStation-WLAN verbinden:");
+            y += lineHeight;
 
-        u8g2.setCursor(margin + 20, y);
-        u8g2.print("- ODER manuell: WLAN \"" + apSSID + "\" wählen (kein Passwort)");
-        y += lineHeight;
+            u8g2.setCursor(margin + 20, y);
+            u8g2.print("- QR-Code 1 scannen (verbindet automatisch)");
+            y += lineHeight;
 
-        y += 10;
-        u8g2.setCursor(margin, y);
-        u8g2.print("3. Einrichtungsseite öffnen:");
-        y += lineHeight;
+            u8g2.setCursor(margin + 20, y);
+            u8g2.print("- ODER manuell: WLAN \"" + apSSID + "\" wählen (kein Passwort)");
+            y += lineHeight;
 
-        u8g2.setCursor(margin + 20, y);
-        u8g2.print("- Seite öffnet sich automatisch");
-        y += lineHeight;
+            y += 10;
+            u8g2.setCursor(margin, y);
+            u8g2.print("3. Einrichtungsseite öffnen:");
+            y += lineHeight;
 
-        u8g2.setCursor(margin + 20, y);
-        u8g2.print("- Falls nicht: QR-Code 2 scannen oder http://10.0.1.1 im Browser öffnen");
-        y += lineHeight;
+            u8g2.setCursor(margin + 20, y);
+            u8g2.print("- Seite öffnet sich automatisch");
+            y += lineHeight;
 
-        y += 10;
-        u8g2.setCursor(margin, y);
-        u8g2.print("4. Ihr Heim-WLAN auswählen und Passwort eingeben");
-        y += lineHeight;
+            u8g2.setCursor(margin + 20, y);
+            u8g2.print("- Falls nicht: QR-Code 2 scannen oder http://10.0.1.1 im Browser öffnen");
+            y += lineHeight;
 
-        y += 10;
-        u8g2.setCursor(margin, y);
-        u8g2.print("5. Warten - MyStation verbindet sich und startet automatisch neu");
-        y += lineHeight;
+            y += 10;
+            u8g2.setCursor(margin, y);
+            u8g2.print("4. Ihr Heim-WLAN auswählen und Passwort eingeben");
+            y += lineHeight;
 
-        u8g2.setFont(u8g2_font_helvB10_tf);
-        u8g2.setCursor(margin, 460);
-        u8g2.print("Hinweis: Nur 2,4-GHz-WLAN wird unterstützt. 5-GHz-Netzwerke werden nicht angezeigt.");
+            y += 10;
+            u8g2.setCursor(margin, y);
+            u8g2.print("5. Warten - MyStation verbindet sich und startet automatisch neu");
+            y += lineHeight;
 
-        // === QR CODES ON RIGHT SIDE ===
-        const int16_t qrX = 540; // X position for QR codes (right side)
-        const uint8_t qrVersion = 3; // Version 3 (29x29 modules)
-        const uint8_t qrScale = 4; // 4 pixels per module
-        int16_t qrSize = QRCodeHelper::getQRCodeSize(qrVersion, qrScale);
+            u8g2.setFont(Fonts::HELVB10);
+            u8g2.setCursor(margin, 460);
+            u8g2.print("Hinweis: Nur 2,4-GHz-WLAN wird unterstützt. 5-GHz-Netzwerke werden nicht angezeigt.");
 
-        // QR Code 1: WiFi Connection
-        int16_t qr1Y = 80;
-        QRCodeHelper::drawQRCode(qrX, qr1Y, wifiQR, qrScale, qrVersion);
-        QRCodeHelper::drawQRLabel(qrX, qr1Y, qrSize, "1. WLAN verbinden", 15);
+            QRCodeHelper::drawQRLabel(qrX, qr1Y, qrSize, "1. WLAN verbinden", 15);
+            QRCodeHelper::drawQRLabel(qrX, qr2Y, qrSize, "2. Seite öffnen", 15);
+        });
 
-        // QR Code 2: Portal URL
-        int16_t qr2Y = qr1Y + qrSize + 60; // Space between QR codes
-        QRCodeHelper::drawQRCode(qrX, qr2Y, urlQR, qrScale, qrVersion);
-        QRCodeHelper::drawQRLabel(qrX, qr2Y, qrSize, "2. Seite öffnen", 15);
+        // === QR CODES ON RIGHT SIDE ===
+        QRCodeHelper::drawQRCode(qrX, qr1Y, wifiQR, qrScale, qrVersion); // QR Code 1: WiFi Connection
+        QRCodeHelper::drawQRCode(qrX, qr2Y, urlQR, qrScale, qrVersion); // QR Code 2: Portal URL
     } while (display.nextPage());
 
     ESP_LOGI(TAG, "Phase 1 WiFi setup instructions displayed with QR codes");
@@ -276,7 +434,7 @@ void DisplayManager::displayPhase2AppSetup() {
         display.fillScreen(GxEPD_WHITE);
 
         // Set up fonts
-        u8g2.setFont(u8g2_font_helvB18_tf); // Bold 18pt for title
+        u8g2.setFont(Fonts::HELVB18); // Bold 18pt for title
         u8g2.setForegroundColor(GxEPD_BLACK);
         u8g2.setBackgroundColor(GxEPD_WHITE);
 
@@ -294,7 +452,7 @@ void DisplayManager::displayPhase2AppSetup() {
         y += lineHeight + 5;
 
         // Draw instruction lines in German
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
 
         y += 10;
         u8g2.setCursor(margin, y);
@@ -356,6 +514,10 @@ void DisplayManager::displayApplicationInfo(float batteryVoltage, int batteryPer
     const char* boardName = "Unknown Board";
 #endif
 
+    // Recorded wakes before this one
+    EnergySummary energy = EnergyMeter::summary(batteryVoltage > 0.0f ? batteryPercent : -1);
+
+    EnergyMeter::Scope refreshing(EnergyPhase::PANEL_REFRESH);
     display.setFullWindow();
     display.firstPage();
     do {
@@ -370,20 +532,20 @@ void DisplayManager::displayApplicationInfo(float batteryVoltage, int batteryPer
         const int16_t lhBig = 30; // line height for section headers
 
         // ── Title bar ──────────────────────────────────────────────────────
-        u8g2.setFont(u8g2_font_helvB18_tf);
+        u8g2.setFont(Fonts::HELVB18);
         int16_t y = 38;
         u8g2.setCursor(margin, y);
         u8g2.print("MyStation - Device Info");
         display.drawFastHLine(margin, y + 6, screenWidth - 2 * margin, GxEPD_BLACK);
 
         // ── LEFT COLUMN ────────────────────────────────────────────────────
-        u8g2.setFont(u8g2_font_helvB12_tf);
+        u8g2.setFont(Fonts::HELVB12);
         y += lhBig + 8;
         u8g2.setCursor(margin, y);
         u8g2.print("Firmware");
         display.drawFastHLine(margin, y + 3, screenWidth / 2 - margin * 2, GxEPD_BLACK);
 
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
         y += lhSmall;
         u8g2.setCursor(margin, y);
         u8g2.printf("Version : %s", FIRMWARE_VERSION);
@@ -406,13 +568,13 @@ void DisplayManager::displayApplicationInfo(float batteryVoltage, int batteryPer
         }
 
         // Battery ──────────────────────────────────────────────────────────
-        u8g2.setFont(u8g2_font_helvB12_tf);
+        u8g2.setFont(Fonts::HELVB12);
         y += lhBig;
         u8g2.setCursor(margin, y);
         u8g2.print("Battery");
         display.drawFastHLine(margin, y + 3, screenWidth / 2 - margin * 2, GxEPD_BLACK);
 
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
         y += lhSmall;
         u8g2.setCursor(margin, y);
 #if SHOW_BATTERY_STATUS
@@ -429,13 +591,13 @@ void DisplayManager::displayApplicationInfo(float batteryVoltage, int batteryPer
 #endif
 
         // ── Weather ────────────────────────────────────────────────────────
-        u8g2.setFont(u8g2_font_helvB12_tf);
+        u8g2.setFont(Fonts::HELVB12);
         y += lhBig;
         u8g2.setCursor(margin, y);
         u8g2.print("Weather");
         display.drawFastHLine(margin, y + 3, screenWidth / 2 - margin * 2, GxEPD_BLACK);
 
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
         y += lhSmall;
         u8g2.setCursor(margin, y);
         u8g2.printf("City    : %s", cfg.cityName);
@@ -458,13 +620,13 @@ void DisplayManager::displayApplicationInfo(float batteryVoltage, int batteryPer
         }
 
         // ── Transport ──────────────────────────────────────────────────────
-        u8g2.setFont(u8g2_font_helvB12_tf);
+        u8g2.setFont(Fonts::HELVB12);
         y += lhBig;
         u8g2.setCursor(margin, y);
         u8g2.print("Transport");
         display.drawFastHLine(margin, y + 3, screenWidth / 2 - margin * 2, GxEPD_BLACK);
 
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
         y += lhSmall;
         u8g2.setCursor(margin, y);
         u8g2.printf("Stop    : %s", cfg.selectedStopName);
@@ -501,12 +663,12 @@ void DisplayManager::displayApplicationInfo(float batteryVoltage, int batteryPer
         display.drawFastVLine(screenWidth / 2, 44, screenHeight - 20 - 44, GxEPD_BLACK);
 
         // Network ──────────────────────────────────────────────────────────
-        u8g2.setFont(u8g2_font_helvB12_tf);
+        u8g2.setFont(Fonts::HELVB12);
         u8g2.setCursor(col2, ry);
         u8g2.print("Network");
         display.drawFastHLine(col2, ry + 3, screenWidth / 2 - margin * 2, GxEPD_BLACK);
 
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
         ry += lhSmall;
         u8g2.setCursor(col2, ry);
         u8g2.printf("SSID    : %s", cfg.ssid);
@@ -526,13 +688,13 @@ void DisplayManager::displayApplicationInfo(float batteryVoltage, int batteryPer
         }
 
         // Display mode ────────────────────────────────────────────────────
-        u8g2.setFont(u8g2_font_helvB12_tf);
+        u8g2.setFont(Fonts::HELVB12);
         ry += lhBig;
         u8g2.setCursor(col2, ry);
         u8g2.print("Display");
         display.drawFastHLine(col2, ry + 3, screenWidth / 2 - margin * 2, GxEPD_BLACK);
 
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
         ry += lhSmall;
         u8g2.setCursor(col2, ry);
         const char* modeName = "Unknown";
@@ -547,16 +709,40 @@ void DisplayManager::displayApplicationInfo(float batteryVoltage, int batteryPer
             break;
         }
         u8g2.printf("Mode    : %s", modeName);
-        ry += lhSmall; // Spacer to align Sleep section with Weather on left
+
+        // Energy ──────────────────────────────────────────────────────────
+        u8g2.setFont(Fonts::HELVB12);
+        ry += lhBig;
+        u8g2.setCursor(col2, ry);
+        u8g2.print("Energy");
+        display.drawFastHLine(col2, ry + 3, screenWidth / 2 - margin * 2, GxEPD_BLACK);
+
+        u8g2.setFont(Fonts::HELVB10);
+        ry += lhSmall;
+        u8g2.setCursor(col2, ry);
+        if (energy.wakes == 0) {
+            u8g2.print("No wakes recorded yet");
+            ry += lhSmall;
+        } else {
+            u8g2.printf("Per wake: %.2f mAh (%s %u%%)", energy.mAhPerWake, EnergyMeter::phaseName(energy.topPhase),
+                        energy.topPhasePercent);
+            ry += lhSmall;
+            u8g2.setCursor(col2, ry);
+            if (energy.runtimeDays > 0.0f) {
+                u8g2.printf("Per day : %.1f mAh, %.0f days left", energy.mAhPerDay, energy.runtimeDays);
+            } else {
+                u8g2.printf("Per day : %.1f mAh", energy.mAhPerDay);
+            }
+        }
 
         // Sleep schedule ──────────────────────────────────────────────────
-        u8g2.setFont(u8g2_font_helvB12_tf);
+        u8g2.setFont(Fonts::HELVB12);
         ry += lhBig;
         u8g2.setCursor(col2, ry);
         u8g2.print("Sleep");
         display.drawFastHLine(col2, ry + 3, screenWidth / 2 - margin * 2, GxEPD_BLACK);
 
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
         ry += lhSmall;
         u8g2.setCursor(col2, ry);
         u8g2.printf("Window  : %s - %s", cfg.sleepStart, cfg.sleepEnd);
@@ -571,23 +757,24 @@ void DisplayManager::displayApplicationInfo(float batteryVoltage, int batteryPer
         u8g2.printf("WE Trans: %s - %s", cfg.weekendTransportStart, cfg.weekendTransportEnd);
 
         // OTA ─────────────────────────────────────────────────────────────
-        u8g2.setFont(u8g2_font_helvB12_tf);
+        u8g2.setFont(Fonts::HELVB12);
         ry += lhBig;
         u8g2.setCursor(col2, ry);
         u8g2.print("OTA Update");
         display.drawFastHLine(col2, ry + 3, screenWidth / 2 - margin * 2, GxEPD_BLACK);
 
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
         ry += lhSmall;
         u8g2.setCursor(col2, ry);
-        u8g2.printf("Enabled : %s", cfg.otaEnabled ? "Yes" : "No");
-        ry += lhSmall;
-        u8g2.setCursor(col2, ry);
-        u8g2.printf("Time    : %s", cfg.otaCheckTime);
+        if (cfg.otaEnabled) {
+            u8g2.printf("Check   : daily at %s", cfg.otaCheckTime);
+        } else {
+            u8g2.print("Check   : disabled");
+        }
 
         // ── Footer ─────────────────────────────────────────────────────────
         display.drawFastHLine(margin, screenHeight - 20, screenWidth - 2 * margin, GxEPD_BLACK);
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
         u8g2.setCursor(margin, screenHeight - 6);
         {
             time_t now;
@@ -620,18 +807,18 @@ void DisplayManager::displayCenteredErrorIcon(icon_name_t iconName, uint8_t icon
     ESP_LOGI(TAG, "Displaying error icon at center (%d, %d) with size %d", iconX, iconY, iconSize);
 
     // Get bitmap data
-    const unsigned char* bitmap = getBitmap(iconName, iconSize);
+    const unsigned char* bitmap = getCompressedBitmap(iconName, iconSize);
     if (!bitmap) {
         ESP_LOGE(TAG, "Failed to get bitmap for icon %d at size %d", iconName, iconSize);
         return;
     }
 
     // Draw the icon centered
-    display.drawInvertedBitmap(iconX, iconY, bitmap, iconSize, iconSize, GxEPD_BLACK);
+    display.drawCompressedBitmap(iconX, iconY, bitmap, iconSize, iconSize, GxEPD_BLACK);
 
     // Draw optional error message below icon
     if (message) {
-        u8g2.setFont(u8g2_font_helvB10_tf); // 10pt bold font
+        u8g2.setFont(Fonts::HELVB10); // 10pt bold font
         u8g2.setForegroundColor(GxEPD_BLACK);
         u8g2.setBackgroundColor(GxEPD_WHITE);
 
@@ -732,12 +919,12 @@ void DisplayManager::displayOTAProgress(const char* currentVersion, const char*
         const int16_t margin = 20;
         int16_t y = 200;
 
-        u8g2.setFont(u8g2_font_helvB18_tf);
+        u8g2.setFont(Fonts::HELVB18);
         u8g2.setCursor(margin, y);
         u8g2.print("Firmware-Update");
 
         y += 40;
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
         u8g2.setCursor(margin, y);
         u8g2.printf("%s  ->  %s", currentVersion, targetVersion);
 
@@ -748,7 +935,7 @@ void DisplayManager::displayOTAProgress(const char* currentVersion, const char*
         bool breakingChange = (tgtMajor > curMajor);
 
         y += 40;
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
         u8g2.setCursor(margin, y);
         u8g2.print("Bitte nicht ausschalten!");
 
@@ -776,12 +963,12 @@ void DisplayManager::displayOTAUpToDate(const char* currentVersion) {
         const int16_t margin = 20;
         int16_t y = 200;
 
-        u8g2.setFont(u8g2_font_helvB18_tf);
+        u8g2.setFont(Fonts::HELVB18);
         u8g2.setCursor(margin, y);
         u8g2.print("Firmware ist aktuell");
 
         y += 40;
-        u8g2.setFont(u8g2_font_helvB10_tf);
+        u8g2.setFont(Fonts::HELVB10);
         u8g2.setCursor(margin, y);
         u8g2.printf("Version: %s", currentVersion);
     } while (display.nextPage());
@@ -0,0 +1,71 @@
+#include "display/fonts.h"
+
+// Base letters for U+00C0..U+00FF
+static const char LATIN1_BASE_LETTERS[] = "AAAAAAACEEEEIIIIDNOOOOOxOUUUUYPs"
+                                          "aaaaaaaceeeeiiiidnooooo?ouuuuypy";
+
+static bool fontsHave(uint16_t codepoint) {
+    if (codepoint >= 0x20 && codepoint < 0x7F) return true; // Always kept
+#if FONT_SUBSET
+    return codepoint < 0x100 && (Fonts::SUBSET_GLYPHS[codepoint >> 3] & (1 << (codepoint & 7)));
+#else
+    return codepoint >= 0xA0 && codepoint < 0x100; // The _tf fonts cover Latin-1
+#endif
+}
+
+uint16_t Fonts::printable(uint16_t codepoint) {
+    if (codepoint < 0x20 || fontsHave(codepoint)) return codepoint; // Control characters draw nothing either way
+
+    if (codepoint >= 0xC0 && codepoint < 0x100) return LATIN1_BASE_LETTERS[codepoint - 0xC0];
+    switch (codepoint) {
+    case 0x00A0: // No-break space
+        return ' ';
+    case 0x00AB: // « »
+    case 0x00BB:
+    case 0x201C: // “ ” „
+    case 0x201D:
+    case 0x201E:
+        return '"';
+    case 0x00B4: // ´ ‘ ’ ‚
+    case 0x2018:
+    case 0x2019:
+    case 0x201A:
+        return '\'';
+    case 0x2010: // Hyphen, en and em dash
+    case 0x2013:
+    case 0x2014:
+        return '-';
+    case 0x2026: // …
+        return '.';
+    case 0x20AC: // €
+        return 'E';
+    default:
+        return '?';
+    }
+}
+
+uint16_t Fonts::nextCodepoint(const uint8_t*& p, const uint8_t* end) {
+    uint8_t first = *p++;
+    int continuation = first >= 0xE0 && first < 0xF0 ? 2 : first >= 0xC0 && first < 0xE0 ? 1 : 0;
+    uint16_t codepoint = continuation == 2 ? first & 0x0F : continuation == 1 ? first & 0x1F : first;
+    while (continuation-- > 0 && (!end || p < end) && (*p & 0xC0) == 0x80) {
+        codepoint = (codepoint << 6) | (*p++ & 0x3F);
+    }
+    return codepoint;
+}
+
+size_t Fonts::encodeUtf8(uint16_t codepoint, char* out) {
+    if (codepoint < 0x80) {
+        out[0] = codepoint;
+        return 1;
+    }
+    if (codepoint < 0x800) {
+        out[0] = 0xC0 | (codepoint >> 6);
+        out[1] = 0x80 | (codepoint & 0x3F);
+        return 2;
+    }
+    out[0] = 0xE0 | (codepoint >> 12);
+    out[1] = 0x80 | ((codepoint >> 6) & 0x3F);
+    out[2] = 0x80 | (codepoint & 0x3F);
+    return 3;
+}
@@ -0,0 +1,218 @@
+#include "display/layer_cache.h"
+#include "display/refresh_planner.h"
+#include <esp_log.h>
+#include <Preferences.h>
+#include "build_config.h"
+#include "global_instances.h"
+
+static const char* TAG = "LAYER_CACHE";
+
+static const char* NVS_NAMESPACE = "layers";
+static const int16_t BAND_ROWS = 32; // Rows rasterized at a time; a band of the full width is 3.2 KB
+
+struct CachedLayer {
+    bool valid;
+    uint32_t key;
+    int16_t w;
+    int16_t h;
+    std::vector<uint8_t> runs;
+};
+
+// Prefix of a layer stored in NVS, followed by the runs
+struct StoredLayerHeader {
+    uint32_t key;
+    int16_t w;
+    int16_t h;
+};
+
+static CachedLayer layers[static_cast<size_t>(LayerCache::Layer::COUNT)];
+static Preferences preferences;
+
+DisplayList* LayerCache::suspended = nullptr;
+uint32_t LayerCache::rasterized = 0;
+
+static void nvsKey(LayerCache::Layer layer, char* out) {
+    snprintf(out, 16, "layer%u", static_cast<unsigned>(layer));
+}
+
+// Writes alternating background and foreground runs, starting with background, in the
+// nibble format RecordingDisplay::drawCompressedBitmap() reads
+class RunWriter {
+public:
+    explicit RunWriter(std::vector<uint8_t>& out) : out(out) {}
+
+    void pixel(bool set) {
+        if (set != foreground) {
+            flush();
+            foreground = set;
+        }
+        length++;
+    }
+
+    void finish() {
+        flush(); // The reader stops at the last row, not at the end of the data
+    }
+
+private:
+    static const uint16_t MAX_RUN = 15 + 0xFF;
+
+    void flush() {
+        while (length > MAX_RUN) {
+            put(MAX_RUN);
+            put(0); // Empty run of the other color
+            length -= MAX_RUN;
+        }
+        put(length);
+        length = 0;
+    }
+
+    void put(uint16_t run) {
+        if (run < 15) {
+            nibble(run);
+            return;
+        }
+        nibble(15);
+        nibble((run - 15) >> 4);
+        nibble((run - 15) & 0x0F);
+    }
+
+    void nibble(uint8_t value) {
+        if (low) {
+            out.back() |= value;
+        } else {
+            out.push_back(value << 4);
+        }
+        low = !low;
+    }
+
+    std::vector<uint8_t>& out;
+    uint32_t length = 0;
+    bool foreground = false;
+    bool low = false;
+};
+
+uint32_t LayerCache::keyFor(Layer layer, int16_t w, int16_t h, uint32_t content) {
+    uint16_t version = LAYOUT_VERSION;
+    uint32_t buildTime = BUILD_TIME;
+    return ContentHash()
+        .add(&version, sizeof(version))
+        .add(FIRMWARE_VERSION)
+        .add(&buildTime, sizeof(buildTime))
+        .add(&layer, sizeof(layer))
+        .add(&w, sizeof(w))
+        .add(&h, sizeof(h))
+        .add(&content, sizeof(content))
+        .get();
+}
+
+bool LayerCache::load(Layer layer, uint32_t key) {
+    CachedLayer& cached = layers[static_cast<size_t>(layer)];
+    if (cached.valid && cached.key == key) return true;
+
+    char name[16];
+    nvsKey(layer, name);
+    if (!preferences.begin(NVS_NAMESPACE, true)) return false; // Nothing stored yet
+    size_t len = preferences.getBytesLength(name);
+    bool found = false;
+    if (len >= sizeof(StoredLayerHeader) && len <= sizeof(StoredLayerHeader) + MAX_STORED_BYTES) {
+        std::vector<uint8_t> blob(len);
+        StoredLayerHeader header;
+        if (preferences.getBytes(name, blob.data(), len) == len) {
+            memcpy(&header, blob.data(), sizeof(header));
+            found = header.key == key;
+        }
+        if (found) {
+            cached.valid = true;
+            cached.key = key;
+            cached.w = header.w;
+            cached.h = header.h;
+            cached.runs.assign(blob.begin() + sizeof(header), blob.end());
+            ESP_LOGD(TAG, "Layer %u loaded from NVS (%u bytes)", static_cast<unsigned>(layer),
+                     static_cast<unsigned>(cached.runs.size()));
+        }
+    }
+    preferences.end();
+    return found;
+}
+
+void LayerCache::beginRaster(DisplayList& recording) {
+    // The layer is recorded on its own, so the frame being recorded must not see it
+    suspended = DisplayList::suspend();
+    recording.beginRecording();
+}
+
+void LayerCache::endRaster(DisplayList& recording, Layer layer, uint32_t key, int16_t x, int16_t y, int16_t w,
+                           int16_t h) {
+    recording.endRecording();
+
+    CachedLayer& cached = layers[static_cast<size_t>(layer)];
+    cached.valid = true;
+    cached.key = key;
+    cached.w = w;
+    cached.h = h;
+    cached.runs.clear();
+
+    // Replay the recording into one band of rows at a time and append the band's runs
+    const int16_t bytesPerRow = (w + 7) / 8;
+    std::vector<uint8_t> band(bytesPerRow * BAND_ROWS);
+    RunWriter writer(cached.runs);
+    for (int16_t top = 0; top < h; top += BAND_ROWS) {
+        int16_t rows = h - top < BAND_ROWS ? h - top : BAND_ROWS;
+        display.beginCapture(x, y + top, w, rows, band.data());
+        recording.replay(display, u8g2, y + top, y + top + rows);
+        display.endCapture();
+        for (int16_t row = 0; row < rows; row++) {
+            const uint8_t* bits = &band[row * bytesPerRow];
+            for (int16_t col = 0; col < w; col++) writer.pixel(bits[col / 8] & (0x80 >> (col & 7)));
+        }
+    }
+    writer.finish();
+    cached.runs.shrink_to_fit();
+    rasterized++;
+
+    DisplayList::resume(suspended);
+    suspended = nullptr;
+
+    ESP_LOGI(TAG, "Layer %u rasterized: %dx%d, %u bytes", static_cast<unsigned>(layer), w, h,
+             static_cast<unsigned>(cached.runs.size()));
+    if (cached.runs.size() > MAX_STORED_BYTES) return;
+
+    std::vector<uint8_t> blob(sizeof(StoredLayerHeader) + cached.runs.size());
+    StoredLayerHeader header = {key, w, h};
+    memcpy(blob.data(), &header, sizeof(header));
+    memcpy(blob.data() + sizeof(header), cached.runs.data(), cached.runs.size());
+    char name[16];
+    nvsKey(layer, name);
+    if (preferences.begin(NVS_NAMESPACE, false)) {
+        if (preferences.putBytes(name, blob.data(), blob.size()) != blob.size()) {
+            ESP_LOGW(TAG, "Failed to store layer %u", static_cast<unsigned>(layer));
+        }
+        preferences.end();
+    }
+}
+
+void LayerCache::blit(Layer layer, int16_t x, int16_t y) {
+    const CachedLayer& cached = layers[static_cast<size_t>(layer)];
+    display.drawCompressedBitmap(x, y, cached.runs.data(), cached.w, cached.h, GxEPD_BLACK);
+}
+
+void LayerCache::clear() {
+    for (CachedLayer& cached : layers) {
+        cached.valid = false;
+        cached.runs.clear();
+        cached.runs.shrink_to_fit();
+    }
+}
+
+void LayerCache::erase() {
+    clear();
+    if (preferences.begin(NVS_NAMESPACE, false)) {
+        preferences.clear();
+        preferences.end();
+    }
+}
+
+size_t LayerCache::bytes(Layer layer) {
+    const CachedLayer& cached = layers[static_cast<size_t>(layer)];
+    return cached.valid ? cached.runs.size() : 0;
+}
@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include <esp_log.h>
 #include <qrcode.h>
+#include "display/fonts.h"
 #include "global_instances.h"
 
 static const char* TAG = "QR_HELPER";
@@ -65,7 +66,7 @@ void QRCodeHelper::drawQRLabel(int16_t x, int16_t y, int16_t qrSize, const Strin
     int16_t textY = y + qrSize + offsetY;
 
     // Set font for label
-    u8g2.setFont(u8g2_font_helvB10_tf); // Bold 10pt
+    u8g2.setFont(Fonts::HELVB10); // Bold 10pt
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 
@@ -0,0 +1,58 @@
+#include "display/refresh_planner.h"
+
+static void addWindow(RefreshPlan& plan, int16_t x, int16_t y, int16_t w, int16_t h) {
+    plan.windows[plan.windowCount++] = {x, y, w, h};
+}
+
+static bool panelMatches(const RefreshState& state, ScreenLayout layout) {
+    return state.panelKept && layout != ScreenLayout::NONE && state.layout == layout;
+}
+
+UpdateRegion RefreshPlanner::changedRegion(const RefreshState& state, ScreenLayout layout,
+                                           const FrameContent& content) {
+    if (!panelMatches(state, layout)) return UpdateRegion::BOTH;
+
+    bool weather = content.weather != state.content.weather;
+    bool transport = content.transport != state.content.transport;
+    if (weather && transport) return UpdateRegion::BOTH;
+    if (weather) return UpdateRegion::WEATHER_ONLY;
+    if (transport) return UpdateRegion::DEPARTURE_ONLY;
+    return UpdateRegion::NONE;
+}
+
+RefreshPlan RefreshPlanner::plan(const RefreshState& state, ScreenLayout layout, const FrameContent& content,
+                                 int16_t width, int16_t height, int16_t footerHeight) {
+    RefreshPlan plan = {};
+
+    UpdateRegion changed = changedRegion(state, layout, content);
+    bool footerChanged = content.footer != state.content.footer;
+    if (changed == UpdateRegion::NONE && !footerChanged) return plan;
+
+    if (changed == UpdateRegion::BOTH || state.partialsSinceFull >= FULL_REFRESH_EVERY) {
+        plan.full = true;
+        return plan;
+    }
+
+    // Weather is the left half, transport the right half; the footer with the time sits under the weather
+    int16_t halfWidth = width / 2;
+    if (changed == UpdateRegion::WEATHER_ONLY) {
+        addWindow(plan, 0, 0, halfWidth, height); // Includes the footer
+    } else if (footerChanged) {
+        addWindow(plan, 0, height - footerHeight, halfWidth, footerHeight);
+    }
+    if (changed == UpdateRegion::DEPARTURE_ONLY) {
+        addWindow(plan, halfWidth, 0, width - halfWidth, height);
+    }
+    return plan;
+}
+
+void RefreshPlanner::record(RefreshState& state, ScreenLayout layout, const FrameContent& content,
+                            const RefreshPlan& plan) {
+    state.layout = layout;
+    state.content = content;
+    if (plan.full) {
+        state.partialsSinceFull = 0;
+    } else if (plan.windowCount > 0 && state.partialsSinceFull < UINT8_MAX) {
+        state.partialsSinceFull++;
+    }
+}
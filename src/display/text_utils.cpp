@@ -1,4 +1,5 @@
 #include "display/text_utils.h"
+#include "display/fonts.h"
 #include "global_instances.h"
 
 static const char* TAG = "TEXT_UTILS";
@@ -6,37 +7,37 @@ static const char* TAG = "TEXT_UTILS";
 
 // Font functions with descriptive names including pixel size and margin
 void TextUtils::setFont8px_margin10px() {
-    u8g2.setFont(u8g2_font_helvB08_tf); // 8pt Helvetica Bold - ~8px height, needs 10px margin
+    u8g2.setFont(Fonts::HELVB08); // 8pt Helvetica Bold - ~8px height, needs 10px margin
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 }
 
 void TextUtils::setFont10px_margin12px() {
-    u8g2.setFont(u8g2_font_helvB10_tf); // 10pt Helvetica Bold - ~10px height, needs 12px margin
+    u8g2.setFont(Fonts::HELVB10); // 10pt Helvetica Bold - ~10px height, needs 12px margin
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 }
 
 void TextUtils::setFont12px_margin15px() {
-    u8g2.setFont(u8g2_font_helvB12_tf); // 12pt Helvetica Bold - ~12px height, needs 15px margin
+    u8g2.setFont(Fonts::HELVB12); // 12pt Helvetica Bold - ~12px height, needs 15px margin
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 }
 
 void TextUtils::setFont14px_margin17px() {
-    u8g2.setFont(u8g2_font_helvB14_tf); // 14pt Helvetica Bold - ~14px height, needs 17px margin
+    u8g2.setFont(Fonts::HELVB14); // 14pt Helvetica Bold - ~14px height, needs 17px margin
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 }
 
 void TextUtils::setFont18px_margin22px() {
-    u8g2.setFont(u8g2_font_helvB18_tf); // 18pt Helvetica Bold - ~18px height, needs 22px margin
+    u8g2.setFont(Fonts::HELVB18); // 18pt Helvetica Bold - ~18px height, needs 22px margin
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 }
 
 void TextUtils::setFont24px_margin28px() {
-    u8g2.setFont(u8g2_font_helvB24_tf); // 24pt Helvetica Bold - ~24px height, needs 28px margin
+    u8g2.setFont(Fonts::HELVB24); // 24pt Helvetica Bold - ~24px height, needs 28px margin
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 }
@@ -88,44 +89,123 @@ int16_t TextUtils::getFontAscent() {
     return u8g2.getFontAscent();
 }
 
-int16_t TextUtils::getTextWidth(const String& text) {
-    return u8g2.getUTF8Width(text.c_str());
-}
+// ===== GLYPH WIDTH CACHE =====
 
-String TextUtils::shortenTextToFit(const String& text, int16_t maxWidth) {
-    if (getTextWidth(text) <= maxWidth) {
-        return text; // Text fits as-is
+// Latin-1 covers everything the German texts use; other code points are measured each time
+static const uint16_t FIRST_CACHED_GLYPH = 0x20;
+static const uint16_t CACHED_GLYPHS = 0x100 - FIRST_CACHED_GLYPH;
+static const uint8_t NOT_MEASURED = 0xFF;
+static const uint8_t CACHED_FONTS = 8; // The six helvB sizes plus headroom
+
+struct FontGlyphWidths {
+    const uint8_t* font;
+    uint8_t advance[CACHED_GLYPHS]; // Cursor advance after the glyph
+    uint8_t extent[CACHED_GLYPHS];  // Width the glyph adds when it ends the string
+};
+
+static FontGlyphWidths glyphCache[CACHED_FONTS];
+static uint8_t nextCacheSlot = 0;
+
+static FontGlyphWidths& widthsForFont(const uint8_t* font) {
+    for (FontGlyphWidths& entry : glyphCache) {
+        if (entry.font == font) return entry;
     }
+    FontGlyphWidths& entry = glyphCache[nextCacheSlot];
+    nextCacheSlot = (nextCacheSlot + 1) % CACHED_FONTS;
+    entry.font = font;
+    memset(entry.advance, NOT_MEASURED, sizeof(entry.advance));
+    memset(entry.extent, NOT_MEASURED, sizeof(entry.extent));
+    return entry;
+}
 
-    // Try progressively shorter versions with "..."
-    String ellipsis = "...";
-    int16_t ellipsisWidth = getTextWidth(ellipsis);
+void TextUtils::glyphWidths(uint16_t codepoint, uint8_t& advance, uint8_t& extent) {
+    codepoint = Fonts::printable(codepoint); // What RecordingU8g2 will actually draw
+    FontGlyphWidths* entry = nullptr;
+    if (codepoint >= FIRST_CACHED_GLYPH && codepoint < FIRST_CACHED_GLYPH + CACHED_GLYPHS) {
+        entry = &widthsForFont(u8g2.getFont());
+        uint8_t index = codepoint - FIRST_CACHED_GLYPH;
+        if (entry->advance[index] != NOT_MEASURED) {
+            advance = entry->advance[index];
+            extent = entry->extent[index];
+            return;
+        }
+    }
 
-    if (maxWidth <= ellipsisWidth) {
-        return ""; // Not enough space even for ellipsis
+    // Measuring the glyph alone and doubled gives both values, whether or not
+    // U8g2 trims the last glyph of a string to its bounding box
+    char glyph[7];
+    size_t len = Fonts::encodeUtf8(codepoint, glyph);
+    glyph[len] = '\0';
+    int16_t single = u8g2.getUTF8Width(glyph);
+    memcpy(glyph + len, glyph, len);
+    glyph[len * 2] = '\0';
+    int16_t doubled = u8g2.getUTF8Width(glyph);
+    advance = constrain(doubled - single, 0, NOT_MEASURED - 1);
+    extent = constrain(single, 0, NOT_MEASURED - 1);
+
+    if (entry) {
+        uint8_t index = codepoint - FIRST_CACHED_GLYPH;
+        entry->advance[index] = advance;
+        entry->extent[index] = extent;
     }
+}
 
-    int16_t availableWidth = maxWidth - ellipsisWidth;
+// ===== MEASUREMENT AND FITTING =====
 
-    // Binary search for the longest fitting substring
-    int left = 0;
-    int right = text.length();
-    int bestLength = 0;
+int16_t TextUtils::getTextWidth(const String& text) {
+    return getTextWidth(text.c_str());
+}
 
-    while (left <= right) {
-        int mid = (left + right) / 2;
-        String testText = text.substring(0, mid);
+int16_t TextUtils::getTextWidth(const char* text) {
+    int16_t width = 0;
+    uint8_t advance = 0;
+    uint8_t extent = 0;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(text);
+    while (*p) {
+        glyphWidths(Fonts::nextCodepoint(p, nullptr), advance, extent);
+        width += advance;
+    }
+    return width - advance + extent;
+}
 
-        if (getTextWidth(testText) <= availableWidth) {
-            bestLength = mid;
-            left = mid + 1;
-        } else {
-            right = mid - 1;
-        }
+String TextUtils::shortenTextToFit(const String& text, int16_t maxWidth) {
+    if (getTextWidth(text) <= maxWidth) {
+        return text; // Text fits as-is
     }
-    if (bestLength == 0) {
-        return ellipsis;
+    return shortenTextToFit(text.c_str(), maxWidth);
+}
+
+String TextUtils::shortenTextToFit(const char* text, int16_t maxWidth) {
+    static const char ELLIPSIS[] = "...";
+    int16_t availableWidth = maxWidth - getTextWidth(ELLIPSIS);
+
+    // One pass over the prefix widths: remember the longest prefix that leaves room
+    // for the ellipsis, and whether the whole text fits without one.
+    // Prefixes always end on a character boundary, never inside a UTF-8 sequence.
+    const uint8_t* start = reinterpret_cast<const uint8_t*>(text);
+    const uint8_t* cursor = start;
+    size_t bestLength = 0;
+    int16_t prefixAdvance = 0;
+    int16_t width = 0;
+    while (*cursor) {
+        uint8_t advance;
+        uint8_t extent;
+        glyphWidths(Fonts::nextCodepoint(cursor, nullptr), advance, extent);
+        width = prefixAdvance + extent; // Width of the text up to and including this glyph
+        prefixAdvance += advance;
+        if (width <= availableWidth) bestLength = cursor - start;
+    }
+    if (width <= maxWidth) {
+        return String(text); // Text fits as-is
+    }
+
+    if (availableWidth <= 0) {
+        return ""; // Not enough space even for ellipsis
     }
 
-    return text.substring(0, bestLength) + ellipsis;
+    String shortened;
+    shortened.reserve(bestLength + sizeof(ELLIPSIS) - 1);
+    shortened.concat(text, bestLength);
+    shortened += ELLIPSIS;
+    return shortened;
 }
@@ -1,12 +1,13 @@
 #include "display/transport_display.h"
 #include "display/text_utils.h"
+#include "display/layer_cache.h"
 #include "util/util.h"
 #include "util/time_manager.h"
 #include "util/battery_manager.h"
 #include "display/common_footer.h"
 #include <esp_log.h>
 #include <vector>
-#include <icons.h>
+#include <icons_compressed.h>
 #include <WiFi.h>
 
 #include "config/config_manager.h"
@@ -92,15 +93,16 @@ void TransportDisplay::drawHalfScreenTransports(const DepartureData& departures,
 void TransportDisplay::drawTransportList(std::vector<const DepartureInfo*> departure, int16_t x, int16_t y, int16_t w,
                                          int16_t h, bool printLabel, int maxPerDirection) {
     if (printLabel) {
-        // Column headers with TRUE 12px margin from current position
-        TextUtils::setFont10px_margin12px(); // Small font for column headers
-        TextUtils::printTextAtTopMargin(x, y, "Soll    Ist      Linie     Ziel");
-
-        y += COLUMN_HEADER_HEIGHT;
-        y += COLUMN_HEADER_SPACING;
-
-        // Underline
-        display.drawLine(x, y, x + w, y, GxEPD_BLACK);
+        const int16_t underlineY = y + COLUMN_HEADER_HEIGHT + COLUMN_HEADER_SPACING;
+        LayerCache::draw(LayerCache::Layer::TRANSPORT_HEADER, x, y, w + 1, underlineY - y + 1, 0, [=] {
+            // Column headers with TRUE 12px margin from current position
+            TextUtils::setFont10px_margin12px(); // Small font for column headers
+            TextUtils::printTextAtTopMargin(x, y, "Soll    Ist      Linie     Ziel");
+
+            // Underline
+            display.drawLine(x, underlineY, x + w, underlineY, GxEPD_BLACK);
+        });
+        y = underlineY;
     }
 
     // Check if there are no departures
@@ -126,10 +128,9 @@ void TransportDisplay::drawTransportList(std::vector<const DepartureInfo*> depar
 void TransportDisplay::getSeparatedTransportDirection(const DepartureData& departures,
                                                       std::vector<const DepartureInfo*>& direction1Departures,
                                                       std::vector<const DepartureInfo*>& direction2Departures) {
-    auto getDirectionNumber = [](const String& flag) -> int {
-        if (flag == "1" || flag.toInt() == 1) return 1;
-        if (flag == "2" || flag.toInt() == 2) return 2;
-        return 0;
+    auto getDirectionNumber = [](const PooledString& flag) -> int {
+        int direction = atoi(flag.c_str());
+        return (direction == 1 || direction == 2) ? direction : 0;
     };
 
     for (int i = 0; i < departures.departureCount; i++) {
@@ -179,7 +180,7 @@ void TransportDisplay::drawFullScreenTransportSection(const DepartureData& depar
         if (batteryLevel > 0) {
             iconX -= iconWidth;
             icon_name batteryIcon = CommonFooter::getBatteryIcon();
-            display.drawInvertedBitmap(iconX, currentY, getBitmap(batteryIcon, 24), 24, 24, GxEPD_BLACK);
+            display.drawCompressedBitmap(iconX, currentY, getCompressedBitmap(batteryIcon, 24), 24, 24, GxEPD_BLACK);
             iconX -= iconSpacing;
         }
     }
@@ -187,12 +188,12 @@ void TransportDisplay::drawFullScreenTransportSection(const DepartureData& depar
     // WiFi icon
     iconX -= iconWidth;
     icon_name wifiIcon = CommonFooter::getWiFiIcon();
-    display.drawInvertedBitmap(iconX, currentY, getBitmap(wifiIcon, 24), 24, 24, GxEPD_BLACK);
+    display.drawCompressedBitmap(iconX, currentY, getCompressedBitmap(wifiIcon, 24), 24, 24, GxEPD_BLACK);
     iconX -= iconSpacing;
 
     // Refresh icon
     iconX -= iconWidth;
-    display.drawInvertedBitmap(iconX, currentY, getBitmap(refresh, 24), 24, 24, GxEPD_BLACK);
+    display.drawCompressedBitmap(iconX, currentY, getCompressedBitmap(refresh, 24), 24, 24, GxEPD_BLACK);
 
     // Time (left of all icons)
     iconX -= (iconSpacing + dateTimeWidth);
@@ -231,22 +232,23 @@ void TransportDisplay::drawSingleTransport(const DepartureInfo& dep, int16_t x,
     int totalWidth = width - x;
 
     // Check if times are different for highlighting
-    bool timesAreDifferent = (dep.rtTime.length() > 0 && dep.rtTime != dep.time);
+    bool timesAreDifferent = (!dep.rtTime.isEmpty() && dep.rtTime != dep.time);
 
     // Clean up destination (remove "Frankfurt (Main)" prefix)
     const String stopName = ConfigManager::getStopNameFromId();
-    String dest = Util::shortenDestination(stopName, dep.direction);
+    String dest = Util::shortenDestination(stopName, dep.direction.c_str());
 
     // Prepare times
-    String sollTime = dep.time.substring(0, 5);
+    char sollTime[6];
+    snprintf(sollTime, sizeof(sollTime), "%.5s", dep.time.c_str());
     String istTime = "";
 
     if (!timesAreDifferent) {
         istTime = "  +00"; // Use "00" to indicate on-time
-    } else if (dep.rtTime.length() > 0) {
-        // Calculate minute difference between scheduled and real-time
-        int scheduledMinutes = dep.time.substring(3, 5).toInt() + dep.time.substring(0, 2).toInt() * 60;
-        int realTimeMinutes = dep.rtTime.substring(3, 5).toInt() + dep.rtTime.substring(0, 2).toInt() * 60;
+    } else {
+        // Calculate minute difference between scheduled and real-time ("HH:MM:SS")
+        int scheduledMinutes = atoi(dep.time.c_str()) * 60 + atoi(dep.time.c_str() + 3);
+        int realTimeMinutes = atoi(dep.rtTime.c_str()) * 60 + atoi(dep.rtTime.c_str() + 3);
         int diffMinutes = realTimeMinutes - scheduledMinutes;
 
         if (diffMinutes > 0) {
@@ -262,9 +264,9 @@ void TransportDisplay::drawSingleTransport(const DepartureInfo& dep, int16_t x,
 
     // Print times with strikethrough if cancelled
     if (dep.cancelled) {
-        TextUtils::printStrikethroughTextAtTopMargin(currentX, currentY, sollTime.c_str());
+        TextUtils::printStrikethroughTextAtTopMargin(currentX, currentY, sollTime);
     } else {
-        TextUtils::printTextAtTopMargin(currentX, currentY, sollTime.c_str());
+        TextUtils::printTextAtTopMargin(currentX, currentY, sollTime);
     }
 
     currentX += COLUMN_PADDING + timeWidth;
@@ -293,9 +295,8 @@ void TransportDisplay::drawSingleTransport(const DepartureInfo& dep, int16_t x,
     // Check if we have disruption information to display
     if (dep.cancelled) {
         TextUtils::printTextAtTopMargin(x + INFO_INDENT, currentY, "Fällt aus");
-    } else if (dep.lead.length() > 0 || dep.text.length() > 0) {
-        // Use the lead text if available, otherwise use text
-        String disruptionInfo = dep.lead.length() > 0 ? dep.lead : dep.text;
+    } else if (!dep.text.isEmpty()) {
+        String disruptionInfo = dep.text.c_str();
 
         // Fit disruption text to available width
         int disruptionMaxWidth = width - INFO_INDENT;
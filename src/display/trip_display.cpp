@@ -180,7 +180,8 @@ int16_t TripDisplay::drawSingleConnection(const TripConnection& conn, int16_t x,
             depHour = atoi(conn.legs[0].rtDepartureTime);
             depMin = atoi(conn.legs[0].rtDepartureTime + 3);
         }
-        struct tm* nowTm = localtime((time_t*)&currentTime);
+        time_t nowTime = currentTime; // time_t is 64 bits on the host (and from IDF 5)
+        struct tm* nowTm = localtime(&nowTime);
         int nowMinutes = nowTm->tm_hour * 60 + nowTm->tm_min;
         int depMinutes = depHour * 60 + depMin;
         int minutesUntil = depMinutes - nowMinutes;
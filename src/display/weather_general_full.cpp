@@ -2,7 +2,7 @@
 #include "display/text_utils.h"
 #include "display/weather_graph.h"
 #include <esp_log.h>
-#include <icons.h>
+#include <icons_compressed.h>
 
 #include "config/config_manager.h"
 #include "util/weather_util.h"
@@ -70,8 +70,8 @@ void WeatherFullDisplay::drawFullScreenWeatherLayout(const WeatherInfo& weather)
     // Current Weather Icon
     // Get weather icon from weather code using the new utility function
     icon_name currentWeatherIcon = WeatherUtil::getWeatherIcon(weather.weatherCode);
-    display.drawInvertedBitmap(leftMargin, colY, getBitmap(currentWeatherIcon, LARGE_ICON), LARGE_ICON, LARGE_ICON,
-                               GxEPD_BLACK);
+    display.drawCompressedBitmap(leftMargin, colY, getCompressedBitmap(currentWeatherIcon, LARGE_ICON), LARGE_ICON,
+                                 LARGE_ICON, GxEPD_BLACK);
     // Current Weather Temperature
     TextUtils::setFont14px_margin17px();
     TextUtils::printTextAtWithMargin(leftMargin, colY + TEMP_TEXT_Y, String(weather.temperature, 1) + "°C");
@@ -102,8 +102,8 @@ void WeatherFullDisplay::drawFullScreenWeatherLayout(const WeatherInfo& weather)
     int16_t thirdColumn = 195;
 
     // Sunrise Sunset
-    display.drawInvertedBitmap(firstColumn, currentY, getBitmap(wi_sunrise, LARGE_ICON), LARGE_ICON, LARGE_ICON,
-                               GxEPD_BLACK);
+    display.drawCompressedBitmap(firstColumn, currentY, getCompressedBitmap(wi_sunrise, LARGE_ICON), LARGE_ICON,
+                                 LARGE_ICON, GxEPD_BLACK);
     TextUtils::printTextAtWithMargin(secondColumn, currentY + TEXT_Y_TITLE, "Sonnenauf / untergang");
     TextUtils::printTextAtWithMargin(secondColumn, currentY + TEXT_Y_VALUE, weather.dailyForecast[0].sunrise);
     TextUtils::printTextAtWithMargin(thirdColumn, currentY + TEXT_Y_VALUE, weather.dailyForecast[0].sunset);
@@ -111,8 +111,8 @@ void WeatherFullDisplay::drawFullScreenWeatherLayout(const WeatherInfo& weather)
 
     // Use Util::sunshineSecondsToHHMM for sunshine duration
     // Sun-shine UN-Index
-    display.drawInvertedBitmap(firstColumn, currentY, getBitmap(wi_0_day_sunny, LARGE_ICON), LARGE_ICON, LARGE_ICON,
-                               GxEPD_BLACK);
+    display.drawCompressedBitmap(firstColumn, currentY, getCompressedBitmap(wi_0_day_sunny, LARGE_ICON), LARGE_ICON,
+                                 LARGE_ICON, GxEPD_BLACK);
     String sunshineText = WeatherUtil::sunshineSecondsToHHMM(weather.dailyForecast[0].sunshineDuration);
     // Use Util::uvIndexToGrade for UV Index
     TextUtils::printTextAtWithMargin(secondColumn, currentY + TEXT_Y_TITLE, "Sonnenstd.");
@@ -125,8 +125,8 @@ void WeatherFullDisplay::drawFullScreenWeatherLayout(const WeatherInfo& weather)
     currentY += WEATHER_ROW_HEIGHT; // Move down after first row of weather info
 
     // precipitation mm, precipitation hours
-    display.drawInvertedBitmap(firstColumn, currentY, getBitmap(wi_61_rain, LARGE_ICON), LARGE_ICON, LARGE_ICON,
-                               GxEPD_BLACK);
+    display.drawCompressedBitmap(firstColumn, currentY, getCompressedBitmap(wi_61_rain, LARGE_ICON), LARGE_ICON,
+                                 LARGE_ICON, GxEPD_BLACK);
     TextUtils::printTextAtWithMargin(secondColumn, currentY + TEXT_Y_TITLE, "Niederschlag");
     TextUtils::printTextAtWithMargin(secondColumn, currentY + TEXT_Y_VALUE,
                                      String(weather.dailyForecast[0].precipitationSum, 1) + " mm");
@@ -136,8 +136,8 @@ void WeatherFullDisplay::drawFullScreenWeatherLayout(const WeatherInfo& weather)
     currentY += WEATHER_ROW_HEIGHT; // Move down after first row of weather info
 
     // Wind speed m/s, Wind Gust m/s, Wind Direction
-    display.drawInvertedBitmap(firstColumn, currentY, getBitmap(wi_strong_wind, LARGE_ICON), LARGE_ICON, LARGE_ICON,
-                               GxEPD_BLACK);
+    display.drawCompressedBitmap(firstColumn, currentY, getCompressedBitmap(wi_strong_wind, LARGE_ICON), LARGE_ICON,
+                                 LARGE_ICON, GxEPD_BLACK);
     String windDirectionText = WeatherUtil::degreeToCompass(weather.dailyForecast[0].windDirection);
     String windText = String(weather.dailyForecast[0].windSpeedMax, 1) + " m/s (Böe " + String(
         weather.dailyForecast[0].windGustsMax, 1) + " m/s )";
@@ -170,9 +170,8 @@ void WeatherFullDisplay::drawFullScreenWeatherLayout(const WeatherInfo& weather)
 
         // Draw WMO weather icon for each day using Util::getWeatherIcon
         icon_name icon = WeatherUtil::getWeatherIcon(weather.dailyForecast[i].weatherCode);
-        display.drawInvertedBitmap(screenTenthWidth * (i + 3), currentY + 15, getBitmap(icon, LARGE_ICON), LARGE_ICON,
-                                   LARGE_ICON,
-                                   GxEPD_BLACK);
+        display.drawCompressedBitmap(screenTenthWidth * (i + 3), currentY + 15, getCompressedBitmap(icon, LARGE_ICON),
+                                     LARGE_ICON, LARGE_ICON, GxEPD_BLACK);
 
         // Show low | high temp without floating point
         int tempMinInt = (int)weather.dailyForecast[i].tempMin;
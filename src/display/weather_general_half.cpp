@@ -2,7 +2,7 @@
 #include "display/text_utils.h"
 #include "display/weather_graph.h"
 #include <esp_log.h>
-#include <icons.h>
+#include <icons_compressed.h>
 #include "config/config_manager.h"
 #include "util/weather_util.h"
 #include "display/common_footer.h"
@@ -96,8 +96,9 @@ void WeatherHalfDisplay::drawWeatherInfoFirstColumn(int16_t leftMargin, int16_t
     // Draw first Column - Current Temperature and Condition
     // Draw weather icon using Util::getWeatherIcon
     icon_name currentWeatherIcon = WeatherUtil::getWeatherIcon(weather.weatherCode);
-    display.drawInvertedBitmap(leftMargin, dayWeatherInfoY, getBitmap(currentWeatherIcon, WEATHER_ICON_SIZE),
-                               WEATHER_ICON_SIZE, WEATHER_ICON_SIZE, GxEPD_BLACK);
+    display.drawCompressedBitmap(leftMargin, dayWeatherInfoY,
+                                 getCompressedBitmap(currentWeatherIcon, WEATHER_ICON_SIZE), WEATHER_ICON_SIZE,
+                                 WEATHER_ICON_SIZE, GxEPD_BLACK);
     // Current temperature: 30px
     String tempText = String(weather.temperature, 1) + "°C  ";
     TextUtils::printTextAtWithMargin(leftMargin, dayWeatherInfoY + 47, tempText);
@@ -132,14 +133,22 @@ void WeatherHalfDisplay::drawWeatherInfoThirdColumn(int16_t currentX, int16_t da
     currentX += padding; // Add padding to the left
     TextUtils::setFont10px_margin12px(); // Small font for weather info
 
-    display.drawInvertedBitmap(currentX, dayWeatherInfoY + 15, getBitmap(wi_sunrise, 32), 32, 32, GxEPD_BLACK);
+    display.drawCompressedBitmap(currentX, dayWeatherInfoY + 15, getCompressedBitmap(wi_sunrise, 32), 32, 32,
+                                 GxEPD_BLACK);
     TextUtils::printTextAtWithMargin(currentX + 40, dayWeatherInfoY + 27, weather.dailyForecast[0].sunrise);
 
-    display.drawInvertedBitmap(currentX, dayWeatherInfoY + 35, getBitmap(wi_sunset, 32), 32, 32, GxEPD_BLACK);
+    display.drawCompressedBitmap(currentX, dayWeatherInfoY + 35, getCompressedBitmap(wi_sunset, 32), 32, 32,
+                                 GxEPD_BLACK);
     TextUtils::printTextAtWithMargin(currentX + 40, dayWeatherInfoY + 47, weather.dailyForecast[0].sunset);
 }
 
+static const uint8_t WEATHER_FOOTER_ELEMENTS = FOOTER_TIME | FOOTER_REFRESH | FOOTER_WIFI | FOOTER_BATTERY;
+
 void WeatherHalfDisplay::drawWeatherFooter(int16_t x, int16_t y, int16_t h) {
     // Use common footer with time and refresh icon
-    CommonFooter::drawFooter(x, y, h, FOOTER_TIME | FOOTER_REFRESH | FOOTER_WIFI | FOOTER_BATTERY);
+    CommonFooter::drawFooter(x, y, h, WEATHER_FOOTER_ELEMENTS);
+}
+
+uint32_t WeatherHalfDisplay::footerFingerprint() {
+    return CommonFooter::fingerprint(WEATHER_FOOTER_ELEMENTS);
 }
@@ -1,11 +1,26 @@
 #include "display/weather_graph.h"
 #include "display/text_utils.h"
+#include "display/layer_cache.h"
 #include <esp_log.h>
 #include <math.h>
 #include "global_instances.h"
 
 static const char* TAG = "WEATHER_GRAPH";
 
+// min() takes its arguments by reference, which needs the constants defined (unoptimized native builds)
+const int WeatherGraph::HOURS_TO_SHOW;
+const int WeatherGraph::HOURS_TO_SHOW_BAR;
+
+// Fill patterns, bit 31 is the first pixel of a row
+static const Stipple GRID_DOTS_H = {{0x80000000}, 1, 6};                // One pixel every 6
+static const Stipple GRID_DOTS_V = {{0x80000000, 0, 0, 0, 0, 0}, 6, 1}; // One pixel every 6 rows
+static const Stipple HUMIDITY_DASHES = {{0xE0000000}, 1, 7};            // 3 on, 4 off
+static const Stipple LEGEND_DASHES = {{0xE0000000}, 1, 9};              // 3 on, 6 off
+// Crosshatch: every 2nd pixel on hatch rows (every 4th row in bars, every 3rd in the
+// legend), every 4th pixel on the other even rows
+static const Stipple RAIN_HATCH = {{0xA0000000, 0, 0x80000000, 0}, 4, 4};
+static const Stipple LEGEND_HATCH = {{0xA0000000, 0, 0x80000000, 0xA0000000, 0x80000000, 0}, 6, 4};
+
 void WeatherGraph::drawTemperatureAndRainGraph(const WeatherInfo& weather,
                                                int16_t x, int16_t y,
                                                int16_t w, int16_t h) {
@@ -45,19 +60,30 @@ void WeatherGraph::drawTemperatureAndRainGraph(const WeatherInfo& weather,
     ESP_LOGI(TAG, "Temperature range: actual %.1f-%.1f°C, dynamic %.1f-%.1f°C",
              actualMin, actualMax, dynamicMin, dynamicMax);
 
-    // Draw graph components
+    // Draw graph components. The rain axis and the legend only depend on the geometry, they
+    // are drawn from the layer cache
+    int16_t rainAxisX = x + w - marginRight;
+    int16_t legendY = y + h - marginLegend;
     drawGraphFrame(graphX, graphY, graphW, graphH);
+    LayerCache::draw(LayerCache::Layer::RAIN_AXIS, rainAxisX, y, marginRight, legendY - y, graphY - y, [=] {
+        drawRainAxis(rainAxisX, graphY, marginRight, graphH);
+    });
     drawTemperatureAxis(x, graphY, marginLeft, graphH, dynamicMin, dynamicMax);
-    drawRainAxis(x + w - marginRight, graphY, marginRight, graphH);
     drawTimeAxis(graphX, y + h - marginBottom - marginLegend, graphW, marginBottom, weather);
-    // <-- Add weather parameter
-    drawGraphLegend(x, y + h - marginLegend, w, marginLegend);
+    LayerCache::draw(LayerCache::Layer::GRAPH_LEGEND, x, legendY, w, marginLegend, 0, [=] {
+        drawGraphLegend(x, legendY, w, marginLegend);
+    });
+
+    // Curves are computed once per frame, drawing them only walks the samples
+    Spline::Polyline humidityCurve;
+    Spline::Polyline temperatureCurve;
+    buildHumidityCurve(weather, graphX, graphY, graphW, graphH, humidityCurve);
+    buildTemperatureCurve(weather, graphX, graphY, graphW, graphH, dynamicMin, dynamicMax, temperatureCurve);
 
     // Draw data layers (order matters for visibility)
     drawRainBars(weather, graphX, graphY, graphW, graphH); // Background: Rain bars
-    drawHumidityLine(weather, graphX, graphY, graphW, graphH); // Middle: Humidity dotted line
-    drawTemperatureLine(weather, graphX, graphY, graphW, graphH, dynamicMin, dynamicMax);
-    // Foreground: Temperature solid line
+    drawHumidityLine(humidityCurve); // Middle: Humidity dotted line
+    drawTemperatureLine(temperatureCurve); // Foreground: Temperature solid line
 
     ESP_LOGI(TAG, "Weather graph completed with %d data points", dataPoints);
 }
@@ -84,9 +110,7 @@ void WeatherGraph::drawGraphLegend(int16_t x, int16_t y, int16_t w, int16_t h) {
     u8g2.setCursor(legendX + lineLen + 8, legendY + 10);
     u8g2.print("Luftfeuchte");
     // Draw dotted line
-    for (int i = 0; i < lineLen; ++i) {
-        if ((i / 3) % 3 == 0) display.drawPixel(legendX + i, legendY + 6, GxEPD_BLACK);
-    }
+    display.fillStipple(legendX, legendY + 6, lineLen, 1, LEGEND_DASHES, GxEPD_BLACK);
 
     // 3. Rain (crosshatch bar)
     legendX += spacingX;
@@ -95,18 +119,7 @@ void WeatherGraph::drawGraphLegend(int16_t x, int16_t y, int16_t w, int16_t h) {
     // Draw crosshatch bar
     int16_t barTop = legendY + 2;
     int16_t barHeight = min(8, h - 4); // fit in legend area
-    // Horizontal lines
-    for (int yb = barTop; yb < barTop + barHeight; yb += 3) {
-        for (int xb = legendX; xb < legendX + lineLen; xb += 2) {
-            display.drawPixel(xb, yb, GxEPD_BLACK);
-        }
-    }
-    // Vertical lines
-    for (int xb = legendX; xb < legendX + lineLen; xb += 4) {
-        for (int yb = barTop; yb < barTop + barHeight; yb += 2) {
-            display.drawPixel(xb, yb, GxEPD_BLACK);
-        }
-    }
+    display.fillStipple(legendX, barTop, lineLen, barHeight, LEGEND_HATCH, GxEPD_BLACK);
 }
 
 void WeatherGraph::drawGraphFrame(int16_t x, int16_t y, int16_t w, int16_t h) {
@@ -117,18 +130,14 @@ void WeatherGraph::drawGraphFrame(int16_t x, int16_t y, int16_t w, int16_t h) {
     for (int i = 1; i < 4; i++) {
         int16_t gridY = y + (h * i) / 4;
         // Dotted line for grid
-        for (int16_t dotX = x + 5; dotX < x + w - 5; dotX += 6) {
-            display.drawPixel(dotX, gridY, GxEPD_BLACK);
-        }
+        display.fillStipple(x + 5, gridY, w - 10, 1, GRID_DOTS_H, GxEPD_BLACK);
     }
 
     // Draw vertical grid lines (every 3 hours)
     for (int i = 1; i < 4; i++) {
         int16_t gridX = x + (w * i) / 4;
         // Dotted line for grid
-        for (int16_t dotY = y + 5; dotY < y + h - 5; dotY += 6) {
-            display.drawPixel(gridX, dotY, GxEPD_BLACK);
-        }
+        display.fillStipple(gridX, y + 5, 1, h - 10, GRID_DOTS_V, GxEPD_BLACK);
     }
 }
 
@@ -221,75 +230,28 @@ void WeatherGraph::drawTimeAxis(int16_t x, int16_t y, int16_t w, int16_t h, cons
     }
 }
 
-void WeatherGraph::drawTemperatureLine(const WeatherInfo& weather,
-                                       int16_t graphX, int16_t graphY,
-                                       int16_t graphW, int16_t graphH,
-                                       float minTemp, float maxTemp) {
-    // Get the number of data points to draw (limited to HOURS_TO_SHOW = 12)
+void WeatherGraph::buildTemperatureCurve(const WeatherInfo& weather,
+                                         int16_t graphX, int16_t graphY,
+                                         int16_t graphW, int16_t graphH,
+                                         float minTemp, float maxTemp, Spline::Polyline& curve) {
+    // Get the number of data points to draw (limited to HOURS_TO_SHOW = 13)
     int dataPoints = min(HOURS_TO_SHOW, weather.hourlyForecastCount);
 
-    // Need at least 2 points to draw a line
-    if (dataPoints < 2) return;
-
-    // === STEP 1: Draw smooth temperature curve through all points ===
-    // Create arrays to store all temperature points for smooth curve calculation
     int16_t tempX[HOURS_TO_SHOW];
     int16_t tempY[HOURS_TO_SHOW];
-
-    // Calculate all point positions first
     for (int i = 0; i < dataPoints; i++) {
         float temp = weather.hourlyForecast[i].temperature;
         tempX[i] = mapToPixel(i, 0, HOURS_TO_SHOW - 1, graphX, graphX + graphW);
         tempY[i] = mapToPixel(temp, minTemp, maxTemp, graphY + graphH, graphY);
     }
 
-    // Draw smooth curve using Catmull-Rom spline interpolation
-    // This creates smooth curves that pass through all data points
-    for (int i = 0; i < dataPoints - 1; i++) {
-        // Get control points for smooth curve calculation
-        // Use previous and next points to calculate smooth tangents
-        int16_t p0x = (i > 0) ? tempX[i - 1] : tempX[i];
-        int16_t p0y = (i > 0) ? tempY[i - 1] : tempY[i];
-        int16_t p1x = tempX[i];
-        int16_t p1y = tempY[i];
-        int16_t p2x = tempX[i + 1];
-        int16_t p2y = tempY[i + 1];
-        int16_t p3x = (i < dataPoints - 2) ? tempX[i + 2] : tempX[i + 1];
-        int16_t p3y = (i < dataPoints - 2) ? tempY[i + 2] : tempY[i + 1];
-
-        // Draw smooth curve between p1 and p2 using many small segments
-        int smoothSteps = 8; // Smooth curve (8 steps sufficient for 1-bit e-paper)
-
-        for (int step = 0; step < smoothSteps; step++) {
-            // Calculate interpolation parameter (0.0 to 1.0)
-            float t1 = (float)step / smoothSteps;
-            float t2 = (float)(step + 1) / smoothSteps;
-
-            // Catmull-Rom spline calculation for smooth curves
-            // This creates smooth curves that pass exactly through data points
-            auto catmullRom = [](float t, int16_t p0, int16_t p1, int16_t p2, int16_t p3) -> int16_t {
-                float t2 = t * t;
-                float t3 = t2 * t;
-
-                float result = 0.5f * (
-                    (2.0f * p1) +
-                    (-p0 + p2) * t +
-                    (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 +
-                    (-p0 + 3.0f * p1 - 3.0f * p2 + p3) * t3
-                );
-
-                return (int16_t)result;
-            };
-
-            // Calculate smooth curve points
-            int16_t curve_x1 = catmullRom(t1, p0x, p1x, p2x, p3x);
-            int16_t curve_y1 = catmullRom(t1, p0y, p1y, p2y, p3y);
-            int16_t curve_x2 = catmullRom(t2, p0x, p1x, p2x, p3x);
-            int16_t curve_y2 = catmullRom(t2, p0y, p1y, p2y, p3y);
-
-            // Draw the smooth curve segment
-            display.drawLine(curve_x1, curve_y1, curve_x2, curve_y2, GxEPD_BLACK);
-        }
+    // Smooth curve through all points (8 steps per hour are sufficient for 1-bit e-paper)
+    Spline::catmullRom(tempX, tempY, dataPoints, TEMPERATURE_CURVE_STEPS, curve);
+}
+
+void WeatherGraph::drawTemperatureLine(const Spline::Polyline& curve) {
+    for (uint8_t i = 1; i < curve.count; i++) {
+        display.drawLine(curve.x[i - 1], curve.y[i - 1], curve.x[i], curve.y[i], GxEPD_BLACK);
     }
 }
 
@@ -309,19 +271,7 @@ void WeatherGraph::drawRainBars(const WeatherInfo& weather,
             int16_t barY = graphY + graphH - barH;
 
             // Crosshatch pattern for rain bars
-            for (int16_t y = barY; y < barY + barH; y += 4) {
-                // Horizontal lines
-                for (int16_t x = barX + 1; x < barX + barWidth - 1; x += 2) {
-                    display.drawPixel(x, y, GxEPD_BLACK);
-                }
-            }
-
-            for (int16_t x = barX + 1; x < barX + barWidth - 1; x += 4) {
-                // Vertical lines
-                for (int16_t y = barY; y < barY + barH; y += 2) {
-                    display.drawPixel(x, y, GxEPD_BLACK);
-                }
-            }
+            display.fillStipple(barX + 1, barY, barWidth - 2, barH, RAIN_HATCH, GxEPD_BLACK);
 
             // Add outline for clear definition (without bottom line)
             // display.drawLine(barX, barY, barX, barY + barH - 1, GxEPD_BLACK);                    // Left side
@@ -331,27 +281,18 @@ void WeatherGraph::drawRainBars(const WeatherInfo& weather,
     }
 }
 
-void WeatherGraph::drawHumidityLine(const WeatherInfo& weather,
-                                    int16_t graphX, int16_t graphY,
-                                    int16_t graphW, int16_t graphH) {
-    // Get the number of data points to draw (limited to HOURS_TO_SHOW = 12)
+void WeatherGraph::buildHumidityCurve(const WeatherInfo& weather,
+                                      int16_t graphX, int16_t graphY,
+                                      int16_t graphW, int16_t graphH, Spline::Polyline& curve) {
+    // Get the number of data points to draw (limited to HOURS_TO_SHOW = 13)
     int dataPoints = min(HOURS_TO_SHOW, weather.hourlyForecastCount);
 
-    // Need at least 2 points to draw a line
-    if (dataPoints < 2) return;
-
-    ESP_LOGI(TAG, "Drawing humidity line with %d data points", dataPoints);
-
     // Humidity range is always 0-100%
     float minHumidity = 0.0f;
     float maxHumidity = 100.0f;
 
-    // === STEP 1: Draw smooth humidity curve through all points ===
-    // Create arrays to store all humidity points for smooth curve calculation
     int16_t humidityX[HOURS_TO_SHOW];
     int16_t humidityY[HOURS_TO_SHOW];
-
-    // Calculate all point positions first
     for (int i = 0; i < dataPoints; i++) {
         float humidity = weather.hourlyForecast[i].humidity;
         humidityX[i] = mapToPixel(i, 0, HOURS_TO_SHOW - 1, graphX, graphX + graphW);
@@ -360,53 +301,15 @@ void WeatherGraph::drawHumidityLine(const WeatherInfo& weather,
         ESP_LOGD(TAG, "Humidity %d: %.1f%% at pixel (%d, %d)", i, humidity, humidityX[i], humidityY[i]);
     }
 
-    // Draw smooth dotted curve using Catmull-Rom spline interpolation
-    // This creates smooth curves that pass through all data points
-    for (int i = 0; i < dataPoints - 1; i++) {
-        // Get control points for smooth curve calculation
-        // Use previous and next points to calculate smooth tangents
-        int16_t p0x = (i > 0) ? humidityX[i - 1] : humidityX[i];
-        int16_t p0y = (i > 0) ? humidityY[i - 1] : humidityY[i];
-        int16_t p1x = humidityX[i];
-        int16_t p1y = humidityY[i];
-        int16_t p2x = humidityX[i + 1];
-        int16_t p2y = humidityY[i + 1];
-        int16_t p3x = (i < dataPoints - 2) ? humidityX[i + 2] : humidityX[i + 1];
-        int16_t p3y = (i < dataPoints - 2) ? humidityY[i + 2] : humidityY[i + 1];
-
-        // Draw smooth dotted curve between p1 and p2 using many small segments
-        int smoothSteps = 3; // Higher number = smoother curve
-
-        for (int step = 0; step < smoothSteps; step++) {
-            // Calculate interpolation parameter (0.0 to 1.0)
-            float t1 = (float)step / smoothSteps;
-            float t2 = (float)(step + 1) / smoothSteps;
-
-            // Catmull-Rom spline calculation for smooth curves
-            // This creates smooth curves that pass exactly through data points
-            auto catmullRom = [](float t, int16_t p0, int16_t p1, int16_t p2, int16_t p3) -> int16_t {
-                float t2 = t * t;
-                float t3 = t2 * t;
-
-                float result = 0.5f * (
-                    (2.0f * p1) +
-                    (-p0 + p2) * t +
-                    (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 +
-                    (-p0 + 3.0f * p1 - 3.0f * p2 + p3) * t3
-                );
-
-                return (int16_t)result;
-            };
-
-            // Calculate smooth curve points
-            int16_t curve_x1 = catmullRom(t1, p0x, p1x, p2x, p3x);
-            int16_t curve_y1 = catmullRom(t1, p0y, p1y, p2y, p3y);
-            int16_t curve_x2 = catmullRom(t2, p0x, p1x, p2x, p3x);
-            int16_t curve_y2 = catmullRom(t2, p0y, p1y, p2y, p3y);
-
-            // Draw the smooth dotted curve segment
-            drawDottedLine(curve_x1, curve_y1, curve_x2, curve_y2);
-        }
+    Spline::catmullRom(humidityX, humidityY, dataPoints, HUMIDITY_CURVE_STEPS, curve);
+}
+
+void WeatherGraph::drawHumidityLine(const Spline::Polyline& curve) {
+    ESP_LOGI(TAG, "Drawing humidity line with %d curve samples", curve.count);
+
+    // Each segment starts its own dot pattern
+    for (uint8_t i = 1; i < curve.count; i++) {
+        drawDottedLine(curve.x[i - 1], curve.y[i - 1], curve.x[i], curve.y[i]);
     }
 }
 
@@ -418,13 +321,19 @@ void WeatherGraph::drawDottedLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2
     int16_t sy = (y1 < y2) ? 1 : -1;
     int16_t err = dx - dy;
 
-    int16_t x = x1, y = y1;
-    int dotCounter = 0;
-
     // Use shorter dots and gaps for clear dotted pattern
     const int dotLength = 3; // 2 pixels on
     const int gapLength = 4; // 3 pixels off
 
+    // Level stretches of the curve (steady humidity) are a plain dotted span
+    if (y1 == y2 && x1 <= x2) {
+        display.fillStipple(x1, y1, x2 - x1 + 1, 1, HUMIDITY_DASHES, GxEPD_BLACK);
+        return;
+    }
+
+    int16_t x = x1, y = y1;
+    int dotCounter = 0;
+
     while (true) {
         // Draw pixel only during "on" phase of dot pattern
         if ((dotCounter % (dotLength + gapLength)) < dotLength) {
@@ -45,11 +45,10 @@ static const char* TAG = "MAIN";
 WebServer server(80);
 
 // E-Paper display for GDEY075T7 (800x480)
-GxEPD2_BW<GxEPD2_750_GDEY075T7, GxEPD2_750_GDEY075T7::HEIGHT> display(
-    GxEPD2_750_GDEY075T7(Pins::EPD_CS, Pins::EPD_DC, Pins::EPD_RES, Pins::EPD_BUSY));
+RecordingDisplay display(GxEPD2_750_GDEY075T7(Pins::EPD_CS, Pins::EPD_DC, Pins::EPD_RES, Pins::EPD_BUSY));
 
 // U8g2 font renderer for UTF-8 support (German umlauts)
-U8G2_FOR_ADAFRUIT_GFX u8g2;
+RecordingU8g2 u8g2;
 
 // RTC memory for persistent state across deep sleep
 RTC_DATA_ATTR unsigned long wakeupCount = 0;
@@ -10,6 +10,8 @@
 #include <StreamUtils.h>
 #include "build_config.h"
 #include "ota/version_helper.h"
+#include "api/tls_session_cache.h"
+#include "util/inflate_stream.h"
 #include "display/display_manager.h"
 
 static const char* TAG = "OTA_UPDATE";
@@ -311,19 +313,21 @@ namespace {
 bool getLatestReleaseFromGitHub(ReleaseInfo& releaseInfo) {
     ESP_LOGI(TAG, "Fetching latest release ");
 
+    ResumableTlsClient tlsClient;
     HTTPClient http;
 
     String url = LATEST_RELEASE_API;
     ESP_LOGI(TAG, "Requesting: %s", url.c_str());
 
-    http.begin(url);
+    http.begin(tlsClient, url);
     http.addHeader("Accept", "application/vnd.github+json");
     http.addHeader("X-GitHub-Api-Version", "2022-11-28");
     // Todo : Add Authorization header
     // http.addHeader("Authorization", "Bearer YOUR-TOKEN");
 
-    const char* keys[] = {"Transfer-Encoding"};
-    http.collectHeaders(keys, 1);
+    http.addHeader("Accept-Encoding", "gzip, deflate");
+    const char* keys[] = {"Transfer-Encoding", "Content-Encoding"};
+    http.collectHeaders(keys, 2);
 
     int httpCode = http.GET();
 
@@ -335,10 +339,12 @@ bool getLatestReleaseFromGitHub(ReleaseInfo& releaseInfo) {
 
     initReleaseFilter();
 
-    // Handle chunked encoding
+    // Handle chunked encoding, then gzip
     Stream& rawStream = http.getStream();
     ChunkDecodingStream decodedStream(http.getStream());
-    Stream& response = http.header("Transfer-Encoding") == "chunked" ? decodedStream : rawStream;
+    Stream& body = http.header("Transfer-Encoding") == "chunked" ? decodedStream : rawStream;
+    InflateStream inflatedStream(body);
+    Stream& response = InflateStream::isCompressed(http.header("Content-Encoding").c_str()) ? inflatedStream : body;
 
     JsonDocument doc;
     DeserializationOption::NestingLimit nestingLimit(10);
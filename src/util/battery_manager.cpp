@@ -1,12 +1,20 @@
 #include "util/battery_manager.h"
 #include "build_config.h"
 #include "config/pins.h"
+#include "config/config_manager.h"
+#include "util/energy_policy.h"
+#include "util/time_manager.h"
+#include "util/timing_manager.h"
 #ifdef SHOW_BATTERY_STATUS
 #include <esp_adc_cal.h>
 #endif
 
 static const char* TAG = "BATTERY_MGR";
 
+static bool batteryInitialized = false;
+
+RTC_DATA_ATTR DischargeState dischargeState = {0.0f, 0, 0.0f, 100};
+
 void BatteryManager::init() {
 #if SHOW_BATTERY_STATUS
     if (SHOW_BATTERY_STATUS) {
@@ -117,6 +125,29 @@ bool BatteryManager::isCharging() {
     return false;
 }
 
+void BatteryManager::updateEnergyPlan(float voltage) {
+    // No battery (USB power) or no clock to measure the discharge against
+    if (voltage <= 0.1f || !TimeManager::isTimeSet()) {
+        TimingManager::setIntervalStretch(100);
+        return;
+    }
+
+    RTCConfigData& config = ConfigManager::getConfig();
+    uint32_t now = (uint32_t)time(nullptr);
+    EnergyTarget target;
+    target.emptyBy = config.chargeDay >= 0 ? EnergyPolicy::endOfNextWeekday(config.chargeDay, now) : 0;
+    target.transportSeconds = config.transportInterval * 60;
+    target.maxTransportSeconds = config.maxTransportInterval * 60;
+    target.weatherSeconds = config.weatherInterval * 3600;
+    target.maxWeatherSeconds = config.maxWeatherInterval * 3600;
+
+    EnergyPlan plan = EnergyPolicy::plan(dischargeState, voltage, now, target);
+    TimingManager::setIntervalStretch(plan.stretchPercent);
+    ESP_LOGI(TAG, "Energy plan: %.3fV, %.4fV/h, %u h to empty, intervals x%u%% (transport %us, weather %us)",
+             voltage, dischargeState.voltsPerHour, plan.secondsToEmpty / 3600, plan.stretchPercent,
+             plan.transportSeconds, plan.weatherSeconds);
+}
+
 float BatteryManager::voltageToPercentage(float voltage) {
     // Clamp voltage to valid range
     if (voltage >= BATTERY_VOLTAGE_MAX) {
@@ -6,6 +6,7 @@
 
 #include "api/dwd_weather_api.h"
 #include "api/google_api.h"
+#include "api/http_connection_pool.h"
 #include "api/rmv_api.h"
 #include "config/config_manager.h"
 #include "config/config_page.h"
@@ -14,10 +15,13 @@
 #include "display/display_manager.h"
 #include "display/trip_display.h"
 #include "util/battery_manager.h"
+#include "util/energy_meter.h"
 #include "util/transport_print.h"
 #include "global_instances.h"
 
+#include "util/parallel_fetch.h"
 #include "util/sleep_utils.h"
+#include "util/string_pool.h"
 #include "util/indoor_sensor.h"
 #include "util/time_manager.h"
 #include "util/timing_manager.h"
@@ -27,8 +31,16 @@
 
 static const char* TAG = "DEVICE_MODE";
 
+// Per-fetch deadlines in half-and-half mode; a fetch past its deadline falls back to cached data
+namespace FetchDeadline {
+    constexpr uint32_t WEATHER_MS = 20000;
+    constexpr uint32_t TRANSPORT_MS = 25000; // RMV responses are larger and slower
+    constexpr uint32_t STACK_SIZE = 10240;   // TLS handshake + JSON parsing, same budget as the loop task plus margin
+}
+
 // Turn off WiFi before display rendering to save power (~100mA)
 static void shutdownWiFiBeforeRender() {
+    HttpConnectionPool::closeAll();
     CommonFooter::cacheWiFiState();
     WiFi.disconnect(true);
     WiFi.mode(WIFI_OFF);
@@ -41,6 +53,22 @@ ConfigManager& configMgr = ConfigManager::getInstance();
 RTCConfigData& config = ConfigManager::getConfig();
 RTC_DATA_ATTR WeatherInfo weather;
 
+// The board lists departures from now + walking time, so its first entry drops off at its
+// (real-time) departure minus the walking time. Until then a fetch only picks up delays.
+static void recordNextDepartureChange(const DepartureData* depart) {
+    uint32_t change = 0;
+    if (depart && depart->departureCount > 0) {
+        uint32_t now = (uint32_t)time(nullptr);
+        for (const DepartureInfo& dep : depart->departures) {
+            const PooledString& clock = dep.rtTime.isEmpty() ? dep.time : dep.rtTime;
+            uint32_t departure = TimingManager::departureTimestamp(String(clock.c_str()), now);
+            if (departure != 0 && (change == 0 || departure < change)) change = departure;
+        }
+        if (change != 0) change -= config.walkingTime * 60;
+    }
+    TimingManager::setNextDepartureChange(change);
+}
+
 void DeviceModeManager::runConfigurationMode() {
     ESP_LOGI(TAG, "=== PHASE 2: CONFIGURATION MODE ===");
 
@@ -98,26 +126,69 @@ void DeviceModeManager::showWeatherDeparture() {
     bool needsWeatherUpdate = TimingManager::isTimeForWeatherUpdate();
     ESP_LOGI(TAG, "Update requirements - Weather: %s", needsWeatherUpdate ? "YES" : "NO");
 
-    if (needsWeatherUpdate && getGeneralWeatherFull(config.latitude, config.longitude, weather)) {
-        printWeatherInfo(weather);
-        TimingManager::markWeatherUpdated();
+    // Result slots are static: a fetch that misses its deadline may still write to them
+    static WeatherInfo fetchedWeather;
+    static TripData trip; // static: ~4KB too large for stack
+    static DepartureData depart;
+
+    // Start from the cached forecast so fields the response lacks keep their last value
+    fetchedWeather = weather;
+    memset(&trip, 0, sizeof(trip));
+
+    FetchJob jobs[2];
+    uint8_t jobCount = 0;
+    FetchJob* weatherJob = nullptr;
+    if (needsWeatherUpdate) {
+        weatherJob = &jobs[jobCount++];
+        *weatherJob = {"weather_fetch", [](void* arg) {
+            return getGeneralWeatherFull(config.latitude, config.longitude, *static_cast<WeatherInfo*>(arg));
+        }, &fetchedWeather, FetchDeadline::WEATHER_MS, FetchDeadline::STACK_SIZE};
+    }
+    FetchJob& transportJob = jobs[jobCount++];
+    if (config.tripMode) {
+        transportJob = {"trip_fetch", [](void* arg) {
+            return getTripFromRMV(config.selectedStopId, config.tripDestId, *static_cast<TripData*>(arg));
+        }, &trip, FetchDeadline::TRANSPORT_MS, FetchDeadline::STACK_SIZE};
+    } else {
+        transportJob = {"departure_fetch", [](void* arg) {
+            return fetchTransportData(*static_cast<DepartureData*>(arg));
+        }, &depart, FetchDeadline::TRANSPORT_MS, FetchDeadline::STACK_SIZE};
     }
 
+    // The fetch tasks do not touch the energy timeline; charge the wait for them as fetching
+    EnergyPhase running = EnergyMeter::enter(EnergyPhase::HTTP_FETCH);
+    ParallelFetch::start(jobs, jobCount);
+
+    if (weatherJob) {
+        ParallelFetch::join(weatherJob, 1);
+        if (weatherJob->ok) {
+            weather = fetchedWeather;
+            printWeatherInfo(weather);
+            TimingManager::markWeatherUpdated();
+        } else {
+            ESP_LOGW(TAG, "Weather fetch %s - showing cached forecast", weatherJob->timedOut ? "timed out" : "failed");
+        }
+    }
+
+    // Weather is final now: draw its half while the transport response is still downloading
+    DisplayManager::prepareWeatherHalf(weather);
+
+    ParallelFetch::join(&transportJob, 1);
+    EnergyMeter::enter(running);
+    TimingManager::markTransportUpdated();
+    recordNextDepartureChange(config.tripMode || !transportJob.ok ? nullptr : &depart);
+
+    // Transport data is not cached across wakes; a stalled fetch shows an empty board
     if (config.tripMode) {
-        // Trip/connection mode
-        static TripData trip; // static: ~4KB too large for stack
-        memset(&trip, 0, sizeof(trip));
-        getTripFromRMV(config.selectedStopId, config.tripDestId, trip);
-        TimingManager::markTransportUpdated();
+        static TripData noTrip;
         shutdownWiFiBeforeRender();
-        DisplayManager::displayHalfNHalfTrip(weather, trip);
+        DisplayManager::displayHalfNHalfTrip(weather, transportJob.timedOut ? noTrip : trip);
     } else {
-        // Departure mode
-        DepartureData depart;
-        fetchTransportData(depart);
-        TimingManager::markTransportUpdated();
+        static DepartureData noDepartures;
         shutdownWiFiBeforeRender();
-        DisplayManager::displayHalfNHalf(weather, depart);
+        DisplayManager::displayHalfNHalf(weather, transportJob.timedOut ? noDepartures : depart);
+        // An abandoned departure fetch may still be interning strings; the arena goes with deep sleep
+        if (!transportJob.timedOut) StringPool::reset();
     }
 }
 
@@ -130,7 +201,12 @@ void DeviceModeManager::updateWeatherFull() {
         // Use RTC config which persists across deep sleep
         ESP_LOGI(TAG, "Fetching weather for location: %s (%.6f, %.6f)",
                  config.cityName, config.latitude, config.longitude);
-        if (getGeneralWeatherFull(config.latitude, config.longitude, weather)) {
+        bool fetched;
+        {
+            EnergyMeter::Scope fetching(EnergyPhase::HTTP_FETCH);
+            fetched = getGeneralWeatherFull(config.latitude, config.longitude, weather);
+        }
+        if (fetched) {
             TimingManager::markWeatherUpdated();
         } else {
             ESP_LOGE(TAG, "Failed to get weather information from DWD.");
@@ -154,9 +230,15 @@ void DeviceModeManager::updateDepartureFull() {
     ESP_LOGI(TAG, "Fetching departures for stop: %s (%s)",
              stopIdToUse.c_str(), config.selectedStopName);
 
-    if (getDepartureFromRMV(stopIdToUse.c_str(), depart)) {
+    bool fetched;
+    {
+        EnergyMeter::Scope fetching(EnergyPhase::HTTP_FETCH);
+        fetched = getDepartureFromRMV(stopIdToUse.c_str(), depart);
+    }
+    if (fetched) {
         printTransportInfo(depart);
         TimingManager::markTransportUpdated();
+        recordNextDepartureChange(&depart);
         // Always display, even if empty
         if (depart.departureCount == 0) {
             ESP_LOGI(TAG, "No departures scheduled at this time");
@@ -165,6 +247,7 @@ void DeviceModeManager::updateDepartureFull() {
         DisplayManager::displayDeparturesFull(depart);
     } else {
         ESP_LOGE(TAG, "Failed to get departure information from RMV.");
+        recordNextDepartureChange(nullptr);
 
         // Create empty departure data to show "No departures" message
         depart.stopId = stopIdToUse;
@@ -173,6 +256,7 @@ void DeviceModeManager::updateDepartureFull() {
         shutdownWiFiBeforeRender();
         DisplayManager::displayDeparturesFull(depart);
     }
+    StringPool::reset(); // Departure strings are no longer referenced
 }
 
 // ===== COMMON OPERATIONAL MODE FUNCTIONS =====
@@ -0,0 +1,193 @@
+#include "util/energy_meter.h"
+#include <Arduino.h>
+#include "build_config.h"
+#ifndef NATIVE_TEST
+#include <esp_timer.h>
+#endif
+
+static const char* TAG = "ENERGY_METER";
+
+// Estimates from the data sheets; replace them with measurements of the board where available.
+// JSON parsing reads the response from the socket, so the radio is still on.
+//                                   INIT START RUN STOP WiFi  NTP  HTTP JSON Panel
+#if defined(BOARD_S3_E1001) || defined(BOARD_S3_EE04)
+static const CurrentProfile BOARD_PROFILE = {{45, 45, 45, 45, 120, 95, 110, 100, 50}, 20.0f, BATTERY_CAPACITY_MAH};
+#elif defined(BOARD_C5_XIAO)
+static const CurrentProfile BOARD_PROFILE = {{30, 30, 30, 30, 110, 85, 100, 90, 40}, 15.0f, BATTERY_CAPACITY_MAH};
+#else
+static const CurrentProfile BOARD_PROFILE = {{25, 25, 25, 25, 100, 80, 90, 80, 35}, 50.0f, BATTERY_CAPACITY_MAH};
+#endif
+
+// The last LOG_SIZE wakes, oldest at wakeLogNext once the ring is full
+RTC_DATA_ATTR WakeRecord wakeLog[EnergyMeter::LOG_SIZE];
+RTC_DATA_ATTR uint8_t wakeLogNext = 0;
+RTC_DATA_ATTR uint8_t wakeLogCount = 0;
+
+// The current wake, in RAM
+static uint64_t phaseMicros[ENERGY_PHASE_COUNT];
+static EnergyPhase currentPhase = EnergyPhase::INIT;
+static uint64_t phaseStartedAt = 0;
+static bool metering = false;
+
+#ifdef NATIVE_TEST
+static uint64_t nativeMicros = 0;
+
+void EnergyMeter::setNativeMicros(uint64_t micros) {
+    nativeMicros = micros;
+}
+
+void EnergyMeter::clearLog() {
+    wakeLogNext = 0;
+    wakeLogCount = 0;
+    metering = false;
+}
+
+uint64_t EnergyMeter::nowMicros() {
+    return nativeMicros;
+}
+
+bool EnergyMeter::onWakeTask() {
+    return metering;
+}
+#else
+static TaskHandle_t wakeTask = nullptr;
+
+uint64_t EnergyMeter::nowMicros() {
+    return (uint64_t)esp_timer_get_time();
+}
+
+bool EnergyMeter::onWakeTask() {
+    return metering && xTaskGetCurrentTaskHandle() == wakeTask;
+}
+#endif
+
+void EnergyMeter::beginWake() {
+    for (uint8_t i = 0; i < ENERGY_PHASE_COUNT; i++) phaseMicros[i] = 0;
+    currentPhase = EnergyPhase::INIT;
+    phaseStartedAt = 0; // esp_timer counts from the application's start
+    metering = true;
+#ifndef NATIVE_TEST
+    wakeTask = xTaskGetCurrentTaskHandle();
+#endif
+}
+
+EnergyPhase EnergyMeter::enter(EnergyPhase phase) {
+    EnergyPhase previous = currentPhase;
+    if (!onWakeTask()) return phase; // A Scope on another task restores nothing either
+    uint64_t now = nowMicros();
+    phaseMicros[(uint8_t)currentPhase] += now - phaseStartedAt;
+    phaseStartedAt = now;
+    currentPhase = phase;
+    return previous;
+}
+
+void EnergyMeter::endWake(uint32_t startedAt, uint32_t sleepSeconds) {
+    if (!onWakeTask()) return;
+    enter(currentPhase);
+    metering = false;
+
+    WakeRecord& wake = wakeLog[wakeLogNext];
+    wake.startedAt = startedAt;
+    wake.sleepSeconds = sleepSeconds;
+    uint32_t awakeMs = 0;
+    for (uint8_t i = 0; i < ENERGY_PHASE_COUNT; i++) {
+        uint64_t ms = phaseMicros[i] / 1000;
+        wake.phaseMs[i] = ms > UINT16_MAX ? UINT16_MAX : (uint16_t)ms;
+        awakeMs += wake.phaseMs[i];
+    }
+    wakeLogNext = (wakeLogNext + 1) % LOG_SIZE;
+    if (wakeLogCount < LOG_SIZE) wakeLogCount++;
+
+    const CurrentProfile& board = profile();
+    uint8_t top = 0;
+    for (uint8_t i = 1; i < ENERGY_PHASE_COUNT; i++) {
+        if (wake.phaseMs[i] * board.phaseMilliamps[i] > wake.phaseMs[top] * board.phaseMilliamps[top]) top = i;
+    }
+    ESP_LOGI(TAG, "Wake: %u ms, %.3f mAh, most in %s (%u ms), then %u s of sleep", awakeMs,
+             wakeMilliampHours(wake, board), phaseName((EnergyPhase)top), wake.phaseMs[top], sleepSeconds);
+    for (uint8_t i = 0; i < ENERGY_PHASE_COUNT; i++) {
+        ESP_LOGD(TAG, "  %-13s %5u ms", phaseName((EnergyPhase)i), wake.phaseMs[i]);
+    }
+}
+
+EnergySummary EnergyMeter::summary(int batteryPercent) {
+    WakeRecord ordered[LOG_SIZE];
+    uint8_t oldest = (wakeLogNext + LOG_SIZE - wakeLogCount) % LOG_SIZE;
+    for (uint8_t i = 0; i < wakeLogCount; i++) {
+        ordered[i] = wakeLog[(oldest + i) % LOG_SIZE];
+    }
+    return summarize(ordered, wakeLogCount, profile(), batteryPercent);
+}
+
+const CurrentProfile& EnergyMeter::profile() {
+    return BOARD_PROFILE;
+}
+
+const char* EnergyMeter::phaseName(EnergyPhase phase) {
+    switch (phase) {
+    case EnergyPhase::INIT: return "Init";
+    case EnergyPhase::START: return "Start";
+    case EnergyPhase::RUNNING: return "Running";
+    case EnergyPhase::STOP: return "Stop";
+    case EnergyPhase::WIFI_CONNECT: return "WiFi";
+    case EnergyPhase::TIME_SYNC: return "NTP";
+    case EnergyPhase::HTTP_FETCH: return "HTTP";
+    case EnergyPhase::JSON_PARSE: return "JSON";
+    case EnergyPhase::PANEL_REFRESH: return "Refresh";
+    default: return "Unknown";
+    }
+}
+
+float EnergyMeter::wakeMilliampHours(const WakeRecord& wake, const CurrentProfile& profile) {
+    float milliampMs = 0.0f;
+    for (uint8_t i = 0; i < ENERGY_PHASE_COUNT; i++) {
+        milliampMs += wake.phaseMs[i] * profile.phaseMilliamps[i];
+    }
+    return milliampMs / 3600000.0f;
+}
+
+EnergySummary EnergyMeter::summarize(const WakeRecord* records, uint8_t count, const CurrentProfile& profile,
+                                     int batteryPercent) {
+    EnergySummary result = {0, 0.0f, 0.0f, EnergyPhase::INIT, 0, 0.0f};
+    if (count == 0) return result;
+
+    float wakeCharge = 0.0f;
+    float phaseCharge[ENERGY_PHASE_COUNT] = {};
+    float awakeSeconds = 0.0f;
+    float plannedSeconds = 0.0f;
+    for (uint8_t r = 0; r < count; r++) {
+        for (uint8_t i = 0; i < ENERGY_PHASE_COUNT; i++) {
+            phaseCharge[i] += records[r].phaseMs[i] * profile.phaseMilliamps[i] / 3600000.0f;
+            awakeSeconds += records[r].phaseMs[i] / 1000.0f;
+        }
+        plannedSeconds += records[r].sleepSeconds;
+    }
+    for (uint8_t i = 0; i < ENERGY_PHASE_COUNT; i++) {
+        wakeCharge += phaseCharge[i];
+        if (phaseCharge[i] > phaseCharge[(uint8_t)result.topPhase]) result.topPhase = (EnergyPhase)i;
+    }
+
+    // A button press cuts a sleep short, so the clock tells the span better than the planned sleeps.
+    // The last wake's sleep has not happened yet; it is counted as planned either way.
+    const WakeRecord& first = records[0];
+    const WakeRecord& last = records[count - 1];
+    float span = awakeSeconds + plannedSeconds;
+    if (count > 1 && first.startedAt != 0 && last.startedAt > first.startedAt) {
+        float lastWake = 0.0f;
+        for (uint8_t i = 0; i < ENERGY_PHASE_COUNT; i++) lastWake += last.phaseMs[i] / 1000.0f;
+        span = (float)(last.startedAt - first.startedAt) + lastWake + last.sleepSeconds;
+    }
+    float sleepSeconds = span > awakeSeconds ? span - awakeSeconds : 0.0f;
+    float sleepCharge = profile.sleepMicroamps / 1000.0f * sleepSeconds / 3600.0f;
+
+    result.wakes = count;
+    result.mAhPerWake = wakeCharge / count;
+    result.mAhPerDay = span > 0.0f ? (wakeCharge + sleepCharge) * 86400.0f / span : 0.0f;
+    result.topPhasePercent = wakeCharge > 0.0f
+                                 ? (uint8_t)(phaseCharge[(uint8_t)result.topPhase] * 100.0f / wakeCharge + 0.5f)
+                                 : 0;
+    if (batteryPercent >= 0 && profile.batteryMilliampHours > 0 && result.mAhPerDay > 0.0f) {
+        result.runtimeDays = profile.batteryMilliampHours * batteryPercent / 100.0f / result.mAhPerDay;
+    }
+    return result;
+}
@@ -0,0 +1,91 @@
+#include "util/energy_policy.h"
+#include <time.h>
+#include "util/battery_manager.h"
+
+static float clampFloat(float value, float low, float high) {
+    if (value < low) return low;
+    if (value > high) return high;
+    return value;
+}
+
+EnergyPlan EnergyPolicy::plan(DischargeState& state, float voltage, uint32_t now, const EnergyTarget& target) {
+    float previous = (state.stretchPercent ? state.stretchPercent : 100) / 100.0f;
+
+    // Sample the discharge rate. It is stored as the rate at the configured intervals,
+    // so samples taken at different stretches are comparable.
+    if (state.anchorVoltage <= 0.0f || now < state.anchorTime) {
+        state.anchorVoltage = voltage;
+        state.anchorTime = now;
+    } else if (voltage > state.anchorVoltage + CHARGE_RISE) {
+        state.anchorVoltage = voltage;
+        state.anchorTime = now;
+        previous = 1.0f; // Charged: start over at the configured intervals
+    } else {
+        uint32_t elapsed = now - state.anchorTime;
+        float drop = state.anchorVoltage - voltage;
+        if (elapsed >= MIN_SAMPLE_SECONDS && (drop >= MIN_SAMPLE_DROP || elapsed >= MAX_SAMPLE_SECONDS)) {
+            float sample = (drop > 0.0f ? drop : 0.0f) / (elapsed / 3600.0f) * previous;
+            state.voltsPerHour = state.voltsPerHour > 0.0f
+                                     ? state.voltsPerHour + SMOOTHING * (sample - state.voltsPerHour)
+                                     : sample;
+            state.anchorVoltage = voltage;
+            state.anchorTime = now;
+        }
+    }
+
+    float remaining = voltage - BATTERY_VOLTAGE_MIN;
+    if (remaining < 0.0f) remaining = 0.0f;
+    float charge = clampFloat(remaining / (BATTERY_VOLTAGE_MAX - BATTERY_VOLTAGE_MIN), 0.0f, 1.0f);
+
+    float stretch = 1.0f;
+    if (charge < RESERVE_FRACTION) {
+        stretch = 1.0f + (RESERVE_STRETCH / 100.0f - 1.0f) * (1.0f - charge / RESERVE_FRACTION);
+    }
+    if (target.emptyBy > now && state.voltsPerHour > 0.0f && remaining > 0.0f) {
+        // Hours to empty at stretch s are remaining / (voltsPerHour / s)
+        float neededHours = (target.emptyBy - now) / 3600.0f;
+        float required = neededHours * state.voltsPerHour / remaining;
+        if (required > stretch) stretch = required;
+    }
+
+    // Past the largest stretch the bounds allow, stretching further would only wind up
+    float limit = 1.0f;
+    if (target.transportSeconds > 0 && target.maxTransportSeconds > target.transportSeconds) {
+        limit = (float)target.maxTransportSeconds / target.transportSeconds;
+    }
+    if (target.weatherSeconds > 0 && target.maxWeatherSeconds > target.weatherSeconds) {
+        float weatherLimit = (float)target.maxWeatherSeconds / target.weatherSeconds;
+        if (weatherLimit > limit) limit = weatherLimit;
+    }
+    stretch = clampFloat(stretch, previous / MAX_STEP, previous * MAX_STEP);
+    stretch = clampFloat(stretch, 1.0f, limit);
+
+    EnergyPlan result;
+    result.stretchPercent = (uint16_t)(stretch * 100.0f + 0.5f);
+    result.transportSeconds = stretchInterval(target.transportSeconds, target.maxTransportSeconds,
+                                              result.stretchPercent);
+    result.weatherSeconds = stretchInterval(target.weatherSeconds, target.maxWeatherSeconds, result.stretchPercent);
+    result.secondsToEmpty = state.voltsPerHour > 0.0f
+                                ? (uint32_t)(remaining / (state.voltsPerHour / stretch) * 3600.0f)
+                                : 0;
+    state.stretchPercent = result.stretchPercent;
+    return result;
+}
+
+uint32_t EnergyPolicy::endOfNextWeekday(uint8_t weekday, uint32_t now) {
+    tm timeInfo;
+    time_t current = (time_t)now;
+    localtime_r(&current, &timeInfo);
+    timeInfo.tm_mday += (weekday + 7 - timeInfo.tm_wday) % 7 + 1;
+    timeInfo.tm_hour = 0;
+    timeInfo.tm_min = 0;
+    timeInfo.tm_sec = 0;
+    timeInfo.tm_isdst = -1;
+    return (uint32_t)mktime(&timeInfo);
+}
+
+uint32_t EnergyPolicy::stretchInterval(uint32_t seconds, uint32_t maxSeconds, uint16_t stretchPercent) {
+    uint32_t stretched = (uint32_t)((uint64_t)seconds * stretchPercent / 100);
+    if (stretched > maxSeconds) stretched = maxSeconds;
+    return stretched > seconds ? stretched : seconds;
+}
@@ -0,0 +1,444 @@
+/**
+ * Streaming inflate for HTTP responses sent with Content-Encoding: gzip/deflate.
+ *
+ * Canonical Huffman decoding as in zlib's reference decoder (puff.c): each
+ * table is a per-length code count plus the symbols sorted by code, decoded
+ * one bit at a time. Unlike puff, decoding stops whenever FILL_TARGET bytes
+ * are ready and resumes at the next symbol, so the reader sees output long
+ * before the body has arrived. Block and wrapper state is kept between
+ * fills; within a symbol, missing input is waited for on the upstream stream.
+ */
+
+#include "util/inflate_stream.h"
+#include <esp_log.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char* TAG = "INFLATE";
+
+namespace {
+    // Base values and extra bits for length codes 257..285 and distance codes 0..29
+    const uint16_t LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27,
+                                      31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    const uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                      2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    const uint16_t DIST_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129,
+                                    193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385,
+                                    24577};
+    const uint8_t DIST_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6,
+                                    6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+    // Order in which code length code lengths are sent in a dynamic block header
+    const uint8_t CODE_LENGTH_ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+    const uint8_t GZIP_FEXTRA = 0x04;
+    const uint8_t GZIP_FNAME = 0x08;
+    const uint8_t GZIP_FCOMMENT = 0x10;
+    const uint8_t GZIP_FHCRC = 0x02;
+    const uint16_t MAX_MATCH = 258;
+} // namespace
+
+InflateStream::InflateStream(Stream& upstream)
+    : upstream(upstream), window(nullptr), produced(0), consumed(0), inputPos(0), inputLen(0), compressedIn(0),
+      bitBuf(0), bitCount(0), state(State::WRAPPER_HEADER), format(Format::RAW), finalBlock(false), storedLeft(0) {
+}
+
+InflateStream::~InflateStream() {
+    free(window);
+}
+
+bool InflateStream::isCompressed(const char* contentEncoding) {
+    if (!contentEncoding) return false;
+    return strcasecmp(contentEncoding, "gzip") == 0 || strcasecmp(contentEncoding, "x-gzip") == 0 ||
+        strcasecmp(contentEncoding, "deflate") == 0;
+}
+
+// ===== Stream interface =====
+
+int InflateStream::available() {
+    // Only decode ahead when it will not block on the network
+    if (pending() == 0 && (inputPos < inputLen || upstream.available() > 0)) fill();
+    return static_cast<int>(pending());
+}
+
+int InflateStream::read() {
+    if (pending() == 0 && !fill()) return -1;
+    return window[consumed++ & (WINDOW_SIZE - 1)];
+}
+
+int InflateStream::peek() {
+    if (pending() == 0 && !fill()) return -1;
+    return window[consumed & (WINDOW_SIZE - 1)];
+}
+
+size_t InflateStream::readBytes(char* buffer, size_t length) {
+    size_t copied = 0;
+    while (copied < length) {
+        if (pending() == 0 && !fill()) break;
+
+        // Contiguous run up to the end of the window
+        size_t offset = consumed & (WINDOW_SIZE - 1);
+        size_t n = length - copied;
+        if (n > pending()) n = pending();
+        if (n > WINDOW_SIZE - offset) n = WINDOW_SIZE - offset;
+
+        memcpy(buffer + copied, window + offset, n);
+        consumed += n;
+        copied += n;
+    }
+    return copied;
+}
+
+// ===== Decoder state machine =====
+
+bool InflateStream::fill() {
+    if (!window && state != State::FAILED && state != State::DONE) {
+#ifdef BOARD_HAS_PSRAM
+        window = static_cast<uint8_t*>(ps_malloc(WINDOW_SIZE));
+#else
+        window = static_cast<uint8_t*>(malloc(WINDOW_SIZE));
+#endif
+        if (!window) fail("no memory for window");
+    }
+
+    while (pending() < FILL_TARGET && state != State::DONE && state != State::FAILED) {
+        // Hand out what is there instead of waiting for more input
+        if (pending() > 0 && inputPos == inputLen && upstream.available() <= 0) break;
+        step();
+    }
+    return pending() > 0;
+}
+
+void InflateStream::step() {
+    switch (state) {
+    case State::WRAPPER_HEADER: readWrapperHeader(); break;
+    case State::BLOCK_HEADER: readBlockHeader(); break;
+    case State::STORED: inflateStored(); break;
+    case State::HUFFMAN: inflateHuffman(); break;
+    case State::TRAILER: readTrailer(); break;
+    case State::DONE:
+    case State::FAILED: break;
+    }
+}
+
+void InflateStream::readWrapperHeader() {
+    int b0 = nextByte();
+    int b1 = nextByte();
+    if (b1 < 0) return;
+
+    if (b0 == 0x1f && b1 == 0x8b) {
+        // gzip: method, flags, mtime(4), xfl, os, then optional fields
+        int method = nextByte();
+        int flags = nextByte();
+        for (int i = 0; i < 6; i++) nextByte();
+        if (flags < 0) return;
+        if (method != 8) return fail("unsupported gzip method");
+
+        if (flags & GZIP_FEXTRA) {
+            int lo = nextByte();
+            int hi = nextByte();
+            if (hi < 0) return;
+            for (int i = (hi << 8) | lo; i > 0 && state != State::FAILED; i--) nextByte();
+        }
+        if (flags & GZIP_FNAME) {
+            int c;
+            while ((c = nextByte()) > 0) {
+            }
+        }
+        if (flags & GZIP_FCOMMENT) {
+            int c;
+            while ((c = nextByte()) > 0) {
+            }
+        }
+        if (flags & GZIP_FHCRC) {
+            nextByte();
+            nextByte();
+        }
+        format = Format::GZIP;
+    } else if ((b0 & 0x0f) == 8 && (b0 >> 4) <= 7 && ((b0 << 8) | b1) % 31 == 0) {
+        if (b1 & 0x20) return fail("preset dictionary not supported");
+        format = Format::ZLIB;
+    } else {
+        // Raw deflate: the two bytes already are the start of the first block
+        bitBuf = static_cast<uint32_t>(b0) | (static_cast<uint32_t>(b1) << 8);
+        bitCount = 16;
+        format = Format::RAW;
+    }
+
+    if (state != State::FAILED) state = State::BLOCK_HEADER;
+}
+
+void InflateStream::readBlockHeader() {
+    int header = bits(3);
+    if (header < 0) return;
+
+    finalBlock = header & 1;
+    switch (header >> 1) {
+    case 0: {
+        alignToByte();
+        int lenLo = nextByte();
+        int lenHi = nextByte();
+        int nlenLo = nextByte();
+        int nlenHi = nextByte();
+        if (nlenHi < 0) return;
+        uint16_t len = static_cast<uint16_t>(lenLo | (lenHi << 8));
+        uint16_t nlen = static_cast<uint16_t>(nlenLo | (nlenHi << 8));
+        if (len != static_cast<uint16_t>(~nlen)) return fail("stored block length mismatch");
+        storedLeft = len;
+        state = State::STORED;
+        break;
+    }
+    case 1: {
+        // Fixed Huffman codes (RFC 1951 3.2.6)
+        uint8_t lengths[MAX_LIT_CODES];
+        uint16_t sym = 0;
+        for (; sym < 144; sym++) lengths[sym] = 8;
+        for (; sym < 256; sym++) lengths[sym] = 9;
+        for (; sym < 280; sym++) lengths[sym] = 7;
+        for (; sym < MAX_LIT_CODES; sym++) lengths[sym] = 8;
+        buildTable(litCount, litSymbol, lengths, MAX_LIT_CODES);
+
+        for (sym = 0; sym < 30; sym++) lengths[sym] = 5;
+        buildTable(distCount, distSymbol, lengths, 30);
+        state = State::HUFFMAN;
+        break;
+    }
+    case 2:
+        readDynamicTables();
+        if (state != State::FAILED) state = State::HUFFMAN;
+        break;
+    default:
+        fail("invalid block type");
+        break;
+    }
+}
+
+void InflateStream::readDynamicTables() {
+    int nlen = bits(5);
+    int ndist = bits(5);
+    int ncode = bits(4);
+    if (ncode < 0) return;
+    nlen += 257;
+    ndist += 1;
+    ncode += 4;
+    if (nlen > 286 || ndist > 30) return fail("too many length or distance codes");
+
+    uint8_t lengths[MAX_LIT_CODES + MAX_DIST_CODES];
+    memset(lengths, 0, 19);
+    for (int i = 0; i < ncode; i++) {
+        int len = bits(3);
+        if (len < 0) return;
+        lengths[CODE_LENGTH_ORDER[i]] = static_cast<uint8_t>(len);
+    }
+
+    // The code length code goes in the distance table until the real one is read
+    if (!buildTable(distCount, distSymbol, lengths, 19)) return fail("bad code length code");
+
+    int index = 0;
+    while (index < nlen + ndist) {
+        int sym = decodeSymbol(distCount, distSymbol);
+        if (sym < 0) return;
+
+        if (sym < 16) {
+            lengths[index++] = static_cast<uint8_t>(sym);
+            continue;
+        }
+
+        uint8_t value = 0;
+        int repeat;
+        if (sym == 16) {
+            if (index == 0) return fail("repeat with no previous length");
+            value = lengths[index - 1];
+            repeat = bits(2);
+            if (repeat < 0) return;
+            repeat += 3;
+        } else if (sym == 17) {
+            repeat = bits(3);
+            if (repeat < 0) return;
+            repeat += 3;
+        } else {
+            repeat = bits(7);
+            if (repeat < 0) return;
+            repeat += 11;
+        }
+        if (index + repeat > nlen + ndist) return fail("too many lengths");
+        while (repeat--) lengths[index++] = value;
+    }
+
+    if (lengths[256] == 0) return fail("no end-of-block code");
+    if (!buildTable(litCount, litSymbol, lengths, nlen)) return fail("bad literal/length code");
+    if (!buildTable(distCount, distSymbol, lengths + nlen, ndist)) return fail("bad distance code");
+}
+
+void InflateStream::inflateStored() {
+    while (storedLeft > 0 && pending() < FILL_TARGET) {
+        // Copy straight from the input buffer when possible
+        if (inputPos == inputLen) {
+            int b = nextByte();
+            if (b < 0) return;
+            put(static_cast<uint8_t>(b));
+            storedLeft--;
+            continue;
+        }
+        size_t n = inputLen - inputPos;
+        if (n > storedLeft) n = storedLeft;
+        if (n > FILL_TARGET - pending()) n = FILL_TARGET - pending();
+        for (size_t i = 0; i < n; i++) put(input[inputPos++]);
+        storedLeft -= n;
+    }
+    if (storedLeft == 0) state = finalBlock ? State::TRAILER : State::BLOCK_HEADER;
+}
+
+void InflateStream::inflateHuffman() {
+    // A match can add MAX_MATCH bytes; never overwrite bytes the reader has not taken yet
+    while (pending() < FILL_TARGET && pending() + MAX_MATCH <= WINDOW_SIZE) {
+        int sym = decodeSymbol(litCount, litSymbol);
+        if (sym < 0) return;
+
+        if (sym < 256) {
+            put(static_cast<uint8_t>(sym));
+            continue;
+        }
+        if (sym == 256) {
+            state = finalBlock ? State::TRAILER : State::BLOCK_HEADER;
+            return;
+        }
+
+        sym -= 257;
+        if (sym >= 29) return fail("invalid length symbol");
+        int extra = bits(LENGTH_EXTRA[sym]);
+        if (extra < 0) return;
+        uint16_t len = LENGTH_BASE[sym] + extra;
+
+        int dsym = decodeSymbol(distCount, distSymbol);
+        if (dsym < 0) return;
+        if (dsym >= 30) return fail("invalid distance symbol");
+        extra = bits(DIST_EXTRA[dsym]);
+        if (extra < 0) return;
+        size_t dist = DIST_BASE[dsym] + extra;
+        if (dist > produced || dist > WINDOW_SIZE) return fail("distance too far back");
+
+        size_t from = produced - dist;
+        while (len--) put(window[from++ & (WINDOW_SIZE - 1)]);
+    }
+}
+
+void InflateStream::readTrailer() {
+    alignToByte();
+
+    if (format == Format::GZIP) {
+        // CRC-32 (not checked - TLS already guarantees integrity), then the size mod 2^32
+        uint8_t trailer[8];
+        for (int i = 0; i < 8; i++) {
+            int b = nextByte();
+            if (b < 0) return;
+            trailer[i] = static_cast<uint8_t>(b);
+        }
+        uint32_t size = trailer[4] | (trailer[5] << 8) | (trailer[6] << 16) | (static_cast<uint32_t>(trailer[7]) << 24);
+        if (size != static_cast<uint32_t>(produced)) return fail("gzip size mismatch");
+    } else if (format == Format::ZLIB) {
+        for (int i = 0; i < 4; i++) {
+            if (nextByte() < 0) return;
+        }
+    }
+
+    ESP_LOGD(TAG, "Inflated %u -> %u bytes", static_cast<unsigned>(compressedIn), static_cast<unsigned>(produced));
+    state = State::DONE;
+}
+
+void InflateStream::fail(const char* reason) {
+    if (state != State::FAILED) {
+        ESP_LOGE(TAG, "Inflate failed after %u input bytes: %s", static_cast<unsigned>(compressedIn), reason);
+    }
+    state = State::FAILED;
+}
+
+// ===== Input =====
+
+int InflateStream::nextByte() {
+    if (state == State::FAILED) return -1;
+
+    if (inputPos == inputLen) {
+        // Take what already arrived; wait (up to the stream timeout) only when nothing has
+        int ready = upstream.available();
+        size_t want = ready > 0 ? (static_cast<size_t>(ready) < INPUT_SIZE ? ready : INPUT_SIZE) : 1;
+        size_t n = upstream.readBytes(reinterpret_cast<char*>(input), want);
+        if (n == 0) {
+            fail("compressed stream ended early");
+            return -1;
+        }
+        inputPos = 0;
+        inputLen = static_cast<uint16_t>(n);
+        compressedIn += n;
+    }
+    return input[inputPos++];
+}
+
+bool InflateStream::needBits(uint8_t n) {
+    while (bitCount < n) {
+        int b = nextByte();
+        if (b < 0) return false;
+        bitBuf |= static_cast<uint32_t>(b) << bitCount;
+        bitCount += 8;
+    }
+    return true;
+}
+
+int InflateStream::bits(uint8_t n) {
+    if (!needBits(n)) return -1;
+    int value = static_cast<int>(bitBuf & ((1u << n) - 1));
+    bitBuf >>= n;
+    bitCount -= n;
+    return value;
+}
+
+void InflateStream::alignToByte() {
+    // Bits are only loaded on demand, so fewer than 8 are left, all from the current byte
+    bitBuf = 0;
+    bitCount = 0;
+}
+
+// ===== Huffman tables =====
+
+bool InflateStream::buildTable(uint16_t* count, uint16_t* symbol, const uint8_t* lengths, uint16_t n) {
+    memset(count, 0, (MAX_CODE_BITS + 1) * sizeof(uint16_t));
+    for (uint16_t sym = 0; sym < n; sym++) count[lengths[sym]]++;
+    if (count[0] == n) return true; // No codes: valid for a distance table of a literal-only block
+
+    // Reject over-subscribed code sets; incomplete ones only fail if an unused code shows up
+    int left = 1;
+    for (uint8_t len = 1; len <= MAX_CODE_BITS; len++) {
+        left <<= 1;
+        left -= count[len];
+        if (left < 0) return false;
+    }
+
+    uint16_t offsets[MAX_CODE_BITS + 1];
+    offsets[1] = 0;
+    for (uint8_t len = 1; len < MAX_CODE_BITS; len++) offsets[len + 1] = offsets[len] + count[len];
+
+    for (uint16_t sym = 0; sym < n; sym++) {
+        if (lengths[sym] != 0) symbol[offsets[lengths[sym]]++] = sym;
+    }
+    return true;
+}
+
+int InflateStream::decodeSymbol(const uint16_t* count, const uint16_t* symbol) {
+    int code = 0;  // Bits read so far
+    int first = 0; // First code of the current length
+    int index = 0; // Index of that code in symbol[]
+    for (uint8_t len = 1; len <= MAX_CODE_BITS; len++) {
+        if (bitCount == 0 && !needBits(1)) return -1;
+        code |= bitBuf & 1;
+        bitBuf >>= 1;
+        bitCount--;
+
+        int n = count[len];
+        if (code - first < n) return symbol[index + code - first];
+        index += n;
+        first = (first + n) << 1;
+        code <<= 1;
+    }
+    fail("invalid Huffman code");
+    return -1;
+}
@@ -0,0 +1,178 @@
+#include "util/parallel_fetch.h"
+#include <Arduino.h>
+#include <esp_log.h>
+#include "build_config.h"
+
+#if PARALLEL_FETCH
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/event_groups.h>
+#endif
+
+static const char* TAG = "PARALLEL_FETCH";
+
+static void resetResult(FetchJob& job) {
+    job.ok = false;
+    job.timedOut = false;
+    job.durationMs = 0;
+    job.startedAt = millis();
+    job.slot = -1;
+}
+
+static void runInline(FetchJob& job) {
+    job.ok = job.run(job.arg);
+    job.durationMs = millis() - job.startedAt;
+}
+
+static void logSummary(const FetchJob* jobs, uint8_t count, uint32_t elapsed) {
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < count; i++) sum += jobs[i].durationMs;
+    ESP_LOGI(TAG, "%u fetches done in %u ms (sequential would be ~%u ms)", count, elapsed, sum);
+}
+
+#if PARALLEL_FETCH
+
+// Task-side state. Kept outside the caller's FetchJob array because an
+// abandoned task keeps running after join() has returned.
+struct TaskSlot {
+    bool (*run)(void* arg);
+    void* arg;
+    volatile bool busy; // Task created and not finished yet
+    volatile bool ok;
+    volatile uint32_t durationMs;
+};
+
+static TaskSlot taskSlots[ParallelFetch::MAX_JOBS];
+static StaticEventGroup_t doneGroupBuffer;
+static EventGroupHandle_t doneGroup = nullptr;
+
+static EventBits_t slotBit(int8_t slot) {
+    return BIT0 << slot;
+}
+
+static void fetchTask(void* param) {
+    TaskSlot* slot = static_cast<TaskSlot*>(param);
+
+    uint32_t start = millis();
+    slot->ok = slot->run(slot->arg);
+    slot->durationMs = millis() - start;
+
+    // Signal first, then free the slot, so a reused slot never sees a stale bit
+    xEventGroupSetBits(doneGroup, slotBit(slot - taskSlots));
+    slot->busy = false;
+    vTaskDelete(nullptr);
+}
+
+static bool startTask(FetchJob& job) {
+    int8_t index = -1;
+    for (uint8_t i = 0; i < ParallelFetch::MAX_JOBS && index < 0; i++) {
+        if (!taskSlots[i].busy) index = i;
+    }
+    if (index < 0) {
+        ESP_LOGW(TAG, "No free task slot for %s (earlier fetch still stalled)", job.name);
+        return false;
+    }
+
+    TaskSlot& slot = taskSlots[index];
+    slot.run = job.run;
+    slot.arg = job.arg;
+    slot.ok = false;
+    slot.durationMs = 0;
+    slot.busy = true;
+    xEventGroupClearBits(doneGroup, slotBit(index));
+
+    BaseType_t created = xTaskCreate(fetchTask, job.name, job.stackSize, &slot, 2, nullptr);
+    if (created != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create %s task", job.name);
+        slot.busy = false;
+        return false;
+    }
+    job.slot = index;
+    return true;
+}
+
+void ParallelFetch::start(FetchJob* jobs, uint8_t count) {
+    if (!doneGroup) doneGroup = xEventGroupCreateStatic(&doneGroupBuffer);
+
+    for (uint8_t i = 0; i < count; i++) {
+        resetResult(jobs[i]);
+        startTask(jobs[i]);
+    }
+
+    // Jobs without a task run here while the others are in flight
+    for (uint8_t i = 0; i < count; i++) {
+        if (jobs[i].slot < 0) runInline(jobs[i]);
+    }
+}
+
+void ParallelFetch::join(FetchJob* jobs, uint8_t count) {
+    uint32_t joinStart = millis();
+    uint32_t firstStart = joinStart;
+    EventBits_t pending = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (jobs[i].slot >= 0) pending |= slotBit(jobs[i].slot);
+        if (jobs[i].startedAt < firstStart) firstStart = jobs[i].startedAt;
+    }
+
+    while (pending) {
+        // Sleep until a job finishes or the nearest deadline passes
+        uint32_t now = millis();
+        uint32_t wait = UINT32_MAX;
+        for (uint8_t i = 0; i < count; i++) {
+            if (jobs[i].slot < 0) continue;
+            uint32_t elapsed = now - jobs[i].startedAt;
+            uint32_t remaining = jobs[i].deadlineMs > elapsed ? jobs[i].deadlineMs - elapsed : 0;
+            if (remaining < wait) wait = remaining;
+        }
+
+        EventBits_t done = xEventGroupWaitBits(doneGroup, pending, pdFALSE, pdFALSE, pdMS_TO_TICKS(wait));
+        now = millis();
+
+        for (uint8_t i = 0; i < count; i++) {
+            FetchJob& job = jobs[i];
+            if (job.slot < 0) continue;
+
+            EventBits_t bit = slotBit(job.slot);
+            if (done & bit) {
+                job.ok = taskSlots[job.slot].ok;
+                job.durationMs = taskSlots[job.slot].durationMs;
+            } else if (now - job.startedAt >= job.deadlineMs) {
+                // Left running; its result slot is ignored from here on
+                ESP_LOGW(TAG, "%s missed its %u ms deadline, using cached data", job.name, job.deadlineMs);
+                job.timedOut = true;
+                job.durationMs = now - job.startedAt;
+            } else {
+                continue;
+            }
+            pending &= ~bit;
+            job.slot = -1;
+        }
+    }
+
+    ESP_LOGD(TAG, "Waited %u ms in join", millis() - joinStart);
+    logSummary(jobs, count, millis() - firstStart);
+}
+
+#else
+
+void ParallelFetch::start(FetchJob* jobs, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        FetchJob& job = jobs[i];
+        resetResult(job);
+        runInline(job);
+        if (job.durationMs > job.deadlineMs) {
+            ESP_LOGW(TAG, "%s took %u ms (deadline %u ms)", job.name, job.durationMs, job.deadlineMs);
+        }
+    }
+}
+
+void ParallelFetch::join(FetchJob* jobs, uint8_t count) {
+    // Everything already ran in start()
+    uint32_t firstStart = millis();
+    for (uint8_t i = 0; i < count; i++) {
+        if (jobs[i].startedAt < firstStart) firstStart = jobs[i].startedAt;
+    }
+    logSummary(jobs, count, millis() - firstStart);
+}
+
+#endif
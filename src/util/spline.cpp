@@ -0,0 +1,45 @@
+#include "util/spline.h"
+
+// Catmull-Rom at t = s/n, scaled by 2n^3:
+//   2n^3 * P(t) = w0 * p0 + w1 * p1 + w2 * p2 + w3 * p3
+struct BasisWeights {
+    int32_t w0, w1, w2, w3;
+};
+
+static BasisWeights basisWeights(int32_t s, int32_t n) {
+    return {
+        -s * n * n + 2 * s * s * n - s * s * s,
+        2 * n * n * n - 5 * s * s * n + 3 * s * s * s,
+        s * n * n + 4 * s * s * n - 3 * s * s * s,
+        -s * s * n + s * s * s,
+    };
+}
+
+static int16_t sample(const BasisWeights& w, int32_t denominator, int16_t p0, int16_t p1, int16_t p2, int16_t p3) {
+    // Integer division truncates toward zero, as the (int16_t) cast of the float formula did
+    return (w.w0 * p0 + w.w1 * p1 + w.w2 * p2 + w.w3 * p3) / denominator;
+}
+
+void Spline::catmullRom(const int16_t* xs, const int16_t* ys, uint8_t count, uint8_t steps, Polyline& out) {
+    out.count = 0;
+    if (count < 2 || steps == 0 || steps > MAX_STEPS) return;
+    while (count > 1 && (count - 1) * steps + 1 > MAX_POINTS) count--;
+
+    BasisWeights weights[MAX_STEPS];
+    for (uint8_t s = 0; s < steps; s++) weights[s] = basisWeights(s, steps);
+    int32_t denominator = 2 * steps * steps * steps;
+
+    for (uint8_t i = 0; i + 1 < count; i++) {
+        uint8_t i0 = i > 0 ? i - 1 : i;
+        uint8_t i3 = i + 2 < count ? i + 2 : i + 1;
+        for (uint8_t s = 0; s < steps; s++) {
+            out.x[out.count] = sample(weights[s], denominator, xs[i0], xs[i], xs[i + 1], xs[i3]);
+            out.y[out.count] = sample(weights[s], denominator, ys[i0], ys[i], ys[i + 1], ys[i3]);
+            out.count++;
+        }
+    }
+    // At t = 1 the curve is exactly on the last point
+    out.x[out.count] = xs[count - 1];
+    out.y[out.count] = ys[count - 1];
+    out.count++;
+}
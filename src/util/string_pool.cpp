@@ -0,0 +1,95 @@
+#include "util/string_pool.h"
+#include <string.h>
+#include <esp_log.h>
+
+static const char* TAG = "STRING_POOL";
+
+// Offset 0 holds the shared empty string, so zero-initialized references are valid
+char StringPool::arena[ARENA_SIZE] = {0};
+uint16_t StringPool::table[TABLE_SIZE] = {0};
+size_t StringPool::used = 1;
+size_t StringPool::pendingLen = 0;
+bool StringPool::pendingOverflow = false;
+size_t StringPool::count = 0;
+size_t StringPool::hits = 0;
+size_t StringPool::dropped = 0;
+
+void StringPool::begin() {
+    pendingLen = 0;
+    pendingOverflow = false;
+}
+
+bool StringPool::append(char c) {
+    // Keep room for the terminator
+    if (used + pendingLen + 1 >= ARENA_SIZE) {
+        pendingOverflow = true;
+        return false;
+    }
+    arena[used + pendingLen++] = c;
+    return true;
+}
+
+void StringPool::truncatePending(size_t len) {
+    if (len < pendingLen) pendingLen = len;
+}
+
+uint16_t StringPool::commit() {
+    if (pendingOverflow) {
+        if (dropped++ == 0) ESP_LOGW(TAG, "Arena full (%u bytes), dropping strings", static_cast<unsigned>(ARENA_SIZE));
+        return 0;
+    }
+    if (pendingLen == 0) return 0;
+
+    char* str = arena + used;
+    str[pendingLen] = '\0';
+
+    size_t mask = TABLE_SIZE - 1;
+    size_t slot = hash(str, pendingLen) & mask;
+    for (size_t probe = 0; probe < TABLE_SIZE; probe++) {
+        uint16_t ref = table[slot];
+        if (ref == 0) {
+            // New string: keep it where it was built
+            if (count < TABLE_SIZE - 1) table[slot] = static_cast<uint16_t>(used);
+            break;
+        }
+        if (memcmp(arena + ref, str, pendingLen + 1) == 0) {
+            hits++;
+            return ref; // Already interned - the pending copy is simply overwritten later
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    uint16_t ref = static_cast<uint16_t>(used);
+    used += pendingLen + 1;
+    count++;
+    pendingLen = 0;
+    return ref;
+}
+
+uint16_t StringPool::intern(const char* str) {
+    begin();
+    while (*str) append(*str++);
+    return commit();
+}
+
+void StringPool::reset() {
+    ESP_LOGD(TAG, "Releasing %u strings (%u bytes, %u dedup hits)", static_cast<unsigned>(count),
+             static_cast<unsigned>(used), static_cast<unsigned>(hits));
+    memset(table, 0, sizeof(table));
+    used = 1;
+    pendingLen = 0;
+    pendingOverflow = false;
+    count = 0;
+    hits = 0;
+    dropped = 0;
+}
+
+uint32_t StringPool::hash(const char* str, size_t len) {
+    // FNV-1a
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h ^= static_cast<uint8_t>(str[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
@@ -77,7 +77,8 @@ namespace SystemInit {
     }
 
     void initDisplay() {
-        display.init(DisplayConstants::SERIAL_BAUD_RATE, true,
+        // initial = false keeps the controller's previous frame usable for a partial refresh
+        display.init(DisplayConstants::SERIAL_BAUD_RATE, !DisplayManager::panelRetained(),
                      DisplayConstants::RESET_DURATION_MS, false);
         display.setRotation(0);
     }
@@ -4,6 +4,13 @@
 
 static const char* TAG = "TIME_MGR";
 
+// German timezone: CET-1CEST,M3.5.0,M10.5.0/3 means:
+// - CET (Central European Time) is UTC+1
+// - CEST (Central European Summer Time) is UTC+2
+// M3.5.0 = DST starts on month 3 (March), week 5 (last), day 0 (Sunday) at 02:00
+// M10.5.0/3 = DST ends on month 10 (October), week 5 (last), day 0 (Sunday) at 03:00
+static const char* TIMEZONE = "CET-1CEST,M3.5.0,M10.5.0/3";
+
 String TimeManager::getGermanDateTimeString() {
     tm timeinfo;
     if (!getCurrentLocalTime(timeinfo)) {
@@ -45,14 +52,7 @@ bool TimeManager::getCurrentLocalTime(tm& timeinfo) {
     }
 
     // Always ensure timezone is set before getting local time
-    // This is necessary because TZ environment may not persist across deep sleep
-    // German timezone: CET-1CEST,M3.5.0,M10.5.0/3 means:
-    // - CET (Central European Time) is UTC+1
-    // - CEST (Central European Summer Time) is UTC+2
-    // M3.5.0 = DST starts on month 3 (March), week 5 (last), day 0 (Sunday) at 02:00
-    // M10.5.0/3 = DST ends on month 10 (October), week 5 (last), day 0 (Sunday) at 03:00
-    setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
-    tzset();
+    applyTimezone();
 
     time_t now = time(nullptr);
     localtime_r(&now, &timeinfo);
@@ -66,6 +66,12 @@ bool TimeManager::getCurrentLocalTime(tm& timeinfo) {
     return true;
 }
 
+void TimeManager::applyTimezone() {
+    // This is necessary because TZ environment may not persist across deep sleep
+    setenv("TZ", TIMEZONE, 1);
+    tzset();
+}
+
 // ===== ENHANCED TIME MANAGEMENT FOR DEEP SLEEP OPTIMIZATION =====
 
 // RTC variables to persist across deep sleep
@@ -128,7 +134,7 @@ bool TimeManager::setupNTPTimeWithRetry(int maxRetries) {
 
         // For ESP32, use configTzTime instead of configTime + setenv
         // German timezone: UTC+1 (CET) in winter, UTC+2 (CEST) in summer
-        configTzTime("CET-1CEST,M3.5.0,M10.5.0/3", "pool.ntp.org", "time.nist.gov");
+        configTzTime(TIMEZONE, "pool.ntp.org", "time.nist.gov");
 
         // Wait for sync with shorter timeout per attempt
         time_t now = time(nullptr);
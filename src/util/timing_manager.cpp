@@ -11,6 +11,8 @@
 #endif
 #include <time.h>
 #include "config/config_manager.h"
+#include "util/energy_policy.h"
+#include "util/wake_schedule.h"
 
 static const char* TAG = "TIMING_MGR";
 
@@ -18,15 +20,26 @@ static const char* TAG = "TIMING_MGR";
 RTC_DATA_ATTR uint32_t lastWeatherUpdate = 0;
 RTC_DATA_ATTR uint32_t lastTransportUpdate = 0;
 RTC_DATA_ATTR uint32_t lastOTACheck = 0;
+RTC_DATA_ATTR uint32_t nextDepartureChange = 0;
+RTC_DATA_ATTR uint16_t intervalStretch = 100; // Percent, set by the battery's energy plan
+RTC_DATA_ATTR WakeSchedule wakeSchedule = {}; // Config time windows, compiled when the config changes
 
 // ============================================================================
 // Device Jitter — deterministic per-device offset to spread API requests
 // ============================================================================
 
+#ifdef NATIVE_TEST
+static uint32_t nativeJitterSeed = 0xDEADBEEF;
+
+void TimingManager::setDeviceJitterSeed(uint32_t seed) {
+    nativeJitterSeed = seed;
+}
+#endif
+
 uint32_t TimingManager::getDeviceJitterSeed() {
 #ifdef NATIVE_TEST
-    // Fixed seed for reproducible test results
-    return 0xDEADBEEF;
+    // Fixed seed for reproducible test results; the fleet simulation varies it per device
+    return nativeJitterSeed;
 #else
     uint8_t mac[6];
     esp_efuse_mac_get_default(mac);
@@ -40,10 +53,22 @@ uint32_t TimingManager::getDeviceJitterSeed() {
 // ============================================================================
 
 
+uint32_t TimingManager::weatherIntervalSeconds() {
+    RTCConfigData& config = ConfigManager::getConfig();
+    return EnergyPolicy::stretchInterval(config.weatherInterval * 3600, config.maxWeatherInterval * 3600,
+                                         intervalStretch);
+}
+
+uint32_t TimingManager::transportIntervalSeconds() {
+    RTCConfigData& config = ConfigManager::getConfig();
+    return EnergyPolicy::stretchInterval(config.transportInterval * 60, config.maxTransportInterval * 60,
+                                         intervalStretch);
+}
+
 uint32_t TimingManager::calculateNextWeatherUpdate(uint32_t currentTimeSeconds) {
     RTCConfigData& config = ConfigManager::getConfig();
     uint32_t lastUpdate = getLastWeatherUpdate();
-    uint32_t intervalSeconds = config.weatherInterval * 3600; // hours to seconds
+    uint32_t intervalSeconds = weatherIntervalSeconds();
 
     uint32_t nextUpdate = (lastUpdate == 0) ? currentTimeSeconds : lastUpdate + intervalSeconds;
 
@@ -53,8 +78,12 @@ uint32_t TimingManager::calculateNextWeatherUpdate(uint32_t currentTimeSeconds)
         nextUpdate = currentTimeSeconds;
     }
 
-    ESP_LOGI(TAG, "Weather interval: %u hours (%u seconds), Next weather update: %u",
-             config.weatherInterval, intervalSeconds, nextUpdate);
+    // The stretch never pushes the interval past maxWeatherInterval; say so when it would have
+    ESP_LOGI(TAG, "Weather interval: %u hours configured, %u%% stretch, %u seconds%s, Next weather update: %u",
+             config.weatherInterval, intervalStretch, intervalSeconds,
+             (uint64_t)config.weatherInterval * 3600 * intervalStretch / 100 > intervalSeconds
+                 ? " (capped at maxWeatherInterval)" : "",
+             nextUpdate);
 
     return nextUpdate;
 }
@@ -62,108 +91,62 @@ uint32_t TimingManager::calculateNextWeatherUpdate(uint32_t currentTimeSeconds)
 uint32_t TimingManager::calculateNextTransportUpdate(uint32_t currentTimeSeconds) {
     RTCConfigData& config = ConfigManager::getConfig();
     uint32_t lastUpdate = getLastTransportUpdate();
-    uint32_t intervalSeconds = config.transportInterval * 60; // minutes to seconds
+    uint32_t intervalSeconds = transportIntervalSeconds();
 
     uint32_t nextUpdate = (lastUpdate == 0) ? currentTimeSeconds + intervalSeconds : lastUpdate + intervalSeconds;
 
+    // Departure-aware: the board shows the same list until its first departure can no longer be
+    // reached, so a fetch before that only picks up delays. Wait for the change, bounded by staleness.
+    if (lastUpdate != 0 && nextDepartureChange > lastUpdate) {
+        uint32_t staleAt = lastUpdate + MAX_DEPARTURE_STALENESS_SECONDS;
+        uint32_t departureWake = nextDepartureChange < staleAt ? nextDepartureChange : staleAt;
+        if (departureWake > nextUpdate) {
+            ESP_LOGI(TAG, "Shown departures unchanged until %u - deferring transport update from %u to %u",
+                     nextDepartureChange, nextUpdate, departureWake);
+            nextUpdate = departureWake;
+        }
+    }
+
     // If update is overdue (in the past), return current time for immediate update
     if (nextUpdate < currentTimeSeconds) {
         ESP_LOGI(TAG, "Transport update overdue - next update: NOW (was scheduled for: %u)", nextUpdate);
         nextUpdate = currentTimeSeconds;
     }
 
-    ESP_LOGI(TAG, "Departure interval: %u minutes (%u seconds), Next departure update: %u",
-             config.transportInterval, intervalSeconds, nextUpdate);
+    ESP_LOGI(TAG, "Departure interval: %u minutes configured, %u%% stretch, %u seconds%s, Next departure update: %u",
+             config.transportInterval, intervalStretch, intervalSeconds,
+             (uint64_t)config.transportInterval * 60 * intervalStretch / 100 > intervalSeconds
+                 ? " (capped at maxTransportInterval)" : "",
+             nextUpdate);
 
     return nextUpdate;
 }
 
 bool TimingManager::isTransportActiveAtTime(uint32_t timestamp) {
-    RTCConfigData& config = ConfigManager::getConfig();
-
-    tm timeInfo;
-    time_t time = (time_t)timestamp;
-    localtime_r(&time, &timeInfo);
-
-    bool weekend = isWeekend(timestamp);
-
-    String start = weekend ? String(config.weekendTransportStart) : String(config.transportActiveStart);
-    String end = weekend ? String(config.weekendTransportEnd) : String(config.transportActiveEnd);
-
-    int minutes = timeInfo.tm_hour * 60 + timeInfo.tm_min;
-    int startMin = parseTimeString(start);
-    int endMin = parseTimeString(end);
-
-    bool isActive = isTimeInRange(minutes, startMin, endMin);
-
-    // Special case: boundary check - treat end boundary as inactive if no previous update
-    if (isActive && minutes == endMin && getLastTransportUpdate() == 0) {
-        ESP_LOGD(TAG, "At end boundary of active hours with no previous update - treating as inactive");
-        return false;
-    }
-
-    return isActive;
+    WakeSchedule& plan = schedule();
+    return WakeScheduler::isTransportActive(plan, WakeScheduler::minuteOfWeek(plan, timestamp));
 }
 
 uint32_t TimingManager::calculateNextActiveTransportTime(uint32_t currentTime) {
-    RTCConfigData& config = ConfigManager::getConfig();
-
-    tm currentTm;
-    time_t now = (time_t)currentTime;
-    localtime_r(&now, &currentTm);
-
-    int currentMin = currentTm.tm_hour * 60 + currentTm.tm_min;
-    bool isCurrentWeekend = config.weekendMode && (currentTm.tm_wday == 0 || currentTm.tm_wday == 6);
-
-    String start = isCurrentWeekend ? String(config.weekendTransportStart) : String(config.transportActiveStart);
-    int startMin = parseTimeString(start);
-
-    uint32_t nextActiveTime;
-
-    if (currentMin < startMin) {
-        // Active period starts later today
-        int minutesUntil = startMin - currentMin;
-        nextActiveTime = currentTime + (minutesUntil * 60);
-        ESP_LOGD(TAG, "Transport active starts in %d minutes", minutesUntil);
-    } else {
-        // Active period starts tomorrow
-        int minutesToMidnight = (24 * 60) - currentMin;
-
-        // Check if tomorrow is weekend
-        int nextDayOfWeek = (currentTm.tm_wday + 1) % 7;
-        bool isTomorrowWeekend = config.weekendMode && (nextDayOfWeek == 0 || nextDayOfWeek == 6);
-        String tomorrowStart = isTomorrowWeekend
-                                   ? String(config.weekendTransportStart)
-                                   : String(config.transportActiveStart);
-        int tomorrowStartMin = parseTimeString(tomorrowStart);
-
-        nextActiveTime = currentTime + ((minutesToMidnight + tomorrowStartMin) * 60);
-        ESP_LOGD(TAG, "Transport active starts tomorrow at %02d:%02d", tomorrowStartMin / 60, tomorrowStartMin % 60);
-    }
-
-    ESP_LOGI(TAG, "Next transport active time: %u", nextActiveTime);
+    WakeSchedule& plan = schedule();
+    uint16_t currentMinute = WakeScheduler::minuteOfWeek(plan, currentTime);
+    uint16_t minutesUntil = WakeScheduler::minutesUntilTransportStart(plan, currentMinute);
+    uint32_t nextActiveTime = currentTime + minutesUntil * 60;
+    ESP_LOGI(TAG, "Next transport active time: %u (in %u minutes)", nextActiveTime, minutesUntil);
     return nextActiveTime;
 }
 
 uint32_t TimingManager::adjustForDeepSleepPeriod(uint32_t nearestUpdate, bool isOTAUpdate) {
-    RTCConfigData& config = ConfigManager::getConfig();
-
-    // Get update time info
-    tm updateTimeInfo;
-    time_t updateTime = (time_t)nearestUpdate;
-    localtime_r(&updateTime, &updateTimeInfo);
-    uint16_t updateMinutes = updateTimeInfo.tm_hour * 60 + updateTimeInfo.tm_min;
-
-    uint16_t sleepStartMin = getSleepStartMin();
-    uint16_t sleepEndMin = getSleepEndMin();
+    WakeSchedule& plan = schedule();
+    uint16_t updateMinute = WakeScheduler::minuteOfWeek(plan, nearestUpdate);
 
     // Check if update is in sleep period
-    if (!isInDeepSleepPeriod(nearestUpdate)) {
+    if (!WakeScheduler::isInSleep(plan, updateMinute)) {
         return nearestUpdate; // Not in sleep period
     }
 
-    ESP_LOGI(TAG, "Next update (%d:%02d) falls within sleep period (%d - %d)",
-             updateTimeInfo.tm_hour, updateTimeInfo.tm_min, sleepStartMin, sleepEndMin);
+    uint16_t minuteOfDay = updateMinute % WakeScheduler::MINUTES_PER_DAY;
+    ESP_LOGI(TAG, "Next update (%d:%02d) falls within sleep period", minuteOfDay / 60, minuteOfDay % 60);
 
     // OTA updates bypass sleep period
     if (isOTAUpdate) {
@@ -171,41 +154,8 @@ uint32_t TimingManager::adjustForDeepSleepPeriod(uint32_t nearestUpdate, bool is
         return nearestUpdate;
     }
 
-    // Calculate sleep end time
-    uint32_t sleepEndSeconds;
-    if (sleepEndMin > updateMinutes) {
-        sleepEndSeconds = nearestUpdate + ((sleepEndMin - updateMinutes) * 60);
-    } else {
-        int minutesUntilNextDay = (24 * 60) - updateMinutes;
-        sleepEndSeconds = nearestUpdate + ((minutesUntilNextDay + sleepEndMin) * 60);
-    }
-
-    // Check if sleep crosses weekend boundary
-    tm sleepEndTimeInfo;
-    time_t sleepEndTime = (time_t)sleepEndSeconds;
-    localtime_r(&sleepEndTime, &sleepEndTimeInfo);
-
-    // Determine if update time is weekend
-    bool isUpdateWeekend = isWeekend(updateTime);
-    bool isSleepEndWeekend = isWeekend(sleepEndTime);
-
-    if (isSleepEndWeekend != isUpdateWeekend) {
-        ESP_LOGI(TAG, "Sleep crosses weekend boundary - adjusting sleep end time");
-
-        String correctSleepEnd = isSleepEndWeekend ? String(config.weekendSleepEnd) : String(config.sleepEnd);
-        int correctSleepEndMin = parseTimeString(correctSleepEnd);
-
-        if (correctSleepEndMin > updateMinutes) {
-            sleepEndSeconds = nearestUpdate + ((correctSleepEndMin - updateMinutes) * 60);
-        } else {
-            int minutesUntilNextDay = (24 * 60) - updateMinutes;
-            sleepEndSeconds = nearestUpdate + ((minutesUntilNextDay + correctSleepEndMin) * 60);
-        }
-
-        ESP_LOGI(TAG, "Adjusted sleep end to %s time: %u seconds",
-                 isSleepEndWeekend ? "weekend" : "weekday", sleepEndSeconds);
-    }
-
+    // The night ends by the sleep end of the day it ends on, weekday or weekend
+    uint32_t sleepEndSeconds = nearestUpdate + WakeScheduler::minutesUntilSleepEnd(plan, updateMinute) * 60;
     ESP_LOGI(TAG, "Final wake time: %u seconds", sleepEndSeconds);
     return sleepEndSeconds;
 }
@@ -241,13 +191,11 @@ uint64_t TimingManager::getNextSleepDurationSeconds() {
         const int TEMP_MODE_DURATION = 120; // 2 minutes
         int remaining = TEMP_MODE_DURATION - elapsed;
 
-        if (isInDeepSleepPeriod()) {
+        WakeSchedule& plan = schedule();
+        uint16_t currentMinute = WakeScheduler::minuteOfWeek(plan, currentTime);
+        uint16_t minutesUntilEnd = WakeScheduler::minutesUntilSleepEnd(plan, currentMinute);
+        if (minutesUntilEnd > 0) {
             // In sleep window → sleep until sleep window ends
-            int currentMin = getCurrentMin();
-            int sleepEndMin = getSleepEndMin();
-            int minutesUntilEnd = (sleepEndMin > currentMin)
-                ? (sleepEndMin - currentMin)
-                : ((24 * 60) - currentMin + sleepEndMin);
             return (uint64_t)max((int)MINIMUM_SLEEP_SECONDS, minutesUntilEnd * 60);
         }
 
@@ -355,69 +303,33 @@ uint64_t TimingManager::getNextSleepDurationSeconds() {
 }
 
 bool TimingManager::isTransportActiveTime() {
-    int currentMinutes = getCurrentMin();
-
-    String activeStart, activeEnd;
-    if (isWeekend()) {
-        activeStart = ConfigManager::getWeekendTransportStart();
-        activeEnd = ConfigManager::getWeekendTransportEnd();
-    } else {
-        activeStart = ConfigManager::getTransportActiveStart();
-        activeEnd = ConfigManager::getTransportActiveEnd();
-    }
-
-    int startMinutes = parseTimeString(activeStart);
-    int endMinutes = parseTimeString(activeEnd);
-
-    return isTimeInRange(currentMinutes, startMinutes, endMinutes);
-}
-
-uint16_t TimingManager::getCurrentMin() {
-    time_t now = GET_CURRENT_TIME();
-    tm timeInfo;
-    localtime_r(&now, &timeInfo);
-    return timeInfo.tm_hour * 60 + timeInfo.tm_min;
+    return isTransportActiveAtTime((uint32_t)GET_CURRENT_TIME());
 }
 
-uint16_t TimingManager::getSleepStartMin() {
-    RTCConfigData& config = ConfigManager::getConfig();
-    String sleepStart = isWeekend() ? String(config.weekendSleepStart) : String(config.sleepStart);
-    return parseTimeString(sleepStart);
-}
-
-uint16_t TimingManager::getSleepEndMin() {
+bool TimingManager::isWeekend() {
     RTCConfigData& config = ConfigManager::getConfig();
-    String sleepEnd = isWeekend() ? String(config.weekendSleepEnd) : String(config.sleepEnd);
-    return parseTimeString(sleepEnd);
-}
-
-bool TimingManager::isInDeepSleepPeriod() {
-    return isTimeInRange(getCurrentMin(), getSleepStartMin(), getSleepEndMin());
-}
-
+    if (!config.weekendMode) {
+        return false;
+    }
+    WakeSchedule& plan = schedule();
+    uint8_t day = WakeScheduler::minuteOfWeek(plan, (uint32_t)GET_CURRENT_TIME()) / WakeScheduler::MINUTES_PER_DAY;
 
-bool TimingManager::isInDeepSleepPeriod(uint32_t timestamp) {
-    tm timeInfo;
-    time_t time = (time_t)timestamp;
-    localtime_r(&time, &timeInfo);
-    uint32_t updateMinutes = timeInfo.tm_hour * 60 + timeInfo.tm_min;
-    return isTimeInRange(updateMinutes, getSleepStartMin(), getSleepEndMin());
+    // 0 = Sunday, 6 = Saturday
+    return day == 0 || day == 6;
 }
 
-bool TimingManager::isWeekend() {
-    return isWeekend(GET_CURRENT_TIME());
+void TimingManager::compileSchedule() {
+    WakeScheduler::compile(wakeSchedule, ConfigManager::getConfig());
+    ESP_LOGI(TAG, "Wake schedule compiled: %u active and %u sleep windows a week", wakeSchedule.activeCount,
+             wakeSchedule.sleepCount);
 }
 
-bool TimingManager::isWeekend(time_t timestamp) {
-    RTCConfigData& config = ConfigManager::getConfig();
-    if (!config.weekendMode) {
-        return false;
+WakeSchedule& TimingManager::schedule() {
+    // Config fields may be changed without a save (tests, the temporary mode), so check the source
+    if (wakeSchedule.fingerprint != WakeScheduler::fingerprint(ConfigManager::getConfig())) {
+        compileSchedule();
     }
-    tm timeInfo;
-    localtime_r(&timestamp, &timeInfo);
-
-    // tm_wday: 0 = Sunday, 6 = Saturday
-    return (timeInfo.tm_wday == 0 || timeInfo.tm_wday == 6);
+    return wakeSchedule;
 }
 
 void TimingManager::markWeatherUpdated() {
@@ -445,7 +357,7 @@ bool TimingManager::isTimeForWeatherUpdate() {
     uint32_t currentTime = (uint32_t)now;
 
     uint8_t tolerance = 20; // seconds
-    uint32_t intervalSeconds = config.weatherInterval * 3600 - tolerance; // Convert hours to seconds
+    uint32_t intervalSeconds = weatherIntervalSeconds() - tolerance;
     bool needUpdate = (currentTime - lastUpdate) > intervalSeconds;
 
     ESP_LOGI(TAG, "Weather: last=%u, now=%u, interval=%u hours, need_update=%s",
@@ -487,18 +399,6 @@ int TimingManager::parseTimeString(const String& timeStr) {
     return hours * 60 + minutes;
 }
 
-bool TimingManager::isTimeInRange(uint32_t currentMinutes, uint32_t startMinutes, uint32_t endMinutes) {
-    if (startMinutes <= endMinutes) {
-        // Same day range (e.g., 06:00 to 22:00)
-        // Use < instead of <= for end to exclude boundary
-        return currentMinutes >= startMinutes && currentMinutes < endMinutes;
-    } else {
-        // Overnight range (e.g., 22:30 to 05:30)
-        // currentMinutes >= 22:30 OR currentMinutes < 05:30 (not <=)
-        return currentMinutes >= startMinutes || currentMinutes < endMinutes;
-    }
-}
-
 uint32_t TimingManager::getLastWeatherUpdate() {
     return lastWeatherUpdate;
 }
@@ -515,6 +415,52 @@ void TimingManager::setLastTransportUpdate(uint32_t timestamp) {
     lastTransportUpdate = timestamp;
 }
 
+void TimingManager::setIntervalStretch(uint16_t percent) {
+    intervalStretch = percent < 100 ? 100 : percent;
+}
+
+uint16_t TimingManager::getIntervalStretch() {
+    return intervalStretch;
+}
+
+void TimingManager::setNextDepartureChange(uint32_t timestamp) {
+    nextDepartureChange = timestamp;
+}
+
+uint32_t TimingManager::getNextDepartureChange() {
+    return nextDepartureChange;
+}
+
+uint32_t TimingManager::departureTimestamp(const String& clock, uint32_t now) {
+    int colonPos = clock.indexOf(':');
+    if (colonPos == -1) return 0;
+    int seconds = parseTimeString(clock) * 60;
+    int secondColon = clock.indexOf(':', colonPos + 1);
+    if (secondColon != -1) seconds += clock.substring(secondColon + 1).toInt();
+
+    tm timeInfo;
+    time_t current = (time_t)now;
+    localtime_r(&current, &timeInfo);
+    timeInfo.tm_hour = seconds / 3600;
+    timeInfo.tm_min = (seconds / 60) % 60;
+    timeInfo.tm_sec = seconds % 60;
+    timeInfo.tm_isdst = -1;
+
+    // Departures are listed from now on: a clock time far in the past is tomorrow's
+    // (after midnight), one far in the future was yesterday's
+    const int halfDay = 12 * 3600;
+    time_t departure = mktime(&timeInfo);
+    if (departure + halfDay < current) {
+        timeInfo.tm_mday++;
+    } else if (departure - halfDay > current) {
+        timeInfo.tm_mday--;
+    } else {
+        return (uint32_t)departure;
+    }
+    timeInfo.tm_isdst = -1;
+    return (uint32_t)mktime(&timeInfo);
+}
+
 uint32_t TimingManager::getLastOTACheck() {
     return lastOTACheck;
 }
@@ -538,32 +484,13 @@ uint32_t TimingManager::calculateNextOTACheckTime(uint32_t currentTimeSeconds) {
         return 0; // Skip OTA check
     }
 
-    // Parse configured OTA check time (format: "HH:MM")
-    int otaCheckMinutes = parseTimeString(String(config.otaCheckTime));
-
-    // Get current time info
-    time_t currentTime = (time_t)currentTimeSeconds;
-    tm currentTm;
-    localtime_r(&currentTime, &currentTm);
-    int currentMinutes = currentTm.tm_hour * 60 + currentTm.tm_min;
-
-    // Calculate next OTA check time
-    uint32_t nextOTACheckSeconds = 0;
-
-    if (currentMinutes < otaCheckMinutes) {
-        // OTA check time is later today
-        int minutesUntilOTA = otaCheckMinutes - currentMinutes;
-        nextOTACheckSeconds = currentTimeSeconds + (minutesUntilOTA * 60);
-        ESP_LOGD(TAG, "Next OTA check is later today in %d minutes at %02d:%02d",
-                 minutesUntilOTA, otaCheckMinutes / 60, otaCheckMinutes % 60);
-    } else {
-        // OTA check time is tomorrow
-        int minutesUntilMidnight = (24 * 60) - currentMinutes;
-        int minutesUntilOTA = minutesUntilMidnight + otaCheckMinutes;
-        nextOTACheckSeconds = currentTimeSeconds + (minutesUntilOTA * 60);
-        ESP_LOGD(TAG, "Next OTA check is tomorrow in %d minutes at %02d:%02d",
-                 minutesUntilOTA, otaCheckMinutes / 60, otaCheckMinutes % 60);
-    }
+    // Configured OTA check time, later today or tomorrow
+    WakeSchedule& plan = schedule();
+    uint16_t currentMinute = WakeScheduler::minuteOfWeek(plan, currentTimeSeconds);
+    uint16_t minutesUntilOTA = WakeScheduler::minutesUntilOTACheck(plan, currentMinute);
+    uint32_t nextOTACheckSeconds = currentTimeSeconds + minutesUntilOTA * 60;
+    ESP_LOGD(TAG, "Next OTA check in %u minutes at %02u:%02u", minutesUntilOTA, plan.otaMinute / 60,
+             plan.otaMinute % 60);
 
     ESP_LOGI(TAG, "Next OTA check scheduled at: %u seconds", nextOTACheckSeconds);
     return nextOTACheckSeconds;
@@ -0,0 +1,209 @@
+#include "util/wake_schedule.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "config/config_manager.h"
+#ifdef NATIVE_TEST
+#include "time_manager.h"
+#else
+#include "util/time_manager.h"
+#endif
+
+// A DST rule never changes the offset twice within this span
+static const uint32_t OFFSET_PROBE_SECONDS = 8 * 24 * 3600;
+
+static uint32_t hashBytes(uint32_t hash, const void* data, size_t length) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u; // FNV-1a
+    }
+    return hash;
+}
+
+static uint32_t hashString(uint32_t hash, const char* text) {
+    return hashBytes(hash, text, strlen(text) + 1);
+}
+
+static bool isWeekendDay(const RTCConfigData& config, uint8_t day) {
+    return config.weekendMode && (day == 0 || day == 6);
+}
+
+static uint16_t clampToDay(uint16_t minutes) {
+    return minutes > WakeScheduler::MINUTES_PER_DAY ? WakeScheduler::MINUTES_PER_DAY : minutes;
+}
+
+uint32_t WakeScheduler::fingerprint(const RTCConfigData& config) {
+    uint32_t hash = 2166136261u;
+    hash = hashBytes(hash, &config.weekendMode, sizeof(config.weekendMode));
+    hash = hashString(hash, config.transportActiveStart);
+    hash = hashString(hash, config.transportActiveEnd);
+    hash = hashString(hash, config.weekendTransportStart);
+    hash = hashString(hash, config.weekendTransportEnd);
+    hash = hashString(hash, config.sleepStart);
+    hash = hashString(hash, config.sleepEnd);
+    hash = hashString(hash, config.weekendSleepStart);
+    hash = hashString(hash, config.weekendSleepEnd);
+    hash = hashString(hash, config.otaCheckTime);
+    return hash != 0 ? hash : 1;
+}
+
+void WakeScheduler::compile(WakeSchedule& schedule, const RTCConfigData& config) {
+    memset(&schedule, 0, sizeof(schedule));
+    for (uint8_t day = 0; day < 7; day++) {
+        bool weekend = isWeekendDay(config, day);
+        uint16_t activeStart = clampToDay(parseClock(weekend ? config.weekendTransportStart
+                                                             : config.transportActiveStart));
+        uint16_t activeEnd = clampToDay(parseClock(weekend ? config.weekendTransportEnd : config.transportActiveEnd));
+        uint16_t sleepStart = clampToDay(parseClock(weekend ? config.weekendSleepStart : config.sleepStart));
+        uint16_t sleepEnd = clampToDay(parseClock(weekend ? config.weekendSleepEnd : config.sleepEnd));
+
+        schedule.activeCount = addWindow(schedule.active, schedule.activeCount, day, activeStart, activeEnd);
+        schedule.sleepCount = addWindow(schedule.sleep, schedule.sleepCount, day, sleepStart, sleepEnd);
+        schedule.transportStart[day] = activeStart;
+    }
+    schedule.activeCount = sortAndMerge(schedule.active, schedule.activeCount);
+    schedule.sleepCount = sortAndMerge(schedule.sleep, schedule.sleepCount);
+    schedule.otaMinute = clampToDay(parseClock(config.otaCheckTime));
+    schedule.fingerprint = fingerprint(config);
+}
+
+uint16_t WakeScheduler::minuteOfWeek(WakeSchedule& schedule, uint32_t timestamp) {
+    if (timestamp < schedule.offsetFrom || timestamp >= schedule.offsetUntil) {
+        // The offset is kept across deep sleep, so it must not be taken while TZ is still unset (UTC)
+        TimeManager::applyTimezone();
+
+        // Find how long the offset holds: it changes at most once before the probe
+        int32_t offset = utcOffsetAt(timestamp);
+        uint32_t low = timestamp;
+        uint32_t high = timestamp + OFFSET_PROBE_SECONDS;
+        if (utcOffsetAt(high) != offset) {
+            while (high - low > 1) {
+                uint32_t middle = low + (high - low) / 2;
+                if (utcOffsetAt(middle) == offset) {
+                    low = middle;
+                } else {
+                    high = middle;
+                }
+            }
+        }
+        schedule.utcOffset = offset;
+        schedule.offsetFrom = timestamp;
+        schedule.offsetUntil = high;
+    }
+
+    int64_t local = (int64_t)timestamp + schedule.utcOffset;
+    int64_t days = local / 86400;
+    uint8_t weekday = (uint8_t)((days + 4) % 7); // 1970-01-01 was a Thursday
+    uint16_t minuteOfDay = (uint16_t)((local % 86400) / 60);
+    return weekday * MINUTES_PER_DAY + minuteOfDay;
+}
+
+bool WakeScheduler::isTransportActive(const WakeSchedule& schedule, uint16_t minuteOfWeek) {
+    return find(schedule.active, schedule.activeCount, minuteOfWeek) != nullptr;
+}
+
+bool WakeScheduler::isInSleep(const WakeSchedule& schedule, uint16_t minuteOfWeek) {
+    return find(schedule.sleep, schedule.sleepCount, minuteOfWeek) != nullptr;
+}
+
+uint16_t WakeScheduler::minutesUntilSleepEnd(const WakeSchedule& schedule, uint16_t minuteOfWeek) {
+    const MinuteInterval* night = find(schedule.sleep, schedule.sleepCount, minuteOfWeek);
+    if (!night) return 0;
+    uint16_t minute = minuteOfWeek >= night->start ? minuteOfWeek : minuteOfWeek + MINUTES_PER_WEEK;
+    return night->end - minute;
+}
+
+uint16_t WakeScheduler::minutesUntilTransportStart(const WakeSchedule& schedule, uint16_t minuteOfWeek) {
+    uint8_t day = minuteOfWeek / MINUTES_PER_DAY;
+    uint16_t minute = minuteOfWeek % MINUTES_PER_DAY;
+    if (minute < schedule.transportStart[day]) {
+        return schedule.transportStart[day] - minute;
+    }
+    return MINUTES_PER_DAY - minute + schedule.transportStart[(day + 1) % 7];
+}
+
+uint16_t WakeScheduler::minutesUntilOTACheck(const WakeSchedule& schedule, uint16_t minuteOfWeek) {
+    uint16_t minute = minuteOfWeek % MINUTES_PER_DAY;
+    if (minute < schedule.otaMinute) {
+        return schedule.otaMinute - minute;
+    }
+    return MINUTES_PER_DAY - minute + schedule.otaMinute;
+}
+
+uint16_t WakeScheduler::parseClock(const char* clock) {
+    const char* colon = strchr(clock, ':');
+    if (!colon) return 0;
+    int minutes = atoi(clock) * 60 + atoi(colon + 1);
+    return minutes > 0 ? (uint16_t)minutes : 0;
+}
+
+uint8_t WakeScheduler::addWindow(MinuteInterval* intervals, uint8_t count, uint8_t day, uint16_t start,
+                                 uint16_t end) {
+    uint16_t base = day * MINUTES_PER_DAY;
+    if (start < end) {
+        intervals[count++] = {(uint16_t)(base + start), (uint16_t)(base + end)};
+    } else if (start > end) {
+        // Evening and morning of the same day
+        intervals[count++] = {(uint16_t)(base + start), (uint16_t)(base + MINUTES_PER_DAY)};
+        if (end > 0) intervals[count++] = {base, (uint16_t)(base + end)};
+    }
+    return count;
+}
+
+uint8_t WakeScheduler::sortAndMerge(MinuteInterval* intervals, uint8_t count) {
+    // Insertion sort: at most MAX_INTERVALS entries
+    for (uint8_t i = 1; i < count; i++) {
+        MinuteInterval current = intervals[i];
+        uint8_t j = i;
+        while (j > 0 && intervals[j - 1].start > current.start) {
+            intervals[j] = intervals[j - 1];
+            j--;
+        }
+        intervals[j] = current;
+    }
+
+    uint8_t merged = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (merged > 0 && intervals[i].start <= intervals[merged - 1].end) {
+            if (intervals[i].end > intervals[merged - 1].end) intervals[merged - 1].end = intervals[i].end;
+        } else {
+            intervals[merged++] = intervals[i];
+        }
+    }
+
+    // Saturday night runs into Sunday morning
+    if (merged > 1 && intervals[merged - 1].end == MINUTES_PER_WEEK && intervals[0].start == 0) {
+        intervals[merged - 1].end = MINUTES_PER_WEEK + intervals[0].end;
+        for (uint8_t i = 1; i < merged; i++) intervals[i - 1] = intervals[i];
+        merged--;
+    }
+    return merged;
+}
+
+const MinuteInterval* WakeScheduler::find(const MinuteInterval* intervals, uint8_t count, uint16_t minuteOfWeek) {
+    for (uint8_t i = 0; i < count; i++) {
+        const MinuteInterval& interval = intervals[i];
+        if (minuteOfWeek >= interval.start && minuteOfWeek < interval.end) return &interval;
+        uint16_t nextWeek = minuteOfWeek + MINUTES_PER_WEEK;
+        if (nextWeek >= interval.start && nextWeek < interval.end) return &interval;
+    }
+    return nullptr;
+}
+
+int32_t WakeScheduler::utcOffsetAt(uint32_t timestamp) {
+    tm local;
+    time_t time = (time_t)timestamp;
+    localtime_r(&time, &local);
+
+    // Days since 1970-01-01 of the local date (civil calendar)
+    int year = local.tm_year + 1900 - (local.tm_mon < 2 ? 1 : 0);
+    int era = (year >= 0 ? year : year - 399) / 400;
+    int yearOfEra = year - era * 400;
+    int month = local.tm_mon + 1;
+    int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + local.tm_mday - 1;
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    int64_t days = (int64_t)era * 146097 + dayOfEra - 719468;
+
+    int64_t localSeconds = days * 86400 + local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec;
+    return (int32_t)(localSeconds - (int64_t)timestamp);
+}
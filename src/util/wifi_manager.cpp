@@ -1,11 +1,30 @@
 #include "util/wifi_manager.h"
 #include "config/config_manager.h"
 #include "util/util.h"
+#include <esp_wifi.h>
 
 static const char* TAG = "WIFI_MGR";
 
 // RTC variables to persist WiFi state across deep sleep
-
+// Last good association and DHCP lease, used to skip the channel scan and DHCP on the next wake
+struct FastConnectInfo {
+    bool valid;
+    char ssid[33];
+    uint8_t bssid[6];
+    int32_t channel;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns1;
+    uint32_t dns2;
+    uint8_t wakesSinceFull;
+};
+
+RTC_DATA_ATTR static FastConnectInfo fastConnect = {};
+RTC_DATA_ATTR static uint32_t fastConnects = 0;
+RTC_DATA_ATTR static uint32_t fastConnectMsTotal = 0;
+RTC_DATA_ATTR static uint32_t fullConnects = 0;
+RTC_DATA_ATTR static uint32_t fullConnectMsTotal = 0;
 
 void MyWiFiManager::reconnectWiFi() {
     if (WiFi.status() == WL_CONNECTED) {
@@ -13,24 +32,112 @@ void MyWiFiManager::reconnectWiFi() {
         return; // Already connected
     }
 
-    WiFi.begin();
+    // Credentials stored by WiFiManager during setup
+    WiFi.mode(WIFI_STA);
+    wifi_config_t saved = {};
+    esp_wifi_get_config(WIFI_IF_STA, &saved);
 
-    int attempts = 0;
-    const int max_attempts = FULL_CONNECT_TIMEOUT_MS / 500;
+    bool cacheUsable = fastConnect.valid && fastConnect.wakesSinceFull < FULL_CONNECT_EVERY_N_WAKES &&
+        strncmp(fastConnect.ssid, reinterpret_cast<const char*>(saved.sta.ssid), sizeof(fastConnect.ssid)) == 0;
 
-    while (WiFi.status() != WL_CONNECTED && attempts < max_attempts) {
-        delay(500);
-        ESP_LOGD(TAG, "Full scan connecting... attempt %d/%d", attempts + 1, max_attempts);
-        attempts++;
+    if (cacheUsable && connectFast(saved)) {
+        fastConnect.wakesSinceFull++;
+        return;
     }
 
-    if (WiFi.status() == WL_CONNECTED) {
-        ESP_LOGI(TAG, "WiFi reconnected successfully via full scan!");
-        ESP_LOGI(TAG, "IP address: %s", WiFi.localIP().toString().c_str());
-        ESP_LOGI(TAG, "Connected to SSID: %s", WiFi.SSID().c_str());
+    if (fastConnect.valid && !cacheUsable) {
+        ESP_LOGI(TAG, "Refreshing cached connection with a full scan and DHCP (%u wakes since last)",
+                 fastConnect.wakesSinceFull);
+    }
+    fastConnect.valid = false;
+
+    if (connectFull(saved)) {
+        saveFastConnect(saved);
+    }
+}
+
+bool MyWiFiManager::connectFast(const wifi_config_t& saved) {
+    uint32_t start = millis();
+
+    WiFi.config(IPAddress(fastConnect.ip), IPAddress(fastConnect.gateway), IPAddress(fastConnect.subnet),
+                IPAddress(fastConnect.dns1), IPAddress(fastConnect.dns2));
+    WiFi.begin(reinterpret_cast<const char*>(saved.sta.ssid), reinterpret_cast<const char*>(saved.sta.password),
+               fastConnect.channel, fastConnect.bssid);
+
+    if (waitForConnection(FAST_CONNECT_TIMEOUT_MS, 10)) {
+        recordConnect(true, millis() - start);
+        ESP_LOGI(TAG, "IP address: %s (cached lease)", WiFi.localIP().toString().c_str());
+        return true;
+    }
+
+    // AP moved to another channel, was replaced, or the lease is gone: start over without hints
+    ESP_LOGW(TAG, "Fast connect to cached AP failed after %u ms, falling back to full scan", millis() - start);
+    WiFi.disconnect();
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE); // Back to DHCP
+    return false;
+}
+
+bool MyWiFiManager::connectFull(const wifi_config_t& saved) {
+    uint32_t start = millis();
+
+    // Explicit credentials clear the BSSID/channel lock a fast attempt may have left in the config
+    if (saved.sta.ssid[0]) {
+        WiFi.begin(reinterpret_cast<const char*>(saved.sta.ssid), reinterpret_cast<const char*>(saved.sta.password));
     } else {
+        WiFi.begin();
+    }
+
+    if (!waitForConnection(FULL_CONNECT_TIMEOUT_MS, 100)) {
         ESP_LOGW(TAG, "Failed to reconnect to WiFi with saved credentials");
+        return false;
+    }
+
+    recordConnect(false, millis() - start);
+    ESP_LOGI(TAG, "IP address: %s", WiFi.localIP().toString().c_str());
+    ESP_LOGI(TAG, "Connected to SSID: %s", WiFi.SSID().c_str());
+    return true;
+}
+
+bool MyWiFiManager::waitForConnection(int timeoutMs, int pollMs) {
+    uint32_t start = millis();
+    while (WiFi.status() != WL_CONNECTED && millis() - start < static_cast<uint32_t>(timeoutMs)) {
+        delay(pollMs);
+    }
+    return WiFi.status() == WL_CONNECTED;
+}
+
+void MyWiFiManager::saveFastConnect(const wifi_config_t& saved) {
+    const uint8_t* bssid = WiFi.BSSID();
+    if (!bssid) return;
+
+    strncpy(fastConnect.ssid, reinterpret_cast<const char*>(saved.sta.ssid), sizeof(fastConnect.ssid) - 1);
+    fastConnect.ssid[sizeof(fastConnect.ssid) - 1] = '\0';
+    memcpy(fastConnect.bssid, bssid, sizeof(fastConnect.bssid));
+    fastConnect.channel = WiFi.channel();
+    fastConnect.ip = WiFi.localIP();
+    fastConnect.gateway = WiFi.gatewayIP();
+    fastConnect.subnet = WiFi.subnetMask();
+    fastConnect.dns1 = WiFi.dnsIP(0);
+    fastConnect.dns2 = WiFi.dnsIP(1);
+    fastConnect.wakesSinceFull = 0;
+    fastConnect.valid = true;
+
+    ESP_LOGD(TAG, "Cached AP %02x:%02x:%02x:%02x:%02x:%02x on channel %d for fast reconnect", bssid[0], bssid[1],
+             bssid[2], bssid[3], bssid[4], bssid[5], fastConnect.channel);
+}
+
+void MyWiFiManager::recordConnect(bool fast, uint32_t durationMs) {
+    if (fast) {
+        fastConnects++;
+        fastConnectMsTotal += durationMs;
+    } else {
+        fullConnects++;
+        fullConnectMsTotal += durationMs;
     }
+    ESP_LOGI(TAG, "WiFi connected via %s in %u ms (avg fast %u ms over %u, full %u ms over %u)",
+             fast ? "cached BSSID/channel/IP" : "full scan and DHCP", durationMs,
+             fastConnects ? fastConnectMsTotal / fastConnects : 0, fastConnects,
+             fullConnects ? fullConnectMsTotal / fullConnects : 0, fullConnects);
 }
 
 void MyWiFiManager::setupWiFiAccessPointAndRestart(WiFiManager& wm) {
@@ -1,18 +1,25 @@
 #!/usr/bin/env python3
 # Script to generate icons.h header file from lib/bitmap_images/ directory.
-# Scans the actual bitmap headers to produce a unified enum and getBitmap() function.
+# Scans the actual bitmap headers to produce a unified enum and getBitmap() function,
+# and the run-length compressed copies with getCompressedBitmap().
 #
 # Usage:
 #   python3 final_generate_icons_h.py
 #
 # Output:
 #   ../lib/bitmap_images/icons.h
+#   ../lib/bitmap_images/icons_compressed.h
 
 import os
+import re
 
 BITMAP_DIR = os.path.join(os.path.dirname(__file__), '..', 'lib', 'bitmap_images')
 SIZES = [16, 24, 32, 48, 64]
 OUTPUT_FILE = os.path.join(BITMAP_DIR, 'icons.h')
+COMPRESSED_FILE = os.path.join(BITMAP_DIR, 'icons_compressed.h')
+
+# Longest run one escaped nibble can hold (15 + one byte)
+MAX_RUN = 15 + 255
 
 # Icons referenced in code but without bitmap data for all sizes.
 # getBitmap() returns nullptr for these — calling code handles that gracefully.
@@ -23,6 +30,11 @@ ENUM_ONLY_ICONS = [
 ]
 
 
+def get_sizes():
+    """Sizes that have a directory of bitmap headers."""
+    return [size for size in SIZES if os.path.isdir(os.path.join(BITMAP_DIR, f'{size}x{size}'))]
+
+
 def get_icon_names():
     """Collect icon names that exist in ALL size directories."""
     icons_per_size = {}
@@ -71,7 +83,7 @@ def generate_icons_h():
     lines.append('#include <cstddef>')
     lines.append('')
 
-    for size in SIZES:
+    for size in get_sizes():
         lines.append(f'#include "icons_{size}x{size}.h"')
     lines.append('')
 
@@ -90,7 +102,7 @@ def generate_icons_h():
     for name in icon_names:
         lines.append(f'  case {name}:')
         lines.append('    switch (size) {')
-        for size in SIZES:
+        for size in get_sizes():
             lines.append(f'    case {size}: return {name}_{size}x{size};')
         lines.append('    default:')
         lines.append('      return nullptr;')
@@ -105,8 +117,110 @@ def generate_icons_h():
     with open(OUTPUT_FILE, 'w') as f:
         f.write('\n'.join(lines) + '\n')
     print(f"icons.h generated at {OUTPUT_FILE}")
-    print(f"  {len(icon_names)} icons, {len(SIZES)} sizes")
+    print(f"  {len(icon_names)} icons, {len(get_sizes())} sizes")
+
+
+def read_bitmap(name, size):
+    """Raw 1bpp bytes of an icon, as png_to_header.py wrote them."""
+    path = os.path.join(BITMAP_DIR, f'{size}x{size}', f'{name}_{size}x{size}.h')
+    with open(path) as f:
+        content = f.read()
+    body = content[content.index('{'):content.index('}')]
+    return bytes(int(value, 16) for value in re.findall(r'0x([0-9a-fA-F]{2})', body))
+
+
+def encode_runs(bitmap, size):
+    """
+    Run-length encodes an icon for drawCompressedBitmap().
+
+    The pixels are read row by row as alternating runs of background (set bit) and
+    foreground (clear bit), starting with background. Each run is one nibble, high
+    nibble first; nibble 15 is followed by a byte holding the rest of a longer run.
+    Runs longer than MAX_RUN are split by a zero-length run of the other color.
+    """
+    stride = (size + 7) // 8
+    runs = []
+    foreground = False
+    length = 0
+    for row in range(size):
+        for col in range(size):
+            pixel = not (bitmap[row * stride + col // 8] & (0x80 >> (col % 8)))
+            if pixel != foreground:
+                runs.append(length)
+                foreground = pixel
+                length = 0
+            length += 1
+    runs.append(length)
+
+    nibbles = []
+    for i, run in enumerate(runs):
+        while run > MAX_RUN:
+            nibbles += [15, 15, 15, 0]  # MAX_RUN, then nothing of the other color
+            run -= MAX_RUN
+        if run < 15:
+            nibbles.append(run)
+        else:
+            nibbles += [15, (run - 15) >> 4, (run - 15) & 0x0F]
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes((nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2))
+
+
+def generate_compressed_h(icon_names):
+    lines = []
+    lines.append('// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`')
+    lines.append('// Run-length compressed icons, drawn with RecordingDisplay::drawCompressedBitmap()')
+    lines.append('')
+    lines.append('#ifndef __ICONS_COMPRESSED_H__')
+    lines.append('#define __ICONS_COMPRESSED_H__')
+    lines.append('')
+    lines.append('#include "icons.h"')
+    lines.append('')
+
+    raw_total = 0
+    compressed_total = 0
+    for size in get_sizes():
+        raw_size = 0
+        compressed_size = 0
+        for name in icon_names:
+            bitmap = read_bitmap(name, size)
+            data = encode_runs(bitmap, size)
+            raw_size += len(bitmap)
+            compressed_size += len(data)
+            lines.append(f'const unsigned char {name}_{size}x{size}_rle[] PROGMEM = {{')
+            for i in range(0, len(data), 12):
+                lines.append('  ' + ', '.join(f'0x{b:02x}' for b in data[i:i + 12]) + ',')
+            lines.append('};')
+        print(f"  {size}x{size}: {raw_size} -> {compressed_size} bytes")
+        raw_total += raw_size
+        compressed_total += compressed_size
+    lines.append('')
+
+    lines.append('inline const unsigned char* getCompressedBitmap(icon_name_t icon, size_t size)')
+    lines.append('{')
+    lines.append('  switch (icon) {')
+    for name in icon_names:
+        lines.append(f'  case {name}:')
+        lines.append('    switch (size) {')
+        for size in get_sizes():
+            lines.append(f'    case {size}: return {name}_{size}x{size}_rle;')
+        lines.append('    default:')
+        lines.append('      return nullptr;')
+        lines.append('    }')
+    lines.append('  default:')
+    lines.append('    return nullptr;')
+    lines.append('  }')
+    lines.append('}')
+    lines.append('')
+    lines.append('#endif')
+
+    with open(COMPRESSED_FILE, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+    print(f"icons_compressed.h generated at {COMPRESSED_FILE}")
+    print(f"  icon flash: {raw_total} -> {compressed_total} bytes "
+          f"({100 * compressed_total // raw_total}%)")
 
 
 if __name__ == '__main__':
     generate_icons_h()
+    generate_compressed_h(get_icon_names())
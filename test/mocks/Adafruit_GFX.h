@@ -0,0 +1,217 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Mock Adafruit_GFX for native render tests: rasterizes into an in-memory 1bpp
+// bitmap instead of an e-paper controller. Primitives produce the same pixels as
+// the Adafruit_GFX implementations the firmware links against, so layouts drawn
+// on the host match the panel. The same primitives are virtual as in Adafruit_GFX.
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+// Draw calls and pixels written since the last resetStats()
+struct GfxStats {
+    uint32_t pixels;
+    uint32_t clipped; // Pixels that fell outside the panel
+    uint32_t lines;
+    uint32_t fastLines;
+    uint32_t rects;
+    uint32_t bitmaps;
+    uint32_t glyphs;
+    uint32_t fills;
+};
+
+class Adafruit_GFX {
+public:
+    Adafruit_GFX(int16_t w, int16_t h) : _width(w), _height(h), bytesPerRow((w + 7) / 8),
+                                         pixels(bytesPerRow * h, 0xFF), stats() {}
+    virtual ~Adafruit_GFX() = default;
+
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+    void setRotation(uint8_t) {} // The board draws in the panel's native landscape orientation
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) {
+        stats.pixels++;
+        if (x < 0 || y < 0 || x >= _width || y >= _height) {
+            stats.clipped++;
+            return;
+        }
+        uint8_t& byte = pixels[y * bytesPerRow + x / 8];
+        uint8_t mask = 0x80 >> (x & 7);
+        if (color == GxEPD_WHITE) {
+            byte |= mask;
+        } else {
+            byte &= ~mask;
+        }
+    }
+
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+        stats.fastLines++;
+        for (int16_t i = 0; i < w; i++) drawPixel(x + i, y, color);
+    }
+
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+        stats.fastLines++;
+        for (int16_t i = 0; i < h; i++) drawPixel(x, y + i, color);
+    }
+
+    virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+        stats.lines++;
+        if (x0 == x1) {
+            if (y0 > y1) swap(y0, y1);
+            drawFastVLine(x0, y0, y1 - y0 + 1, color);
+            return;
+        }
+        if (y0 == y1) {
+            if (x0 > x1) swap(x0, x1);
+            drawFastHLine(x0, y0, x1 - x0 + 1, color);
+            return;
+        }
+
+        // Bresenham exactly as Adafruit_GFX::writeLine
+        bool steep = abs(y1 - y0) > abs(x1 - x0);
+        if (steep) {
+            swap(x0, y0);
+            swap(x1, y1);
+        }
+        if (x0 > x1) {
+            swap(x0, x1);
+            swap(y0, y1);
+        }
+        int16_t dx = x1 - x0;
+        int16_t dy = abs(y1 - y0);
+        int16_t err = dx / 2;
+        int16_t ystep = y0 < y1 ? 1 : -1;
+        for (; x0 <= x1; x0++) {
+            if (steep) {
+                drawPixel(y0, x0, color);
+            } else {
+                drawPixel(x0, y0, color);
+            }
+            err -= dy;
+            if (err < 0) {
+                y0 += ystep;
+                err += dx;
+            }
+        }
+    }
+
+    virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        stats.rects++;
+        drawFastHLine(x, y, w, color);
+        drawFastHLine(x, y + h - 1, w, color);
+        drawFastVLine(x, y, h, color);
+        drawFastVLine(x + w - 1, y, h, color);
+    }
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        stats.rects++;
+        for (int16_t i = x; i < x + w; i++) drawFastVLine(i, y, h, color);
+    }
+
+    virtual void fillScreen(uint16_t color) {
+        stats.fills++;
+        fillRows(0, _height, color);
+    }
+
+    // Set bits are drawn in color, clear bits are left alone
+    void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color) {
+        drawBits(x, y, bitmap, w, h, color, false);
+    }
+
+    // ===== Host-only helpers =====
+
+    bool getPixel(int16_t x, int16_t y) const {
+        // true = black
+        if (x < 0 || y < 0 || x >= _width || y >= _height) return false;
+        return !(pixels[y * bytesPerRow + x / 8] & (0x80 >> (x & 7)));
+    }
+
+    // Panel bit order: MSB first, 1 = white
+    const std::vector<uint8_t>& buffer() const { return pixels; }
+
+    uint32_t blackPixels() const {
+        uint32_t count = 0;
+        for (int16_t y = 0; y < _height; y++) {
+            for (int16_t x = 0; x < _width; x++) count += getPixel(x, y);
+        }
+        return count;
+    }
+
+    // Binary PBM (P4): 1 = black, so the panel bits are inverted
+    bool writePBM(const char* path) const {
+        FILE* f = fopen(path, "wb");
+        if (!f) return false;
+        fprintf(f, "P4\n%d %d\n", _width, _height);
+        for (uint8_t byte : pixels) fputc(static_cast<uint8_t>(~byte), f);
+        return fclose(f) == 0;
+    }
+
+    // Reads a P4 file of the same size into out (panel bit order); false if missing or mismatched
+    bool readPBM(const char* path, std::vector<uint8_t>& out) const {
+        FILE* f = fopen(path, "rb");
+        if (!f) return false;
+        int w = 0;
+        int h = 0;
+        bool ok = fscanf(f, "P4 %d %d", &w, &h) == 2 && w == _width && h == _height && fgetc(f) != EOF;
+        if (ok) {
+            out.resize(pixels.size());
+            ok = fread(out.data(), 1, out.size(), f) == out.size();
+            for (uint8_t& byte : out) byte = static_cast<uint8_t>(~byte);
+        }
+        fclose(f);
+        return ok;
+    }
+
+    const GfxStats& getStats() const { return stats; }
+    void resetStats() { stats = GfxStats(); }
+
+    // Stand-in glyph from the U8g2 mock: counted as a glyph, not as the lines it is drawn with
+    void drawGlyphBox(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        GfxStats before = stats;
+        drawRect(x, y, w, h, color);
+        uint32_t pixelsDrawn = stats.pixels - before.pixels;
+        uint32_t clippedDrawn = stats.clipped - before.clipped;
+        stats = before;
+        stats.pixels += pixelsDrawn;
+        stats.clipped += clippedDrawn;
+        stats.glyphs++;
+    }
+
+protected:
+    void drawBits(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color, bool inverted) {
+        stats.bitmaps++;
+        if (!bitmap) return;
+        int16_t byteWidth = (w + 7) / 8;
+        for (int16_t j = 0; j < h; j++) {
+            for (int16_t i = 0; i < w; i++) {
+                bool set = bitmap[j * byteWidth + i / 8] & (0x80 >> (i & 7));
+                if (set != inverted) drawPixel(x + i, y + j, color);
+            }
+        }
+    }
+
+    void fillRows(int16_t top, int16_t bottom, uint16_t color) {
+        memset(pixels.data() + top * bytesPerRow, color == GxEPD_WHITE ? 0xFF : 0x00, (bottom - top) * bytesPerRow);
+    }
+
+    int16_t _width;
+    int16_t _height;
+
+private:
+    static void swap(int16_t& a, int16_t& b) {
+        int16_t t = a;
+        a = b;
+        b = t;
+    }
+
+    int16_t bytesPerRow;
+    std::vector<uint8_t> pixels;
+    GfxStats stats;
+};
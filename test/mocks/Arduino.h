@@ -2,7 +2,38 @@
 
 // Mock Arduino.h for native testing
 #include "esp32_mocks.h"
+#include "Stream.h"
+#include <cstdarg>
 
 // Additional Arduino-like definitions that might be needed
 typedef uint8_t byte;
 typedef bool boolean;
+
+// Flash data is ordinary memory on the host
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+
+// Mock Serial: writes to stdout
+class MockSerial {
+public:
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        va_list args;
+        va_start(args, format);
+        int n = vprintf(format, args);
+        va_end(args);
+        return n < 0 ? 0 : n;
+    }
+    size_t print(const char* str) { return fputs(str, stdout) < 0 ? 0 : strlen(str); }
+    size_t println(const char* str = "") { return printf("%s\n", str); }
+};
+
+static MockSerial Serial __attribute__((unused));
+
+// Mock ESP: fixed chip values
+class MockESP {
+public:
+    uint32_t getFreeHeap() const { return 200 * 1024; }
+    uint64_t getEfuseMac() const { return 0x0000A1B2C3D4E5F6ULL; }
+};
+
+static MockESP ESP __attribute__((unused));
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Adafruit_GFX.h"
+
+// Mock GxEPD2_BW for native render tests. The Adafruit_GFX mock's bitmap holds
+// the whole frame; with a paged buffer (page_height below the panel height, or
+// setPageHeight() on the host) only the rows of the current page accept pixels,
+// as in GxEPD2, and each page adds its rows to the frame. Panel operations only
+// count what the firmware would have sent to the controller.
+template <typename Driver, uint16_t page_height>
+class GxEPD2_BW : public Adafruit_GFX {
+public:
+    GxEPD2_BW() : Adafruit_GFX(Driver::WIDTH, Driver::HEIGHT) {}
+
+    void init(uint32_t = 0, bool = true, uint16_t = 10, bool = false) {}
+    uint16_t pages() const { return (Driver::HEIGHT + pageRows - 1) / pageRows; }
+    uint16_t pageHeight() const { return pageRows; }
+
+    void setFullWindow() {}
+    void setPartialWindow(uint16_t, uint16_t, uint16_t, uint16_t) {}
+    void firstPage() {
+        currentPage = 0;
+        paging = pages() > 1;
+        if (paging) fillScreen(GxEPD_WHITE);
+    }
+    bool nextPage() {
+        if (paging && ++currentPage < pages()) {
+            fillScreen(GxEPD_WHITE);
+            return true;
+        }
+        paging = false;
+        fullRefreshes++;
+        return false;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (paging && (y < pageTop() || y >= pageBottom())) return; // Not in this page's buffer
+        Adafruit_GFX::drawPixel(x, y, color);
+    }
+
+    void fillScreen(uint16_t color) override {
+        if (!paging) {
+            Adafruit_GFX::fillScreen(color);
+            return;
+        }
+        fillRows(pageTop(), pageBottom(), color);
+    }
+
+    // GxEPD2 variant: clear bits are drawn in color (icons are black on white)
+    void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color) {
+        drawBits(x, y, bitmap, w, h, color, true);
+    }
+
+    void display(bool partial = false) {
+        if (partial) {
+            partialRefreshes++;
+        } else {
+            fullRefreshes++;
+        }
+    }
+    void displayWindow(int16_t, int16_t, int16_t, int16_t) { partialRefreshes++; }
+    void powerOff() {}
+    void hibernate() {}
+
+    // ===== Host-only helpers =====
+
+    // Emulates a board built with a smaller page buffer
+    void setPageHeight(uint16_t rows) { pageRows = rows; }
+
+    uint32_t fullRefreshes = 0;
+    uint32_t partialRefreshes = 0;
+
+private:
+    int16_t pageTop() const { return currentPage * pageRows; }
+    int16_t pageBottom() const { return pageTop() + pageRows < Driver::HEIGHT ? pageTop() + pageRows : Driver::HEIGHT; }
+
+    uint16_t pageRows = page_height;
+    uint16_t currentPage = 0;
+    bool paging = false;
+};
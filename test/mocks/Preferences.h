@@ -88,6 +88,20 @@ public:
         return defaultValue;
     }
 
+    size_t getBytesLength(const char* key) {
+        auto it = storage.find(key);
+        return it != storage.end() ? it->second.size() : 0;
+    }
+
+    size_t getBytes(const char* key, void* buf, size_t maxLen) {
+        auto it = storage.find(key);
+        if (it == storage.end() || it->second.size() > maxLen) {
+            return 0;
+        }
+        std::memcpy(buf, it->second.data(), it->second.size());
+        return it->second.size();
+    }
+
     // Setters
     size_t putUChar(const char* key, uint8_t value) {
         storage[key] = std::vector<uint8_t>(reinterpret_cast<uint8_t*>(&value),
@@ -129,6 +143,12 @@ public:
         return value.size();
     }
 
+    size_t putBytes(const char* key, const void* value, size_t len) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(value);
+        storage[key] = std::vector<uint8_t>(bytes, bytes + len);
+        return len;
+    }
+
 private:
     std::string namespace_name;
     std::map<std::string, std::vector<uint8_t>> storage;
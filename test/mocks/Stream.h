@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+
+// Mock Arduino Stream: subclasses provide available()/read()/peek()
+class Stream {
+public:
+    virtual ~Stream() = default;
+
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    virtual size_t readBytes(char* buffer, size_t length) {
+        size_t count = 0;
+        while (count < length) {
+            int c = read();
+            if (c < 0) break;
+            buffer[count++] = static_cast<char>(c);
+        }
+        return count;
+    }
+
+    void setTimeout(unsigned long timeout) { _timeout = timeout; }
+
+protected:
+    unsigned long _timeout = 1000;
+};
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "Adafruit_GFX.h"
+#include "esp32_mocks.h"
+
+// Mock U8g2_for_Adafruit_GFX for native render tests.
+//
+// The real font data lives in the U8g2 library, which native builds do not
+// link, so the mock fonts carry only metrics: Helvetica Bold advance widths
+// scaled to the pixel size of each U8g2 font. Glyphs are drawn as outline
+// boxes shaped like the letter (cap height, x-height, descender), which keeps
+// word shapes, alignment and ellipsis decisions visible in golden images.
+
+// { pixel size (em), ascent, descent } of the U8g2 helvB fonts the firmware uses
+static const uint8_t u8g2_font_helvB08_tf[] = {8, 6, 2};
+static const uint8_t u8g2_font_helvB10_tf[] = {10, 8, 2};
+static const uint8_t u8g2_font_helvB12_tf[] = {13, 9, 3};
+static const uint8_t u8g2_font_helvB14_tf[] = {15, 11, 3};
+static const uint8_t u8g2_font_helvB18_tf[] = {19, 14, 4};
+static const uint8_t u8g2_font_helvB24_tf[] = {25, 18, 5};
+
+class U8G2_FOR_ADAFRUIT_GFX {
+public:
+    void begin(Adafruit_GFX& gfx) { target = &gfx; }
+    void setFont(const uint8_t* f) { font = f; }
+    void setFontMode(uint8_t) {} // Always transparent, as configured in SystemInit
+    void setFontDirection(uint8_t) {}
+    void setForegroundColor(uint16_t color) { foreground = color; }
+    void setBackgroundColor(uint16_t color) { background = color; }
+    void setCursor(int16_t x, int16_t y) {
+        cursorX = x;
+        cursorY = y;
+    }
+    int16_t getCursorX() const { return cursorX; }
+    int16_t getCursorY() const { return cursorY; }
+
+    int8_t getFontAscent() const { return font[1]; }
+    int8_t getFontDescent() const { return -static_cast<int8_t>(font[2]); }
+
+    int16_t getUTF8Width(const char* str) const {
+        int16_t width = 0;
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(str);
+        while (*p) {
+            width += advance(decode(p));
+            glyphLookups++;
+        }
+        return width;
+    }
+
+    virtual ~U8G2_FOR_ADAFRUIT_GFX() = default;
+
+    // Print interface: UTF-8 is decoded byte by byte, as in the library
+    virtual size_t write(uint8_t v) {
+        if (pending == 0) {
+            codepoint = v;
+            pending = v >= 0xF0 ? 3 : v >= 0xE0 ? 2 : v >= 0xC0 ? 1 : 0;
+            if (pending) codepoint &= 0x3F >> pending;
+        } else if ((v & 0xC0) == 0x80) {
+            codepoint = (codepoint << 6) | (v & 0x3F);
+            pending--;
+        } else {
+            pending = 0;
+            return write(v);
+        }
+        if (pending == 0) drawGlyph(codepoint);
+        return 1;
+    }
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+
+    size_t print(const char* str) { return write(reinterpret_cast<const uint8_t*>(str), strlen(str)); }
+    size_t print(const String& str) { return print(str.c_str()); }
+    size_t print(char c) {
+        char str[2] = {c, '\0'};
+        return print(str);
+    }
+    size_t print(int value) { return printf("%d", value); }
+    size_t print(unsigned int value) { return printf("%u", value); }
+    size_t print(long value) { return printf("%ld", value); }
+    size_t print(unsigned long value) { return printf("%lu", value); }
+    size_t print(double value, int digits = 2) { return printf("%.*f", digits, value); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        char buffer[256];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        return print(buffer);
+    }
+
+    // Host-only: glyphs looked up by getUTF8Width(); U8g2 walks the font data for each
+    mutable uint32_t glyphLookups = 0;
+
+private:
+    // Helvetica-Bold advance widths (AFM units per 1000 em) for ' ' .. '~'
+    static uint16_t asciiWidth(uint8_t c) {
+        static const uint16_t widths[] = {
+            278, 333, 474, 556, 556, 889, 722, 238, 333, 333, 389, 584, 278, 333, 278, 278, // ' ' .. '/'
+            556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 333, 333, 584, 584, 584, 611, // '0' .. '?'
+            975, 722, 722, 722, 722, 667, 611, 778, 722, 278, 556, 722, 611, 833, 722, 778, // '@' .. 'O'
+            667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611, 333, 278, 333, 584, 556, // 'P' .. '_'
+            333, 556, 611, 556, 611, 556, 333, 611, 611, 278, 278, 556, 278, 889, 611, 611, // '`' .. 'o'
+            611, 611, 389, 556, 333, 611, 556, 778, 556, 556, 500, 389, 280, 389, 584,      // 'p' .. '~'
+        };
+        return c >= 32 && c <= 126 ? widths[c - 32] : 556;
+    }
+
+    // Latin-1 letters the German texts use, measured like their base letter
+    static uint32_t baseLetter(uint32_t cp) {
+        switch (cp) {
+        case 0xC4: return 'A';
+        case 0xD6: return 'O';
+        case 0xDC: return 'U';
+        case 0xE4: return 'a';
+        case 0xF6: return 'o';
+        case 0xFC: return 'u';
+        case 0xDF: return 'B';
+        default: return cp;
+        }
+    }
+
+    static uint32_t decode(const uint8_t*& p) {
+        uint32_t cp = *p++;
+        int extra = cp >= 0xF0 ? 3 : cp >= 0xE0 ? 2 : cp >= 0xC0 ? 1 : 0;
+        if (extra) cp &= 0x3F >> extra;
+        while (extra-- > 0 && (*p & 0xC0) == 0x80) cp = (cp << 6) | (*p++ & 0x3F);
+        return cp;
+    }
+
+    int16_t advance(uint32_t cp) const {
+        uint32_t base = baseLetter(cp);
+        uint16_t width = base == 0xB0 ? 400 : asciiWidth(base < 128 ? base : 0);
+        return (width * font[0] + 500) / 1000;
+    }
+
+    void drawGlyph(uint32_t cp) {
+        int16_t w = advance(cp);
+        uint32_t c = baseLetter(cp);
+        if (c != ' ' && target) {
+            int16_t ascent = font[1];
+            int16_t top = ascent;
+            int16_t bottom = 0;
+            if (c >= 'a' && c <= 'z' && !strchr("bdfhklt", static_cast<char>(c))) top = (ascent * 3 + 2) / 4;
+            if (c < 128 && strchr("gjpqy,;", static_cast<char>(c))) bottom = font[2];
+            if (c == '.' || c == ',' || c == '_') top = 2;
+            if (c == '-' || c == ':' || c == '=') {
+                top = (ascent + 1) / 2 + 1;
+                bottom = -(ascent / 2 - 1);
+            }
+
+            int16_t boxW = w > 2 ? w - 1 : 1;
+            int16_t boxH = top + bottom;
+            target->drawGlyphBox(cursorX, cursorY - top, boxW, boxH > 0 ? boxH : 1, foreground);
+        }
+        cursorX += w;
+    }
+
+    Adafruit_GFX* target = nullptr;
+    const uint8_t* font = u8g2_font_helvB10_tf;
+    int16_t cursorX = 0;
+    int16_t cursorY = 0;
+    uint16_t foreground = GxEPD_BLACK;
+    uint16_t background = GxEPD_WHITE;
+    uint32_t codepoint = 0;
+    uint8_t pending = 0;
+};
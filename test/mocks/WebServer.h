@@ -0,0 +1,4 @@
+#pragma once
+
+// Mock WebServer: only declared through global_instances.h in native builds
+class WebServer {};
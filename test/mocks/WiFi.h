@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+// Mock WiFi for native builds: a connected station with a fixed signal
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_CONNECTED = 3,
+    WL_DISCONNECTED = 6,
+} wl_status_t;
+
+class MockWiFiClass {
+public:
+    wl_status_t status() const { return connected ? WL_CONNECTED : WL_DISCONNECTED; }
+    int8_t RSSI() const { return rssi; }
+
+    bool connected = true;
+    int8_t rssi = -55;
+};
+
+static MockWiFiClass WiFi;
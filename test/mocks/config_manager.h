@@ -18,6 +18,9 @@ struct RTCConfigData {
     char transportActiveStart[6] = "06:00";
     char transportActiveEnd[6] = "22:00";
     int walkingTime = 5; // minutes
+    int maxWeatherInterval = 6; // hours
+    int maxTransportInterval = 30; // minutes
+    int8_t chargeDay = -1;
     char sleepStart[6] = "23:00";
     char sleepEnd[6] = "05:30";
     bool weekendMode = true;
@@ -6,13 +6,19 @@
 #include <algorithm>
 #include <ctime>
 #include <cstring>
+#include <cctype>
 
-// Mock ESP32 logging
-#define ESP_LOGI(tag, format, ...) printf("[INFO][%s] " format "\n", tag, ##__VA_ARGS__)
-#define ESP_LOGW(tag, format, ...) printf("[WARN][%s] " format "\n", tag, ##__VA_ARGS__)
-#define ESP_LOGE(tag, format, ...) printf("[ERROR][%s] " format "\n", tag, ##__VA_ARGS__)
-#define ESP_LOGD(tag, format, ...) printf("[DEBUG][%s] " format "\n", tag, ##__VA_ARGS__)
-#define ESP_LOGV(tag, format, ...) printf("[VERBOSE][%s] " format "\n", tag, ##__VA_ARGS__)
+// Mock ESP32 logging; NATIVE_LOG_LEVEL follows ESP-IDF (1 = errors ... 5 = verbose)
+#ifndef NATIVE_LOG_LEVEL
+#define NATIVE_LOG_LEVEL 5
+#endif
+#define MOCK_LOG(level, prefix, tag, format, ...) \
+    do { if (NATIVE_LOG_LEVEL >= level) printf("[" prefix "][%s] " format "\n", tag, ##__VA_ARGS__); } while (0)
+#define ESP_LOGE(tag, format, ...) MOCK_LOG(1, "ERROR", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) MOCK_LOG(2, "WARN", tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) MOCK_LOG(3, "INFO", tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) MOCK_LOG(4, "DEBUG", tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) MOCK_LOG(5, "VERBOSE", tag, format, ##__VA_ARGS__)
 #define RTC_DATA_ATTR
 
 // Mock Arduino String class
@@ -21,15 +27,37 @@ public:
     String() = default;
     String(const char* str) : std::string(str ? str : "") {}
     String(const std::string& str) : std::string(str) {}
+    explicit String(char c) : std::string(1, c) {}
     String(int val) : std::string(std::to_string(val)) {}
     String(unsigned int val) : std::string(std::to_string(val)) {}
     String(long val) : std::string(std::to_string(val)) {}
     String(unsigned long val) : std::string(std::to_string(val)) {}
-    String(float val) : std::string(std::to_string(val)) {}
-    String(double val) : std::string(std::to_string(val)) {}
+    // Like Arduino: floats are formatted with a fixed number of decimals (2 by default)
+    String(float val, unsigned int decimals = 2) : std::string(formatFloat(val, decimals)) {}
+    String(double val, unsigned int decimals = 2) : std::string(formatFloat(val, decimals)) {}
 
-    int indexOf(char c) const {
-        size_t pos = find(c);
+    bool concat(const char* cstr, unsigned int length) {
+        append(cstr, length);
+        return true;
+    }
+
+    int indexOf(char c, int from = 0) const {
+        size_t pos = find(c, from);
+        return pos == std::string::npos ? -1 : static_cast<int>(pos);
+    }
+
+    int indexOf(const String& str, int from = 0) const {
+        size_t pos = find(str, from);
+        return pos == std::string::npos ? -1 : static_cast<int>(pos);
+    }
+
+    int lastIndexOf(char c) const {
+        size_t pos = rfind(c);
+        return pos == std::string::npos ? -1 : static_cast<int>(pos);
+    }
+
+    int lastIndexOf(const String& str) const {
+        size_t pos = rfind(str);
         return pos == std::string::npos ? -1 : static_cast<int>(pos);
     }
 
@@ -44,6 +72,55 @@ public:
         return String(substr(start, end - start));
     }
 
+    char charAt(unsigned int index) const { return index < size() ? (*this)[index] : '\0'; }
+    bool isEmpty() const { return empty(); }
+    bool equals(const String& other) const { return *this == other; }
+    bool startsWith(const String& prefix) const { return compare(0, prefix.size(), prefix) == 0; }
+    bool endsWith(const String& suffix) const {
+        return size() >= suffix.size() && compare(size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+    void trim() {
+        size_t first = find_first_not_of(" \t\r\n");
+        if (first == std::string::npos) {
+            clear();
+            return;
+        }
+        assign(substr(first, find_last_not_of(" \t\r\n") - first + 1));
+    }
+
+    void toUpperCase() {
+        for (char& c : *this) c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+    }
+
+    void toLowerCase() {
+        for (char& c : *this) c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+    }
+
+    void replace(const String& from, const String& to) {
+        if (from.empty()) return;
+        size_t pos = 0;
+        while ((pos = find(from, pos)) != std::string::npos) {
+            std::string::replace(pos, from.size(), to);
+            pos += to.size();
+        }
+    }
+
+    void remove(unsigned int index, unsigned int count = static_cast<unsigned int>(-1)) {
+        if (index < size()) erase(index, count);
+    }
+
+    // Arduino appends numbers as text; std::string would append them as a char
+    String& operator+=(const std::string& str) { append(str); return *this; }
+    String& operator+=(const char* str) { append(str ? str : ""); return *this; }
+    String& operator+=(char c) { push_back(c); return *this; }
+    String& operator+=(int val) { return *this += String(val); }
+    String& operator+=(unsigned int val) { return *this += String(val); }
+    String& operator+=(long val) { return *this += String(val); }
+    String& operator+=(unsigned long val) { return *this += String(val); }
+    String& operator+=(float val) { return *this += String(val); }
+    String& operator+=(double val) { return *this += String(val); }
+
     int toInt() const {
         try { return std::stoi(*this); } catch (...) { return 0; }
     }
@@ -55,8 +132,34 @@ public:
     int length() const { return static_cast<int>(size()); }
 
     const char* c_str() const { return std::string::c_str(); }
+
+private:
+    static std::string formatFloat(double val, unsigned int decimals) {
+        char buf[48];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, val);
+        return buf;
+    }
 };
 
+inline String operator+(const String& a, const String& b) {
+    return String(static_cast<const std::string&>(a) + static_cast<const std::string&>(b));
+}
+inline String operator+(const String& a, const char* b) { return String(static_cast<const std::string&>(a) + b); }
+inline String operator+(const char* a, const String& b) { return String(a + static_cast<const std::string&>(b)); }
+inline String operator+(const String& a, char b) { return String(static_cast<const std::string&>(a) + b); }
+inline String operator+(const String& a, int b) { return a + String(b); }
+inline String operator+(const String& a, unsigned int b) { return a + String(b); }
+inline String operator+(const String& a, long b) { return a + String(b); }
+inline String operator+(const String& a, unsigned long b) { return a + String(b); }
+inline String operator+(const String& a, float b) { return a + String(b); }
+inline String operator+(const String& a, double b) { return a + String(b); }
+
+// Arduino helpers used by the display code
+template <typename T, typename L, typename H>
+inline T constrain(T value, L low, H high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
 // Ensure min/max are available
 using std::min;
 using std::max;
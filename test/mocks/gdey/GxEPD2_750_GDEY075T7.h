@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+// Mock panel driver: only the geometry of the 7.5" GDEY075T7
+class GxEPD2_750_GDEY075T7 {
+public:
+    static const uint16_t WIDTH = 800;
+    static const uint16_t HEIGHT = 480;
+};
@@ -28,6 +28,10 @@ public:
         return true;
     }
 
+    static void applyTimezone() {
+        // No-op for mock: tests run in the host's TZ or set it themselves
+    }
+
     static bool needsPeriodicSync() {
         return false;
     }
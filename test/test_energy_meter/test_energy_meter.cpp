@@ -0,0 +1,155 @@
+#include <unity.h>
+#include "util/energy_meter.h"
+
+static const uint64_t MS = 1000; // Native clock runs in microseconds
+
+// 10 mA base, 100 mA with the radio on, 50 mA refreshing, 20 uA asleep, 1000 mAh
+static const CurrentProfile PROFILE = {{10, 10, 10, 10, 100, 100, 100, 100, 50}, 20.0f, 1000};
+
+static WakeRecord wakeOf(uint32_t startedAt, uint32_t sleepSeconds, uint16_t baseMs, uint16_t wifiMs,
+                         uint16_t refreshMs) {
+    WakeRecord wake = {};
+    wake.startedAt = startedAt;
+    wake.sleepSeconds = sleepSeconds;
+    wake.phaseMs[(uint8_t)EnergyPhase::RUNNING] = baseMs;
+    wake.phaseMs[(uint8_t)EnergyPhase::WIFI_CONNECT] = wifiMs;
+    wake.phaseMs[(uint8_t)EnergyPhase::PANEL_REFRESH] = refreshMs;
+    return wake;
+}
+
+// One wake on the native clock: 200 ms init, 1 s WiFi, 300 ms start, 2 s fetch with 500 ms parse, 3 s refresh
+static void runWake(uint32_t startedAt, uint32_t sleepSeconds) {
+    EnergyMeter::setNativeMicros(0);
+    EnergyMeter::beginWake();
+    EnergyMeter::setNativeMicros(200 * MS);
+    EnergyMeter::enter(EnergyPhase::START);
+    {
+        EnergyMeter::Scope connecting(EnergyPhase::WIFI_CONNECT);
+        EnergyMeter::setNativeMicros(1200 * MS);
+    }
+    EnergyMeter::setNativeMicros(1500 * MS);
+    EnergyMeter::enter(EnergyPhase::RUNNING);
+    {
+        EnergyMeter::Scope fetching(EnergyPhase::HTTP_FETCH);
+        EnergyMeter::setNativeMicros(2500 * MS);
+        {
+            EnergyMeter::Scope parsing(EnergyPhase::JSON_PARSE);
+            EnergyMeter::setNativeMicros(3000 * MS);
+        }
+        EnergyMeter::setNativeMicros(3500 * MS);
+    }
+    {
+        EnergyMeter::Scope refreshing(EnergyPhase::PANEL_REFRESH);
+        EnergyMeter::setNativeMicros(6500 * MS);
+    }
+    EnergyMeter::enter(EnergyPhase::STOP);
+    EnergyMeter::setNativeMicros(6600 * MS);
+    EnergyMeter::endWake(startedAt, sleepSeconds);
+}
+
+void setUp(void) {
+    EnergyMeter::clearLog();
+}
+
+void tearDown(void) {}
+
+// Test: Nested scopes charge each millisecond to exactly one phase and hand back to the enclosing one
+void test_phases_are_exclusive() {
+    runWake(1000000, 300);
+    EnergySummary summary = EnergyMeter::summary(-1);
+
+    TEST_ASSERT_EQUAL(1, summary.wakes);
+    // 6.6 s awake at the default profile: check against the same wake built by hand
+    WakeRecord expected = {};
+    expected.phaseMs[(uint8_t)EnergyPhase::INIT] = 200;
+    expected.phaseMs[(uint8_t)EnergyPhase::WIFI_CONNECT] = 1000;
+    expected.phaseMs[(uint8_t)EnergyPhase::START] = 300;
+    expected.phaseMs[(uint8_t)EnergyPhase::HTTP_FETCH] = 1500;
+    expected.phaseMs[(uint8_t)EnergyPhase::JSON_PARSE] = 500;
+    expected.phaseMs[(uint8_t)EnergyPhase::PANEL_REFRESH] = 3000;
+    expected.phaseMs[(uint8_t)EnergyPhase::STOP] = 100;
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, EnergyMeter::wakeMilliampHours(expected, EnergyMeter::profile()),
+                             summary.mAhPerWake);
+}
+
+// Test: Charge is the sum of phase durations times the phase current
+void test_wake_charge() {
+    WakeRecord wake = wakeOf(0, 0, 3600, 3600, 0);
+    // 3.6 s at 10 mA and 3.6 s at 100 mA
+    TEST_ASSERT_FLOAT_WITHIN(0.00001f, 0.11f, EnergyMeter::wakeMilliampHours(wake, PROFILE));
+}
+
+// Test: Per-day figure adds deep sleep over the span between the first and last wake
+void test_per_day_includes_sleep() {
+    // 96 wakes a day, every 15 minutes: 3.6 s at 100 mA each (0.1 mAh)
+    WakeRecord wakes[4];
+    for (uint32_t i = 0; i < 4; i++) wakes[i] = wakeOf(1000000 + i * 900, 896, 0, 3600, 0);
+    EnergySummary summary = EnergyMeter::summarize(wakes, 4, PROFILE, 50);
+
+    TEST_ASSERT_EQUAL(4, summary.wakes);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.1f, summary.mAhPerWake);
+    // 9.6 mAh of wakes and 0.02 mA x (24 h - 96 x 3.6 s) of sleep
+    float sleep = 0.02f * (86400.0f - 96 * 3.6f) / 3600.0f;
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 9.6f + sleep, summary.mAhPerDay);
+    TEST_ASSERT_EQUAL(EnergyPhase::WIFI_CONNECT, summary.topPhase);
+    TEST_ASSERT_EQUAL(100, summary.topPhasePercent);
+    // Half of 1000 mAh
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 500.0f / (9.6f + sleep), summary.runtimeDays);
+}
+
+// Test: A button press cuts the planned sleep short; the clock decides the span
+void test_span_follows_the_clock() {
+    WakeRecord wakes[2] = {wakeOf(1000000, 3600, 0, 3600, 0), wakeOf(1000600, 3600, 0, 3600, 0)};
+    EnergySummary summary = EnergyMeter::summarize(wakes, 2, PROFILE, -1);
+
+    // 600 s to the second wake, then its 3.6 s and 3600 s of sleep
+    float span = 600.0f + 3.6f + 3600.0f;
+    float sleep = 0.02f * (span - 7.2f) / 3600.0f;
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, (0.2f + sleep) * 86400.0f / span, summary.mAhPerDay);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, summary.runtimeDays); // Battery level unknown
+}
+
+// Test: Without a clock, the planned sleeps give the span
+void test_span_without_clock() {
+    WakeRecord wakes[2] = {wakeOf(0, 1796, 0, 3600, 0), wakeOf(0, 1796, 0, 3600, 0)};
+    EnergySummary summary = EnergyMeter::summarize(wakes, 2, PROFILE, -1);
+
+    float span = 7.2f + 2 * 1796.0f;
+    float sleep = 0.02f * 3592.0f / 3600.0f;
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, (0.2f + sleep) * 86400.0f / span, summary.mAhPerDay);
+}
+
+// Test: The ring keeps the last LOG_SIZE wakes
+void test_ring_keeps_last_wakes() {
+    for (uint32_t i = 0; i < EnergyMeter::LOG_SIZE + 5; i++) runWake(1000000 + i * 600, 593);
+    EnergySummary summary = EnergyMeter::summary(-1);
+    TEST_ASSERT_EQUAL(EnergyMeter::LOG_SIZE, summary.wakes);
+
+    // The span runs from the oldest kept wake, so it only comes out right if the ring is read in order
+    float awake = EnergyMeter::LOG_SIZE * 6.6f;
+    float span = (EnergyMeter::LOG_SIZE - 1) * 600.0f + 6.6f + 593.0f;
+    float wakeCharge = summary.mAhPerWake * EnergyMeter::LOG_SIZE;
+    float sleep = EnergyMeter::profile().sleepMicroamps / 1000.0f * (span - awake) / 3600.0f;
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, (wakeCharge + sleep) * 86400.0f / span, summary.mAhPerDay);
+}
+
+// Test: Nothing recorded yet
+void test_empty_log() {
+    EnergySummary summary = EnergyMeter::summary(80);
+    TEST_ASSERT_EQUAL(0, summary.wakes);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, summary.mAhPerDay);
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_phases_are_exclusive);
+    RUN_TEST(test_wake_charge);
+    RUN_TEST(test_per_day_includes_sleep);
+    RUN_TEST(test_span_follows_the_clock);
+    RUN_TEST(test_span_without_clock);
+    RUN_TEST(test_ring_keeps_last_wakes);
+    RUN_TEST(test_empty_log);
+
+    return UNITY_END();
+}
@@ -0,0 +1,207 @@
+#include <unity.h>
+#include <cstdio>
+#include <ctime>
+#include "util/energy_policy.h"
+#include "util/battery_manager.h"
+
+static const uint32_t HOUR = 3600;
+static const uint32_t WAKE_STEP = 15 * 60; // Trace resolution
+
+static time_t createTime(int year, int month, int day, int hour, int minute, int second) {
+    tm timeinfo = {};
+    timeinfo.tm_year = year - 1900;
+    timeinfo.tm_mon = month - 1;
+    timeinfo.tm_mday = day;
+    timeinfo.tm_hour = hour;
+    timeinfo.tm_min = minute;
+    timeinfo.tm_sec = second;
+    timeinfo.tm_isdst = -1;
+    return mktime(&timeinfo);
+}
+
+// 5 minute transport and 1 hour weather interval, stretchable to 30 minutes and 6 hours
+static EnergyTarget targetBy(uint32_t emptyBy) {
+    EnergyTarget target;
+    target.emptyBy = emptyBy;
+    target.transportSeconds = 5 * 60;
+    target.maxTransportSeconds = 30 * 60;
+    target.weatherSeconds = HOUR;
+    target.maxWeatherSeconds = 6 * HOUR;
+    return target;
+}
+
+/**
+ * Simulated battery: the wakes draw WAKE_DRAIN volts per hour at the configured intervals,
+ * sleep current SLEEP_DRAIN regardless of them. Readings carry up to +-8 mV of ADC noise.
+ */
+struct BatteryTrace {
+    static constexpr float WAKE_DRAIN = 0.010f;
+    static constexpr float SLEEP_DRAIN = 0.002f;
+
+    float voltage = BATTERY_VOLTAGE_MAX;
+    uint32_t noise = 12345;
+
+    void drain(uint32_t seconds, uint16_t stretchPercent) {
+        float rate = SLEEP_DRAIN + WAKE_DRAIN * 100.0f / stretchPercent;
+        voltage -= rate * seconds / HOUR;
+    }
+
+    float read() {
+        noise = noise * 1103515245u + 12345u;
+        return voltage + ((int)((noise >> 16) % 17) - 8) / 1000.0f;
+    }
+};
+
+struct TraceResult {
+    uint32_t emptyAt;     // 0 if the battery lasted
+    uint16_t maxStretch;
+    uint16_t maxStep;     // Largest stretch change between wakes, percent of the previous stretch
+};
+
+static TraceResult runTrace(uint32_t start, uint32_t end, const EnergyTarget& target, bool adaptive) {
+    DischargeState state = {};
+    BatteryTrace battery;
+    TraceResult result = {0, 100, 0};
+    uint16_t stretch = 100;
+    for (uint32_t now = start; now < end; now += WAKE_STEP) {
+        if (adaptive) {
+            EnergyPlan plan = EnergyPolicy::plan(state, battery.read(), now, target);
+            uint16_t step = (uint16_t)((plan.stretchPercent > stretch ? plan.stretchPercent - stretch
+                                                                       : stretch - plan.stretchPercent) *
+                                       100 / stretch);
+            if (step > result.maxStep) result.maxStep = step;
+            if (plan.stretchPercent > result.maxStretch) result.maxStretch = plan.stretchPercent;
+            stretch = plan.stretchPercent;
+        }
+        battery.drain(WAKE_STEP, stretch);
+        if (battery.voltage <= BATTERY_VOLTAGE_MIN) {
+            result.emptyAt = now;
+            break;
+        }
+    }
+    return result;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Test: At the configured intervals the trace runs empty after about 3.6 days
+void test_trace_without_policy_runs_empty() {
+    uint32_t start = (uint32_t)createTime(2025, 10, 27, 8, 0, 0); // Monday
+    TraceResult result = runTrace(start, start + 7 * 24 * HOUR, targetBy(0), false);
+
+    printf("Without policy: empty after %.1f days\n", (result.emptyAt - start) / 86400.0f);
+    TEST_ASSERT_NOT_EQUAL(0, result.emptyAt);
+    TEST_ASSERT_LESS_THAN(4 * 24 * HOUR, result.emptyAt - start);
+}
+
+// Test: "Last until Sunday" from Monday morning stretches the intervals enough to get there
+void test_trace_lasts_until_charge_day() {
+    uint32_t start = (uint32_t)createTime(2025, 10, 27, 8, 0, 0); // Monday
+    uint32_t sundayEnd = EnergyPolicy::endOfNextWeekday(0, start);
+    TraceResult result = runTrace(start, sundayEnd, targetBy(sundayEnd), true);
+
+    printf("Until Sunday: max stretch %u%%, largest step %u%%\n", result.maxStretch, result.maxStep);
+    TEST_ASSERT_EQUAL(0, result.emptyAt);
+    TEST_ASSERT_GREATER_THAN(100, result.maxStretch);
+    TEST_ASSERT_LESS_OR_EQUAL(600, result.maxStretch); // 30 of 5 minutes
+    TEST_ASSERT_LESS_OR_EQUAL(50, result.maxStep);
+}
+
+// Test: A target the battery reaches anyway keeps the configured intervals until the reserve
+void test_reachable_target_keeps_intervals() {
+    uint32_t start = (uint32_t)createTime(2025, 10, 27, 8, 0, 0);
+    EnergyTarget target = targetBy(start + 48 * HOUR);
+    DischargeState state = {};
+    BatteryTrace battery;
+
+    for (uint32_t now = start; now < target.emptyBy; now += WAKE_STEP) {
+        EnergyPlan plan = EnergyPolicy::plan(state, battery.read(), now, target);
+        TEST_ASSERT_EQUAL(100, plan.stretchPercent);
+        TEST_ASSERT_EQUAL(5 * 60, plan.transportSeconds);
+        TEST_ASSERT_EQUAL(HOUR, plan.weatherSeconds);
+        battery.drain(WAKE_STEP, plan.stretchPercent);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.012f, state.voltsPerHour); // Wake and sleep drain
+}
+
+// Test: Without a target, only the last RESERVE_FRACTION of charge stretches the intervals
+void test_reserve_stretch_without_target() {
+    uint32_t now = (uint32_t)createTime(2025, 10, 27, 8, 0, 0);
+    float span = BATTERY_VOLTAGE_MAX - BATTERY_VOLTAGE_MIN;
+    DischargeState state = {};
+
+    EnergyPlan plan = EnergyPolicy::plan(state, BATTERY_VOLTAGE_MIN + span * 0.5f, now, targetBy(0));
+    TEST_ASSERT_EQUAL(100, plan.stretchPercent);
+
+    // Stretch grows towards RESERVE_STRETCH in steps of at most MAX_STEP
+    uint16_t previous = 100;
+    for (int wake = 1; wake <= 8; wake++) {
+        plan = EnergyPolicy::plan(state, BATTERY_VOLTAGE_MIN + span * 0.01f, now + wake * WAKE_STEP, targetBy(0));
+        TEST_ASSERT_GREATER_OR_EQUAL(previous, plan.stretchPercent);
+        TEST_ASSERT_LESS_OR_EQUAL(previous * 3 / 2 + 1, plan.stretchPercent);
+        previous = plan.stretchPercent;
+    }
+    TEST_ASSERT_INT_WITHIN(5, 290, plan.stretchPercent);
+    TEST_ASSERT_EQUAL(5 * 60 * plan.stretchPercent / 100, plan.transportSeconds);
+}
+
+// Test: Charging (voltage rise) returns to the configured intervals
+void test_charge_resets_stretch() {
+    uint32_t now = (uint32_t)createTime(2025, 10, 27, 8, 0, 0);
+    DischargeState state = {BATTERY_VOLTAGE_MIN + 0.1f, now - HOUR, 0.02f, 400};
+
+    EnergyPlan plan = EnergyPolicy::plan(state, BATTERY_VOLTAGE_MAX, now, targetBy(0));
+
+    TEST_ASSERT_EQUAL(100, plan.stretchPercent);
+    TEST_ASSERT_EQUAL_FLOAT(BATTERY_VOLTAGE_MAX, state.anchorVoltage);
+    TEST_ASSERT_EQUAL_UINT32(now, state.anchorTime);
+}
+
+// Test: Readings closer together than MIN_SAMPLE_SECONDS or MIN_SAMPLE_DROP are not sampled
+void test_noise_is_not_sampled() {
+    uint32_t now = (uint32_t)createTime(2025, 10, 27, 8, 0, 0);
+    DischargeState state = {};
+
+    EnergyPolicy::plan(state, 3.800f, now, targetBy(0));
+    EnergyPolicy::plan(state, 3.790f, now + HOUR, targetBy(0)); // Too soon
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, state.voltsPerHour);
+    EnergyPolicy::plan(state, 3.795f, now + 3 * HOUR, targetBy(0)); // Within the noise
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, state.voltsPerHour);
+
+    EnergyPolicy::plan(state, 3.770f, now + 4 * HOUR, targetBy(0));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0075f, state.voltsPerHour);
+}
+
+// Test: Stretched intervals stay within the configured and maximum interval
+void test_stretch_interval_bounds() {
+    TEST_ASSERT_EQUAL(300, EnergyPolicy::stretchInterval(300, 1800, 100));
+    TEST_ASSERT_EQUAL(750, EnergyPolicy::stretchInterval(300, 1800, 250));
+    TEST_ASSERT_EQUAL(1800, EnergyPolicy::stretchInterval(300, 1800, 900));
+    TEST_ASSERT_EQUAL(300, EnergyPolicy::stretchInterval(300, 1800, 50));
+    // A maximum below the configured interval disables stretching
+    TEST_ASSERT_EQUAL(3 * HOUR, EnergyPolicy::stretchInterval(3 * HOUR, HOUR, 300));
+}
+
+// Test: The charge day ends at the midnight after it, today included
+void test_end_of_next_weekday() {
+    uint32_t monday = (uint32_t)createTime(2025, 10, 27, 8, 0, 0);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)createTime(2025, 11, 3, 0, 0, 0), EnergyPolicy::endOfNextWeekday(0, monday));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)createTime(2025, 10, 28, 0, 0, 0), EnergyPolicy::endOfNextWeekday(1, monday));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)createTime(2025, 10, 29, 0, 0, 0), EnergyPolicy::endOfNextWeekday(2, monday));
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_trace_without_policy_runs_empty);
+    RUN_TEST(test_trace_lasts_until_charge_day);
+    RUN_TEST(test_reachable_target_keeps_intervals);
+    RUN_TEST(test_reserve_stretch_without_target);
+    RUN_TEST(test_charge_resets_stretch);
+    RUN_TEST(test_noise_is_not_sampled);
+    RUN_TEST(test_stretch_interval_bounds);
+    RUN_TEST(test_end_of_next_weekday);
+
+    return UNITY_END();
+}
@@ -0,0 +1,479 @@
+/**
+ * Fleet wake simulation: N devices with varied configs, jitter seeds and button presses run
+ * the real TimingManager over simulated weeks on MockTime. Each wake mirrors
+ * ActivityManager and DeviceModeManager: button wake, OTA check at its configured minute,
+ * the fetches of the effective display mode, then the sleep TimingManager asks for.
+ *
+ * Only TimingManager and EnergyPolicy are the real code. The config comes from the
+ * ConfigManager mock of the timing tests, and the wake flow around them is a copy in this
+ * file, so it can drift from ActivityManager and DeviceModeManager; update simulateWake()
+ * when they change.
+ *
+ * Reports per-second request counts for RMV and Open-Meteo, per-device wake counts and an
+ * energy estimate. Run with:
+ *
+ *   pio test -e native-fleet -v
+ *
+ * FLEET_DEVICES, FLEET_DAYS and FLEET_SEED override the defaults; FLEET_CSV=<path> writes
+ * the per-second histogram (seconds with requests only) for plotting.
+ */
+#include <unity.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <vector>
+#include "util/timing_manager.h"
+#include "config/config_manager.h"
+#include "mock_time.h"
+
+static const uint32_t DAY = 24 * 3600;
+
+// Rough figures for the reference board (see docs/hardware-setup.md)
+static const float AWAKE_MA = 100.0f;     // WiFi and display refresh
+static const float SLEEP_MA = 0.03f;      // Deep sleep
+static const float BATTERY_MAH = 2000.0f;
+static const uint32_t FETCH_SECONDS = 2;  // One HTTPS request; half-and-half fetches in parallel
+static const uint32_t RENDER_SECONDS = 4; // Layout and full refresh
+
+struct DeviceProfile {
+    uint32_t jitterSeed;    // Stands in for the MAC address
+    uint8_t displayMode;
+    int transportInterval;  // Minutes
+    int weatherInterval;    // Hours
+    int walkingTime;
+    const char* activeStart;
+    const char* activeEnd;
+    const char* sleepStart;
+    const char* sleepEnd;
+    bool weekendMode;
+    bool otaEnabled;
+    char otaCheckTime[6];   // Randomized on first boot, like the firmware does
+    uint16_t headway;       // Minutes between departures at the stop, 0 = busy stop (change unknown)
+    uint8_t headwayPhase;
+    uint8_t connectSeconds; // WiFi association and DHCP until the first request
+    uint8_t bootDelay;      // Seconds after power returns
+    std::vector<uint32_t> presses;
+};
+
+struct DeviceStats {
+    uint8_t displayMode;
+    uint32_t wakes;
+    uint32_t awakeSeconds;
+    uint32_t sleepSeconds;
+    uint32_t rmvRequests;
+    uint32_t weatherRequests;
+};
+
+struct FleetResult {
+    uint32_t start;
+    uint32_t seconds;
+    std::vector<uint16_t> rmv;     // Requests per simulated second
+    std::vector<uint16_t> weather;
+    std::vector<DeviceStats> devices;
+    uint32_t otaChecks;
+};
+
+// xorshift32; deterministic across platforms, unlike rand()
+class Random {
+public:
+    explicit Random(uint32_t seed) : state(seed ? seed : 1) {}
+
+    uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    uint32_t below(uint32_t n) { return next() % n; }
+
+    template <typename T, size_t N>
+    const T& pick(const T (&options)[N]) { return options[below(N)]; }
+
+private:
+    uint32_t state;
+};
+
+static uint32_t envOr(const char* name, uint32_t fallback) {
+    const char* value = getenv(name);
+    return value && *value ? (uint32_t)strtoul(value, nullptr, 10) : fallback;
+}
+
+static time_t createTime(int year, int month, int day, int hour, int minute, int second) {
+    tm timeinfo = {};
+    timeinfo.tm_year = year - 1900;
+    timeinfo.tm_mon = month - 1;
+    timeinfo.tm_mday = day;
+    timeinfo.tm_hour = hour;
+    timeinfo.tm_min = minute;
+    timeinfo.tm_sec = second;
+    timeinfo.tm_isdst = -1;
+    return mktime(&timeinfo);
+}
+
+static std::vector<DeviceProfile> makeFleet(uint32_t count, uint32_t start, uint32_t days, uint32_t seed,
+                                            bool jitter) {
+    static const uint8_t MODES[] = {
+        DISPLAY_MODE_HALF_AND_HALF, DISPLAY_MODE_HALF_AND_HALF, DISPLAY_MODE_HALF_AND_HALF,
+        DISPLAY_MODE_TRANSPORT_ONLY, DISPLAY_MODE_WEATHER_ONLY,
+    };
+    static const int TRANSPORT_INTERVALS[] = {3, 3, 5, 5, 5, 10, 15};
+    static const int WEATHER_INTERVALS[] = {1, 2, 3, 3, 3, 6};
+    static const char* const WINDOWS[][2] = {
+        {"06:00", "09:00"}, {"06:00", "09:00"}, {"06:30", "08:30"}, {"07:00", "10:00"}, {"16:00", "19:00"},
+    };
+    static const char* const SLEEPS[][2] = {{"22:30", "05:30"}, {"23:00", "06:00"}, {"00:00", "06:00"}};
+    static const uint16_t HEADWAYS[] = {0, 0, 10, 15, 20, 30};
+
+    Random random(seed);
+    std::vector<DeviceProfile> fleet(count);
+    for (uint32_t i = 0; i < count; i++) {
+        DeviceProfile& device = fleet[i];
+        device.jitterSeed = jitter ? random.next() : 0;
+        device.displayMode = random.pick(MODES);
+        device.transportInterval = random.pick(TRANSPORT_INTERVALS);
+        device.weatherInterval = random.pick(WEATHER_INTERVALS);
+        device.walkingTime = 2 + random.below(9);
+        const char* const* window = random.pick(WINDOWS);
+        device.activeStart = window[0];
+        device.activeEnd = window[1];
+        const char* const* sleep = random.pick(SLEEPS);
+        device.sleepStart = sleep[0];
+        device.sleepEnd = sleep[1];
+        device.weekendMode = random.below(2) == 0;
+        device.otaEnabled = random.below(10) != 0;
+        snprintf(device.otaCheckTime, sizeof(device.otaCheckTime), "%02u:%02u", 1 + random.below(4),
+                 random.below(60));
+        device.headway = random.pick(HEADWAYS);
+        device.headwayPhase = device.headway ? random.below(device.headway) : 0;
+        device.connectSeconds = 2 + random.below(5);
+        device.bootDelay = random.below(5);
+
+        // Up to two presses a day between 07:00 and 21:00
+        uint32_t pressesPerDay = random.below(3);
+        for (uint32_t day = 0; day < days; day++) {
+            for (uint32_t p = 0; p < pressesPerDay; p++) {
+                device.presses.push_back(start + day * DAY + 7 * 3600 + random.below(14 * 3600));
+            }
+        }
+        std::sort(device.presses.begin(), device.presses.end());
+    }
+    return fleet;
+}
+
+// When the first reachable departure leaves, as DeviceModeManager records it after a fetch
+static uint32_t departureChange(const DeviceProfile& device, uint32_t now) {
+    if (device.headway == 0) return 0;
+    uint32_t headway = device.headway * 60;
+    uint32_t reachable = now + device.walkingTime * 60;
+    uint32_t phase = device.headwayPhase * 60;
+    uint32_t departure = ((reachable - phase + headway - 1) / headway) * headway + phase;
+    return departure - device.walkingTime * 60;
+}
+
+static void configure(const DeviceProfile& device) {
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.displayMode = device.displayMode;
+    config.transportInterval = device.transportInterval;
+    config.weatherInterval = device.weatherInterval;
+    config.walkingTime = device.walkingTime;
+    strcpy(config.transportActiveStart, device.activeStart);
+    strcpy(config.transportActiveEnd, device.activeEnd);
+    strcpy(config.sleepStart, device.sleepStart);
+    strcpy(config.sleepEnd, device.sleepEnd);
+    config.weekendMode = device.weekendMode;
+    strcpy(config.weekendTransportStart, "08:00");
+    strcpy(config.weekendTransportEnd, "20:00");
+    strcpy(config.weekendSleepStart, "23:00");
+    strcpy(config.weekendSleepEnd, "07:00");
+    config.otaEnabled = device.otaEnabled;
+    strcpy(config.otaCheckTime, device.otaCheckTime);
+    config.inTemporaryMode = false;
+    config.temporaryDisplayMode = 0xFF;
+    config.temporaryModeActivationTime = 0;
+
+    // Power-on: RTC memory is cleared
+    TimingManager::setLastWeatherUpdate(0);
+    TimingManager::setLastTransportUpdate(0);
+    TimingManager::setLastOTACheck(0);
+    TimingManager::setNextDepartureChange(0);
+    TimingManager::setIntervalStretch(100);
+    TimingManager::setDeviceJitterSeed(device.jitterSeed);
+}
+
+static bool otaTimeMatches(const RTCConfigData& config, uint32_t now) {
+    int hour = 0;
+    int minute = 0;
+    if (!config.otaEnabled || sscanf(config.otaCheckTime, "%d:%d", &hour, &minute) != 2) return false;
+    tm timeInfo;
+    time_t current = (time_t)now;
+    localtime_r(&current, &timeInfo);
+    return timeInfo.tm_hour == hour && abs(timeInfo.tm_min - minute) <= 1;
+}
+
+static void record(FleetResult& result, std::vector<uint16_t>& histogram, uint32_t now) {
+    if (now >= result.start && now - result.start < result.seconds) histogram[now - result.start]++;
+}
+
+// One wake: ActivityManager::onStart() to onStop()
+static uint32_t simulateWake(const DeviceProfile& device, DeviceStats& stats, FleetResult& result, uint32_t wake,
+                             bool pressed) {
+    RTCConfigData& config = ConfigManager::getConfig();
+    uint32_t now = wake + device.connectSeconds;
+    MockTime::setMockTime(now);
+
+    // ButtonManager::handleWakeupMode()
+    if (pressed) {
+        config.inTemporaryMode = true;
+        config.temporaryDisplayMode = config.displayMode == DISPLAY_MODE_WEATHER_ONLY
+                                          ? DISPLAY_MODE_TRANSPORT_ONLY
+                                          : DISPLAY_MODE_WEATHER_ONLY;
+        config.temporaryModeActivationTime = now;
+    } else if (config.inTemporaryMode && now - config.temporaryModeActivationTime >= 120) {
+        config.inTemporaryMode = false;
+        config.temporaryDisplayMode = 0xFF;
+        config.temporaryModeActivationTime = 0;
+    }
+
+    // OTAManager::checkAndApplyUpdate(), up to date
+    if (otaTimeMatches(config, now)) {
+        result.otaChecks++;
+        TimingManager::setLastOTACheck(now);
+    }
+
+    uint8_t mode = TimingManager::getEffectiveDisplayMode();
+    bool weather = mode != DISPLAY_MODE_TRANSPORT_ONLY && TimingManager::isTimeForWeatherUpdate();
+    bool transport = mode != DISPLAY_MODE_WEATHER_ONLY;
+    if (weather) {
+        record(result, result.weather, now);
+        stats.weatherRequests++;
+    }
+    if (transport) {
+        record(result, result.rmv, now);
+        stats.rmvRequests++;
+    }
+
+    // Half-and-half fetches both in parallel, the others only fetch one
+    uint32_t fetched = now + (weather || transport ? FETCH_SECONDS : 0);
+    MockTime::setMockTime(fetched);
+    if (weather) TimingManager::markWeatherUpdated();
+    if (transport) {
+        TimingManager::markTransportUpdated();
+        TimingManager::setNextDepartureChange(departureChange(device, fetched));
+    }
+
+    uint32_t done = fetched + RENDER_SECONDS;
+    MockTime::setMockTime(done);
+    uint32_t sleep = (uint32_t)TimingManager::getNextSleepDurationSeconds();
+
+    stats.wakes++;
+    stats.awakeSeconds += done - wake;
+    stats.sleepSeconds += sleep;
+    return done + sleep;
+}
+
+static FleetResult simulateFleet(const std::vector<DeviceProfile>& fleet, uint32_t start, uint32_t seconds) {
+    FleetResult result;
+    result.start = start;
+    result.seconds = seconds;
+    result.rmv.assign(seconds, 0);
+    result.weather.assign(seconds, 0);
+    result.otaChecks = 0;
+
+    for (const DeviceProfile& device : fleet) {
+        configure(device);
+        DeviceStats stats = {};
+        stats.displayMode = device.displayMode;
+        size_t press = 0;
+        uint32_t wake = start + device.bootDelay;
+        while (wake < start + seconds) {
+            // A button press wakes the device early; presses while awake are not simulated
+            bool pressed = press < device.presses.size() && device.presses[press] <= wake;
+            if (pressed) wake = device.presses[press];
+            while (press < device.presses.size() && device.presses[press] <= wake) press++;
+            wake = simulateWake(device, stats, result, wake, pressed);
+        }
+        result.devices.push_back(stats);
+    }
+    MockTime::useRealTime();
+    return result;
+}
+
+struct HistogramSummary {
+    uint32_t total;
+    uint16_t peak;
+    uint32_t peakSecond;
+    uint16_t p999;  // 99.9th percentile of the seconds with requests
+    uint32_t busySeconds;
+};
+
+static HistogramSummary summarize(const std::vector<uint16_t>& histogram) {
+    HistogramSummary summary = {0, 0, 0, 0, 0};
+    std::vector<uint16_t> busy;
+    for (uint32_t s = 0; s < histogram.size(); s++) {
+        if (!histogram[s]) continue;
+        summary.total += histogram[s];
+        busy.push_back(histogram[s]);
+        if (histogram[s] > summary.peak) {
+            summary.peak = histogram[s];
+            summary.peakSecond = s;
+        }
+    }
+    summary.busySeconds = busy.size();
+    if (!busy.empty()) {
+        std::sort(busy.begin(), busy.end());
+        summary.p999 = busy[std::min(busy.size() - 1, busy.size() * 999 / 1000)];
+    }
+    return summary;
+}
+
+static uint16_t peakBetween(const std::vector<uint16_t>& histogram, uint32_t from, uint32_t to) {
+    uint16_t peak = 0;
+    for (uint32_t s = from; s < to && s < histogram.size(); s++) peak = std::max(peak, histogram[s]);
+    return peak;
+}
+
+static void printTopSeconds(const char* api, const std::vector<uint16_t>& histogram, uint32_t start) {
+    std::vector<uint32_t> order;
+    for (uint32_t s = 0; s < histogram.size(); s++) {
+        if (histogram[s]) order.push_back(s);
+    }
+    size_t shown = std::min<size_t>(5, order.size());
+    std::partial_sort(order.begin(), order.begin() + shown, order.end(),
+                      [&](uint32_t a, uint32_t b) { return histogram[a] > histogram[b]; });
+    for (size_t i = 0; i < shown; i++) {
+        char when[32];
+        time_t at = (time_t)(start + order[i]);
+        strftime(when, sizeof(when), "%a %H:%M:%S", localtime(&at));
+        printf("  %-10s %4u req/s at %s\n", api, histogram[order[i]], when);
+    }
+}
+
+static float mahPerDay(const DeviceStats& stats, uint32_t days) {
+    return (stats.awakeSeconds * AWAKE_MA + stats.sleepSeconds * SLEEP_MA) / 3600.0f / days;
+}
+
+static void printReport(const FleetResult& result, uint32_t days) {
+    static const char* const MODE_NAMES[] = {"half-and-half", "weather-only", "transport-only"};
+
+    printf("\n=== Fleet: %u devices, %u days ===\n", (unsigned)result.devices.size(), days);
+    const char* apis[] = {"RMV", "Open-Meteo"};
+    const std::vector<uint16_t>* histograms[] = {&result.rmv, &result.weather};
+    for (int i = 0; i < 2; i++) {
+        HistogramSummary s = summarize(*histograms[i]);
+        printf("%-10s %8u requests, %6u busy seconds, peak %u req/s, p99.9 %u req/s\n", apis[i], s.total,
+               s.busySeconds, s.peak, s.p999);
+    }
+    printf("OTA checks: %u\n", result.otaChecks);
+    printf("Busiest seconds:\n");
+    printTopSeconds("RMV", result.rmv, result.start);
+    printTopSeconds("Open-Meteo", result.weather, result.start);
+
+    printf("Per device (min / median / max):\n");
+    for (uint8_t mode = 0; mode < 3; mode++) {
+        std::vector<float> wakes;
+        std::vector<float> energy;
+        for (const DeviceStats& stats : result.devices) {
+            if (stats.displayMode != mode) continue;
+            wakes.push_back((float)stats.wakes / days);
+            energy.push_back(mahPerDay(stats, days));
+        }
+        if (wakes.empty()) continue;
+        std::sort(wakes.begin(), wakes.end());
+        std::sort(energy.begin(), energy.end());
+        size_t mid = wakes.size() / 2;
+        printf("  %-15s %4u devices, wakes/day %5.0f / %5.0f / %5.0f, mAh/day %5.1f / %5.1f / %5.1f, "
+               "%.0f days on %.0f mAh (median)\n",
+               MODE_NAMES[mode], (unsigned)wakes.size(), wakes.front(), wakes[mid], wakes.back(), energy.front(),
+               energy[mid], energy.back(), BATTERY_MAH / energy[mid], BATTERY_MAH);
+    }
+}
+
+static void writeCsv(const FleetResult& result, const char* path) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("Cannot write %s\n", path);
+        return;
+    }
+    fprintf(file, "second,timestamp,rmv,open_meteo\n");
+    for (uint32_t s = 0; s < result.seconds; s++) {
+        if (result.rmv[s] || result.weather[s]) {
+            fprintf(file, "%u,%u,%u,%u\n", s, result.start + s, result.rmv[s], result.weather[s]);
+        }
+    }
+    fclose(file);
+    printf("Histogram written to %s\n", path);
+}
+
+void setUp(void) {}
+
+void tearDown(void) {
+    MockTime::useRealTime();
+    TimingManager::setDeviceJitterSeed(0xDEADBEEF);
+}
+
+// Test: A week of the whole fleet, the report the simulation is for
+void test_fleet_week_report() {
+    uint32_t devices = envOr("FLEET_DEVICES", 1000);
+    uint32_t days = envOr("FLEET_DAYS", 7);
+    uint32_t start = (uint32_t)createTime(2025, 10, 27, 0, 0, 0); // Monday, power returns at midnight
+    std::vector<DeviceProfile> fleet = makeFleet(devices, start, days, envOr("FLEET_SEED", 1), true);
+
+    FleetResult result = simulateFleet(fleet, start, days * DAY);
+    printReport(result, days);
+    const char* csv = getenv("FLEET_CSV");
+    if (csv && *csv) writeCsv(result, csv);
+
+    for (const DeviceStats& stats : result.devices) {
+        TEST_ASSERT_GREATER_THAN(days, stats.wakes); // At least daily
+        TEST_ASSERT_LESS_OR_EQUAL(stats.wakes, stats.rmvRequests);
+        TEST_ASSERT_LESS_OR_EQUAL(stats.wakes, stats.weatherRequests);
+        // Never more often than the shortest interval allows (plus button presses)
+        TEST_ASSERT_LESS_OR_EQUAL(days * DAY / 150, stats.wakes);
+    }
+}
+
+// Identical devices on one network: the same config and connect time, only the seed differs
+static std::vector<DeviceProfile> uniformFleet(uint32_t count, uint32_t start, bool jitter) {
+    std::vector<DeviceProfile> fleet = makeFleet(count, start, 1, 7, jitter);
+    for (DeviceProfile& device : fleet) {
+        uint32_t seed = device.jitterSeed;
+        device = fleet[0];
+        device.jitterSeed = seed;
+        device.displayMode = DISPLAY_MODE_HALF_AND_HALF;
+        device.connectSeconds = 3;
+        device.bootDelay = 0;
+        device.presses.clear();
+    }
+    return fleet;
+}
+
+// Report: How far the first-wake jitter spreads identical devices that boot at once.
+// It is only added while no update has been recorded, but the first wake fetches (and
+// records) before it computes the sleep, so a fleet whose first fetch succeeds stays
+// aligned. Only devices whose first fetch failed are spread. Nothing is asserted, so a
+// fix of the jitter shows up in the printed peaks without breaking the suite.
+void test_boot_jitter_spread() {
+    uint32_t devices = 500;
+    uint32_t boot = (uint32_t)createTime(2025, 10, 28, 7, 0, 0); // Tuesday, inside most transport windows
+
+    FleetResult withJitter = simulateFleet(uniformFleet(devices, boot, true), boot, 3600);
+    FleetResult withoutJitter = simulateFleet(uniformFleet(devices, boot, false), boot, 3600);
+
+    // The boot itself is not spread; look at the following wakes
+    uint16_t peakWith = peakBetween(withJitter.rmv, 60, 3600);
+    uint16_t peakWithout = peakBetween(withoutJitter.rmv, 60, 3600);
+    printf("RMV peak after the boot of %u devices: %u req/s with jitter, %u without\n", devices, peakWith,
+           peakWithout);
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_fleet_week_report);
+    RUN_TEST(test_boot_jitter_spread);
+
+    return UNITY_END();
+}
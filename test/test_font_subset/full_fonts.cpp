@@ -0,0 +1,14 @@
+// The full fonts of U8g2_for_Adafruit_GFX, compiled without the rest of the library (its renderer
+// needs Adafruit GFX). They come straight from the library, not through the subsetter's parser.
+#include "u8g2_fonts.c"
+#include "full_fonts.h"
+
+const uint8_t* const FULL_FONTS[FONT_COUNT] = {
+    u8g2_font_helvB08_tf, u8g2_font_helvB10_tf, u8g2_font_helvB12_tf,
+    u8g2_font_helvB14_tf, u8g2_font_helvB18_tf, u8g2_font_helvB24_tf,
+};
+
+const size_t FULL_FONT_SIZES[FONT_COUNT] = {
+    sizeof(u8g2_font_helvB08_tf), sizeof(u8g2_font_helvB10_tf), sizeof(u8g2_font_helvB12_tf),
+    sizeof(u8g2_font_helvB14_tf), sizeof(u8g2_font_helvB18_tf), sizeof(u8g2_font_helvB24_tf),
+};
@@ -0,0 +1,8 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// helvB08, 10, 12, 14, 18 and 24 as the library ships them, in the order of Fonts::HELVBxx
+static const size_t FONT_COUNT = 6;
+extern const uint8_t* const FULL_FONTS[FONT_COUNT];
+extern const size_t FULL_FONT_SIZES[FONT_COUNT];
@@ -0,0 +1,154 @@
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+#include "display/fonts.h"
+#include "full_fonts.h"
+
+#if !FONT_SUBSET
+#error "tools/subset_fonts.py did not generate the subsets, see its output above"
+#endif
+
+static const char* const FONT_NAMES[FONT_COUNT] = {"helvB08", "helvB10", "helvB12", "helvB14", "helvB18", "helvB24"};
+static const uint8_t* const SUBSETS[FONT_COUNT] = {Fonts::HELVB08, Fonts::HELVB10, Fonts::HELVB12,
+                                                   Fonts::HELVB14, Fonts::HELVB18, Fonts::HELVB24};
+
+// U8g2 font header (u8g2_read_font_info)
+static const size_t HEADER_SIZE = 23;
+static const size_t BITS_PER_CHAR_WIDTH = 4;
+static const size_t START_POS_UPPER_A = 17;
+static const size_t START_POS_LOWER_A = 19;
+static const size_t START_POS_UNICODE = 21;
+
+static uint16_t word(const uint8_t* p) { return (p[0] << 8) | p[1]; }
+
+// Glyph record of an 8-bit encoding, searched like u8g2_font_get_glyph_data(); nullptr if missing
+static const uint8_t* findGlyph(const uint8_t* font, uint16_t encoding) {
+    const uint8_t* p = font + HEADER_SIZE;
+    if (encoding >= 'a') {
+        p += word(font + START_POS_LOWER_A);
+    } else if (encoding >= 'A') {
+        p += word(font + START_POS_UPPER_A);
+    }
+    for (; p[1] != 0; p += p[1]) {
+        if (p[0] == encoding) return p;
+    }
+    return nullptr;
+}
+
+// Reads the glyph header bit fields LSB first, like u8g2_font_decode_get_unsigned_bits()
+struct BitReader {
+    const uint8_t* p;
+    uint8_t bit;
+
+    unsigned get(uint8_t count) {
+        unsigned value = *p >> bit;
+        bit += count;
+        if (bit >= 8) {
+            value |= *++p << (8 - (bit - count));
+            bit -= 8;
+        }
+        return value & ((1u << count) - 1);
+    }
+
+    int getSigned(uint8_t count) { return static_cast<int>(get(count)) - (1 << (count - 1)); }
+};
+
+// How far U8g2 moves the cursor after the glyph (delta x, after width, height and offsets)
+static int advanceWidth(const uint8_t* font, const uint8_t* glyph) {
+    const uint8_t* bits = font + BITS_PER_CHAR_WIDTH;
+    BitReader reader = {glyph + 2, 0};
+    reader.get(bits[0]);
+    reader.get(bits[1]);
+    reader.getSigned(bits[2]);
+    reader.getSigned(bits[3]);
+    return reader.getSigned(bits[4]);
+}
+
+static bool kept(uint16_t codepoint) {
+    return codepoint < 0x100 && (Fonts::SUBSET_GLYPHS[codepoint >> 3] & (1 << (codepoint & 7)));
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_subset_keeps_the_font_metrics() {
+    for (size_t i = 0; i < FONT_COUNT; i++) {
+        const uint8_t* full = FULL_FONTS[i];
+        const uint8_t* subset = SUBSETS[i];
+        // Bounding box mode, bit field widths, ascent and descent: all but the glyph count and offsets
+        TEST_ASSERT_EQUAL_HEX8_ARRAY_MESSAGE(full + 1, subset + 1, START_POS_UPPER_A - 1, FONT_NAMES[i]);
+
+        unsigned glyphs = 0;
+        for (const uint8_t* p = subset + HEADER_SIZE; p[1] != 0; p += p[1]) glyphs++;
+        TEST_ASSERT_EQUAL_MESSAGE(glyphs, subset[0], FONT_NAMES[i]);
+        TEST_ASSERT_LESS_THAN_MESSAGE(full[0], subset[0], FONT_NAMES[i]);
+    }
+}
+
+void test_kept_glyphs_match_the_full_fonts() {
+    char message[48];
+    for (size_t i = 0; i < FONT_COUNT; i++) {
+        for (uint16_t codepoint = 0x20; codepoint < 0x100; codepoint++) {
+            snprintf(message, sizeof(message), "%s U+%04X", FONT_NAMES[i], codepoint);
+            const uint8_t* full = findGlyph(FULL_FONTS[i], codepoint);
+            const uint8_t* subset = findGlyph(SUBSETS[i], codepoint);
+            if (!kept(codepoint) || !full) {
+                TEST_ASSERT_NULL_MESSAGE(subset, message);
+                continue;
+            }
+            TEST_ASSERT_NOT_NULL_MESSAGE(subset, message);
+            TEST_ASSERT_EQUAL_MESSAGE(full[1], subset[1], message);
+            TEST_ASSERT_EQUAL_HEX8_ARRAY_MESSAGE(full, subset, full[1], message);
+            TEST_ASSERT_EQUAL_MESSAGE(advanceWidth(FULL_FONTS[i], full), advanceWidth(SUBSETS[i], subset), message);
+        }
+    }
+}
+
+void test_ascii_and_german_letters_are_kept() {
+    const uint16_t german[] = {0xC4, 0xD6, 0xDC, 0xE4, 0xF6, 0xFC, 0xDF, 0xB0}; // ÄÖÜäöüß°
+    for (size_t i = 0; i < FONT_COUNT; i++) {
+        for (uint16_t codepoint = 0x20; codepoint < 0x7F; codepoint++) {
+            TEST_ASSERT_NOT_NULL_MESSAGE(findGlyph(SUBSETS[i], codepoint), FONT_NAMES[i]);
+        }
+        for (uint16_t codepoint : german) {
+            TEST_ASSERT_NOT_NULL_MESSAGE(findGlyph(SUBSETS[i], codepoint), FONT_NAMES[i]);
+        }
+    }
+}
+
+void test_unicode_section_is_unchanged() {
+    for (size_t i = 0; i < FONT_COUNT; i++) {
+        const uint8_t* full = FULL_FONTS[i];
+        const uint8_t* subset = SUBSETS[i];
+        size_t length = FULL_FONT_SIZES[i] - HEADER_SIZE - word(full + START_POS_UNICODE);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY_MESSAGE(full + HEADER_SIZE + word(full + START_POS_UNICODE),
+                                             subset + HEADER_SIZE + word(subset + START_POS_UNICODE), length,
+                                             FONT_NAMES[i]);
+    }
+}
+
+void test_fallbacks_are_in_every_subset() {
+    const uint16_t others[] = {0x2013, 0x2014, 0x2018, 0x2019, 0x201E, 0x201C, 0x2026, 0x20AC, 0x2192};
+    char message[48];
+    for (size_t i = 0; i < FONT_COUNT; i++) {
+        for (uint16_t codepoint = 0xA0; codepoint < 0x100; codepoint++) {
+            snprintf(message, sizeof(message), "%s U+%04X", FONT_NAMES[i], codepoint);
+            TEST_ASSERT_NOT_NULL_MESSAGE(findGlyph(SUBSETS[i], Fonts::printable(codepoint)), message);
+        }
+        for (uint16_t codepoint : others) {
+            snprintf(message, sizeof(message), "%s U+%04X", FONT_NAMES[i], codepoint);
+            TEST_ASSERT_NOT_NULL_MESSAGE(findGlyph(SUBSETS[i], Fonts::printable(codepoint)), message);
+        }
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_subset_keeps_the_font_metrics);
+    RUN_TEST(test_kept_glyphs_match_the_full_fonts);
+    RUN_TEST(test_ascii_and_german_letters_are_kept);
+    RUN_TEST(test_unicode_section_is_unchanged);
+    RUN_TEST(test_fallbacks_are_in_every_subset);
+    return UNITY_END();
+}
@@ -0,0 +1,195 @@
+#include <unity.h>
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include "api/http_body_stream.h"
+
+// The next response on a keep-alive connection; it must stay unread
+static const char NEXT_RESPONSE[] = "HTTP/1.1 200 OK\r\n";
+
+// Serves bytes like a network socket: available() only reports the current "packet"
+class SocketStream : public Stream {
+public:
+    SocketStream(const std::string& data, size_t packetSize) : data(data), packetSize(packetSize) {}
+
+    int available() override {
+        if (pos >= data.size()) return 0;
+        if (packetLeft == 0) packetLeft = packetSize;
+        return static_cast<int>(std::min(packetLeft, data.size() - pos));
+    }
+
+    int read() override {
+        if (pos >= data.size()) return -1; // Like a timeout on an idle connection
+        if (packetLeft > 0) packetLeft--;
+        return static_cast<unsigned char>(data[pos++]);
+    }
+
+    int peek() override { return pos < data.size() ? static_cast<unsigned char>(data[pos]) : -1; }
+
+    std::string rest() const { return data.substr(pos); }
+
+private:
+    std::string data;
+    size_t packetSize;
+    size_t packetLeft = 0;
+    size_t pos = 0;
+};
+
+static std::string chunked(const std::string& body, size_t chunkSize, const char* extension = "") {
+    std::string out;
+    char header[32];
+    for (size_t i = 0; i < body.size(); i += chunkSize) {
+        size_t n = std::min(chunkSize, body.size() - i);
+        snprintf(header, sizeof(header), "%zx%s\r\n", n, extension);
+        out += header;
+        out += body.substr(i, n);
+        out += "\r\n";
+    }
+    return out + "0\r\n\r\n";
+}
+
+static std::string readAll(HttpBodyStream& body, size_t readSize) {
+    std::string out;
+    std::string buf(readSize, '\0');
+    size_t n;
+    while ((n = body.readBytes(&buf[0], buf.size())) > 0) out.append(buf.data(), n);
+    return out;
+}
+
+static std::string sampleBody() {
+    std::string body = "{\"Departure\":[";
+    for (int i = 0; i < 40; i++) body += "{\"name\":\"Bus " + std::to_string(i) + "\"},";
+    return body + "{}],\"serverVersion\":\"1.0\"}";
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_chunked_body_is_decoded() {
+    std::string body = sampleBody();
+    const size_t chunkSizes[] = {1, 7, 100, 4096};
+    const size_t readSizes[] = {1, 13, 512};
+    for (size_t chunkSize : chunkSizes) {
+        for (size_t readSize : readSizes) {
+            SocketStream socket(chunked(body, chunkSize) + NEXT_RESPONSE, 5);
+            HttpBodyStream stream(socket, true, -1);
+            TEST_ASSERT_EQUAL_STRING(body.c_str(), readAll(stream, readSize).c_str());
+            TEST_ASSERT_TRUE(stream.skipRest()); // Only the terminator is left
+            TEST_ASSERT_TRUE(stream.isDone());
+            TEST_ASSERT_EQUAL_STRING(NEXT_RESPONSE, socket.rest().c_str());
+        }
+    }
+}
+
+void test_skip_rest_stops_at_the_chunk_terminator() {
+    std::string body = sampleBody();
+    SocketStream socket(chunked(body, 64) + NEXT_RESPONSE, 16);
+    HttpBodyStream stream(socket, true, -1);
+
+    // A parser that stops after the Departure array
+    std::string head(100, '\0');
+    TEST_ASSERT_EQUAL(100, stream.readBytes(&head[0], head.size()));
+    TEST_ASSERT_FALSE(stream.isDone());
+
+    TEST_ASSERT_TRUE(stream.skipRest());
+    TEST_ASSERT_EQUAL(body.size(), stream.bodyBytes());
+    TEST_ASSERT_EQUAL_STRING(NEXT_RESPONSE, socket.rest().c_str());
+}
+
+void test_extensions_and_trailers_are_skipped() {
+    std::string body = sampleBody();
+    std::string wire = chunked(body, 50, ";name=value");
+    wire.replace(wire.size() - 2, 2, "Expires: 0\r\n\r\n"); // Trailer field before the final empty line
+    SocketStream socket(wire + NEXT_RESPONSE, 3);
+    HttpBodyStream stream(socket, true, -1);
+
+    TEST_ASSERT_EQUAL_STRING(body.c_str(), readAll(stream, 32).c_str());
+    TEST_ASSERT_TRUE(stream.skipRest());
+    TEST_ASSERT_EQUAL_STRING(NEXT_RESPONSE, socket.rest().c_str());
+}
+
+void test_content_length_body_stops_at_its_length() {
+    std::string body = sampleBody();
+    SocketStream socket(body + NEXT_RESPONSE, 7);
+    HttpBodyStream stream(socket, false, static_cast<int>(body.size()));
+
+    std::string head(10, '\0');
+    TEST_ASSERT_EQUAL(10, stream.readBytes(&head[0], head.size()));
+    TEST_ASSERT_TRUE(stream.skipRest());
+    TEST_ASSERT_EQUAL_STRING(NEXT_RESPONSE, socket.rest().c_str());
+
+    SocketStream again(body + NEXT_RESPONSE, 7);
+    HttpBodyStream whole(again, false, static_cast<int>(body.size()));
+    TEST_ASSERT_EQUAL_STRING(body.c_str(), readAll(whole, 64).c_str());
+    TEST_ASSERT_TRUE(whole.isDone());
+    TEST_ASSERT_EQUAL(-1, whole.read());
+}
+
+void test_available_never_reaches_past_the_chunk() {
+    SocketStream socket(chunked("abcdef", 4) + NEXT_RESPONSE, 64);
+    HttpBodyStream stream(socket, true, -1);
+
+    TEST_ASSERT_EQUAL(4, stream.available());
+    TEST_ASSERT_EQUAL('a', stream.peek());
+    std::string head(4, '\0');
+    TEST_ASSERT_EQUAL(4, stream.readBytes(&head[0], head.size()));
+    TEST_ASSERT_EQUAL(2, stream.available());
+    TEST_ASSERT_EQUAL('e', stream.read());
+    TEST_ASSERT_EQUAL('f', stream.read());
+    TEST_ASSERT_EQUAL(0, stream.available());
+    TEST_ASSERT_EQUAL(-1, stream.read());
+    TEST_ASSERT_TRUE(stream.isDone());
+    TEST_ASSERT_EQUAL_STRING(NEXT_RESPONSE, socket.rest().c_str());
+}
+
+void test_unfinished_bodies_are_not_reported_clean() {
+    std::string body = sampleBody();
+
+    // More left than the skip limit
+    SocketStream large(chunked(body, 64), 64);
+    HttpBodyStream big(large, true, -1);
+    TEST_ASSERT_FALSE(big.skipRest(100));
+
+    // Connection ends before the terminator
+    std::string wire = chunked(body, 64);
+    SocketStream truncated(wire.substr(0, wire.size() - 3), 64);
+    HttpBodyStream cut(truncated, true, -1);
+    TEST_ASSERT_FALSE(cut.skipRest());
+    TEST_ASSERT_FALSE(cut.isDone());
+
+    // Neither chunked nor Content-Length: only the server closing the connection ends it
+    SocketStream unframed(body, 64);
+    HttpBodyStream open(unframed, false, -1);
+    TEST_ASSERT_EQUAL_STRING(body.c_str(), readAll(open, 64).c_str());
+    TEST_ASSERT_FALSE(open.skipRest());
+}
+
+void test_malformed_chunk_size_fails() {
+    SocketStream socket("zz\r\nabc\r\n0\r\n\r\n", 64);
+    HttpBodyStream stream(socket, true, -1);
+    TEST_ASSERT_EQUAL(-1, stream.read());
+    TEST_ASSERT_TRUE(stream.hasError());
+    TEST_ASSERT_FALSE(stream.skipRest());
+
+    // Chunk data longer than announced
+    SocketStream overlong("2\r\nabc\r\n0\r\n\r\n", 64);
+    HttpBodyStream longer(overlong, true, -1);
+    TEST_ASSERT_EQUAL_STRING("ab", readAll(longer, 8).c_str());
+    TEST_ASSERT_FALSE(longer.skipRest());
+    TEST_ASSERT_TRUE(longer.hasError());
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_chunked_body_is_decoded);
+    RUN_TEST(test_skip_rest_stops_at_the_chunk_terminator);
+    RUN_TEST(test_extensions_and_trailers_are_skipped);
+    RUN_TEST(test_content_length_body_stops_at_its_length);
+    RUN_TEST(test_available_never_reaches_past_the_chunk);
+    RUN_TEST(test_unfinished_bodies_are_not_reported_clean);
+    RUN_TEST(test_malformed_chunk_size_fails);
+
+    return UNITY_END();
+}
@@ -0,0 +1,257 @@
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "util/inflate_stream.h"
+#include "api/rmv_departure_parser.h"
+#include "api/rmv_json_parser.h"
+
+// Fixtures live in test/rmv/; pio runs native tests from the project root
+#define RMV_FIXTURE_DIR "test/rmv/"
+
+static std::string loadFile(const char* name) {
+    std::string path = std::string(RMV_FIXTURE_DIR) + name;
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return std::string();
+    std::string data;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.append(buf, n);
+    fclose(f);
+    return data;
+}
+
+// Serves bytes like a network socket: available() only reports the current "packet"
+class FixtureStream : public Stream {
+public:
+    FixtureStream(const std::string& data, size_t packetSize) : data(data), packetSize(packetSize) {}
+
+    int available() override {
+        if (pos >= data.size()) return 0;
+        if (packetLeft == 0) packetLeft = packetSize;
+        return static_cast<int>(std::min(packetLeft, data.size() - pos));
+    }
+
+    int read() override {
+        if (pos >= data.size()) return -1; // Like a timeout on a closed connection
+        if (packetLeft > 0) packetLeft--;
+        return static_cast<unsigned char>(data[pos++]);
+    }
+
+    int peek() override { return pos < data.size() ? static_cast<unsigned char>(data[pos]) : -1; }
+
+    size_t position() const { return pos; }
+
+private:
+    const std::string& data;
+    size_t packetSize;
+    size_t packetLeft = 0;
+    size_t pos = 0;
+};
+
+static std::string inflateAll(InflateStream& inflated, size_t readSize) {
+    std::string out;
+    std::vector<char> buf(readSize);
+    size_t n;
+    while ((n = inflated.readBytes(buf.data(), buf.size())) > 0) out.append(buf.data(), n);
+    return out;
+}
+
+// Produced with Python's zlib/gzip from the string below
+static const char SMALL_JSON[] = "{\"current\":{\"temperature_2m\":12.3},\"hourly\":{\"time\":[\"2025-10-16T00:00\","
+                                 "\"2025-10-16T01:00\",\"2025-10-16T02:00\"]}}";
+
+// zlib wrapper, fixed Huffman block
+static const uint8_t SMALL_ZLIB[] = {
+    0x78, 0xda, 0xab, 0x56, 0x4a, 0x2e, 0x2d, 0x2a, 0x4a, 0xcd, 0x2b, 0x51, 0xb2, 0xaa, 0x56, 0x2a, 0x49, 0xcd,
+    0x2d, 0x48, 0x2d, 0x4a, 0x2c, 0x29, 0x2d, 0x4a, 0x8d, 0x37, 0xca, 0x55, 0xb2, 0x32, 0x34, 0xd2, 0x33, 0xae,
+    0xd5, 0x51, 0xca, 0xc8, 0x2f, 0x2d, 0xca, 0xa9, 0x04, 0x2b, 0xc8, 0xcc, 0x4d, 0x55, 0xb2, 0x8a, 0x56, 0x32,
+    0x32, 0x30, 0x32, 0xd5, 0x35, 0x34, 0xd0, 0x35, 0x34, 0x0b, 0x31, 0x30, 0xb0, 0x32, 0x30, 0x50, 0xd2, 0x41,
+    0x11, 0x32, 0xc4, 0x14, 0x32, 0x02, 0x09, 0xc5, 0xd6, 0xd6, 0x02, 0x00, 0x85, 0x45, 0x1e, 0x5c};
+
+// gzip wrapper, stored (level 0) block
+static const uint8_t SMALL_GZIP_STORED[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01, 0x70, 0x00, 0x8f, 0xff, 0x7b, 0x22, 0x63,
+    0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x22, 0x3a, 0x7b, 0x22, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74,
+    0x75, 0x72, 0x65, 0x5f, 0x32, 0x6d, 0x22, 0x3a, 0x31, 0x32, 0x2e, 0x33, 0x7d, 0x2c, 0x22, 0x68, 0x6f, 0x75,
+    0x72, 0x6c, 0x79, 0x22, 0x3a, 0x7b, 0x22, 0x74, 0x69, 0x6d, 0x65, 0x22, 0x3a, 0x5b, 0x22, 0x32, 0x30, 0x32,
+    0x35, 0x2d, 0x31, 0x30, 0x2d, 0x31, 0x36, 0x54, 0x30, 0x30, 0x3a, 0x30, 0x30, 0x22, 0x2c, 0x22, 0x32, 0x30,
+    0x32, 0x35, 0x2d, 0x31, 0x30, 0x2d, 0x31, 0x36, 0x54, 0x30, 0x31, 0x3a, 0x30, 0x30, 0x22, 0x2c, 0x22, 0x32,
+    0x30, 0x32, 0x35, 0x2d, 0x31, 0x30, 0x2d, 0x31, 0x36, 0x54, 0x30, 0x32, 0x3a, 0x30, 0x30, 0x22, 0x5d, 0x7d,
+    0x7d, 0x38, 0x16, 0x44, 0x58, 0x70, 0x00, 0x00, 0x00};
+
+void setUp(void) {
+    StringPool::reset();
+}
+
+void tearDown(void) {}
+
+void test_content_encoding_detection() {
+    TEST_ASSERT_TRUE(InflateStream::isCompressed("gzip"));
+    TEST_ASSERT_TRUE(InflateStream::isCompressed("GZIP"));
+    TEST_ASSERT_TRUE(InflateStream::isCompressed("x-gzip"));
+    TEST_ASSERT_TRUE(InflateStream::isCompressed("deflate"));
+    TEST_ASSERT_FALSE(InflateStream::isCompressed("identity"));
+    TEST_ASSERT_FALSE(InflateStream::isCompressed("br"));
+    TEST_ASSERT_FALSE(InflateStream::isCompressed(""));
+    TEST_ASSERT_FALSE(InflateStream::isCompressed(nullptr));
+}
+
+void test_gzip_fixture_round_trip() {
+    std::string plain = loadFile("departures.json5");
+    std::string gz = loadFile("departures.json5.gz");
+    TEST_ASSERT_FALSE(plain.empty());
+    TEST_ASSERT_FALSE(gz.empty());
+
+    // Packet sizes below and above the input slice, read sizes below and above the fill target
+    const size_t packetSizes[] = {1, 7, InflateStream::INPUT_SIZE, 1460, 5000};
+    const size_t readSizes[] = {1, 333, 4096};
+    for (size_t packetSize : packetSizes) {
+        for (size_t readSize : readSizes) {
+            FixtureStream upstream(gz, packetSize);
+            InflateStream inflated(upstream);
+
+            std::string out = inflateAll(inflated, readSize);
+            TEST_ASSERT_FALSE(inflated.hasError());
+            TEST_ASSERT_TRUE(inflated.isDone());
+            TEST_ASSERT_EQUAL(plain.size(), out.size());
+            TEST_ASSERT_TRUE(out == plain);
+
+            // Trailer consumed: a keep-alive connection is left at the next response
+            TEST_ASSERT_EQUAL(gz.size(), upstream.position());
+            TEST_ASSERT_EQUAL(gz.size(), inflated.compressedBytes());
+        }
+    }
+}
+
+void test_zlib_fixed_huffman() {
+    std::string compressed(reinterpret_cast<const char*>(SMALL_ZLIB), sizeof(SMALL_ZLIB));
+    FixtureStream upstream(compressed, 5);
+    InflateStream inflated(upstream);
+
+    TEST_ASSERT_EQUAL_STRING(SMALL_JSON, inflateAll(inflated, 16).c_str());
+    TEST_ASSERT_TRUE(inflated.isDone());
+    TEST_ASSERT_EQUAL(sizeof(SMALL_ZLIB), upstream.position());
+}
+
+void test_raw_deflate_without_wrapper() {
+    // "Content-Encoding: deflate" servers that skip the zlib header
+    std::string compressed(reinterpret_cast<const char*>(SMALL_ZLIB) + 2, sizeof(SMALL_ZLIB) - 6);
+    FixtureStream upstream(compressed, 1460);
+    InflateStream inflated(upstream);
+
+    TEST_ASSERT_EQUAL_STRING(SMALL_JSON, inflateAll(inflated, 64).c_str());
+    TEST_ASSERT_TRUE(inflated.isDone());
+}
+
+void test_gzip_stored_block() {
+    std::string compressed(reinterpret_cast<const char*>(SMALL_GZIP_STORED), sizeof(SMALL_GZIP_STORED));
+    FixtureStream upstream(compressed, 3);
+    InflateStream inflated(upstream);
+
+    TEST_ASSERT_EQUAL('{', inflated.peek());
+    TEST_ASSERT_EQUAL('{', inflated.read());
+    std::string rest = inflateAll(inflated, 10);
+    TEST_ASSERT_EQUAL_STRING(SMALL_JSON + 1, rest.c_str());
+    TEST_ASSERT_TRUE(inflated.isDone());
+    TEST_ASSERT_EQUAL(-1, inflated.read());
+}
+
+void test_truncated_stream_fails() {
+    std::string gz = loadFile("departures.json5.gz").substr(0, 5000);
+    FixtureStream upstream(gz, 1460);
+    InflateStream inflated(upstream);
+
+    std::string out = inflateAll(inflated, 512);
+    TEST_ASSERT_TRUE(inflated.hasError());
+    TEST_ASSERT_FALSE(inflated.isDone());
+    TEST_ASSERT_GREATER_THAN(0, out.size());
+    TEST_ASSERT_TRUE(loadFile("departures.json5").compare(0, out.size(), out) == 0);
+}
+
+void test_corrupt_stream_fails() {
+    // Block type 3 does not exist
+    std::string compressed(reinterpret_cast<const char*>(SMALL_ZLIB), sizeof(SMALL_ZLIB));
+    compressed[2] = static_cast<char>(0x07);
+    FixtureStream upstream(compressed, 1460);
+    InflateStream inflated(upstream);
+
+    TEST_ASSERT_EQUAL(-1, inflated.read());
+    TEST_ASSERT_TRUE(inflated.hasError());
+
+    // Wrong ISIZE in the gzip trailer
+    std::string gz(reinterpret_cast<const char*>(SMALL_GZIP_STORED), sizeof(SMALL_GZIP_STORED));
+    gz[gz.size() - 4] ^= 1;
+    FixtureStream upstream2(gz, 1460);
+    InflateStream inflated2(upstream2);
+    inflateAll(inflated2, 64);
+    TEST_ASSERT_TRUE(inflated2.hasError());
+}
+
+void test_stream_parser_over_gzip_matches_plain() {
+    std::string plain = loadFile("departures.json5");
+    std::string gz = loadFile("departures.json5.gz");
+
+    FixtureStream plainStream(plain, 1460);
+    DepartureData expected;
+    RMVStreamParser expectedParser(expected, 40);
+    TEST_ASSERT_TRUE(expectedParser.parseResponse(plainStream));
+
+    const size_t packetSizes[] = {1, 100, 1460};
+    for (size_t packetSize : packetSizes) {
+        FixtureStream upstream(gz, packetSize);
+        InflateStream inflated(upstream);
+        DepartureData data;
+        RMVStreamParser parser(data, 40);
+
+        TEST_ASSERT_TRUE(parser.parseResponse(inflated));
+        TEST_ASSERT_EQUAL(expected.departureCount, data.departureCount);
+        for (int i = 0; i < expected.departureCount; i++) {
+            TEST_ASSERT_EQUAL_STRING(expected.departures[i].line.c_str(), data.departures[i].line.c_str());
+            TEST_ASSERT_EQUAL_STRING(expected.departures[i].direction.c_str(), data.departures[i].direction.c_str());
+            TEST_ASSERT_EQUAL_STRING(expected.departures[i].time.c_str(), data.departures[i].time.c_str());
+            TEST_ASSERT_EQUAL_STRING(expected.departures[i].rtTime.c_str(), data.departures[i].rtTime.c_str());
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark: decode throughput and bytes saved on the wire
+// ---------------------------------------------------------------------------
+
+void test_benchmark_inflate_throughput() {
+    std::string plain = loadFile("departures.json5");
+    std::string gz = loadFile("departures.json5.gz");
+    const int iterations = 20;
+
+    auto start = std::chrono::steady_clock::now();
+    size_t total = 0;
+    for (int i = 0; i < iterations; i++) {
+        FixtureStream upstream(gz, 1460);
+        InflateStream inflated(upstream);
+        total += inflateAll(inflated, 512).size();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    TEST_ASSERT_EQUAL(plain.size() * iterations, total);
+    printf("[BENCH] inflate: %zu -> %zu bytes (%.1f%% on the wire), %.1f MB/s decoded\n", gz.size(), plain.size(),
+           100.0 * gz.size() / plain.size(), total / seconds / 1e6);
+    printf("[MEM] window %zu bytes + decoder %zu bytes\n", InflateStream::WINDOW_SIZE, sizeof(InflateStream));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_content_encoding_detection);
+    RUN_TEST(test_gzip_fixture_round_trip);
+    RUN_TEST(test_zlib_fixed_huffman);
+    RUN_TEST(test_raw_deflate_without_wrapper);
+    RUN_TEST(test_gzip_stored_block);
+    RUN_TEST(test_truncated_stream_fails);
+    RUN_TEST(test_corrupt_stream_fails);
+    RUN_TEST(test_stream_parser_over_gzip_matches_plain);
+    RUN_TEST(test_benchmark_inflate_throughput);
+    return UNITY_END();
+}
@@ -0,0 +1,199 @@
+#include <unity.h>
+#include "display/refresh_planner.h"
+
+// GDEY075T7 in landscape, footer as in DisplayConstants
+static const int16_t WIDTH = 800;
+static const int16_t HEIGHT = 480;
+static const int16_t FOOTER = 15;
+
+static const FrameContent SHOWN = {0x1111, 0x2222, 0x3333};
+
+static RefreshState keptPanel(ScreenLayout layout, uint8_t partials = 0) {
+    RefreshState state = {};
+    state.layout = layout;
+    state.partialsSinceFull = partials;
+    state.panelKept = true;
+    state.content = SHOWN;
+    return state;
+}
+
+static FrameContent changed(bool weather, bool footer, bool transport) {
+    FrameContent content = SHOWN;
+    if (weather) content.weather++;
+    if (footer) content.footer++;
+    if (transport) content.transport++;
+    return content;
+}
+
+static RefreshPlan planFor(const RefreshState& state, ScreenLayout layout, const FrameContent& content) {
+    return RefreshPlanner::plan(state, layout, content, WIDTH, HEIGHT, FOOTER);
+}
+
+static void assertWindow(const RefreshWindow& window, int16_t x, int16_t y, int16_t w, int16_t h) {
+    TEST_ASSERT_EQUAL(x, window.x);
+    TEST_ASSERT_EQUAL(y, window.y);
+    TEST_ASSERT_EQUAL(w, window.w);
+    TEST_ASSERT_EQUAL(h, window.h);
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_content_hash_is_fnv1a() {
+    TEST_ASSERT_EQUAL_HEX32(2166136261u, ContentHash().get());
+    TEST_ASSERT_EQUAL_HEX32(0xe40c292cu, ContentHash().add("a", 1).get());
+    // Strings include their terminator, so splitting them differently changes the hash
+    TEST_ASSERT_NOT_EQUAL(ContentHash().add("ab").add("c").get(), ContentHash().add("a").add("bc").get());
+}
+
+void test_first_frame_is_full() {
+    RefreshState state = {};
+    TEST_ASSERT_TRUE(planFor(state, ScreenLayout::HALF_DEPARTURES, SHOWN).full);
+}
+
+void test_hibernated_panel_is_full() {
+    RefreshState state = keptPanel(ScreenLayout::HALF_DEPARTURES);
+    state.panelKept = false;
+    TEST_ASSERT_TRUE(planFor(state, ScreenLayout::HALF_DEPARTURES, SHOWN).full);
+}
+
+void test_layout_change_is_full() {
+    RefreshState state = keptPanel(ScreenLayout::HALF_DEPARTURES);
+    TEST_ASSERT_TRUE(planFor(state, ScreenLayout::HALF_TRIP, SHOWN).full);
+    TEST_ASSERT_TRUE(planFor(state, ScreenLayout::NONE, SHOWN).full);
+}
+
+void test_both_halves_changed_is_full() {
+    RefreshState state = keptPanel(ScreenLayout::HALF_DEPARTURES);
+    TEST_ASSERT_TRUE(planFor(state, ScreenLayout::HALF_DEPARTURES, changed(true, false, true)).full);
+}
+
+void test_unchanged_frame_is_skipped() {
+    RefreshState state = keptPanel(ScreenLayout::HALF_DEPARTURES, 3);
+    RefreshPlan plan = planFor(state, ScreenLayout::HALF_DEPARTURES, SHOWN);
+
+    TEST_ASSERT_FALSE(plan.full);
+    TEST_ASSERT_EQUAL(0, plan.windowCount);
+    TEST_ASSERT_EQUAL(UpdateRegion::NONE, RefreshPlanner::changedRegion(state, ScreenLayout::HALF_DEPARTURES, SHOWN));
+
+    // A skipped frame is not a partial refresh
+    RefreshPlanner::record(state, ScreenLayout::HALF_DEPARTURES, SHOWN, plan);
+    TEST_ASSERT_EQUAL(3, state.partialsSinceFull);
+}
+
+void test_unchanged_frame_is_skipped_even_when_full_is_due() {
+    // Nothing to show, so nothing ghosts; the full refresh waits for the next change
+    RefreshState state = keptPanel(ScreenLayout::HALF_DEPARTURES, RefreshPlanner::FULL_REFRESH_EVERY);
+    RefreshPlan plan = planFor(state, ScreenLayout::HALF_DEPARTURES, SHOWN);
+    TEST_ASSERT_FALSE(plan.full);
+    TEST_ASSERT_EQUAL(0, plan.windowCount);
+}
+
+void test_footer_only_refreshes_footer_strip() {
+    RefreshState state = keptPanel(ScreenLayout::HALF_DEPARTURES);
+    RefreshPlan plan = planFor(state, ScreenLayout::HALF_DEPARTURES, changed(false, true, false));
+
+    TEST_ASSERT_FALSE(plan.full);
+    TEST_ASSERT_EQUAL(1, plan.windowCount);
+    assertWindow(plan.windows[0], 0, 465, 400, 15);
+}
+
+void test_departures_refresh_right_half_and_footer() {
+    RefreshState state = keptPanel(ScreenLayout::HALF_DEPARTURES);
+    RefreshPlan plan = planFor(state, ScreenLayout::HALF_DEPARTURES, changed(false, true, true));
+
+    TEST_ASSERT_FALSE(plan.full);
+    TEST_ASSERT_EQUAL(2, plan.windowCount);
+    assertWindow(plan.windows[0], 0, 465, 400, 15);
+    assertWindow(plan.windows[1], 400, 0, 400, 480);
+}
+
+void test_departures_with_same_footer_refresh_right_half_only() {
+    RefreshState state = keptPanel(ScreenLayout::HALF_DEPARTURES);
+    RefreshPlan plan = planFor(state, ScreenLayout::HALF_DEPARTURES, changed(false, false, true));
+
+    TEST_ASSERT_EQUAL(1, plan.windowCount);
+    assertWindow(plan.windows[0], 400, 0, 400, 480);
+}
+
+void test_weather_refreshes_left_half_including_footer() {
+    RefreshState state = keptPanel(ScreenLayout::HALF_TRIP);
+    RefreshPlan plan = planFor(state, ScreenLayout::HALF_TRIP, changed(true, true, false));
+
+    TEST_ASSERT_FALSE(plan.full);
+    TEST_ASSERT_EQUAL(1, plan.windowCount);
+    assertWindow(plan.windows[0], 0, 0, 400, 480);
+}
+
+void test_partial_windows_are_byte_aligned() {
+    // The controller addresses x in whole bytes
+    RefreshState state = keptPanel(ScreenLayout::HALF_TRIP);
+    for (uint8_t mask = 1; mask < 8; mask++) {
+        FrameContent content = changed(mask & 1, mask & 2, mask & 4);
+        RefreshPlan plan = planFor(state, ScreenLayout::HALF_TRIP, content);
+        for (uint8_t i = 0; i < plan.windowCount; i++) {
+            TEST_ASSERT_EQUAL(0, plan.windows[i].x % 8);
+            TEST_ASSERT_EQUAL(0, plan.windows[i].w % 8);
+            TEST_ASSERT_LESS_OR_EQUAL(WIDTH, plan.windows[i].x + plan.windows[i].w);
+            TEST_ASSERT_LESS_OR_EQUAL(HEIGHT, plan.windows[i].y + plan.windows[i].h);
+        }
+    }
+}
+
+void test_full_refresh_every_n_partials() {
+    RefreshState state = keptPanel(ScreenLayout::HALF_DEPARTURES);
+    int fullCount = 0;
+    int partialCount = 0;
+
+    // 3 * (N partials + 1 full), starting right after a full refresh; departures change every wake
+    for (int wake = 0; wake < 3 * (RefreshPlanner::FULL_REFRESH_EVERY + 1); wake++) {
+        FrameContent content = state.content;
+        content.transport++;
+        content.footer++;
+        RefreshPlan plan = planFor(state, ScreenLayout::HALF_DEPARTURES, content);
+        RefreshPlanner::record(state, ScreenLayout::HALF_DEPARTURES, content, plan);
+        if (plan.full) {
+            fullCount++;
+            TEST_ASSERT_EQUAL(0, state.partialsSinceFull);
+        } else {
+            partialCount++;
+        }
+        TEST_ASSERT_LESS_OR_EQUAL(RefreshPlanner::FULL_REFRESH_EVERY, state.partialsSinceFull);
+    }
+
+    TEST_ASSERT_EQUAL(3, fullCount);
+    TEST_ASSERT_EQUAL(3 * RefreshPlanner::FULL_REFRESH_EVERY, partialCount);
+}
+
+void test_record_tracks_layout_and_content() {
+    RefreshState state = keptPanel(ScreenLayout::HALF_DEPARTURES, 4);
+    RefreshPlan full = {};
+    full.full = true;
+    FrameContent content = changed(true, true, true);
+    RefreshPlanner::record(state, ScreenLayout::HALF_TRIP, content, full);
+
+    TEST_ASSERT_EQUAL(ScreenLayout::HALF_TRIP, state.layout);
+    TEST_ASSERT_EQUAL(0, state.partialsSinceFull);
+    TEST_ASSERT_EQUAL_HEX32(content.transport, state.content.transport);
+    TEST_ASSERT_EQUAL(0, planFor(state, ScreenLayout::HALF_TRIP, content).windowCount);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_content_hash_is_fnv1a);
+    RUN_TEST(test_first_frame_is_full);
+    RUN_TEST(test_hibernated_panel_is_full);
+    RUN_TEST(test_layout_change_is_full);
+    RUN_TEST(test_both_halves_changed_is_full);
+    RUN_TEST(test_unchanged_frame_is_skipped);
+    RUN_TEST(test_unchanged_frame_is_skipped_even_when_full_is_due);
+    RUN_TEST(test_footer_only_refreshes_footer_strip);
+    RUN_TEST(test_departures_refresh_right_half_and_footer);
+    RUN_TEST(test_departures_with_same_footer_refresh_right_half_only);
+    RUN_TEST(test_weather_refreshes_left_half_including_footer);
+    RUN_TEST(test_partial_windows_are_byte_aligned);
+    RUN_TEST(test_full_refresh_every_n_partials);
+    RUN_TEST(test_record_tracks_layout_and_content);
+    return UNITY_END();
+}
@@ -0,0 +1,53 @@
+#ifdef NATIVE_TEST
+
+#include "util/time_manager.h"
+#include "util/battery_manager.h"
+
+// Fixed clock and battery so rendered frames are reproducible
+
+static tm renderTime() {
+    tm timeinfo = {};
+    timeinfo.tm_year = 2025 - 1900;
+    timeinfo.tm_mon = 9; // October
+    timeinfo.tm_mday = 29;
+    timeinfo.tm_hour = 12;
+    timeinfo.tm_min = 34;
+    timeinfo.tm_wday = 3; // Wednesday
+    timeinfo.tm_yday = 301;
+    return timeinfo;
+}
+
+bool TimeManager::isTimeSet() {
+    return true;
+}
+
+bool TimeManager::getCurrentLocalTime(tm& timeinfo) {
+    timeinfo = renderTime();
+    return true;
+}
+
+String TimeManager::getGermanDateTimeString() {
+    return "12:34 29.10.2025 Mittwoch";
+}
+
+bool BatteryManager::isAvailable() {
+    return true;
+}
+
+float BatteryManager::getBatteryVoltage() {
+    return 3.85f;
+}
+
+int BatteryManager::getBatteryPercentage() {
+    return 80;
+}
+
+int BatteryManager::getBatteryIconLevel() {
+    return 4;
+}
+
+bool BatteryManager::isCharging() {
+    return false;
+}
+
+#endif // NATIVE_TEST
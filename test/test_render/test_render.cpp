@@ -0,0 +1,903 @@
+#include <unity.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include "global_instances.h"
+#include "api/rmv_departure_parser.h"
+#include "config/config_manager.h"
+#include "display/common_footer.h"
+#include "display/fonts.h"
+#include "display/layer_cache.h"
+#include "display/text_utils.h"
+#include "display/transport_display.h"
+#include "display/trip_display.h"
+#include "display/weather_general_full.h"
+#include "display/weather_general_half.h"
+#include "display/weather_graph.h"
+#include "util/spline.h"
+#include <icons_compressed.h>
+
+// Golden frames live in test/render/; pio runs native tests from the project root.
+// Set UPDATE_GOLDEN=1 to rewrite them after an intended layout change.
+#define GOLDEN_DIR "test/render/"
+#define RMV_FIXTURE_DIR "test/rmv/"
+
+// Headless stand-ins for the instances main.cpp defines on the device
+WebServer server;
+RecordingDisplay display;
+RecordingU8g2 u8g2;
+unsigned long wakeupCount = 0;
+
+// Layout of DisplayManager's landscape split
+static const int16_t WIDTH = 800;
+static const int16_t HEIGHT = 480;
+static const int16_t HALF = WIDTH / 2;
+static const int16_t FOOTER = 15;
+static const int16_t MARGIN = 10;
+
+// ===== Fixtures =====
+
+static std::string readFile(const char* path) {
+    std::string data;
+    FILE* f = fopen(path, "rb");
+    if (!f) return data;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.append(buf, n);
+    fclose(f);
+    return data;
+}
+
+// departures.json5 only has // comments outside strings
+static std::string stripComments(const std::string& raw) {
+    std::string json;
+    bool inString = false;
+    for (size_t i = 0; i < raw.size(); i++) {
+        char c = raw[i];
+        if (inString) {
+            json += c;
+            if (c == '\\' && i + 1 < raw.size()) {
+                json += raw[++i];
+            } else if (c == '"') {
+                inString = false;
+            }
+        } else if (c == '/' && i + 1 < raw.size() && raw[i + 1] == '/') {
+            while (i < raw.size() && raw[i] != '\n') i++;
+        } else {
+            inString = c == '"';
+            json += c;
+        }
+    }
+    return json;
+}
+
+static bool loadDepartures(DepartureData& data) {
+    std::string json = stripComments(readFile(RMV_FIXTURE_DIR "departures.json5"));
+    RMVDepartureParser parser(data, RMV_MAX_DEPARTURES);
+    return !json.empty() && parser.feed(json.data(), json.size()) && parser.isDone();
+}
+
+static void makeWeather(WeatherInfo& weather) {
+    memset(&weather, 0, sizeof(weather));
+    strcpy(weather.time, "2025-10-29T12:30");
+    weather.temperature = 13.4f;
+    weather.precipitation = 0.2f;
+    weather.weatherCode = 61;
+
+    // A mild day: temperature peaks mid-afternoon, a shower passes in the evening
+    weather.hourlyForecastCount = 13;
+    for (int i = 0; i < weather.hourlyForecastCount; i++) {
+        WeatherHourlyForecast& hour = weather.hourlyForecast[i];
+        snprintf(hour.time, sizeof(hour.time), "2025-10-29T%02u:00", static_cast<unsigned>(11 + i) % 24);
+        hour.temperature = 11.0f + 4.0f * sinf((i - 1) * 3.14159f / 8.0f);
+        hour.weatherCode = i >= 6 && i <= 8 ? 61 : 3;
+        hour.rainChance = i >= 5 && i <= 9 ? 20 + 15 * (i - 5) : 5;
+        hour.rainfall = i >= 6 && i <= 8 ? 0.8f : 0.0f;
+        hour.humidity = 60 + 3 * i;
+    }
+
+    weather.dailyForecastCount = 7;
+    for (int d = 0; d < weather.dailyForecastCount; d++) {
+        WeatherDailyForecast& day = weather.dailyForecast[d];
+        snprintf(day.time, sizeof(day.time), "2025-%02d-%02d", d < 3 ? 10 : 11, d < 3 ? 29 + d : d - 2);
+        snprintf(day.sunrise, sizeof(day.sunrise), "07:%02d", 10 + d);
+        snprintf(day.sunset, sizeof(day.sunset), "16:%02d", 59 - d);
+        day.windDirection = 200 + 10 * d;
+        day.weatherCode = d % 2 ? 3 : 61;
+        day.tempMax = 15.0f - d * 0.5f;
+        day.tempMin = 6.0f - d * 0.3f;
+        day.uvIndex = 1.5f;
+        day.precipitationSum = d % 2 ? 0.0f : 2.4f;
+        day.precipitationHours = d % 2 ? 0 : 3;
+        day.sunshineDuration = 3600.0f * (3 + d % 3);
+        day.apparentTempMin = day.tempMin - 2.0f;
+        day.apparentTempMax = day.tempMax - 1.0f;
+        day.windSpeedMax = 18.0f + d;
+        day.windGustsMax = 35.0f + d;
+    }
+}
+
+static void setLeg(TripLeg& leg, const char* dep, const char* arr, const char* rtDep, const char* line,
+                   const char* direction, const char* arrival, const char* platform) {
+    memset(&leg, 0, sizeof(leg));
+    strcpy(leg.departureTime, dep);
+    strcpy(leg.arrivalTime, arr);
+    strcpy(leg.rtDepartureTime, rtDep);
+    strcpy(leg.line, line);
+    strcpy(leg.direction, direction);
+    strcpy(leg.arrivalStation, arrival);
+    strcpy(leg.platform, platform);
+}
+
+static void clockAfter(const tm& now, int minutes, char* out) {
+    // Unsigned, so the compiler sees "HH:MM" always fits the 6 bytes
+    unsigned total = (unsigned)(now.tm_hour * 60 + now.tm_min + minutes) % (24 * 60);
+    snprintf(out, 6, "%02u:%02u", total / 60, total % 60);
+}
+
+// TripDisplay shows "in N min" against the real clock, so departures are placed relative to now
+static void makeTrip(TripData& trip, time_t now) {
+    tm local;
+    localtime_r(&now, &local);
+    memset(&trip, 0, sizeof(trip));
+
+    const int offsets[] = {4, 12, 19, 33};
+    trip.connectionCount = 4;
+    for (int i = 0; i < trip.connectionCount; i++) {
+        TripConnection& conn = trip.connections[i];
+        char dep[6];
+        char transfer[6];
+        char arr[6];
+        char rt[6] = "";
+        clockAfter(local, offsets[i], dep);
+        clockAfter(local, offsets[i] + 11, transfer);
+        clockAfter(local, offsets[i] + 27, arr);
+        if (i == 1) clockAfter(local, offsets[i] + 3, rt);
+
+        conn.legCount = i == 2 ? 1 : 2;
+        conn.durationMinutes = 27;
+        setLeg(conn.legs[0], dep, transfer, rt, "S5", "Frankfurt (Main) Südbahnhof", "Frankfurt (Main) Hauptbahnhof",
+               "3");
+        conn.legs[0].cancelled = i == 3;
+        if (conn.legCount > 1) {
+            setLeg(conn.legs[1], transfer, arr, "", "U4", "Enkheim", "Konstablerwache", "1");
+        } else {
+            strcpy(conn.legs[0].arrivalTime, arr);
+        }
+    }
+}
+
+// ===== Frames, drawn the way DisplayManager composes them =====
+
+static void drawWeatherHalf(const WeatherInfo& weather) {
+    WeatherHalfDisplay::drawHalfScreenWeatherLayout(weather, MARGIN, HALF - MARGIN, 0, HEIGHT);
+    WeatherHalfDisplay::drawWeatherFooter(0, HEIGHT - FOOTER, FOOTER);
+}
+
+static void drawHalfDeparturesFrame(const WeatherInfo& weather, const DepartureData& departures) {
+    display.fillScreen(GxEPD_WHITE);
+    drawWeatherHalf(weather);
+    TransportDisplay::drawHalfScreenTransportSection(departures, HALF, 0, HALF, HEIGHT);
+    display.drawLine(HALF, 0, HALF, HEIGHT - 1, GxEPD_BLACK);
+}
+
+static void drawHalfTripFrame(const WeatherInfo& weather, const TripData& trip) {
+    display.fillScreen(GxEPD_WHITE);
+    drawWeatherHalf(weather);
+    TripDisplay::drawTripConnections(trip, HALF + 1, 0, WIDTH - HALF - 1, HEIGHT);
+    display.drawLine(HALF, 0, HALF, HEIGHT - 1, GxEPD_BLACK);
+}
+
+static void drawWeatherFullFrame(const WeatherInfo& weather) {
+    display.fillScreen(GxEPD_WHITE);
+    WeatherFullDisplay::drawFullScreenWeatherLayout(weather);
+    WeatherFullDisplay::drawWeatherFooter(0, HEIGHT - FOOTER, FOOTER);
+}
+
+static void drawDeparturesFullFrame(const DepartureData& departures) {
+    display.fillScreen(GxEPD_WHITE);
+    TransportDisplay::drawFullScreenTransportSection(departures, 0, 0, WIDTH, HEIGHT);
+}
+
+// Records the layout once and replays it page by page, as DisplayManager::endFrame() does
+template <typename Draw>
+static void drawPaged(DisplayList& frame, uint16_t pageHeight, Draw draw) {
+    display.setPageHeight(pageHeight);
+    frame.beginRecording();
+    draw();
+    frame.endRecording();
+
+    int16_t pageTop = 0;
+    display.firstPage();
+    do {
+        frame.replay(display, u8g2, pageTop, pageTop + display.pageHeight());
+        pageTop += display.pageHeight();
+    } while (display.nextPage());
+    display.setPageHeight(HEIGHT);
+}
+
+// The loop the display list replaces: the whole layout runs again for every page
+template <typename Draw>
+static void drawPagedWithoutList(uint16_t pageHeight, Draw draw) {
+    display.setPageHeight(pageHeight);
+    display.firstPage();
+    do {
+        draw();
+    } while (display.nextPage());
+    display.setPageHeight(HEIGHT);
+}
+
+// ===== Golden comparison =====
+
+static void assertMatchesGolden(const char* name) {
+    std::string path = std::string(GOLDEN_DIR) + name + ".pbm";
+    const char* update = getenv("UPDATE_GOLDEN");
+    if (update && strcmp(update, "1") == 0) {
+        TEST_ASSERT_TRUE_MESSAGE(display.writePBM(path.c_str()), "Cannot write golden frame");
+        printf("[GOLDEN] %s rewritten\n", path.c_str());
+        return;
+    }
+
+    std::vector<uint8_t> golden;
+    if (!display.readPBM(path.c_str(), golden)) {
+        display.writePBM((std::string(GOLDEN_DIR) + name + ".actual.pbm").c_str());
+        TEST_FAIL_MESSAGE("Golden frame missing; the rendered frame was written as .actual.pbm");
+    }
+
+    // Report the bounding box of the differences to find the regression quickly
+    const std::vector<uint8_t>& frame = display.buffer();
+    const int16_t bytesPerRow = (WIDTH + 7) / 8;
+    uint32_t diffPixels = 0;
+    int16_t minX = WIDTH, minY = HEIGHT, maxX = -1, maxY = -1;
+    for (size_t i = 0; i < frame.size(); i++) {
+        uint8_t diff = frame[i] ^ golden[i];
+        if (!diff) continue;
+        int16_t y = i / bytesPerRow;
+        for (int bit = 0; bit < 8; bit++) {
+            if (!(diff & (0x80 >> bit))) continue;
+            int16_t x = (i % bytesPerRow) * 8 + bit;
+            diffPixels++;
+            minX = std::min(minX, x);
+            maxX = std::max(maxX, x);
+            minY = std::min(minY, y);
+            maxY = std::max(maxY, y);
+        }
+    }
+
+    if (diffPixels) {
+        display.writePBM((std::string(GOLDEN_DIR) + name + ".actual.pbm").c_str());
+        char message[160];
+        snprintf(message, sizeof(message), "%u pixels differ from %s within (%d,%d)-(%d,%d); see .actual.pbm",
+                 diffPixels, path.c_str(), minX, minY, maxX, maxY);
+        TEST_FAIL_MESSAGE(message);
+    }
+}
+
+// ===== Tests =====
+
+static WeatherInfo weather;
+static DepartureData departures;
+
+void setUp(void) {
+    display.fillScreen(GxEPD_WHITE);
+    display.resetStats();
+    u8g2.begin(display);
+
+    RTCConfigData& config = ConfigManager::getConfig();
+    strcpy(config.cityName, "Frankfurt am Main");
+    strcpy(config.selectedStopId, "A=1@O=Frankfurt (Main) Hauptbahnhof@X=8663785@Y=50107149@U=80@L=3000010@");
+    CommonFooter::cacheWiFiState();
+}
+
+void tearDown(void) {}
+
+void test_fixtures_load() {
+    TEST_ASSERT_TRUE(loadDepartures(departures));
+    TEST_ASSERT_GREATER_THAN(10, departures.departureCount);
+    makeWeather(weather);
+}
+
+void test_half_departures_frame() {
+    drawHalfDeparturesFrame(weather, departures);
+    TEST_ASSERT_GREATER_THAN(0, display.getStats().glyphs);
+    assertMatchesGolden("half_departures");
+}
+
+void test_half_departures_frame_without_departures() {
+    DepartureData empty;
+    empty.departureCount = 0;
+    drawHalfDeparturesFrame(weather, empty);
+    assertMatchesGolden("half_departures_empty");
+}
+
+void test_half_trip_frame() {
+    // Redraw if the minute changed while drawing, so "in N min" matches the fixture
+    time_t now;
+    do {
+        now = time(nullptr);
+        TripData trip;
+        makeTrip(trip, now);
+        drawHalfTripFrame(weather, trip);
+    } while (time(nullptr) / 60 != now / 60);
+    assertMatchesGolden("half_trip");
+}
+
+void test_weather_full_frame() {
+    drawWeatherFullFrame(weather);
+    assertMatchesGolden("weather_full");
+}
+
+void test_departures_full_frame() {
+    drawDeparturesFullFrame(departures);
+    assertMatchesGolden("departures_full");
+}
+
+void test_frames_stay_inside_the_panel() {
+    // Anything drawn off-panel is a layout bug the frame itself cannot show
+    drawHalfDeparturesFrame(weather, departures);
+    TEST_ASSERT_EQUAL(0, display.getStats().clipped);
+    drawWeatherFullFrame(weather);
+    TEST_ASSERT_EQUAL(0, display.getStats().clipped);
+    drawDeparturesFullFrame(departures);
+    TEST_ASSERT_EQUAL(0, display.getStats().clipped);
+}
+
+void test_display_list_records_without_drawing() {
+    DisplayList frame;
+    frame.beginRecording();
+    drawHalfDeparturesFrame(weather, departures);
+    frame.endRecording();
+
+    TEST_ASSERT_NULL(DisplayList::recording());
+    TEST_ASSERT_TRUE(frame.complete());
+    TEST_ASSERT_EQUAL(0, display.blackPixels());
+    TEST_ASSERT_EQUAL(0, display.getStats().pixels);
+
+    // Far smaller than the 48 KB frame buffer a paged board saves
+    printf("Half-and-half frame: %u commands, %u bytes\n", (unsigned)frame.commandCount(), (unsigned)frame.bytes());
+    TEST_ASSERT_LESS_THAN(12000, frame.bytes());
+}
+
+void test_display_list_replays_pages_to_golden_frames() {
+    const uint16_t pageHeights[] = {HEIGHT, 120, 64, 7};
+    for (uint16_t pageHeight : pageHeights) {
+        DisplayList frame;
+        drawPaged(frame, pageHeight, [] { drawHalfDeparturesFrame(weather, departures); });
+        assertMatchesGolden("half_departures");
+        drawPaged(frame, pageHeight, [] { drawWeatherFullFrame(weather); });
+        assertMatchesGolden("weather_full");
+        drawPaged(frame, pageHeight, [] { drawDeparturesFullFrame(departures); });
+        assertMatchesGolden("departures_full");
+    }
+}
+
+void test_layer_cache_keeps_frames_identical() {
+    // First wake: the static layers are rasterized, once each
+    LayerCache::erase();
+    uint32_t rasterized = LayerCache::rasterizations();
+    drawHalfDeparturesFrame(weather, departures);
+    assertMatchesGolden("half_departures");
+    uint32_t glyphsRasterizing = display.getStats().glyphs;
+    TEST_ASSERT_EQUAL(rasterized + 3, LayerCache::rasterizations()); // Column header, rain axis, legend
+
+    // Same wake: blitted from RAM, without laying out their text
+    display.resetStats();
+    drawHalfDeparturesFrame(weather, departures);
+    assertMatchesGolden("half_departures");
+    TEST_ASSERT_LESS_THAN(glyphsRasterizing, display.getStats().glyphs);
+
+    // Next wake: loaded from NVS
+    LayerCache::clear();
+    drawHalfDeparturesFrame(weather, departures);
+    assertMatchesGolden("half_departures");
+    TEST_ASSERT_EQUAL(rasterized + 3, LayerCache::rasterizations());
+    printf("Layers: column header %u bytes, rain axis %u bytes, legend %u bytes\n",
+           (unsigned)LayerCache::bytes(LayerCache::Layer::TRANSPORT_HEADER),
+           (unsigned)LayerCache::bytes(LayerCache::Layer::RAIN_AXIS),
+           (unsigned)LayerCache::bytes(LayerCache::Layer::GRAPH_LEGEND));
+
+    // Rasterized while the frame is recording: the layer must not end up in the frame's list
+    LayerCache::erase();
+    DisplayList frame;
+    drawPaged(frame, 64, [] { drawHalfDeparturesFrame(weather, departures); });
+    assertMatchesGolden("half_departures");
+}
+
+void test_layer_cache_redraws_changed_layers() {
+    LayerCache::erase();
+    uint32_t rasterized = LayerCache::rasterizations();
+    drawWeatherFullFrame(weather);
+    TEST_ASSERT_EQUAL(rasterized + 2, LayerCache::rasterizations());
+
+    // The half screen graph has another geometry, so its rain axis and legend are drawn again
+    drawHalfDeparturesFrame(weather, departures);
+    TEST_ASSERT_EQUAL(rasterized + 5, LayerCache::rasterizations());
+    assertMatchesGolden("half_departures");
+
+    // Different content at the same size
+    display.fillScreen(GxEPD_WHITE);
+    auto label = [](const char* text) {
+        return [text] {
+            TextUtils::setFont10px_margin12px();
+            TextUtils::printTextAtTopMargin(10, 10, text);
+        };
+    };
+    LayerCache::draw(LayerCache::Layer::TRANSPORT_HEADER, 10, 10, 200, 20, 1, label("Soll"));
+    uint32_t sollPixels = display.blackPixels();
+    display.fillScreen(GxEPD_WHITE);
+    LayerCache::draw(LayerCache::Layer::TRANSPORT_HEADER, 10, 10, 200, 20, 2, label("Soll    Ist"));
+    TEST_ASSERT_GREATER_THAN(sollPixels, display.blackPixels());
+    TEST_ASSERT_EQUAL(rasterized + 7, LayerCache::rasterizations());
+}
+
+// The fitting TextUtils used before the glyph width tables: binary search over byte
+// lengths with a substring and a full measurement per step
+static String shortenBySubstring(const String& text, int16_t maxWidth) {
+    if ((int16_t)u8g2.getUTF8Width(text.c_str()) <= maxWidth) return text;
+    int16_t ellipsisWidth = u8g2.getUTF8Width("...");
+    if (maxWidth <= ellipsisWidth) return "";
+    int left = 0;
+    int right = text.length();
+    int bestLength = 0;
+    while (left <= right) {
+        int mid = (left + right) / 2;
+        if (u8g2.getUTF8Width(text.substring(0, mid).c_str()) <= maxWidth - ellipsisWidth) {
+            bestLength = mid;
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+    return bestLength == 0 ? String("...") : text.substring(0, bestLength) + "...";
+}
+
+static void (*const FONTS[])() = {
+    TextUtils::setFont8px_margin10px, TextUtils::setFont10px_margin12px, TextUtils::setFont12px_margin15px,
+    TextUtils::setFont14px_margin17px, TextUtils::setFont18px_margin22px, TextUtils::setFont24px_margin28px,
+};
+
+// The text RecordingU8g2 actually draws: missing glyphs replaced by their fallback
+static std::string printedText(const char* text) {
+    std::string out;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(text);
+    while (*p) {
+        char utf8[3];
+        out.append(utf8, Fonts::encodeUtf8(Fonts::printable(Fonts::nextCodepoint(p, nullptr)), utf8));
+    }
+    return out;
+}
+
+void test_text_width_matches_u8g2() {
+    const char* samples[] = {
+        "", "A", "Frankfurt (Main) Hauptbahnhof", "Bad Homburg v.d.Höhe", "Gießen Oberhessen",
+        "12°C", "Ä", "Zoo → Ostbahnhof",
+    };
+    for (auto setFont : FONTS) {
+        setFont();
+        // Twice: the first pass fills the glyph tables, the second reads them
+        for (int pass = 0; pass < 2; pass++) {
+            for (const char* sample : samples) {
+                TEST_ASSERT_EQUAL_MESSAGE(u8g2.getUTF8Width(printedText(sample).c_str()),
+                                          TextUtils::getTextWidth(sample), sample);
+            }
+        }
+    }
+}
+
+void test_missing_glyphs_print_fallback() {
+    TEST_ASSERT_EQUAL('A', Fonts::printable('A'));
+    TEST_ASSERT_EQUAL(0xF6, Fonts::printable(0xF6)); // ö is in every font build
+    TEST_ASSERT_EQUAL(0xB0, Fonts::printable(0xB0)); // °
+    TEST_ASSERT_EQUAL('"', Fonts::printable(0x201E)); // „
+    TEST_ASSERT_EQUAL('-', Fonts::printable(0x2013)); // –
+    TEST_ASSERT_EQUAL('?', Fonts::printable(0x2192)); // →
+
+    // Drawn exactly like the fallback text, whether printed at once or byte by byte
+    const char* texts[][2] = {{"Zoo \xE2\x86\x92 Ost", "Zoo ? Ost"}, {"\xE2\x80\x9EHalt\xE2\x80\x9C", "\"Halt\""}};
+    for (auto& text : texts) {
+        TextUtils::setFont10px_margin12px();
+        display.fillScreen(GxEPD_WHITE);
+        u8g2.setCursor(MARGIN, 40);
+        u8g2.print(text[1]);
+        int16_t expectedX = u8g2.getCursorX();
+        uint32_t expectedPixels = display.blackPixels();
+
+        display.fillScreen(GxEPD_WHITE);
+        u8g2.setCursor(MARGIN, 40);
+        u8g2.print(text[0]);
+        TEST_ASSERT_EQUAL_MESSAGE(expectedX, u8g2.getCursorX(), text[1]);
+        TEST_ASSERT_EQUAL_MESSAGE(expectedPixels, display.blackPixels(), text[1]);
+
+        display.fillScreen(GxEPD_WHITE);
+        u8g2.setCursor(MARGIN, 40);
+        for (const char* c = text[0]; *c; c++) u8g2.print(*c);
+        TEST_ASSERT_EQUAL_MESSAGE(expectedPixels, display.blackPixels(), text[1]);
+    }
+}
+
+static const size_t ICON_SIZES[] = {24, 32, 48, 64};
+
+void test_compressed_icons_match_raw_bitmaps() {
+    for (int icon = 0; icon <= wifi_off; icon++) {
+        for (size_t size : ICON_SIZES) {
+            const unsigned char* raw = getBitmap(static_cast<icon_name_t>(icon), size);
+            const unsigned char* runs = getCompressedBitmap(static_cast<icon_name_t>(icon), size);
+            TEST_ASSERT_EQUAL(raw == nullptr, runs == nullptr);
+            if (!raw) continue;
+
+            // Odd position, so runs do not line up with buffer bytes
+            display.fillScreen(GxEPD_WHITE);
+            display.drawInvertedBitmap(13, 7, raw, size, size, GxEPD_BLACK);
+            std::vector<uint8_t> expected = display.buffer();
+            display.fillScreen(GxEPD_WHITE);
+            display.drawCompressedBitmap(13, 7, runs, size, size, GxEPD_BLACK);
+            TEST_ASSERT_TRUE_MESSAGE(expected == display.buffer(), "compressed icon differs from raw bitmap");
+        }
+    }
+}
+
+// What fillStipple() draws, one drawPixel() at a time
+static void fillStippleByPixel(int16_t x, int16_t y, int16_t w, int16_t h, const Stipple& pattern) {
+    for (int16_t row = 0; row < h; row++) {
+        uint32_t bits = pattern.rows[row % pattern.rowCount];
+        for (int16_t col = 0; col < w; col++) {
+            if (bits & (0x80000000u >> (col % pattern.period))) display.drawPixel(x + col, y + row, GxEPD_BLACK);
+        }
+    }
+}
+
+void test_stipple_matches_pixel_loops() {
+    static const Stipple patterns[] = {
+        {{0x80000000}, 1, 6},
+        {{0xE0000000}, 1, 9},
+        {{0xA0000000, 0, 0x80000000, 0}, 4, 4},
+        {{0x12345678, 0x9ABCDEF0, 0x0F0F0F0F}, 3, 32},
+        {{0xB6000000, 0x6D000000}, 2, 11},
+    };
+    // Word boundaries, odd phases and clipping on every panel edge
+    const int16_t areas[][4] = {
+        {0, 0, 1, 1}, {5, 3, 31, 7}, {17, 40, 33, 9}, {100, 100, 250, 60}, {-13, -5, 70, 20}, {770, 470, 50, 30},
+    };
+    for (const Stipple& pattern : patterns) {
+        for (const auto& area : areas) {
+            display.fillScreen(GxEPD_WHITE);
+            fillStippleByPixel(area[0], area[1], area[2], area[3], pattern);
+            std::vector<uint8_t> expected = display.buffer();
+            display.fillScreen(GxEPD_WHITE);
+            display.fillStipple(area[0], area[1], area[2], area[3], pattern, GxEPD_BLACK);
+            TEST_ASSERT_TRUE_MESSAGE(expected == display.buffer(), "stipple differs from the pixel loop");
+        }
+    }
+}
+
+// The float Catmull-Rom that WeatherGraph evaluated before Spline
+static int16_t catmullRomFloat(float t, int16_t p0, int16_t p1, int16_t p2, int16_t p3) {
+    float t2 = t * t;
+    float t3 = t2 * t;
+    float result = 0.5f * ((2.0f * p1) + (-p0 + p2) * t + (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 +
+                           (-p0 + 3.0f * p1 - 3.0f * p2 + p3) * t3);
+    return (int16_t)result;
+}
+
+static void floatCurve(const int16_t* xs, const int16_t* ys, uint8_t count, uint8_t steps, Spline::Polyline& out) {
+    out.count = 0;
+    for (int i = 0; i < count - 1; i++) {
+        int i0 = i > 0 ? i - 1 : i;
+        int i3 = i < count - 2 ? i + 2 : i + 1;
+        for (int step = 0; step < steps; step++) {
+            float t = (float)step / steps;
+            out.x[out.count] = catmullRomFloat(t, xs[i0], xs[i], xs[i + 1], xs[i3]);
+            out.y[out.count] = catmullRomFloat(t, ys[i0], ys[i], ys[i + 1], ys[i3]);
+            out.count++;
+        }
+    }
+    // The last segment's t = 1 lands exactly on the last point
+    out.x[out.count] = xs[count - 1];
+    out.y[out.count] = ys[count - 1];
+    out.count++;
+}
+
+// Sample s of n on segment i, scaled by 2n^3 so it is a whole number
+static int64_t scaledSample(const int16_t* p, uint8_t count, int i, int64_t s, int64_t n) {
+    int64_t p0 = p[i > 0 ? i - 1 : i];
+    int64_t p1 = p[i];
+    int64_t p2 = p[i + 1];
+    int64_t p3 = p[i + 2 < count ? i + 2 : i + 1];
+    return 2 * p1 * n * n * n + (-p0 + p2) * s * n * n + (2 * p0 - 5 * p1 + 4 * p2 - p3) * s * s * n +
+        (-p0 + 3 * p1 - 3 * p2 + p3) * s * s * s;
+}
+
+// Hourly curve points as WeatherGraph places them: 13 hours over the graph width
+static void randomCurvePoints(int16_t* xs, int16_t* ys, int16_t top, int16_t height) {
+    for (int i = 0; i < 13; i++) {
+        xs[i] = 35 + (i * 330) / 12;
+        ys[i] = top + rand() % (height + 1);
+    }
+}
+
+void test_spline_matches_float_curves() {
+    srand(7);
+    int16_t xs[13];
+    int16_t ys[13];
+    Spline::Polyline fixed;
+    Spline::Polyline reference;
+    int humidityDifferences = 0;
+    int humiditySamples = 0;
+    for (int trace = 0; trace < 2000; trace++) {
+        randomCurvePoints(xs, ys, 40, 230);
+        uint8_t count = 2 + trace % 12;
+
+        // Temperature: 8 steps, t = s/8 is exact in float, so every sample must match
+        Spline::catmullRom(xs, ys, count, 8, fixed);
+        floatCurve(xs, ys, count, 8, reference);
+        TEST_ASSERT_EQUAL(reference.count, fixed.count);
+        TEST_ASSERT_EQUAL(0, memcmp(reference.x, fixed.x, fixed.count * sizeof(int16_t)));
+        TEST_ASSERT_EQUAL(0, memcmp(reference.y, fixed.y, fixed.count * sizeof(int16_t)));
+
+        // Humidity: 3 steps. Float t = 1/3 is slightly off, so where the exact curve value is a
+        // whole number the float formula can land a hair below it and truncate one pixel short.
+        // Those are the only differences allowed.
+        Spline::catmullRom(xs, ys, count, 3, fixed);
+        floatCurve(xs, ys, count, 3, reference);
+        TEST_ASSERT_EQUAL(reference.count, fixed.count);
+        for (uint8_t k = 0; k + 1 < fixed.count; k++) {
+            const struct {
+                const int16_t* points;
+                int16_t fixed;
+                int16_t reference;
+            } axes[] = {{xs, fixed.x[k], reference.x[k]}, {ys, fixed.y[k], reference.y[k]}};
+            for (const auto& axis : axes) {
+                humiditySamples++;
+                if (axis.fixed == axis.reference) continue;
+                int64_t exact = scaledSample(axis.points, count, k / 3, k % 3, 3);
+                TEST_ASSERT_EQUAL_MESSAGE(0, exact % 54, "fixed-point curve differs off a whole pixel");
+                TEST_ASSERT_EQUAL(exact / 54, axis.fixed);
+                TEST_ASSERT_EQUAL(1, abs(axis.reference - axis.fixed));
+                humidityDifferences++;
+            }
+        }
+    }
+    printf("Humidity curve: %d of %d float samples truncated below a whole pixel\n", humidityDifferences,
+           humiditySamples);
+}
+
+static bool isAscii(const String& text) {
+    for (char c : text) {
+        if (static_cast<uint8_t>(c) >= 0x80) return false;
+    }
+    return true;
+}
+
+void test_shorten_text_matches_previous_fitting() {
+    // Only ASCII: the byte-wise search could cut umlauts in half (see the next test)
+    for (auto setFont : FONTS) {
+        setFont();
+        for (int i = 0; i < departures.departureCount; i++) {
+            String direction = departures.departures[i].direction.c_str();
+            if (!isAscii(direction)) continue;
+            for (int16_t maxWidth = 0; maxWidth <= 200; maxWidth += 7) {
+                TEST_ASSERT_EQUAL_STRING(shortenBySubstring(direction, maxWidth).c_str(),
+                                         TextUtils::shortenTextToFit(direction, maxWidth).c_str());
+            }
+        }
+    }
+}
+
+void test_shorten_text_cuts_on_character_boundaries() {
+    TextUtils::setFont12px_margin15px();
+    const String name = "Höchst Schloßplatz Süd";
+    for (int16_t maxWidth = 0; maxWidth < TextUtils::getTextWidth(name); maxWidth++) {
+        String fitted = TextUtils::shortenTextToFit(name, maxWidth);
+        TEST_ASSERT_LESS_OR_EQUAL(maxWidth, TextUtils::getTextWidth(fitted));
+        if (fitted.isEmpty()) continue;
+
+        // Whatever precedes the ellipsis is a prefix of the name that does not end inside a UTF-8 sequence
+        size_t kept = fitted.length() - 3;
+        TEST_ASSERT_EQUAL_STRING("...", fitted.c_str() + kept);
+        TEST_ASSERT_EQUAL(0, strncmp(name.c_str(), fitted.c_str(), kept));
+        TEST_ASSERT_NOT_EQUAL(0x80, static_cast<uint8_t>(name[kept]) & 0xC0);
+    }
+}
+
+// ===== Benchmarks =====
+
+template <typename Draw>
+static void bench(const char* name, int iterations, Draw draw) {
+    display.fillScreen(GxEPD_WHITE);
+    display.resetStats();
+    draw();
+    GfxStats stats = display.getStats();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) draw();
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+        iterations;
+
+    printf("[BENCH] %-34s %8.1f us  %6u px  %4u glyphs  %3u lines  %3u fast lines  %3u rects  %2u bitmaps\n", name,
+           us, stats.pixels, stats.glyphs, stats.lines, stats.fastLines, stats.rects, stats.bitmaps);
+}
+
+void test_render_benchmark() {
+    // Host timings only rank the sections; pixel and call counts carry over to the device
+    const int iterations = 200;
+    TripData trip;
+    makeTrip(trip, time(nullptr));
+
+    bench("weather half layout", iterations, [] {
+        WeatherHalfDisplay::drawHalfScreenWeatherLayout(weather, MARGIN, HALF - MARGIN, 0, HEIGHT);
+    });
+    bench("  drawTemperatureAndRainGraph", iterations, [] {
+        WeatherGraph::drawTemperatureAndRainGraph(weather, MARGIN, 150, HALF - 2 * MARGIN, 304);
+    });
+    bench("weather footer", iterations, [] {
+        WeatherHalfDisplay::drawWeatherFooter(0, HEIGHT - FOOTER, FOOTER);
+    });
+    bench("drawHalfScreenTransportSection", iterations, [] {
+        TransportDisplay::drawHalfScreenTransportSection(departures, HALF, 0, HALF, HEIGHT);
+    });
+    bench("drawTripConnections", iterations, [&trip] {
+        TripDisplay::drawTripConnections(trip, HALF + 1, 0, WIDTH - HALF - 1, HEIGHT);
+    });
+    bench("half-and-half frame", iterations, [] {
+        drawHalfDeparturesFrame(weather, departures);
+    });
+    bench("drawFullScreenWeatherLayout", iterations, [] {
+        WeatherFullDisplay::drawFullScreenWeatherLayout(weather);
+    });
+    bench("drawFullScreenTransportSection", iterations, [] {
+        TransportDisplay::drawFullScreenTransportSection(departures, 0, 0, WIDTH, HEIGHT);
+    });
+}
+
+void test_text_fitting_benchmark() {
+    // Every departure destination fitted into the width of the half-screen destination column
+    const int iterations = 200;
+    TextUtils::setFont12px_margin15px();
+    auto fitAll = [](String (*fit)(const String&, int16_t)) {
+        size_t kept = 0;
+        for (int i = 0; i < departures.departureCount; i++) {
+            kept += fit(departures.departures[i].direction.c_str(), 150).length();
+        }
+        return kept;
+    };
+    TEST_ASSERT_EQUAL(fitAll(shortenBySubstring), fitAll(TextUtils::shortenTextToFit));
+
+    const struct {
+        const char* name;
+        String (*fit)(const String&, int16_t);
+    } variants[] = {
+        {"substring binary search", shortenBySubstring},
+        {"glyph width tables", TextUtils::shortenTextToFit},
+    };
+    for (const auto& variant : variants) {
+        // Glyph lookups are what costs on the device; the mock font measures a glyph in O(1)
+        fitAll(variant.fit);
+        u8g2.glyphLookups = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) fitAll(variant.fit);
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+            iterations;
+        printf("[BENCH] fit %d destinations, %-24s %8.1f us  %6u glyph lookups\n", departures.departureCount,
+               variant.name, us, u8g2.glyphLookups / iterations);
+    }
+}
+
+void test_icon_blit_benchmark() {
+    // Every icon at every size, as raw bitmaps and as run-length compressed icons
+    auto drawAll = [](bool compressed) {
+        int16_t x = 0;
+        for (int icon = 0; icon <= wifi_off; icon++) {
+            icon_name_t name = static_cast<icon_name_t>(icon);
+            for (size_t size : ICON_SIZES) {
+                if (compressed) {
+                    display.drawCompressedBitmap(x % 700, 100, getCompressedBitmap(name, size), size, size,
+                                                 GxEPD_BLACK);
+                } else {
+                    display.drawInvertedBitmap(x % 700, 100, getBitmap(name, size), size, size, GxEPD_BLACK);
+                }
+                x += size;
+            }
+        }
+    };
+    bench("icons, drawInvertedBitmap", 200, [&] { drawAll(false); });
+    bench("icons, drawCompressedBitmap", 200, [&] { drawAll(true); });
+}
+
+void test_stipple_benchmark() {
+    // Rain bars at 100% across the weather half's graph area, hatched the way WeatherGraph does
+    static const Stipple hatch = {{0xA0000000, 0, 0x80000000, 0}, 4, 4};
+    bench("rain hatch, drawPixel loops", 200, [] { fillStippleByPixel(45, 40, 310, 230, hatch); });
+    bench("rain hatch, fillStipple", 200, [] { display.fillStipple(45, 40, 310, 230, hatch, GxEPD_BLACK); });
+}
+
+void test_spline_benchmark() {
+    // Both weather graph curves of one frame: 13 hourly points, 8 and 3 steps per hour
+    const int iterations = 2000;
+    srand(11);
+    int16_t xs[13];
+    int16_t ys[13];
+    randomCurvePoints(xs, ys, 40, 230);
+    const struct {
+        const char* name;
+        void (*curve)(const int16_t*, const int16_t*, uint8_t, uint8_t, Spline::Polyline&);
+    } variants[] = {
+        {"float Catmull-Rom", floatCurve},
+        {"integer Spline", Spline::catmullRom},
+    };
+    for (const auto& variant : variants) {
+        Spline::Polyline temperature;
+        Spline::Polyline humidity;
+        int32_t checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            variant.curve(xs, ys, 13, 8, temperature);
+            variant.curve(xs, ys, 13, 3, humidity);
+            checksum += temperature.y[i % temperature.count] + humidity.y[i % humidity.count];
+        }
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+            iterations;
+        printf("[BENCH] weather curves, %-18s %8.2f us  %3u samples  (checksum %d)\n", variant.name, us,
+               temperature.count + humidity.count, checksum);
+    }
+}
+
+void test_layer_cache_benchmark() {
+    // The half-and-half frame with its static layers rasterized every time, and blitted from the cache
+    bench("half-and-half frame, layers rasterized", 200, [] {
+        LayerCache::erase();
+        drawHalfDeparturesFrame(weather, departures);
+    });
+    bench("half-and-half frame, layers cached", 200, [] { drawHalfDeparturesFrame(weather, departures); });
+}
+
+void test_paged_frame_benchmark() {
+    // Layout cost must not grow with the page count once the frame is recorded
+    const int iterations = 100;
+    const uint16_t pageHeights[] = {HEIGHT, 120, 60};
+    for (uint16_t pageHeight : pageHeights) {
+        char name[48];
+        snprintf(name, sizeof(name), "half frame, %u pages, layout per page", (HEIGHT + pageHeight - 1) / pageHeight);
+        bench(name, iterations, [pageHeight] {
+            drawPagedWithoutList(pageHeight, [] { drawHalfDeparturesFrame(weather, departures); });
+        });
+        snprintf(name, sizeof(name), "half frame, %u pages, display list", (HEIGHT + pageHeight - 1) / pageHeight);
+        DisplayList frame;
+        bench(name, iterations, [pageHeight, &frame] {
+            drawPaged(frame, pageHeight, [] { drawHalfDeparturesFrame(weather, departures); });
+        });
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_fixtures_load);
+    RUN_TEST(test_half_departures_frame);
+    RUN_TEST(test_half_departures_frame_without_departures);
+    RUN_TEST(test_half_trip_frame);
+    RUN_TEST(test_weather_full_frame);
+    RUN_TEST(test_departures_full_frame);
+    RUN_TEST(test_frames_stay_inside_the_panel);
+    RUN_TEST(test_display_list_records_without_drawing);
+    RUN_TEST(test_display_list_replays_pages_to_golden_frames);
+    RUN_TEST(test_layer_cache_keeps_frames_identical);
+    RUN_TEST(test_layer_cache_redraws_changed_layers);
+    RUN_TEST(test_text_width_matches_u8g2);
+    RUN_TEST(test_missing_glyphs_print_fallback);
+    RUN_TEST(test_compressed_icons_match_raw_bitmaps);
+    RUN_TEST(test_stipple_matches_pixel_loops);
+    RUN_TEST(test_spline_matches_float_curves);
+    RUN_TEST(test_shorten_text_matches_previous_fitting);
+    RUN_TEST(test_shorten_text_cuts_on_character_boundaries);
+    RUN_TEST(test_render_benchmark);
+    RUN_TEST(test_text_fitting_benchmark);
+    RUN_TEST(test_icon_blit_benchmark);
+    RUN_TEST(test_stipple_benchmark);
+    RUN_TEST(test_spline_benchmark);
+    RUN_TEST(test_layer_cache_benchmark);
+    RUN_TEST(test_paged_frame_benchmark);
+    return UNITY_END();
+}
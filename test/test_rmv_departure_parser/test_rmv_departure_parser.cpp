@@ -0,0 +1,514 @@
+#include <unity.h>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include "api/rmv_departure_parser.h"
+#include "api/rmv_json_parser.h"
+
+// Fixtures live in test/rmv/; pio runs native tests from the project root
+#define RMV_FIXTURE_DIR "test/rmv/"
+
+// Read a .json5 fixture, drop comments and optionally wrap a single departure object
+// as {"Departure":[...]} so it looks like a real departureBoard response
+static std::string loadFixture(const char* name, bool wrapSingleDeparture = false) {
+    std::string path = std::string(RMV_FIXTURE_DIR) + name;
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return std::string();
+    std::string raw;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) raw.append(buf, n);
+    fclose(f);
+
+    std::string json;
+    bool inString = false;
+    for (size_t i = 0; i < raw.size(); i++) {
+        char c = raw[i];
+        if (inString) {
+            json += c;
+            if (c == '\\' && i + 1 < raw.size()) {
+                json += raw[++i];
+            } else if (c == '"') {
+                inString = false;
+            }
+        } else if (c == '"') {
+            inString = true;
+            json += c;
+        } else if (c == '/' && i + 1 < raw.size() && raw[i + 1] == '/') {
+            while (i < raw.size() && raw[i] != '\n') i++;
+        } else if (c == '/' && i + 1 < raw.size() && raw[i + 1] == '*') {
+            size_t end = raw.find("*/", i + 2);
+            i = end == std::string::npos ? raw.size() : end + 1;
+        } else {
+            json += c;
+        }
+    }
+
+    if (wrapSingleDeparture) {
+        // Snippets may end with a trailing comma copied from the array
+        while (!json.empty() && (isspace(static_cast<unsigned char>(json.back())) || json.back() == ',')) {
+            json.pop_back();
+        }
+        json = "{\"Departure\":[" + json + "]}";
+    }
+    return json;
+}
+
+static bool parseAll(const std::string& json, DepartureData& data, size_t maxDepartures = 40) {
+    RMVDepartureParser parser(data, maxDepartures);
+    return parser.feed(json.data(), json.size()) && parser.isDone();
+}
+
+void setUp(void) {
+    StringPool::reset();
+}
+
+void tearDown(void) {}
+
+void test_board_fixture_parses_all_departures() {
+    std::string json = loadFixture("departures.json5");
+    TEST_ASSERT_FALSE(json.empty());
+
+    DepartureData data;
+    TEST_ASSERT_TRUE(parseAll(json, data));
+    TEST_ASSERT_EQUAL(30, data.departureCount);
+    TEST_ASSERT_EQUAL(30, (int)data.departures.size());
+
+    const DepartureInfo& first = data.departures[0];
+    TEST_ASSERT_EQUAL_STRING("S5", first.line.c_str());
+    TEST_ASSERT_EQUAL_STRING("S", first.category.c_str());
+    TEST_ASSERT_EQUAL_STRING("21:46:00", first.time.c_str());
+    TEST_ASSERT_EQUAL_STRING("21:48:00", first.rtTime.c_str());
+    TEST_ASSERT_EQUAL_STRING("2", first.track.c_str());
+    TEST_ASSERT_EQUAL_STRING("Frankfurt (Main) Südbahnhof", first.direction.c_str());
+    TEST_ASSERT_EQUAL_STRING("1", first.directionFlag.c_str());
+    TEST_ASSERT_EQUAL_STRING("S3, S4, S5: nächtliche Teilausfälle mit Ersatzverkehr", first.text.c_str());
+    TEST_ASSERT_FALSE(first.cancelled);
+
+    const DepartureInfo& bus = data.departures[1];
+    TEST_ASSERT_EQUAL_STRING("M34", bus.line.c_str());
+    TEST_ASSERT_EQUAL_STRING("Bus", bus.category.c_str());
+    TEST_ASSERT_EQUAL_STRING("Ost", bus.track.c_str());
+    TEST_ASSERT_EQUAL_STRING("", bus.text.c_str());
+}
+
+void test_board_fixture_missing_fields_stay_empty() {
+    DepartureData data;
+    TEST_ASSERT_TRUE(parseAll(loadFixture("departures.json5"), data));
+
+    // Departure 28 has no rtTime, track or directionFlag and is cancelled
+    const DepartureInfo& dep = data.departures[28];
+    TEST_ASSERT_EQUAL_STRING("M55", dep.line.c_str());
+    TEST_ASSERT_EQUAL_STRING("22:39:00", dep.time.c_str());
+    TEST_ASSERT_EQUAL_STRING("", dep.rtTime.c_str());
+    TEST_ASSERT_EQUAL_STRING("", dep.track.c_str());
+    TEST_ASSERT_EQUAL_STRING("", dep.directionFlag.c_str());
+    TEST_ASSERT_TRUE(dep.cancelled);
+}
+
+void test_single_departure_fixtures() {
+    DepartureData data;
+
+    TEST_ASSERT_TRUE(parseAll(loadFixture("cancelled.json5", true), data));
+    TEST_ASSERT_EQUAL(1, data.departureCount);
+    TEST_ASSERT_EQUAL_STRING("S3", data.departures[0].line.c_str());
+    TEST_ASSERT_EQUAL_STRING("13:26:00", data.departures[0].time.c_str());
+    TEST_ASSERT_TRUE(data.departures[0].cancelled);
+
+    TEST_ASSERT_TRUE(parseAll(loadFixture("departure_sbahn.json5", true), data));
+    TEST_ASSERT_EQUAL(1, data.departureCount);
+    TEST_ASSERT_EQUAL_STRING("18:21:00", data.departures[0].rtTime.c_str());
+    TEST_ASSERT_EQUAL_STRING("S1, S2, S3, S4, S5, S6, S7, S8, S9: aktuelle Störung (Stand 18.06., 17:46 Uhr)",
+                             data.departures[0].text.c_str());
+
+    TEST_ASSERT_TRUE(parseAll(loadFixture("depature_bus.json5", true), data));
+    TEST_ASSERT_EQUAL(1, data.departureCount);
+    TEST_ASSERT_EQUAL_STRING("56", data.departures[0].line.c_str());
+    TEST_ASSERT_EQUAL_STRING("Eschborn Südbahnhof", data.departures[0].direction.c_str());
+    TEST_ASSERT_EQUAL_STRING("2", data.departures[0].directionFlag.c_str());
+}
+
+void test_stops_reading_at_max_departures() {
+    std::string json = loadFixture("departures.json5");
+    DepartureData data;
+    RMVDepartureParser parser(data, 22);
+
+    TEST_ASSERT_TRUE(parser.feed(json.data(), json.size()));
+    TEST_ASSERT_TRUE(parser.isDone());
+    TEST_ASSERT_EQUAL(22, data.departureCount);
+    TEST_ASSERT_LESS_THAN(json.size(), parser.bytesConsumed());
+}
+
+void test_byte_wise_feed_matches_bulk_feed() {
+    std::string json = loadFixture("departures.json5");
+
+    DepartureData bulk;
+    TEST_ASSERT_TRUE(parseAll(json, bulk));
+
+    DepartureData bytewise;
+    RMVDepartureParser parser(bytewise, 40);
+    for (size_t i = 0; i < json.size() && !parser.isDone(); i++) {
+        TEST_ASSERT_TRUE(parser.feed(&json[i], 1));
+    }
+
+    TEST_ASSERT_EQUAL(bulk.departureCount, bytewise.departureCount);
+    for (int i = 0; i < bulk.departureCount; i++) {
+        TEST_ASSERT_EQUAL_MEMORY(&bulk.departures[i], &bytewise.departures[i], sizeof(DepartureInfo));
+    }
+}
+
+void test_no_reallocation_while_parsing() {
+    std::string json = loadFixture("departures.json5");
+    DepartureData data;
+    RMVDepartureParser parser(data, 40);
+
+    const DepartureInfo* storage = data.departures.data();
+    size_t capacity = data.departures.capacity();
+    TEST_ASSERT_TRUE(parser.feed(json.data(), json.size()));
+
+    // Reserved once in reset(); records are filled in place
+    TEST_ASSERT_TRUE(storage == data.departures.data());
+    TEST_ASSERT_EQUAL(capacity, data.departures.capacity());
+}
+
+void test_long_values_truncate_on_utf8_boundary() {
+    // 62 ASCII bytes followed by 'ü' (2 bytes) does not fit into direction[64]
+    std::string direction(62, 'a');
+    std::string json = "{\"Departure\":[{\"direction\":\"" + direction + "\xc3\xbc" + "x\"}]}";
+
+    DepartureData data;
+    TEST_ASSERT_TRUE(parseAll(json, data));
+    TEST_ASSERT_EQUAL_STRING(direction.c_str(), data.departures[0].direction.c_str());
+}
+
+void test_escapes_are_decoded() {
+    std::string json = "{\"Departure\":[{\"direction\":\"M\\u00fchlberg \\\"Nord\\\"\",\"time\":\"08:00:00\"}]}";
+
+    DepartureData data;
+    TEST_ASSERT_TRUE(parseAll(json, data));
+    TEST_ASSERT_EQUAL_STRING("Mühlberg \"Nord\"", data.departures[0].direction.c_str());
+    TEST_ASSERT_EQUAL_STRING("08:00:00", data.departures[0].time.c_str());
+}
+
+void test_only_first_product_and_message_are_used() {
+    std::string json =
+        "{\"Departure\":[{\"Product\":[{\"line\":\"S1\",\"catOut\":\"S\"},{\"line\":\"S9\",\"catOut\":\"X\"}],"
+        "\"ProductAtStop\":{\"line\":\"ignored\"},"
+        "\"Messages\":{\"Message\":[{\"head\":\"first\"},{\"head\":\"second\"}]}}]}";
+
+    DepartureData data;
+    TEST_ASSERT_TRUE(parseAll(json, data));
+    TEST_ASSERT_EQUAL_STRING("S1", data.departures[0].line.c_str());
+    TEST_ASSERT_EQUAL_STRING("S", data.departures[0].category.c_str());
+    TEST_ASSERT_EQUAL_STRING("first", data.departures[0].text.c_str());
+}
+
+void test_response_without_departures() {
+    DepartureData data;
+    TEST_ASSERT_TRUE(parseAll("{\"serverVersion\":\"2.45\",\"Departure\":[],\"requestId\":\"x\"}", data));
+    TEST_ASSERT_EQUAL(0, data.departureCount);
+
+    TEST_ASSERT_TRUE(parseAll("{\"serverVersion\":\"2.45\"}", data));
+    TEST_ASSERT_EQUAL(0, data.departureCount);
+}
+
+void test_malformed_input_is_rejected() {
+    DepartureData data;
+    RMVDepartureParser parser(data);
+    const char* missingColon = "{\"Departure\":[{\"time\" \"08:00\"}]}";
+    TEST_ASSERT_FALSE(parser.feed(missingColon, strlen(missingColon)));
+    TEST_ASSERT_TRUE(parser.hasError());
+
+    parser.reset();
+    const char* mismatched = "{\"Departure\":[}";
+    TEST_ASSERT_FALSE(parser.feed(mismatched, strlen(mismatched)));
+
+    // Truncated body: no error, but not done either
+    parser.reset();
+    const char* truncated = "{\"Departure\":[{\"time\":\"08:";
+    TEST_ASSERT_TRUE(parser.feed(truncated, strlen(truncated)));
+    TEST_ASSERT_FALSE(parser.isDone());
+}
+
+void test_string_pool_interns_duplicates() {
+    uint16_t a = StringPool::intern("S6");
+    uint16_t b = StringPool::intern("Frankfurt (Main) Hauptbahnhof");
+    uint16_t c = StringPool::intern("S6");
+
+    TEST_ASSERT_EQUAL(a, c);
+    TEST_ASSERT_NOT_EQUAL(a, b);
+    TEST_ASSERT_EQUAL_STRING("S6", StringPool::get(a));
+    TEST_ASSERT_EQUAL(2, (int)StringPool::stringCount());
+    TEST_ASSERT_EQUAL(1, (int)StringPool::internHits());
+    TEST_ASSERT_EQUAL(0, StringPool::intern(""));
+
+    StringPool::reset();
+    TEST_ASSERT_EQUAL(0, (int)StringPool::stringCount());
+    TEST_ASSERT_EQUAL(a, StringPool::intern("S6")); // Arena starts over at the same offset
+}
+
+void test_string_pool_overflow_drops_strings() {
+    char value[64];
+    int stored = 0;
+    for (int i = 0; i < 200; i++) {
+        snprintf(value, sizeof(value), "unique destination number %03d padded to length", i);
+        if (StringPool::intern(value) != 0) stored++;
+    }
+
+    TEST_ASSERT_LESS_THAN(200, stored);
+    TEST_ASSERT_GREATER_THAN(0, (int)StringPool::droppedStrings());
+    TEST_ASSERT_LESS_OR_EQUAL(StringPool::ARENA_SIZE, StringPool::bytesUsed());
+}
+
+void test_departures_share_pooled_strings() {
+    DepartureData data;
+    TEST_ASSERT_TRUE(parseAll(loadFixture("departures.json5"), data));
+
+    // Departures 1 and 7 are both M34 towards Mönchhofstraße
+    TEST_ASSERT_TRUE(data.departures[1].line == data.departures[7].line);
+    TEST_ASSERT_EQUAL(data.departures[1].direction.ref, data.departures[7].direction.ref);
+    TEST_ASSERT_TRUE(data.departures[2].rtTime == data.departures[2].time);
+    TEST_ASSERT_TRUE(data.departures[0].rtTime != data.departures[0].time);
+}
+
+void test_memory_per_departure() {
+    DepartureData data;
+    TEST_ASSERT_TRUE(parseAll(loadFixture("departures.json5"), data));
+
+    // Reference points: the former char[] record and its String-based predecessor (10 Strings)
+    const size_t fixedRecord = 12 + 64 + 4 + 9 + 9 + 8 + 12 + 96 + 1;
+    size_t stringRecordHeap = 0;
+    for (const DepartureInfo& dep : data.departures) {
+        const PooledString* fields[] = {&dep.line, &dep.direction, &dep.directionFlag, &dep.time,
+                                        &dep.rtTime, &dep.track, &dep.category, &dep.text};
+        for (const PooledString* field : fields) {
+            size_t len = strlen(field->c_str());
+            if (len > 0) stringRecordHeap += len + 1 + 8; // Payload + allocator header
+        }
+    }
+
+    size_t count = static_cast<size_t>(data.departureCount);
+    double pooled = sizeof(DepartureInfo) + static_cast<double>(StringPool::bytesUsed()) / count;
+    printf("[MEM] %zu departures, %zu unique strings, %zu dedup hits, arena %zu bytes\n", count,
+           StringPool::stringCount(), StringPool::internHits(), StringPool::bytesUsed());
+    printf("[MEM] per departure: pooled %.1f bytes (%zu record + arena share), char[] %zu bytes, "
+           "host String %.1f bytes (%zu + heap)\n",
+           pooled, sizeof(DepartureInfo), fixedRecord,
+           10 * sizeof(String) + 1 + static_cast<double>(stringRecordHeap) / count, 10 * sizeof(String) + 1);
+
+    TEST_ASSERT_LESS_THAN(fixedRecord, static_cast<size_t>(pooled));
+    TEST_ASSERT_LESS_THAN(StringPool::ARENA_SIZE / 2, StringPool::bytesUsed());
+}
+
+// Serves a fixture like a network socket: available() only reports the current "packet"
+class FixtureStream : public Stream {
+public:
+    FixtureStream(const std::string& data, size_t packetSize) : data(data), packetSize(packetSize) {}
+
+    int available() override {
+        if (pos >= data.size()) return 0;
+        if (packetLeft == 0) packetLeft = packetSize;
+        return static_cast<int>(std::min(packetLeft, data.size() - pos));
+    }
+
+    int read() override {
+        if (pos >= data.size()) return -1; // Like a timeout on a closed connection
+        if (packetLeft > 0) packetLeft--;
+        return static_cast<unsigned char>(data[pos++]);
+    }
+
+    int peek() override { return pos < data.size() ? static_cast<unsigned char>(data[pos]) : -1; }
+
+private:
+    const std::string& data;
+    size_t packetSize;
+    size_t packetLeft = 0;
+    size_t pos = 0;
+};
+
+void test_stream_parser_matches_bulk_parse() {
+    std::string json = loadFixture("departures.json5");
+    DepartureData bulk;
+    TEST_ASSERT_TRUE(parseAll(json, bulk));
+
+    // Packet sizes below, equal to and above the buffer size, plus odd sizes that split tokens
+    const size_t packetSizes[] = {1, 7, 100, RMVStreamParser::BUFFER_SIZE, 1460, 5000};
+    for (size_t packetSize : packetSizes) {
+        FixtureStream stream(json, packetSize);
+        DepartureData data;
+        RMVStreamParser parser(data, 40);
+
+        TEST_ASSERT_TRUE(parser.parseResponse(stream));
+        TEST_ASSERT_EQUAL(bulk.departureCount, data.departureCount);
+        for (int i = 0; i < bulk.departureCount; i++) {
+            TEST_ASSERT_EQUAL_MEMORY(&bulk.departures[i], &data.departures[i], sizeof(DepartureInfo));
+        }
+    }
+}
+
+void test_stream_parser_memory_bounded_by_buffer() {
+    std::string json = loadFixture("departures.json5");
+    FixtureStream stream(json, 1460);
+    DepartureData data;
+    RMVStreamParser parser(data, 22);
+
+    TEST_ASSERT_TRUE(parser.parseResponse(stream));
+    TEST_ASSERT_EQUAL(22, data.departureCount);
+    TEST_ASSERT_LESS_OR_EQUAL(RMVStreamParser::BUFFER_SIZE, parser.peakBuffered());
+
+    // Stops reading once enough departures are in
+    TEST_ASSERT_LESS_THAN(json.size(), parser.bytesRead());
+    printf("[MEM] buffer %zu bytes + parser %zu bytes for a %zu byte response\n", RMVStreamParser::BUFFER_SIZE,
+           sizeof(RMVStreamParser) - RMVStreamParser::BUFFER_SIZE, json.size());
+}
+
+void test_stream_parser_keeps_more_than_22_departures() {
+    std::string json = loadFixture("departures.json5");
+    FixtureStream stream(json, 1460);
+    DepartureData data;
+    RMVStreamParser parser(data);
+
+    TEST_ASSERT_TRUE(parser.parseResponse(stream));
+    TEST_ASSERT_EQUAL(30, data.departureCount);
+    TEST_ASSERT_EQUAL_STRING("22:40:00", data.departures[29].time.c_str());
+}
+
+void test_stream_parser_truncated_body_fails() {
+    std::string json = loadFixture("departures.json5").substr(0, 20000);
+    FixtureStream stream(json, 1460);
+    DepartureData data;
+    RMVStreamParser parser(data);
+
+    TEST_ASSERT_FALSE(parser.parseResponse(stream));
+    TEST_ASSERT_EQUAL(json.size(), parser.bytesRead());
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark: streaming parser vs. the previous filtered JsonDocument path
+// ---------------------------------------------------------------------------
+
+#if __has_include(<ArduinoJson.h>)
+#include <ArduinoJson.h>
+
+// Pre-streaming departure record: one heap string per field
+struct LegacyDepartureInfo {
+    std::string line, direction, directionFlag, time, rtTime, track, category, text;
+    bool cancelled;
+};
+
+// Mirrors the former initDepartureFilter() + populateDepartureData() in rmv_api.cpp
+static size_t legacyParse(const std::string& json, std::vector<LegacyDepartureInfo>& out) {
+    JsonDocument filter;
+    filter["Departure"][0]["time"] = true;
+    filter["Departure"][0]["track"] = true;
+    filter["Departure"][0]["rtTime"] = true;
+    filter["Departure"][0]["cancelled"] = true;
+    filter["Departure"][0]["direction"] = true;
+    filter["Departure"][0]["directionFlag"] = true;
+    filter["Departure"][0]["Product"][0]["line"] = true;
+    filter["Departure"][0]["Product"][0]["catOut"] = true;
+    filter["Departure"][0]["Messages"]["Message"][0]["head"] = true;
+
+    JsonDocument doc;
+    if (deserializeJson(doc, json, DeserializationOption::Filter(filter), DeserializationOption::NestingLimit(20))) {
+        return 0;
+    }
+
+    out.clear();
+    JsonArrayConst departures = doc["Departure"];
+    out.reserve(departures.size());
+    for (JsonVariantConst dep : departures) {
+        LegacyDepartureInfo info;
+        info.direction = dep["direction"] | "";
+        info.directionFlag = dep["directionFlag"] | "";
+        info.time = dep["time"] | "";
+        info.rtTime = dep["rtTime"] | "";
+        info.cancelled = dep["cancelled"].as<bool>();
+        info.track = dep["track"] | "";
+        info.line = dep["Product"][0]["line"] | "";
+        info.category = dep["Product"][0]["catOut"] | "";
+        info.text = dep["Messages"]["Message"][0]["head"] | "";
+        out.push_back(info);
+    }
+    return doc.memoryUsage();
+}
+#endif
+
+void test_benchmark_against_fixtures() {
+    const char* fixtures[] = {"departures.json5", "cancelled.json5", "departure_sbahn.json5", "depature_bus.json5"};
+    const int iterations = 200;
+
+    for (const char* name : fixtures) {
+        std::string json = loadFixture(name, strcmp(name, "departures.json5") != 0);
+        TEST_ASSERT_FALSE(json.empty());
+
+        DepartureData data;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            TEST_ASSERT_TRUE(parseAll(json, data, RMV_MAX_DEPARTURES));
+        }
+        double streamUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+            iterations;
+
+        printf("[BENCH] %-22s %7zu bytes  stream: %8.1f us  %5.1f MB/s  %d departures, %zu bytes records\n", name,
+               json.size(), streamUs, json.size() / streamUs, data.departureCount,
+               data.departures.capacity() * sizeof(DepartureInfo));
+
+#if __has_include(<ArduinoJson.h>)
+        std::vector<LegacyDepartureInfo> legacy;
+        size_t docBytes = 0;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            docBytes = legacyParse(json, legacy);
+        }
+        double legacyUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+            iterations;
+
+        printf("[BENCH] %-22s %7zu bytes  legacy: %8.1f us  %5.1f MB/s  %zu departures, %zu bytes JsonDocument\n",
+               name, json.size(), legacyUs, json.size() / legacyUs, legacy.size(), docBytes);
+
+        // Both paths must agree on the visible fields (legacy keeps every departure)
+        for (int i = 0; i < data.departureCount; i++) {
+            TEST_ASSERT_EQUAL_STRING(legacy[i].line.c_str(), data.departures[i].line.c_str());
+            TEST_ASSERT_EQUAL_STRING(legacy[i].direction.c_str(), data.departures[i].direction.c_str());
+            TEST_ASSERT_EQUAL_STRING(legacy[i].time.c_str(), data.departures[i].time.c_str());
+            TEST_ASSERT_EQUAL_STRING(legacy[i].rtTime.c_str(), data.departures[i].rtTime.c_str());
+            TEST_ASSERT_EQUAL_STRING(legacy[i].text.c_str(), data.departures[i].text.c_str());
+            TEST_ASSERT_EQUAL(legacy[i].cancelled, data.departures[i].cancelled);
+        }
+#endif
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_board_fixture_parses_all_departures);
+    RUN_TEST(test_board_fixture_missing_fields_stay_empty);
+    RUN_TEST(test_single_departure_fixtures);
+    RUN_TEST(test_stops_reading_at_max_departures);
+    RUN_TEST(test_byte_wise_feed_matches_bulk_feed);
+    RUN_TEST(test_no_reallocation_while_parsing);
+    RUN_TEST(test_long_values_truncate_on_utf8_boundary);
+    RUN_TEST(test_escapes_are_decoded);
+    RUN_TEST(test_only_first_product_and_message_are_used);
+    RUN_TEST(test_response_without_departures);
+    RUN_TEST(test_malformed_input_is_rejected);
+
+    RUN_TEST(test_string_pool_interns_duplicates);
+    RUN_TEST(test_string_pool_overflow_drops_strings);
+    RUN_TEST(test_departures_share_pooled_strings);
+    RUN_TEST(test_memory_per_departure);
+
+    RUN_TEST(test_stream_parser_matches_bulk_parse);
+    RUN_TEST(test_stream_parser_memory_bounded_by_buffer);
+    RUN_TEST(test_stream_parser_keeps_more_than_22_departures);
+    RUN_TEST(test_stream_parser_truncated_body_fails);
+
+    RUN_TEST(test_benchmark_against_fixtures);
+
+    return UNITY_END();
+}
@@ -34,6 +34,9 @@ RTCConfigData ConfigManager::rtcConfig = {
     // filterFlags
     false, // tripMode
     "", // tripDestId
+    6, // maxWeatherInterval
+    30, // maxTransportInterval
+    -1, // chargeDay
     false, // configMode
     0, // lastUpdate
     false, // inTemporaryMode
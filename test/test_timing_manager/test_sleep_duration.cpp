@@ -1,4 +1,5 @@
 #include <unity.h>
+#include <cstdlib>
 #include <ctime>
 #include "util/timing_manager.h"
 #include "config/config_manager.h"
@@ -59,6 +60,8 @@ void setUp(void) {
     TimingManager::setLastWeatherUpdate(0);
     TimingManager::setLastTransportUpdate(0);
     TimingManager::setLastOTACheck(0);
+    TimingManager::setNextDepartureChange(0);
+    TimingManager::setIntervalStretch(100);
 }
 
 void tearDown(void) {
@@ -1192,6 +1195,302 @@ void test_jitter_seed_is_deterministic() {
     printf("Jitter seed: 0x%08X, jitter value: %u seconds\n", seed1, seed1 % MAX_JITTER_SECONDS);
 }
 
+// Test: A quiet stop (20 min headway) sleeps until its first departure leaves the list
+void test_departure_change_defers_transport_update() {
+    time_t morning = createTime(2025, 10, 30, 7, 0, 0); // Thursday
+    MockTime::setMockTime(morning);
+
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.displayMode = DISPLAY_MODE_TRANSPORT_ONLY;
+    config.transportInterval = 5; // 5 minutes
+    config.otaEnabled = false;
+
+    TimingManager::setLastTransportUpdate((uint32_t)morning);
+    TimingManager::setNextDepartureChange((uint32_t)morning + 17 * 60);
+
+    uint64_t sleepDuration = TimingManager::getNextSleepDurationSeconds();
+
+    printf("Departure change in 17 minutes: %llu seconds\n", static_cast<unsigned long long>(sleepDuration));
+    TEST_ASSERT_EQUAL(17 * 60, sleepDuration);
+}
+
+// Test: A distant departure change is bounded by the maximum staleness
+void test_departure_change_bounded_by_staleness() {
+    time_t morning = createTime(2025, 10, 30, 7, 0, 0);
+    MockTime::setMockTime(morning);
+
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.displayMode = DISPLAY_MODE_TRANSPORT_ONLY;
+    config.transportInterval = 5;
+    config.otaEnabled = false;
+
+    TimingManager::setLastTransportUpdate((uint32_t)morning);
+    TimingManager::setNextDepartureChange((uint32_t)morning + 55 * 60);
+
+    uint64_t sleepDuration = TimingManager::getNextSleepDurationSeconds();
+
+    printf("Departure change in 55 minutes: %llu seconds\n", static_cast<unsigned long long>(sleepDuration));
+    TEST_ASSERT_EQUAL(MAX_DEPARTURE_STALENESS_SECONDS, sleepDuration);
+}
+
+// Test: A busy stop never wakes more often than the configured interval
+void test_departure_change_sooner_than_interval_keeps_interval() {
+    time_t morning = createTime(2025, 10, 30, 7, 0, 0);
+    MockTime::setMockTime(morning);
+
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.displayMode = DISPLAY_MODE_TRANSPORT_ONLY;
+    config.transportInterval = 5;
+    config.otaEnabled = false;
+
+    TimingManager::setLastTransportUpdate((uint32_t)morning);
+    TimingManager::setNextDepartureChange((uint32_t)morning + 2 * 60);
+
+    uint64_t sleepDuration = TimingManager::getNextSleepDurationSeconds();
+
+    printf("Departure change in 2 minutes: %llu seconds\n", static_cast<unsigned long long>(sleepDuration));
+    TEST_ASSERT_EQUAL(300, sleepDuration);
+}
+
+// Test: Unknown (0) or outdated departure changes fall back to the interval
+void test_departure_change_unknown_uses_interval() {
+    time_t morning = createTime(2025, 10, 30, 7, 0, 0);
+    MockTime::setMockTime(morning);
+
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.displayMode = DISPLAY_MODE_TRANSPORT_ONLY;
+    config.transportInterval = 5;
+    config.otaEnabled = false;
+
+    TimingManager::setLastTransportUpdate((uint32_t)morning);
+    TimingManager::setNextDepartureChange(0);
+    TEST_ASSERT_EQUAL(300, TimingManager::getNextSleepDurationSeconds());
+
+    // Change time from before the last fetch
+    TimingManager::setNextDepartureChange((uint32_t)morning - 60);
+    TEST_ASSERT_EQUAL(300, TimingManager::getNextSleepDurationSeconds());
+}
+
+// Test: Half-and-half still wakes for a weather update due before the departure change
+void test_departure_change_halfhalf_weather_first() {
+    time_t morning = createTime(2025, 10, 30, 7, 0, 0);
+    MockTime::setMockTime(morning);
+
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.displayMode = DISPLAY_MODE_HALF_AND_HALF;
+    config.transportInterval = 5;
+    config.weatherInterval = 1;
+    config.otaEnabled = false;
+
+    TimingManager::setLastWeatherUpdate((uint32_t)morning - 50 * 60); // Due in 10 minutes
+    TimingManager::setLastTransportUpdate((uint32_t)morning);
+    TimingManager::setNextDepartureChange((uint32_t)morning + 20 * 60);
+
+    uint64_t sleepDuration = TimingManager::getNextSleepDurationSeconds();
+
+    printf("Weather due before departure change: %llu seconds\n", static_cast<unsigned long long>(sleepDuration));
+    TEST_ASSERT_EQUAL(600, sleepDuration);
+}
+
+// Test: Departure clock times resolve to the occurrence nearest to now
+void test_departure_timestamp_wraps_midnight() {
+    time_t lateEvening = createTime(2025, 10, 30, 23, 50, 0);
+
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)createTime(2025, 10, 30, 23, 58, 0),
+                             TimingManager::departureTimestamp("23:58", (uint32_t)lateEvening));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)createTime(2025, 10, 31, 0, 12, 0),
+                             TimingManager::departureTimestamp("00:12", (uint32_t)lateEvening));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)createTime(2025, 10, 30, 23, 58, 30),
+                             TimingManager::departureTimestamp("23:58:30", (uint32_t)lateEvening));
+
+    // A departure shortly before now (delayed, still listed) stays on the same day
+    time_t afterMidnight = createTime(2025, 10, 31, 0, 5, 0);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)createTime(2025, 10, 30, 23, 59, 0),
+                             TimingManager::departureTimestamp("23:59", (uint32_t)afterMidnight));
+
+    TEST_ASSERT_EQUAL_UINT32(0, TimingManager::departureTimestamp("", (uint32_t)lateEvening));
+}
+
+// Test: The energy plan's stretch lengthens the intervals up to the configured maximum
+void test_interval_stretch_within_bounds() {
+    time_t morning = createTime(2025, 10, 30, 7, 0, 0);
+    MockTime::setMockTime(morning);
+
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.displayMode = DISPLAY_MODE_TRANSPORT_ONLY;
+    config.transportInterval = 5;
+    config.maxTransportInterval = 12;
+    config.otaEnabled = false;
+
+    TimingManager::setLastTransportUpdate((uint32_t)morning);
+
+    TimingManager::setIntervalStretch(200);
+    TEST_ASSERT_EQUAL(600, TimingManager::getNextSleepDurationSeconds());
+
+    TimingManager::setIntervalStretch(400); // Capped by maxTransportInterval
+    TEST_ASSERT_EQUAL(720, TimingManager::getNextSleepDurationSeconds());
+
+    TimingManager::setIntervalStretch(50); // Never shorter than configured
+    TEST_ASSERT_EQUAL(100, TimingManager::getIntervalStretch());
+    TEST_ASSERT_EQUAL(300, TimingManager::getNextSleepDurationSeconds());
+}
+
+// ===== COMPILED WAKE SCHEDULE EQUIVALENCE TESTS =====
+// The reference functions below are the String and localtime_r() based checks the schedule
+// replaced, asked about the time they run at (now == timestamp).
+
+static int legacyParseTime(const String& timeStr) {
+    int colonPos = timeStr.indexOf(':');
+    if (colonPos == -1) return 0;
+    return timeStr.substring(0, colonPos).toInt() * 60 + timeStr.substring(colonPos + 1).toInt();
+}
+
+static bool legacyInRange(int minutes, int start, int end) {
+    return start <= end ? minutes >= start && minutes < end : minutes >= start || minutes < end;
+}
+
+static bool legacyWeekend(const RTCConfigData& config, const tm& timeInfo) {
+    return config.weekendMode && (timeInfo.tm_wday == 0 || timeInfo.tm_wday == 6);
+}
+
+static bool legacyTransportActive(const RTCConfigData& config, uint32_t timestamp) {
+    tm timeInfo;
+    time_t time = (time_t)timestamp;
+    localtime_r(&time, &timeInfo);
+    bool weekend = legacyWeekend(config, timeInfo);
+    int start = legacyParseTime(weekend ? String(config.weekendTransportStart) : String(config.transportActiveStart));
+    int end = legacyParseTime(weekend ? String(config.weekendTransportEnd) : String(config.transportActiveEnd));
+    return legacyInRange(timeInfo.tm_hour * 60 + timeInfo.tm_min, start, end);
+}
+
+// Wake time for an update at timestamp: pushed to the sleep end if it falls into the sleep window
+static uint32_t legacySleepAdjust(const RTCConfigData& config, uint32_t timestamp) {
+    tm timeInfo;
+    time_t time = (time_t)timestamp;
+    localtime_r(&time, &timeInfo);
+    int minutes = timeInfo.tm_hour * 60 + timeInfo.tm_min;
+    bool weekend = legacyWeekend(config, timeInfo);
+    int sleepStart = legacyParseTime(weekend ? String(config.weekendSleepStart) : String(config.sleepStart));
+    int sleepEnd = legacyParseTime(weekend ? String(config.weekendSleepEnd) : String(config.sleepEnd));
+    if (!legacyInRange(minutes, sleepStart, sleepEnd)) return timestamp;
+
+    uint32_t end = timestamp + (sleepEnd > minutes ? sleepEnd - minutes : 24 * 60 - minutes + sleepEnd) * 60;
+    tm endInfo;
+    time_t endTime = (time_t)end;
+    localtime_r(&endTime, &endInfo);
+    bool endWeekend = legacyWeekend(config, endInfo);
+    if (endWeekend != weekend) {
+        int correctEnd = legacyParseTime(endWeekend ? String(config.weekendSleepEnd) : String(config.sleepEnd));
+        end = timestamp + (correctEnd > minutes ? correctEnd - minutes : 24 * 60 - minutes + correctEnd) * 60;
+    }
+    return end;
+}
+
+static uint32_t legacyNextTransportStart(const RTCConfigData& config, uint32_t timestamp) {
+    tm timeInfo;
+    time_t time = (time_t)timestamp;
+    localtime_r(&time, &timeInfo);
+    int minutes = timeInfo.tm_hour * 60 + timeInfo.tm_min;
+    bool weekend = legacyWeekend(config, timeInfo);
+    int start = legacyParseTime(weekend ? String(config.weekendTransportStart) : String(config.transportActiveStart));
+    if (minutes < start) return timestamp + (start - minutes) * 60;
+
+    tm tomorrow = timeInfo;
+    tomorrow.tm_wday = (timeInfo.tm_wday + 1) % 7;
+    bool tomorrowWeekend = legacyWeekend(config, tomorrow);
+    int tomorrowStart = legacyParseTime(tomorrowWeekend ? String(config.weekendTransportStart)
+                                                        : String(config.transportActiveStart));
+    return timestamp + (24 * 60 - minutes + tomorrowStart) * 60;
+}
+
+static uint32_t legacyNextOTACheck(const RTCConfigData& config, uint32_t timestamp) {
+    tm timeInfo;
+    time_t time = (time_t)timestamp;
+    localtime_r(&time, &timeInfo);
+    int minutes = timeInfo.tm_hour * 60 + timeInfo.tm_min;
+    int ota = legacyParseTime(String(config.otaCheckTime));
+    return timestamp + (minutes < ota ? ota - minutes : 24 * 60 - minutes + ota) * 60;
+}
+
+// Compares every minute (at :17 seconds) of the days from start against the reference
+static void assertScheduleMatchesLegacy(const RTCConfigData& config, time_t start, int days) {
+    WakeSchedule plan;
+    WakeScheduler::compile(plan, config);
+    char message[96];
+    for (uint32_t t = (uint32_t)start + 17; t < (uint32_t)start + days * 86400; t += 60) {
+        uint16_t minute = WakeScheduler::minuteOfWeek(plan, t);
+        snprintf(message, sizeof(message), "timestamp %u (minute of week %u)", t, minute);
+
+        TEST_ASSERT_EQUAL_MESSAGE(legacyTransportActive(config, t), WakeScheduler::isTransportActive(plan, minute),
+                                  message);
+        uint32_t sleepEnd = t + WakeScheduler::minutesUntilSleepEnd(plan, minute) * 60;
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(legacySleepAdjust(config, t), sleepEnd, message);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(legacyNextTransportStart(config, t),
+                                         t + WakeScheduler::minutesUntilTransportStart(plan, minute) * 60, message);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(legacyNextOTACheck(config, t),
+                                         t + WakeScheduler::minutesUntilOTACheck(plan, minute) * 60, message);
+    }
+}
+
+// Test: The compiled schedule answers like the string-based checks for the setUp config
+void test_schedule_matches_legacy_default_config() {
+    RTCConfigData& config = ConfigManager::getConfig();
+    assertScheduleMatchesLegacy(config, createTime(2025, 10, 27, 0, 0, 0), 8); // Monday to Monday
+}
+
+// Test: Weekend mode off, and transport windows that run past midnight
+void test_schedule_matches_legacy_overnight_windows() {
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.weekendMode = false;
+    strcpy(config.transportActiveStart, "22:00");
+    strcpy(config.transportActiveEnd, "02:00");
+    strcpy(config.sleepStart, "01:00");
+    strcpy(config.sleepEnd, "05:00");
+    strcpy(config.otaCheckTime, "00:00");
+    assertScheduleMatchesLegacy(config, createTime(2025, 10, 27, 0, 0, 0), 8);
+
+    config.weekendMode = true;
+    strcpy(config.weekendTransportStart, "23:00");
+    strcpy(config.weekendTransportEnd, "01:30");
+    strcpy(config.weekendSleepStart, "00:00");
+    strcpy(config.weekendSleepEnd, "09:00");
+    strcpy(config.sleepStart, "22:00");
+    strcpy(config.sleepEnd, "00:00"); // Until midnight
+    strcpy(config.otaCheckTime, "23:59");
+    assertScheduleMatchesLegacy(config, createTime(2025, 10, 27, 0, 0, 0), 8);
+}
+
+// Test: The cached UTC offset follows the DST changes of the weeks they happen in
+void test_schedule_matches_legacy_across_dst() {
+    const char* previousTz = getenv("TZ");
+    String savedTz = previousTz ? String(previousTz) : String("");
+    setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+    tzset();
+
+    RTCConfigData& config = ConfigManager::getConfig();
+    strcpy(config.otaCheckTime, "02:30"); // Skipped on the spring change
+    assertScheduleMatchesLegacy(config, createTime(2025, 3, 27, 0, 0, 0), 5);
+    assertScheduleMatchesLegacy(config, createTime(2025, 10, 23, 0, 0, 0), 5);
+
+    if (previousTz) {
+        setenv("TZ", savedTz.c_str(), 1);
+    } else {
+        unsetenv("TZ");
+    }
+    tzset();
+}
+
+// Test: A config change reaches the sleep calculation without an explicit compile
+void test_schedule_recompiles_on_config_change() {
+    time_t morning = createTime(2025, 10, 30, 7, 30, 0); // Thursday
+    MockTime::setMockTime(morning);
+    TEST_ASSERT_TRUE(TimingManager::isTransportActiveTime());
+
+    RTCConfigData& config = ConfigManager::getConfig();
+    strcpy(config.transportActiveStart, "08:00");
+    TEST_ASSERT_FALSE(TimingManager::isTransportActiveTime());
+}
+
 int main() {
     UNITY_BEGIN();
 
@@ -1258,5 +1557,22 @@ int main() {
     RUN_TEST(test_jitter_not_applied_when_transport_updated);
     RUN_TEST(test_jitter_seed_is_deterministic);
 
+    // Departure-aware transport wake tests
+    RUN_TEST(test_departure_change_defers_transport_update);
+    RUN_TEST(test_departure_change_bounded_by_staleness);
+    RUN_TEST(test_departure_change_sooner_than_interval_keeps_interval);
+    RUN_TEST(test_departure_change_unknown_uses_interval);
+    RUN_TEST(test_departure_change_halfhalf_weather_first);
+    RUN_TEST(test_departure_timestamp_wraps_midnight);
+
+    // Battery energy plan
+    RUN_TEST(test_interval_stretch_within_bounds);
+
+    // Compiled wake schedule
+    RUN_TEST(test_schedule_matches_legacy_default_config);
+    RUN_TEST(test_schedule_matches_legacy_overnight_windows);
+    RUN_TEST(test_schedule_matches_legacy_across_dst);
+    RUN_TEST(test_schedule_recompiles_on_config_change);
+
     return UNITY_END();
 }
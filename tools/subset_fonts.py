@@ -0,0 +1,224 @@
+#!/usr/bin/env python3
+"""
+Subset the U8g2 helvB fonts → src/display/fonts_subset.cpp
+
+The full _tf fonts carry every Latin-1 glyph. The UI needs printable ASCII, the German
+letters, ° and the few other characters that appear in the firmware's string literals
+and the API fixtures (test/rmv, test/dwd_weather). Everything else is dropped; at runtime
+Fonts::printable() maps characters missing from the subset to a fallback glyph.
+
+Reads u8g2_fonts.c from the installed U8g2_for_Adafruit_GFX library. When it is not
+installed yet (first build before the library download) the full fonts are used.
+
+Opt-in: as a PlatformIO pre-script it only generates the subsets for environments that set
+`custom_font_subset = yes`. `pio test -e native-fonts` checks the generated subsets against
+the library's full fonts.
+
+Usage:
+    python3 tools/subset_fonts.py [path/to/u8g2_fonts.c]
+    # or via PlatformIO extra_scripts (defines FONT_SUBSET=1 where custom_font_subset = yes)
+"""
+
+import glob
+import os
+import re
+import sys
+
+FONTS = ["helvB08", "helvB10", "helvB12", "helvB14", "helvB18", "helvB24"]
+
+# Always kept, whatever the scan finds
+BASE_CHARSET = set(range(0x20, 0x7F)) | {ord(c) for c in "ÄÖÜäöüß°"}
+
+HEADER_SIZE = 23
+START_POS_UPPER_A = 17
+START_POS_LOWER_A = 19
+START_POS_UNICODE = 21
+
+C_ESCAPES = {"n": 10, "t": 9, "r": 13, "a": 7, "b": 8, "f": 12, "v": 11, "\\": 92, '"': 34, "'": 39, "?": 63}
+
+
+def get_project_root():
+    """Get project root - works both as CLI script and PlatformIO SCons script."""
+    try:
+        return os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    except NameError:
+        return os.getcwd()
+
+
+def find_u8g2_fonts(project_root):
+    pattern = os.path.join(project_root, ".pio", "libdeps", "*", "U8g2_for_Adafruit_GFX", "src", "u8g2_fonts.c")
+    matches = sorted(glob.glob(pattern))
+    return matches[0] if matches else None
+
+
+def unescape_c_literal(body):
+    """Bytes of the body of a C string literal (without quotes)."""
+    out = bytearray()
+    i = 0
+    while i < len(body):
+        ch = body[i]
+        if ch != "\\":
+            out += ch.encode("latin-1")
+            i += 1
+            continue
+        nxt = body[i + 1]
+        if nxt in "01234567":
+            digits = re.match(r"[0-7]{1,3}", body[i + 1:]).group(0)
+            out.append(int(digits, 8) & 0xFF)
+            i += 1 + len(digits)
+        elif nxt == "x":
+            digits = re.match(r"[0-9a-fA-F]+", body[i + 2:]).group(0)
+            out.append(int(digits, 16) & 0xFF)
+            i += 2 + len(digits)
+        else:
+            out.append(C_ESCAPES[nxt])
+            i += 2
+    return bytes(out)
+
+
+def read_font(source, name):
+    """Font array as stored in flash, including the string literal's terminating NUL."""
+    match = re.search(r"\bu8g2_font_" + name + r"_tf\s*\[\s*\d*\s*\][^=]*=\s*((?:\"(?:[^\"\\]|\\.)*\"\s*)+);", source)
+    if not match:
+        return None
+    pieces = re.findall(r"\"((?:[^\"\\]|\\.)*)\"", match.group(1))
+    return b"".join(unescape_c_literal(p) for p in pieces) + b"\0"
+
+
+def subset_font(font, keep):
+    """Drops the 8-bit glyphs not in keep; the unicode section is copied as it is."""
+    header = bytearray(font[:HEADER_SIZE])
+    unicode_offset = (font[START_POS_UNICODE] << 8) | font[START_POS_UNICODE + 1]
+
+    glyphs = bytearray()
+    pos_upper_a = None
+    pos_lower_a = None
+    kept = 0
+    pos = HEADER_SIZE
+    while font[pos + 1] != 0:  # A record of size 0 ends the 8-bit glyphs
+        encoding, size = font[pos], font[pos + 1]
+        if encoding in keep:
+            if pos_upper_a is None and encoding >= ord("A"):
+                pos_upper_a = len(glyphs)
+            if pos_lower_a is None and encoding >= ord("a"):
+                pos_lower_a = len(glyphs)
+            glyphs += font[pos:pos + size]
+            kept += 1
+        pos += size
+
+    removed = (pos - HEADER_SIZE) - len(glyphs)
+    if unicode_offset < pos - HEADER_SIZE:
+        raise ValueError("unicode section overlaps the 8-bit glyphs")
+    unicode_offset -= removed
+    pos_upper_a = len(glyphs) if pos_upper_a is None else pos_upper_a
+    pos_lower_a = len(glyphs) if pos_lower_a is None else pos_lower_a
+
+    header[0] = kept
+    header[START_POS_UPPER_A:START_POS_UPPER_A + 2] = pos_upper_a.to_bytes(2, "big")
+    header[START_POS_LOWER_A:START_POS_LOWER_A + 2] = pos_lower_a.to_bytes(2, "big")
+    header[START_POS_UNICODE:START_POS_UNICODE + 2] = unicode_offset.to_bytes(2, "big")
+    return bytes(header) + bytes(glyphs) + font[pos:]
+
+
+def scan_charset(project_root):
+    """Latin-1 characters the UI can draw: string literals in the firmware and the fixture data."""
+    charset = set(BASE_CHARSET)
+    literal = re.compile(r"\"((?:[^\"\\\n]|\\.)*)\"")
+    sources = []
+    for folder in ("src", "include"):
+        for ext in ("*.cpp", "*.h"):
+            sources += glob.glob(os.path.join(project_root, folder, "**", ext), recursive=True)
+    for path in sources:
+        if path.endswith(("config_page_html.h", "fonts_subset.cpp")):
+            continue  # Web page and generated fonts, never drawn on the panel
+        with open(path, "r", encoding="utf-8", errors="ignore") as f:
+            for text in literal.findall(f.read()):
+                charset.update(ord(c) for c in text if 0xA0 <= ord(c) < 0x100)
+
+    fixtures = []
+    for folder in ("rmv", "dwd_weather"):
+        fixtures += glob.glob(os.path.join(project_root, "test", folder, "*.json*"))
+    for path in fixtures:
+        if path.endswith(".gz"):
+            continue
+        with open(path, "r", encoding="utf-8", errors="ignore") as f:
+            charset.update(ord(c) for c in f.read() if 0xA0 <= ord(c) < 0x100)
+    return charset
+
+
+def format_array(name, data):
+    lines = [f"const uint8_t {name}[{len(data)}] PROGMEM = {{"]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def generate_subset(project_root, fonts_source=None):
+    """Writes the subset fonts; returns False when the full fonts have to be used."""
+    fonts_source = fonts_source or find_u8g2_fonts(project_root)
+    output = os.path.join(project_root, "src", "display", "fonts_subset.cpp")
+    if not fonts_source or not os.path.exists(fonts_source):
+        print("subset_fonts: U8g2_for_Adafruit_GFX not installed yet, using the full fonts")
+        return False
+
+    with open(fonts_source, "r", encoding="latin-1") as f:
+        source = f.read()
+
+    charset = scan_charset(project_root)
+    glyph_bits = bytearray(32)
+    for codepoint in charset:
+        glyph_bits[codepoint >> 3] |= 1 << (codepoint & 7)
+
+    arrays = []
+    for name in FONTS:
+        font = read_font(source, name)
+        if font is None:
+            print(f"subset_fonts: u8g2_font_{name}_tf not found in {fonts_source}, using the full fonts")
+            return False
+        subset = subset_font(font, charset)
+        arrays.append(format_array(f"Fonts::SUBSET_{name.upper()}", subset))
+        print(f"subset_fonts: {name} {len(font)} -> {len(subset)} bytes")
+
+    extra = "".join(chr(c) for c in sorted(charset) if c >= 0x80)
+    content = (
+        "// AUTO-GENERATED by tools/subset_fonts.py — DO NOT EDIT\n"
+        f"// Source: {os.path.basename(fonts_source)}, ASCII plus: {extra}\n"
+        '#include "display/fonts.h"\n'
+        "\n"
+        "#if FONT_SUBSET\n"
+        "#include <Arduino.h>\n"
+        "\n"
+        + "\n\n".join(arrays)
+        + "\n\n"
+        + format_array("Fonts::SUBSET_GLYPHS", glyph_bits)
+        + "\n#endif\n"
+    )
+
+    # Only write if content changed (avoid unnecessary rebuilds)
+    if os.path.exists(output):
+        with open(output, "r", encoding="utf-8") as f:
+            if f.read() == content:
+                print(f"subset_fonts: {output} is up to date")
+                return True
+
+    with open(output, "w", encoding="utf-8") as f:
+        f.write(content)
+    print(f"subset_fonts: Generated {output} ({len(charset)} glyphs per font)")
+    return True
+
+
+# PlatformIO pre-build script entry point
+try:
+    Import("env")
+    # Running inside PlatformIO SCons
+    if env.GetProjectOption("custom_font_subset", "no") == "yes":
+        try:
+            if generate_subset(env.subst("$PROJECT_DIR")):
+                env.Append(CPPDEFINES=[("FONT_SUBSET", 1)])
+        except Exception as error:  # Never fail the build over the fonts
+            print(f"subset_fonts: WARNING {error}, using the full fonts")
+except NameError:
+    # Running as standalone CLI script
+    if __name__ == "__main__":
+        generate_subset(get_project_root(), sys.argv[1] if len(sys.argv) > 1 else None)